@@ -45,6 +45,7 @@ apt-get install -y \
     valgrind \
     wget \
     zip \
+    zlib1g-dev \
     swig \
     expect \
     g++-7 \
@@ -403,6 +403,7 @@ void ClockNetwork::reserve_spines(const size_t& num_spines) {
   spine_parents_.reserve(num_spines);
   spine_children_.reserve(num_spines);
   spine_parent_trees_.reserve(num_spines);
+  spine_name2id_map_.reserve(num_spines);
 }
 
 void ClockNetwork::reserve_trees(const size_t& num_trees) {
@@ -411,6 +412,7 @@ void ClockNetwork::reserve_trees(const size_t& num_trees) {
   tree_widths_.reserve(num_trees);
   tree_top_spines_.reserve(num_trees);
   tree_taps_.reserve(num_trees);
+  tree_name2id_map_.reserve(num_trees);
 }
 
 void ClockNetwork::set_default_segment(const RRSegmentId& seg_id) {
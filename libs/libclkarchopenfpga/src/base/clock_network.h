@@ -5,8 +5,8 @@
  * This file include the declaration of pin constraints
  *******************************************************************/
 #include <array>
-#include <map>
 #include <string>
+#include <unordered_map>
 
 /* Headers from vtrutil library */
 #include "vtr_geometry.h"
@@ -254,8 +254,8 @@ class ClockNetwork {
   RRSwitchId default_switch_id_;
 
   /* Fast lookup */
-  std::map<std::string, ClockTreeId> tree_name2id_map_;
-  std::map<std::string, ClockSpineId> spine_name2id_map_;
+  std::unordered_map<std::string, ClockTreeId> tree_name2id_map_;
+  std::unordered_map<std::string, ClockSpineId> spine_name2id_map_;
 
   /* Flags */
   mutable bool is_dirty_;
@@ -1,11 +1,17 @@
 #include "rr_clock_spatial_lookup.h"
 
+#include <algorithm>
+
 #include "vtr_assert.h"
 #include "vtr_log.h"
 
 namespace openfpga {  // begin namespace openfpga
 
-RRClockSpatialLookup::RRClockSpatialLookup() {}
+/* Number of directions stored in the look-up: INC and DEC */
+constexpr size_t RR_CLOCK_SPATIAL_LOOKUP_NUM_DIRECTIONS = 2;
+
+RRClockSpatialLookup::RRClockSpatialLookup()
+  : width_(0), height_(0), num_trees_(0), num_levels_(0), num_pins_(0) {}
 
 RRNodeId RRClockSpatialLookup::find_node(int x, int y, const ClockTreeId& tree,
                                          const ClockLevelId& lvl,
@@ -19,43 +25,32 @@ RRNodeId RRClockSpatialLookup::find_node(int x, int y, const ClockTreeId& tree,
     return RRNodeId::INVALID();
   }
 
-  /* Sanity check to ensure the x, y, side and ptc are in range
+  /* Sanity check to ensure the x, y, tree, level and pin are in range
    * - Return an valid id by searching in look-up when all the parameters are in
    * range
    * - Return an invalid id if any out-of-range is detected
+   * Note that no message is printed here, as out-of-range queries are
+   * expected when looking for the neighbours of a node at the border
    */
-  if (size_t(dir) >= rr_node_indices_.size()) {
-    VTR_LOG("Direction out of range");
-    return RRNodeId::INVALID();
-  }
-
-  if (size_t(x) >= rr_node_indices_[dir].dim_size(0)) {
-    VTR_LOG("X out of range");
+  if ((size_t(x) >= width_) || (size_t(y) >= height_) ||
+      (size_t(tree) >= num_trees_) || (size_t(lvl) >= num_levels_) ||
+      (size_t(pin) >= num_pins_)) {
     return RRNodeId::INVALID();
   }
 
-  if (size_t(y) >= rr_node_indices_[dir].dim_size(1)) {
-    VTR_LOG("Y out of range");
-    return RRNodeId::INVALID();
-  }
-
-  if (size_t(tree) >= rr_node_indices_[dir][x][y].size()) {
-    VTR_LOG("Tree id out of range");
-    return RRNodeId::INVALID();
-  }
-
-  if (size_t(lvl) == rr_node_indices_[dir][x][y][size_t(tree)].size()) {
-    VTR_LOG("Level id out of range");
-    return RRNodeId::INVALID();
-  }
-
-  if (size_t(pin) ==
-      rr_node_indices_[dir][x][y][size_t(tree)][size_t(lvl)].size()) {
-    VTR_LOG("Pin id out of range");
-    return RRNodeId::INVALID();
-  }
+  return rr_node_indices_[node_index(dir, x, y, size_t(tree), size_t(lvl),
+                                     size_t(pin))];
+}
 
-  return rr_node_indices_[dir][x][y][size_t(tree)][size_t(lvl)][size_t(pin)];
+size_t RRClockSpatialLookup::node_index(const size_t& dir, const size_t& x,
+                                        const size_t& y, const size_t& tree,
+                                        const size_t& lvl,
+                                        const size_t& pin) const {
+  size_t index = dir * width_ + x;
+  index = index * height_ + y;
+  index = index * num_trees_ + tree;
+  index = index * num_levels_ + lvl;
+  return index * num_pins_ + pin;
 }
 
 void RRClockSpatialLookup::add_node(RRNodeId node, int x, int y,
@@ -65,69 +60,84 @@ void RRClockSpatialLookup::add_node(RRNodeId node, int x, int y,
                                     const Direction& direction) {
   size_t dir = size_t(direction);
   VTR_ASSERT(node); /* Must have a valid node id to be added */
-  VTR_ASSERT_SAFE(2 == rr_node_indices_[dir].ndims());
+  VTR_ASSERT(dir < RR_CLOCK_SPATIAL_LOOKUP_NUM_DIRECTIONS);
 
-  resize_nodes(x, y, direction);
-
-  if (size_t(tree) >= rr_node_indices_[dir][x][y].size()) {
-    rr_node_indices_[dir][x][y].resize(size_t(tree) + 1);
-  }
-
-  if (size_t(lvl) >= rr_node_indices_[dir][x][y][size_t(tree)].size()) {
-    rr_node_indices_[dir][x][y][size_t(tree)].resize(size_t(lvl) + 1);
-  }
-
-  if (size_t(pin) >=
-      rr_node_indices_[dir][x][y][size_t(tree)][size_t(lvl)].size()) {
-    rr_node_indices_[dir][x][y][size_t(tree)][size_t(lvl)].resize(size_t(pin) +
-                                                                  1);
-  }
+  resize_nodes(x, y, size_t(tree), size_t(lvl), size_t(pin));
 
   /* Resize on demand finished; Register the node */
-  rr_node_indices_[dir][x][y][size_t(tree)][size_t(lvl)][size_t(pin)] = node;
+  rr_node_indices_[node_index(dir, x, y, size_t(tree), size_t(lvl),
+                              size_t(pin))] = node;
 }
 
 void RRClockSpatialLookup::reserve_nodes(int x, int y, int tree, int lvl,
                                          int pin) {
-  for (Direction dir : {Direction::INC, Direction::DEC}) {
-    resize_nodes(x, y, dir);
-    for (int ix = 0; ix < x; ++ix) {
-      for (int iy = 0; iy < y; ++iy) {
-        rr_node_indices_[size_t(dir)][ix][iy].resize(tree);
-        for (int itree = 0; itree < tree; ++itree) {
-          rr_node_indices_[size_t(dir)][ix][iy][itree].resize(lvl);
-          for (int ilvl = 0; ilvl < lvl; ++ilvl) {
-            rr_node_indices_[size_t(dir)][ix][iy][itree][ilvl].resize(pin);
-          }
-        }
-      }
-    }
+  /* The look-up is sized by the largest index of each dimension */
+  if ((0 < x) && (0 < y) && (0 < tree) && (0 < lvl) && (0 < pin)) {
+    resize_nodes(x - 1, y - 1, tree - 1, lvl - 1, pin - 1);
   }
 }
 
-void RRClockSpatialLookup::resize_nodes(int x, int y,
-                                        const Direction& direction) {
+void RRClockSpatialLookup::resize_nodes(int x, int y, int tree, int lvl,
+                                        int pin) {
   /* Expand the fast look-up if the new node is out-of-range
    * This may seldom happen because the rr_graph building function
    * should ensure the fast look-up well organized
    */
-  size_t dir = size_t(direction);
-  VTR_ASSERT(dir < rr_node_indices_.size());
   VTR_ASSERT(x >= 0);
   VTR_ASSERT(y >= 0);
+  VTR_ASSERT(tree >= 0);
+  VTR_ASSERT(lvl >= 0);
+  VTR_ASSERT(pin >= 0);
+
+  if ((size_t(x) < width_) && (size_t(y) < height_) &&
+      (size_t(tree) < num_trees_) && (size_t(lvl) < num_levels_) &&
+      (size_t(pin) < num_pins_)) {
+    return;
+  }
 
-  if ((x >= int(rr_node_indices_[dir].dim_size(0))) ||
-      (y >= int(rr_node_indices_[dir].dim_size(1)))) {
-    rr_node_indices_[dir].resize(
-      {std::max(rr_node_indices_[dir].dim_size(0), size_t(x) + 1),
-       std::max(rr_node_indices_[dir].dim_size(1), size_t(y) + 1)});
+  /* Re-layout the existing nodes in the new storage */
+  RRClockSpatialLookup orig_lookup;
+  orig_lookup.width_ = width_;
+  orig_lookup.height_ = height_;
+  orig_lookup.num_trees_ = num_trees_;
+  orig_lookup.num_levels_ = num_levels_;
+  orig_lookup.num_pins_ = num_pins_;
+  orig_lookup.rr_node_indices_.swap(rr_node_indices_);
+
+  width_ = std::max(width_, size_t(x) + 1);
+  height_ = std::max(height_, size_t(y) + 1);
+  num_trees_ = std::max(num_trees_, size_t(tree) + 1);
+  num_levels_ = std::max(num_levels_, size_t(lvl) + 1);
+  num_pins_ = std::max(num_pins_, size_t(pin) + 1);
+  rr_node_indices_.assign(RR_CLOCK_SPATIAL_LOOKUP_NUM_DIRECTIONS * width_ *
+                            height_ * num_trees_ * num_levels_ * num_pins_,
+                          RRNodeId::INVALID());
+
+  for (size_t idir = 0; idir < RR_CLOCK_SPATIAL_LOOKUP_NUM_DIRECTIONS;
+       ++idir) {
+    for (size_t ix = 0; ix < orig_lookup.width_; ++ix) {
+      for (size_t iy = 0; iy < orig_lookup.height_; ++iy) {
+        for (size_t itree = 0; itree < orig_lookup.num_trees_; ++itree) {
+          for (size_t ilvl = 0; ilvl < orig_lookup.num_levels_; ++ilvl) {
+            for (size_t ipin = 0; ipin < orig_lookup.num_pins_; ++ipin) {
+              rr_node_indices_[node_index(idir, ix, iy, itree, ilvl, ipin)] =
+                orig_lookup.rr_node_indices_[orig_lookup.node_index(
+                  idir, ix, iy, itree, ilvl, ipin)];
+            }
+          }
+        }
+      }
+    }
   }
 }
 
 void RRClockSpatialLookup::clear() {
-  for (auto& data : rr_node_indices_) {
-    data.clear();
-  }
+  width_ = 0;
+  height_ = 0;
+  num_trees_ = 0;
+  num_levels_ = 0;
+  num_pins_ = 0;
+  rr_node_indices_.clear();
 }
 
 }  // end namespace openfpga
@@ -16,6 +16,8 @@
  *   - Update the look-up with new nodes
  *   - Find the id of a node with given information, e.g., x, y, type etc.
  */
+#include <vector>
+
 #include "clock_network_fwd.h"
 #include "physical_types.h"
 #include "rr_graph_fwd.h"
@@ -94,18 +96,28 @@ class RRClockSpatialLookup {
   /** @brief Clear all the data inside */
   void clear();
 
+ private: /* Private accessors */
+  /** @brief Index of a node in the flat storage */
+  size_t node_index(const size_t& dir, const size_t& x, const size_t& y,
+                    const size_t& tree, const size_t& lvl,
+                    const size_t& pin) const;
+
  private: /* Private mutators */
   /** @brief Resize the nodes upon needs */
-  void resize_nodes(int x, int y, const Direction& direction);
+  void resize_nodes(int x, int y, int tree, int lvl, int pin);
 
   /* -- Internal data storage -- */
  private:
-  /* Fast look-up:
+  /* Size of each dimension of the fast look-up */
+  size_t width_;
+  size_t height_;
+  size_t num_trees_;
+  size_t num_levels_;
+  size_t num_pins_;
+  /* Fast look-up, where the nodes are stored in a flat array indexed by
    * [INC|DEC][0..grid_width][0..grid_height][tree_id][level_id][clock_pin_id]
    */
-  std::array<vtr::NdMatrix<std::vector<std::vector<std::vector<RRNodeId>>>, 2>,
-             2>
-    rr_node_indices_;
+  std::vector<RRNodeId> rr_node_indices_;
 };
 
 }  // end namespace openfpga
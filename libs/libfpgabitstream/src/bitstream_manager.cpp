@@ -59,6 +59,22 @@ ConfigBlockId BitstreamManager::bit_parent_block(
   return bit_parent_blocks_[bit_id];
 }
 
+size_t BitstreamManager::bit_index_in_parent_block(
+  const ConfigBitId& bit_id) const {
+  /* Ensure a valid id */
+  VTR_ASSERT(true == valid_bit_id(bit_id));
+
+  const ConfigBlockId& parent_block = bit_parent_blocks_[bit_id];
+  size_t lsb = block_bit_id_lsbs_[parent_block];
+  size_t length = block_bit_lengths_[parent_block];
+  /* Bits which are not registered through add_block_bits() are not indexed by
+   * the parent block, which is the same as a miss in the list of block bits */
+  if ((size_t(bit_id) < lsb) || (size_t(bit_id) >= lsb + length)) {
+    return length;
+  }
+  return size_t(bit_id) - lsb;
+}
+
 std::string BitstreamManager::block_name(const ConfigBlockId& block_id) const {
   /* Ensure the input ids are valid */
   VTR_ASSERT(true == valid_block_id(block_id));
@@ -139,6 +139,10 @@ class BitstreamManager {
   /* Find the parent block of a configuration bit */
   ConfigBlockId bit_parent_block(const ConfigBitId& bit_id) const;
 
+  /* Find the index of a configuration bit among the bits of its parent block.
+   * This is a constant-time lookup based on the bit id of the block lsb */
+  size_t bit_index_in_parent_block(const ConfigBitId& bit_id) const;
+
   /* Find a name of a block */
   std::string block_name(const ConfigBlockId& block_id) const;
 
@@ -61,16 +61,7 @@ std::vector<ConfigBlockId> find_bitstream_manager_top_blocks(
  *******************************************************************/
 size_t find_bitstream_manager_config_bit_index_in_parent_block(
   const BitstreamManager& bitstream_manager, const ConfigBitId& bit_id) {
-  size_t curr_index = 0;
-  for (const ConfigBitId& cand_bit : bitstream_manager.block_bits(
-         bitstream_manager.bit_parent_block(bit_id))) {
-    if (cand_bit == bit_id) {
-      break;
-    }
-    curr_index++;
-  }
-
-  return curr_index;
+  return bitstream_manager.bit_index_in_parent_block(bit_id);
 }
 
 /********************************************************************
@@ -0,0 +1,660 @@
+/********************************************************************
+ * This file includes a streaming parser which reads an XML of an
+ * architecture bitstream to a bitstream manager.
+ * Unlike read_xml_architecture_bitstream(), no DOM is built: the file is
+ * consumed chunk by chunk and bitstream blocks/bits are created as soon
+ * as their XML nodes are parsed. The memory footprint of the parser is
+ * bounded by the depth of the block hierarchy, instead of the file size.
+ *
+ * Note that only the subset of XML produced by
+ * write_xml_architecture_bitstream() is supported, i.e., elements,
+ * attributes, comments and the XML declaration. Use the DOM-based parser
+ * when a thorough validation of the file is required.
+ *******************************************************************/
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef OPENFPGA_WITH_ZLIB
+#include <zlib.h>
+#endif
+
+/* Headers from vtr util library */
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+
+/* Headers from libarchfpga */
+#include "arch_error.h"
+#include "openfpga_reserved_words.h"
+#include "stream_read_xml_arch_bitstream.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/* Number of bytes to be read from the file at a time */
+constexpr size_t ARCH_BITSTREAM_STREAM_CHUNK_SIZE = 1 << 20;
+
+/* Average number of bytes taken by a block and by a bit in the files written
+ * by write_xml_architecture_bitstream(), including the <hierarchy> nodes.
+ * Used to reserve the database when a file does not provide size hints */
+constexpr size_t ARCH_BITSTREAM_BYTES_PER_BLOCK = 512;
+constexpr size_t ARCH_BITSTREAM_BYTES_PER_BIT = 128;
+
+/********************************************************************
+ * Estimate the number of bytes of the XML contents of a file.
+ * For a gzip-compressed file, the uncompressed size (modulo 2^32) is
+ * stored in the last 4 bytes, in little endian.
+ * Return 0 if the file can not be inspected
+ *******************************************************************/
+static size_t estimate_xml_stream_num_bytes(const char* fname) {
+  std::FILE* fp = std::fopen(fname, "rb");
+  if (nullptr == fp) {
+    return 0;
+  }
+  size_t num_bytes = 0;
+  long file_size = (0 == std::fseek(fp, 0, SEEK_END)) ? std::ftell(fp) : -1;
+  if (0 < file_size) {
+    num_bytes = static_cast<size_t>(file_size);
+    std::rewind(fp);
+    unsigned char magic[2];
+    unsigned char trailer[4];
+    if ((4 < num_bytes) && (2 == std::fread(magic, 1, 2, fp)) &&
+        (0x1f == magic[0]) && (0x8b == magic[1]) &&
+        (0 == std::fseek(fp, -4, SEEK_END)) &&
+        (4 == std::fread(trailer, 1, 4, fp))) {
+      size_t isize = size_t(trailer[0]) | (size_t(trailer[1]) << 8) |
+                     (size_t(trailer[2]) << 16) | (size_t(trailer[3]) << 24);
+      /* The uncompressed size is truncated for files larger than 4GB */
+      if (isize > num_bytes) {
+        num_bytes = isize;
+      }
+    }
+  }
+  std::fclose(fp);
+  return num_bytes;
+}
+
+/********************************************************************
+ * A character source which reads a file in chunks.
+ * When zlib is available, gzip-compressed files are decompressed on the
+ * fly, while plain text files are read transparently.
+ *******************************************************************/
+class ArchBitstreamXmlSource {
+ public: /* Constructor and destructor */
+  explicit ArchBitstreamXmlSource(const char* fname)
+    : fname_(fname),
+      buffer_(ARCH_BITSTREAM_STREAM_CHUNK_SIZE),
+      pos_(0),
+      end_(0),
+      line_(1) {
+#ifdef OPENFPGA_WITH_ZLIB
+    file_ = gzopen(fname, "rb");
+#else
+    file_ = std::fopen(fname, "rb");
+#endif
+    if (nullptr == file_) {
+      archfpga_throw(fname, 0, "Unable to open file '%s'!\n", fname);
+    }
+#ifndef OPENFPGA_WITH_ZLIB
+    /* Detect the magic number of gzip files, so that users get a clear hint
+     * rather than a syntax error */
+    if (refill() && (2 <= end_) && ('\x1f' == buffer_[0]) &&
+        ('\x8b' == buffer_[1])) {
+      std::fclose(file_);
+      archfpga_throw(fname, 0,
+                     "Reading gzip-compressed file requires OpenFPGA to be "
+                     "built with zlib!\n");
+    }
+#endif
+  }
+
+  ~ArchBitstreamXmlSource() {
+#ifdef OPENFPGA_WITH_ZLIB
+    gzclose(file_);
+#else
+    std::fclose(file_);
+#endif
+  }
+
+ public: /* Public accessors */
+  const char* fname() const { return fname_; }
+  size_t line() const { return line_; }
+
+ public: /* Public mutators */
+  /* Return the next character without consuming it, or EOF */
+  int peek() {
+    if ((pos_ == end_) && (false == refill())) {
+      return EOF;
+    }
+    return static_cast<unsigned char>(buffer_[pos_]);
+  }
+
+  /* Consume the next character, or EOF */
+  int get() {
+    int c = peek();
+    if (EOF != c) {
+      ++pos_;
+      if ('\n' == c) {
+        ++line_;
+      }
+    }
+    return c;
+  }
+
+ private: /* Internal functions */
+  bool refill() {
+#ifdef OPENFPGA_WITH_ZLIB
+    int num_bytes =
+      gzread(file_, buffer_.data(), static_cast<unsigned>(buffer_.size()));
+    if (0 > num_bytes) {
+      archfpga_throw(fname_, line_, "Failed in decompressing file!\n");
+    }
+    end_ = static_cast<size_t>(num_bytes);
+#else
+    end_ = std::fread(buffer_.data(), 1, buffer_.size(), file_);
+#endif
+    pos_ = 0;
+    return 0 < end_;
+  }
+
+ private: /* Internal data */
+  const char* fname_;
+#ifdef OPENFPGA_WITH_ZLIB
+  gzFile file_;
+#else
+  std::FILE* file_;
+#endif
+  std::vector<char> buffer_;
+  size_t pos_;
+  size_t end_;
+  size_t line_;
+};
+
+/********************************************************************
+ * Tokens returned by the XML pull parser
+ *******************************************************************/
+enum e_xml_stream_token {
+  XML_STREAM_START_TAG,
+  XML_STREAM_END_TAG,
+  XML_STREAM_END_OF_FILE
+};
+
+/* A start or end tag. Attribute storage is reused between tags */
+struct XmlStreamTag {
+  std::string name;
+  std::vector<std::pair<std::string, std::string>> attributes;
+  size_t num_attributes;
+  bool self_closing;
+};
+
+/********************************************************************
+ * A minimal pull parser for XML, returning tags one by one
+ *******************************************************************/
+class XmlStreamTokenizer {
+ public: /* Constructor */
+  explicit XmlStreamTokenizer(ArchBitstreamXmlSource& source)
+    : source_(source) {}
+
+ public: /* Public mutators */
+  e_xml_stream_token next(XmlStreamTag& tag) {
+    while (true) {
+      /* Text contents are not used in the bitstream file, skip them */
+      int c = source_.get();
+      while ((EOF != c) && ('<' != c)) {
+        c = source_.get();
+      }
+      if (EOF == c) {
+        return XML_STREAM_END_OF_FILE;
+      }
+      c = source_.peek();
+      if ('?' == c) {
+        skip_until("?>");
+        continue;
+      }
+      if ('!' == c) {
+        source_.get();
+        if ('-' == source_.peek()) {
+          source_.get();
+          expect('-');
+          skip_until("-->");
+        } else {
+          skip_until(">");
+        }
+        continue;
+      }
+      if ('/' == c) {
+        source_.get();
+        read_name(tag.name);
+        skip_spaces();
+        expect('>');
+        return XML_STREAM_END_TAG;
+      }
+
+      read_name(tag.name);
+      read_attributes(tag);
+      return XML_STREAM_START_TAG;
+    }
+  }
+
+  [[noreturn]] void error(const std::string& message) {
+    archfpga_throw(source_.fname(), source_.line(), "%s", message.c_str());
+  }
+
+ private: /* Internal functions */
+  static bool is_space(const int& c) {
+    return (' ' == c) || ('\t' == c) || ('\n' == c) || ('\r' == c);
+  }
+
+  static bool is_name_char(const int& c) {
+    return (EOF != c) && (false == is_space(c)) && ('=' != c) && ('>' != c) &&
+           ('/' != c) && ('"' != c) && ('\'' != c);
+  }
+
+  void skip_spaces() {
+    while (is_space(source_.peek())) {
+      source_.get();
+    }
+  }
+
+  void expect(const char& expected) {
+    if (expected != source_.get()) {
+      error(std::string("Expect '") + expected + "' in XML syntax!\n");
+    }
+  }
+
+  /* Consume characters until the terminator (inclusive) */
+  void skip_until(const std::string& terminator) {
+    std::string window;
+    while (window != terminator) {
+      int c = source_.get();
+      if (EOF == c) {
+        error("Unexpected end of file when looking for '" + terminator +
+              "'!\n");
+      }
+      window.push_back(static_cast<char>(c));
+      if (window.size() > terminator.size()) {
+        window.erase(window.begin());
+      }
+    }
+  }
+
+  void read_name(std::string& name) {
+    name.clear();
+    while (is_name_char(source_.peek())) {
+      name.push_back(static_cast<char>(source_.get()));
+    }
+    if (name.empty()) {
+      error("Expect a name in XML syntax!\n");
+    }
+  }
+
+  /* Decode a character reference, e.g., &amp; */
+  void read_reference(std::string& value) {
+    std::string ref;
+    int c = source_.get();
+    while ((';' != c) && (EOF != c) && (8 > ref.size())) {
+      ref.push_back(static_cast<char>(c));
+      c = source_.get();
+    }
+    if ("amp" == ref) {
+      value.push_back('&');
+    } else if ("lt" == ref) {
+      value.push_back('<');
+    } else if ("gt" == ref) {
+      value.push_back('>');
+    } else if ("quot" == ref) {
+      value.push_back('"');
+    } else if ("apos" == ref) {
+      value.push_back('\'');
+    } else if ((1 < ref.size()) && ('#' == ref[0])) {
+      bool hex = ('x' == ref[1]);
+      long code =
+        std::strtol(ref.c_str() + (hex ? 2 : 1), nullptr, hex ? 16 : 10);
+      value.push_back(static_cast<char>(code));
+    } else {
+      error("Unsupported character reference '&" + ref + ";'!\n");
+    }
+  }
+
+  void read_attributes(XmlStreamTag& tag) {
+    tag.num_attributes = 0;
+    tag.self_closing = false;
+    while (true) {
+      skip_spaces();
+      int c = source_.peek();
+      if ('/' == c) {
+        source_.get();
+        expect('>');
+        tag.self_closing = true;
+        return;
+      }
+      if ('>' == c) {
+        source_.get();
+        return;
+      }
+      if (tag.num_attributes == tag.attributes.size()) {
+        tag.attributes.emplace_back();
+      }
+      std::pair<std::string, std::string>& attr =
+        tag.attributes[tag.num_attributes];
+      ++tag.num_attributes;
+
+      read_name(attr.first);
+      skip_spaces();
+      expect('=');
+      skip_spaces();
+      int quote = source_.get();
+      if (('"' != quote) && ('\'' != quote)) {
+        error("Expect a quoted value for attribute '" + attr.first +
+              "'!\n");
+      }
+      attr.second.clear();
+      for (c = source_.get(); quote != c; c = source_.get()) {
+        if (EOF == c) {
+          error("Unexpected end of file in attribute '" + attr.first +
+                "'!\n");
+        }
+        if ('&' == c) {
+          read_reference(attr.second);
+        } else {
+          attr.second.push_back(static_cast<char>(c));
+        }
+      }
+    }
+  }
+
+ private: /* Internal data */
+  ArchBitstreamXmlSource& source_;
+};
+
+/********************************************************************
+ * Find the value of an attribute in a tag.
+ * Return nullptr if not found
+ *******************************************************************/
+static const std::string* find_xml_stream_attribute(const XmlStreamTag& tag,
+                                                    const char* attr_name) {
+  for (size_t iattr = 0; iattr < tag.num_attributes; ++iattr) {
+    if (tag.attributes[iattr].first == attr_name) {
+      return &(tag.attributes[iattr].second);
+    }
+  }
+  return nullptr;
+}
+
+/********************************************************************
+ * The XML nodes which are currently open during parsing
+ *******************************************************************/
+enum e_arch_bitstream_stream_frame {
+  ARCH_BITSTREAM_FRAME_BLOCK,
+  ARCH_BITSTREAM_FRAME_INPUT_NETS,
+  ARCH_BITSTREAM_FRAME_OUTPUT_NETS,
+  ARCH_BITSTREAM_FRAME_BITSTREAM,
+  ARCH_BITSTREAM_FRAME_IGNORED
+};
+
+struct ArchBitstreamStreamFrame {
+  e_arch_bitstream_stream_frame type;
+  std::string name;
+  /* The bitstream block that the node belongs to */
+  ConfigBlockId block;
+};
+
+/********************************************************************
+ * Build a bitstream manager from the tags returned by the tokenizer.
+ * Only the currently open nodes, the nets and the bits of the current
+ * block are kept in memory.
+ *******************************************************************/
+class ArchBitstreamStreamBuilder {
+ public: /* Constructor */
+  ArchBitstreamStreamBuilder(XmlStreamTokenizer& tokenizer,
+                             BitstreamManager& bitstream_manager,
+                             const size_t& num_file_bytes)
+    : tokenizer_(tokenizer),
+      bitstream_manager_(bitstream_manager),
+      num_file_bytes_(num_file_bytes) {}
+
+ public: /* Public mutators */
+  void run() {
+    XmlStreamTag tag;
+    while (true) {
+      e_xml_stream_token token = tokenizer_.next(tag);
+      if (XML_STREAM_END_OF_FILE == token) {
+        break;
+      }
+      if (XML_STREAM_START_TAG == token) {
+        start_node(tag);
+        if (true == tag.self_closing) {
+          end_node(tag.name);
+        }
+      } else {
+        end_node(tag.name);
+      }
+    }
+
+    if (false == frames_.empty()) {
+      tokenizer_.error("Unexpected end of file: node <" + frames_.back().name +
+                       "> is not closed!\n");
+    }
+    if (false == bitstream_manager_.valid_block_id(top_block_)) {
+      tokenizer_.error("Expect a root node <bitstream_block>!\n");
+    }
+  }
+
+ private: /* Internal functions */
+  const std::string& required_attribute(const XmlStreamTag& tag,
+                                        const char* attr_name) {
+    const std::string* value = find_xml_stream_attribute(tag, attr_name);
+    if (nullptr == value) {
+      tokenizer_.error(std::string("Required attribute '") + attr_name +
+                       "' is missing in node <" + tag.name + ">!\n");
+    }
+    return *value;
+  }
+
+  void push_frame(const e_arch_bitstream_stream_frame& type,
+                  const std::string& name, const ConfigBlockId& block) {
+    frames_.emplace_back();
+    frames_.back().type = type;
+    frames_.back().name = name;
+    frames_.back().block = block;
+  }
+
+  /* Reserve the database, based on the size hints which may be provided by
+   * the top-level block, or estimated from the size of the file */
+  void reserve_bitstream(const XmlStreamTag& tag) {
+    size_t num_blocks = num_file_bytes_ / ARCH_BITSTREAM_BYTES_PER_BLOCK;
+    const std::string* num_blocks_hint =
+      find_xml_stream_attribute(tag, "num_blocks");
+    if (nullptr != num_blocks_hint) {
+      num_blocks = std::strtoul(num_blocks_hint->c_str(), nullptr, 10);
+    }
+    size_t num_bits = num_file_bytes_ / ARCH_BITSTREAM_BYTES_PER_BIT;
+    const std::string* num_bits_hint =
+      find_xml_stream_attribute(tag, "num_bits");
+    if (nullptr != num_bits_hint) {
+      num_bits = std::strtoul(num_bits_hint->c_str(), nullptr, 10);
+    }
+    bitstream_manager_.reserve_blocks(num_blocks);
+    bitstream_manager_.reserve_bits(num_bits);
+  }
+
+  /* Create the top-level block */
+  void start_top_block(const XmlStreamTag& tag) {
+    if (true == bitstream_manager_.valid_block_id(top_block_)) {
+      tokenizer_.error("Only one root node <bitstream_block> is allowed!\n");
+    }
+    if (tag.name != std::string("bitstream_block")) {
+      tokenizer_.error("Expect a root node <bitstream_block> but found <" +
+                       tag.name + ">!\n");
+    }
+    const std::string& top_block_name = required_attribute(tag, "name");
+    if (top_block_name != std::string(FPGA_TOP_MODULE_NAME)) {
+      tokenizer_.error(std::string("Top-level block must be named as '") +
+                       FPGA_TOP_MODULE_NAME + "'!\n");
+    }
+
+    reserve_bitstream(tag);
+    top_block_ = bitstream_manager_.add_block(top_block_name);
+    push_frame(ARCH_BITSTREAM_FRAME_BLOCK, tag.name, top_block_);
+  }
+
+  void start_block_child_node(const XmlStreamTag& tag,
+                              const ConfigBlockId& parent_block) {
+    /* Only bitstream blocks are allowed under the top-level block */
+    if ((1 == frames_.size()) &&
+        (tag.name != std::string("bitstream_block"))) {
+      tokenizer_.error("Invalid node <" + tag.name +
+                       "> under the top-level block!\n");
+    }
+
+    if (tag.name == std::string("bitstream_block")) {
+      /* The hierarchy level should be the depth of the block */
+      const std::string* hie_level =
+        find_xml_stream_attribute(tag, "hierarchy_level");
+      if ((nullptr != hie_level) &&
+          (frames_.size() != std::strtoul(hie_level->c_str(), nullptr, 10))) {
+        tokenizer_.error("Mismatch in hierarchy_level of block '" +
+                         required_attribute(tag, "name") + "'!\n");
+      }
+      ConfigBlockId curr_block =
+        bitstream_manager_.add_block(required_attribute(tag, "name"));
+      bitstream_manager_.add_child_block(parent_block, curr_block);
+      push_frame(ARCH_BITSTREAM_FRAME_BLOCK, tag.name, curr_block);
+    } else if (tag.name == std::string("input_nets")) {
+      nets_.clear();
+      push_frame(ARCH_BITSTREAM_FRAME_INPUT_NETS, tag.name, parent_block);
+    } else if (tag.name == std::string("output_nets")) {
+      nets_.clear();
+      push_frame(ARCH_BITSTREAM_FRAME_OUTPUT_NETS, tag.name, parent_block);
+    } else if (tag.name == std::string("bitstream")) {
+      /* Parse path_id: -2 is an invalid value defined in the bitstream manager
+       * internally */
+      const std::string* path_id = find_xml_stream_attribute(tag, "path_id");
+      if ((nullptr != path_id) && (-2 < std::atoi(path_id->c_str()))) {
+        bitstream_manager_.add_path_id_to_block(parent_block,
+                                                std::atoi(path_id->c_str()));
+      }
+      bits_.clear();
+      push_frame(ARCH_BITSTREAM_FRAME_BITSTREAM, tag.name, parent_block);
+    } else {
+      /* Other nodes, e.g., <hierarchy>, are not stored in the database */
+      push_frame(ARCH_BITSTREAM_FRAME_IGNORED, tag.name, parent_block);
+    }
+  }
+
+  void start_node(const XmlStreamTag& tag) {
+    if (true == frames_.empty()) {
+      start_top_block(tag);
+      return;
+    }
+
+    const ArchBitstreamStreamFrame& frame = frames_.back();
+    ConfigBlockId block = frame.block;
+    switch (frame.type) {
+      case ARCH_BITSTREAM_FRAME_BLOCK:
+        start_block_child_node(tag, block);
+        return;
+      case ARCH_BITSTREAM_FRAME_INPUT_NETS:
+      case ARCH_BITSTREAM_FRAME_OUTPUT_NETS: {
+        if (tag.name != std::string("path")) {
+          tokenizer_.error("Expect node <path> but found <" + tag.name +
+                           ">!\n");
+        }
+        int id = std::atoi(required_attribute(tag, "id").c_str());
+        if (0 > id) {
+          tokenizer_.error("Invalid path id in node <path>!\n");
+        }
+        if (size_t(id) >= nets_.size()) {
+          nets_.resize(id + 1);
+        }
+        nets_[id] = required_attribute(tag, "net_name");
+        break;
+      }
+      case ARCH_BITSTREAM_FRAME_BITSTREAM:
+        if (tag.name != std::string("bit")) {
+          tokenizer_.error("Expect node <bit> but found <" + tag.name + ">!\n");
+        }
+        bits_.push_back(1 ==
+                        std::atoi(required_attribute(tag, "value").c_str()));
+        break;
+      case ARCH_BITSTREAM_FRAME_IGNORED:
+        break;
+      default:
+        VTR_ASSERT_MSG(false, "Invalid type of stream frame");
+    }
+    push_frame(ARCH_BITSTREAM_FRAME_IGNORED, tag.name, block);
+  }
+
+  std::string join_nets() const {
+    std::string nets_str;
+    bool need_splitter = false;
+    for (const std::string& net : nets_) {
+      if (true == need_splitter) {
+        nets_str += std::string(" ");
+      }
+      nets_str += net;
+      need_splitter = true;
+    }
+    return nets_str;
+  }
+
+  void end_node(const std::string& name) {
+    if ((true == frames_.empty()) || (frames_.back().name != name)) {
+      tokenizer_.error("Mismatched closing node </" + name + ">!\n");
+    }
+
+    const ArchBitstreamStreamFrame& frame = frames_.back();
+    switch (frame.type) {
+      case ARCH_BITSTREAM_FRAME_INPUT_NETS:
+        bitstream_manager_.add_input_net_id_to_block(frame.block, join_nets());
+        break;
+      case ARCH_BITSTREAM_FRAME_OUTPUT_NETS:
+        bitstream_manager_.add_output_net_id_to_block(frame.block,
+                                                      join_nets());
+        break;
+      case ARCH_BITSTREAM_FRAME_BITSTREAM:
+        bitstream_manager_.add_block_bits(frame.block, bits_);
+        break;
+      default:
+        break;
+    }
+    frames_.pop_back();
+  }
+
+ private: /* Internal data */
+  XmlStreamTokenizer& tokenizer_;
+  BitstreamManager& bitstream_manager_;
+  size_t num_file_bytes_;
+  ConfigBlockId top_block_;
+  std::vector<ArchBitstreamStreamFrame> frames_;
+  std::vector<std::string> nets_;
+  std::vector<bool> bits_;
+};
+
+/********************************************************************
+ * Parse an architecture bitstream file to an object of BitstreamManager
+ * with a streaming parser. The file can be either a plain XML file or a
+ * gzip-compressed one (requires zlib)
+ *******************************************************************/
+BitstreamManager stream_read_xml_architecture_bitstream(const char* fname) {
+  vtr::ScopedStartFinishTimer timer(
+    "Read Architecture Bitstream file (streaming)");
+
+  BitstreamManager bitstream_manager;
+
+  ArchBitstreamXmlSource source(fname);
+  XmlStreamTokenizer tokenizer(source);
+  ArchBitstreamStreamBuilder builder(tokenizer, bitstream_manager,
+                                     estimate_xml_stream_num_bytes(fname));
+  builder.run();
+
+  VTR_LOG("Read %lu blocks and %lu bits from the architecture bitstream\n",
+          bitstream_manager.num_blocks(), bitstream_manager.num_bits());
+
+  return bitstream_manager;
+}
+
+} /* end namespace openfpga */
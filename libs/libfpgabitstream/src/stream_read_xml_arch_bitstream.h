@@ -0,0 +1,19 @@
+#ifndef STREAM_READ_XML_ARCH_BITSTREAM_H
+#define STREAM_READ_XML_ARCH_BITSTREAM_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include "bitstream_manager.h"
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+/* begin namespace openfpga */
+namespace openfpga {
+
+BitstreamManager stream_read_xml_architecture_bitstream(const char* fname);
+
+} /* end namespace openfpga */
+
+#endif
@@ -2,8 +2,6 @@
  * This file includes functions that output bitstream database
  * to files in different formats
  *******************************************************************/
-#include <chrono>
-#include <ctime>
 #include <fstream>
 
 /* Headers from vtrutil library */
@@ -34,9 +32,7 @@ static void write_bitstream_xml_file_head(std::fstream& fp,
   fp << "\t- Organization: University of Utah" << std::endl;
 
   if (include_time_stamp) {
-    auto end = std::chrono::system_clock::now();
-    std::time_t end_time = std::chrono::system_clock::to_time_t(end);
-    fp << "\t- Date: " << std::ctime(&end_time);
+    fp << "\t- Date: " << get_current_time_stamp();
   }
 
   fp << "-->" << std::endl;
@@ -0,0 +1,164 @@
+/*********************************************************************
+ * Member functions for the classes CommandLogBuffer and CommandLogCapture
+ ********************************************************************/
+#include "command_log_buffer.h"
+
+#include <cstdarg>
+#include <mutex>
+
+#include "vtr_assert.h"
+#include "vtr_log.h"
+#include "vtr_util.h"
+
+/* Begin namespace openfpga */
+namespace openfpga {
+
+/* The buffer where the logs of the calling thread go, if any */
+static thread_local CommandLogBuffer* thread_log_buffer = nullptr;
+
+/* The original printers of vtrutil, which are used by the threads without
+ * any capture */
+static std::once_flag printer_install_flag;
+static vtr::PrintHandlerInfo original_printf = nullptr;
+static vtr::PrintHandlerInfo original_printf_info = nullptr;
+static vtr::PrintHandlerWarning original_printf_warning = nullptr;
+static vtr::PrintHandlerError original_printf_error = nullptr;
+static vtr::PrintHandlerDirect original_printf_direct = nullptr;
+
+/* Print a log with the original printers */
+static void print_original_log(const CommandLogBuffer::e_log_type& log_type,
+                               const char* file_name,
+                               const unsigned int& line_num,
+                               const std::string& message) {
+  switch (log_type) {
+    case CommandLogBuffer::LOG_INFO:
+      original_printf("%s", message.c_str());
+      break;
+    case CommandLogBuffer::LOG_WARNING:
+      original_printf_warning(file_name, line_num, "%s", message.c_str());
+      break;
+    case CommandLogBuffer::LOG_ERROR:
+      original_printf_error(file_name, line_num, "%s", message.c_str());
+      break;
+    case CommandLogBuffer::LOG_DIRECT:
+      original_printf_direct("%s", message.c_str());
+      break;
+    default:
+      VTR_ASSERT_MSG(false, "Invalid type of log");
+  }
+}
+
+/* Capture a log to the buffer of the calling thread, or print it
+ * immediately if the thread has no buffer */
+static void capture_log(const CommandLogBuffer::e_log_type& log_type,
+                        const char* file_name, const unsigned int& line_num,
+                        const std::string& message) {
+  if (nullptr == thread_log_buffer) {
+    print_original_log(log_type, file_name, line_num, message);
+    return;
+  }
+  thread_log_buffer->add_log(log_type, file_name, line_num, message);
+}
+
+static void capture_log_info(const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  std::string message = vtr::vstring_fmt(format, args);
+  va_end(args);
+  capture_log(CommandLogBuffer::LOG_INFO, nullptr, 0, message);
+}
+
+static void capture_log_warning(const char* file_name, unsigned int line_num,
+                                const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  std::string message = vtr::vstring_fmt(format, args);
+  va_end(args);
+  capture_log(CommandLogBuffer::LOG_WARNING, file_name, line_num, message);
+}
+
+static void capture_log_error(const char* file_name, unsigned int line_num,
+                              const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  std::string message = vtr::vstring_fmt(format, args);
+  va_end(args);
+  capture_log(CommandLogBuffer::LOG_ERROR, file_name, line_num, message);
+}
+
+static void capture_log_direct(const char* format, ...) {
+  va_list args;
+  va_start(args, format);
+  std::string message = vtr::vstring_fmt(format, args);
+  va_end(args);
+  capture_log(CommandLogBuffer::LOG_DIRECT, nullptr, 0, message);
+}
+
+/************************************************************************
+ * Member functions for class CommandLogBuffer
+ ***********************************************************************/
+void CommandLogBuffer::flush() const {
+  for (size_t ilog = 0; ilog < log_types_.size(); ++ilog) {
+    switch (log_types_[ilog]) {
+      case LOG_INFO:
+        vtr::printf("%s", log_messages_[ilog].c_str());
+        break;
+      case LOG_WARNING:
+        vtr::printf_warning(log_file_names_[ilog], log_line_nums_[ilog], "%s",
+                            log_messages_[ilog].c_str());
+        break;
+      case LOG_ERROR:
+        vtr::printf_error(log_file_names_[ilog], log_line_nums_[ilog], "%s",
+                          log_messages_[ilog].c_str());
+        break;
+      case LOG_DIRECT:
+        vtr::printf_direct("%s", log_messages_[ilog].c_str());
+        break;
+      default:
+        VTR_ASSERT_MSG(false, "Invalid type of log");
+    }
+  }
+}
+
+void CommandLogBuffer::add_log(const e_log_type& log_type,
+                               const char* file_name,
+                               const unsigned int& line_num,
+                               const std::string& message) {
+  log_types_.push_back(log_type);
+  log_file_names_.push_back(file_name);
+  log_line_nums_.push_back(line_num);
+  log_messages_.push_back(message);
+}
+
+/************************************************************************
+ * Install the capturing printers. The printers are never restored, since
+ * any other thread may be reading the pointers at any time
+ ***********************************************************************/
+void install_command_log_printers() {
+  std::call_once(printer_install_flag, []() {
+    original_printf = vtr::printf;
+    original_printf_info = vtr::printf_info;
+    original_printf_warning = vtr::printf_warning;
+    original_printf_error = vtr::printf_error;
+    original_printf_direct = vtr::printf_direct;
+    vtr::printf = capture_log_info;
+    vtr::printf_info = capture_log_info;
+    vtr::printf_warning = capture_log_warning;
+    vtr::printf_error = capture_log_error;
+    vtr::printf_direct = capture_log_direct;
+  });
+}
+
+/************************************************************************
+ * Member functions for class CommandLogCapture
+ ***********************************************************************/
+CommandLogCapture::CommandLogCapture(CommandLogBuffer& log_buffer) {
+  prev_log_buffer_ = thread_log_buffer;
+  thread_log_buffer = &log_buffer;
+}
+
+CommandLogCapture::~CommandLogCapture() {
+  thread_log_buffer = prev_log_buffer_;
+}
+
+} /* End namespace openfpga */
@@ -0,0 +1,81 @@
+#ifndef COMMAND_LOG_BUFFER_H
+#define COMMAND_LOG_BUFFER_H
+
+/********************************************************************
+ * Include header files that are required by data structure declaration
+ *******************************************************************/
+#include <string>
+#include <vector>
+
+/* Begin namespace openfpga */
+namespace openfpga {
+
+/*********************************************************************
+ * A buffer to store the logs printed by a command, so that the logs of
+ * commands running concurrently are not mixed up and can be printed
+ * command by command afterwards.
+ *
+ * An example of how to use
+ * -----------------------
+ *   CommandLogBuffer cmd_log;
+ *   {
+ *     // Logs printed by this thread are captured until the end of scope
+ *     CommandLogCapture cmd_log_capture(cmd_log);
+ *     VTR_LOG("...");
+ *   }
+ *   // Print the captured logs
+ *   cmd_log.flush();
+ *
+ * Note that only the logs printed through the printers of vtrutil, e.g.,
+ * VTR_LOG(), VTR_LOG_WARN() and VTR_LOG_ERROR(), can be captured.
+ ********************************************************************/
+class CommandLogBuffer {
+ public: /* Types */
+  enum e_log_type { LOG_INFO, LOG_WARNING, LOG_ERROR, LOG_DIRECT };
+
+ public: /* Public accessors */
+  /* Print the captured logs in the same order as they were captured.
+   * This should be called by a thread which is not capturing logs */
+  void flush() const;
+
+ public: /* Public mutators */
+  void add_log(const e_log_type& log_type, const char* file_name,
+               const unsigned int& line_num, const std::string& message);
+
+ private: /* Internal data */
+  std::vector<e_log_type> log_types_;
+  /* Source file and line of warnings and errors */
+  std::vector<const char*> log_file_names_;
+  std::vector<unsigned int> log_line_nums_;
+  std::vector<std::string> log_messages_;
+};
+
+/*********************************************************************
+ * Override the printers of vtrutil once for all, so that the logs of a
+ * thread go to its capture buffer if any, or are printed immediately
+ * otherwise. This must be called by the main thread before starting any
+ * thread which captures logs, as the printers are global pointers.
+ ********************************************************************/
+void install_command_log_printers();
+
+/*********************************************************************
+ * Capture the logs printed by the calling thread into a buffer during the
+ * lifetime of the object, while logs from the other threads are still
+ * printed immediately. The printers should have been installed by
+ * install_command_log_printers().
+ ********************************************************************/
+class CommandLogCapture {
+ public: /* Public constructor */
+  CommandLogCapture(CommandLogBuffer& log_buffer);
+  ~CommandLogCapture();
+  CommandLogCapture(const CommandLogCapture&) = delete;
+  CommandLogCapture& operator=(const CommandLogCapture&) = delete;
+
+ private: /* Internal data */
+  /* The buffer of the calling thread before the capture */
+  CommandLogBuffer* prev_log_buffer_;
+};
+
+} /* End namespace openfpga */
+
+#endif
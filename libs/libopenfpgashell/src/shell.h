@@ -185,6 +185,14 @@ class Shell {
     const std::vector<ShellCommandId>& cmd_dependency);
   ShellCommandClassId add_command_class(const char* name);
 
+  /* Run consecutive const commands in script mode concurrently, as they only
+   * read the data exchange <T>. The logs are still printed command by
+   * command, in the same order as the script.
+   * At most num_threads commands run at the same time, where 0 means all the
+   * hardware threads */
+  void set_parallel_const_commands(const bool& parallel_const_commands,
+                                   const size_t& num_threads = 0);
+
  public: /* Public validators */
   bool valid_command_id(const ShellCommandId& cmd_id) const;
   bool valid_command_class_id(const ShellCommandClassId& cmd_class_id) const;
@@ -212,6 +220,29 @@ class Shell {
   int execute_command(const char* cmd_line, T& common_context,
                       const bool& allow_hidden_command = true);
 
+ private: /* Private executors */
+  /* Split a command line into tokens, return false if the line is illegal */
+  bool tokenize_command_line(const char* cmd_line,
+                             std::vector<std::string>& tokens) const;
+  /* Check if all the commands required by a command have been executed */
+  bool check_command_dependency(const ShellCommandId& cmd_id) const;
+  /* Find the const command called by a command line, which can be run
+   * concurrently with a group of commands. Return an invalid id if not
+   * applicable */
+  ShellCommandId find_parallel_const_command(
+    const std::string& cmd_line,
+    const std::vector<ShellCommandId>& cmd_group) const;
+  /* Execute a const command with its own parsing results, without any
+   * change to the shell, so that multiple commands can run concurrently */
+  int execute_const_command(const char* cmd_line, const T& common_context,
+                            const ShellCommandId& cmd_id,
+                            CommandContext& cmd_context) const;
+  /* Execute a group of const commands concurrently, and then print their
+   * logs and update their status in order. Return the most severe status */
+  int execute_const_commands(const std::vector<std::string>& cmd_lines,
+                             const std::vector<ShellCommandId>& cmd_ids,
+                             T& common_context);
+
  private: /* Internal data */
   /* Name of the shell, this will appear in the interactive mode */
   std::string name_;
@@ -297,6 +328,10 @@ class Shell {
 
   /* Timer */
   std::clock_t time_start_;
+
+  /* Run consecutive const commands concurrently in script mode */
+  bool parallel_const_commands_;
+  size_t parallel_const_command_threads_;
 };
 
 } /* End namespace openfpga */
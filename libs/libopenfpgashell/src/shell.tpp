@@ -3,12 +3,14 @@
  ********************************************************************/
 #include <fstream>
 #include <algorithm>
+#include <atomic>
 
 /* Headers from vtrutil library */
 #include "vtr_log.h"
 #include "vtr_assert.h"
 
 /* Headers from openfpgautil library */
+#include "openfpga_parallel.h"
 #include "openfpga_tokenizer.h"
 
 /* Headers from readline library */
@@ -18,6 +20,7 @@
 /* Headers from openfpgashell library */
 #include "command_parser.h"
 #include "command_echo.h"
+#include "command_log_buffer.h"
 
 /* Begin namespace openfpga */
 namespace openfpga {
@@ -29,6 +32,8 @@ template<class T>
 Shell<T>::Shell() {
   name_ = std::string("shell_no_name");
   time_start_ = 0;
+  parallel_const_commands_ = false;
+  parallel_const_command_threads_ = 0;
 }
 
 /************************************************************************
@@ -260,6 +265,13 @@ ShellCommandClassId Shell<T>::add_command_class(const char* name) {
   return cmd_class;
 } 
 
+template<class T>
+void Shell<T>::set_parallel_const_commands(const bool& parallel_const_commands,
+                                           const size_t& num_threads) {
+  parallel_const_commands_ = parallel_const_commands;
+  parallel_const_command_threads_ = num_threads;
+}
+
 /************************************************************************
  * Public executors
  ***********************************************************************/
@@ -327,6 +339,12 @@ void Shell<T>::run_script_mode(const char* script_file_name,
    */
   std::string cmd_line;
 
+  /* Consecutive const commands to be executed concurrently */
+  std::vector<std::string> const_cmd_lines;
+  std::vector<ShellCommandId> const_cmd_ids;
+
+  bool fatal_error = false;
+
   /* Read line by line */
   while (getline(fp, line)) {
     /* Skip empty line */
@@ -378,9 +396,27 @@ void Shell<T>::run_script_mode(const char* script_file_name,
 
     /* Process the command only when the full command line in ended */
     if (!cmd_line.empty()) {
-      VTR_LOG("\nCommand line to execute: %s\n", cmd_line.c_str());
-      /* Do not allow any hidden command to be directly called by users */
-      int status = execute_command(cmd_line.c_str(), context, false);
+      /* A const command is queued, so that it can be executed concurrently with the consecutive const commands */
+      if (true == parallel_const_commands_) {
+        ShellCommandId const_cmd_id = find_parallel_const_command(cmd_line, const_cmd_ids);
+        if (ShellCommandId::INVALID() != const_cmd_id) {
+          const_cmd_lines.push_back(cmd_line);
+          const_cmd_ids.push_back(const_cmd_id);
+          cmd_line.clear();
+          continue;
+        }
+      }
+
+      /* Finish the queued const commands before this command */
+      int status = execute_const_commands(const_cmd_lines, const_cmd_ids, context);
+      const_cmd_lines.clear();
+      const_cmd_ids.clear();
+
+      if (CMD_EXEC_FATAL_ERROR != status) {
+        VTR_LOG("\nCommand line to execute: %s\n", cmd_line.c_str());
+        /* Do not allow any hidden command to be directly called by users */
+        status = execute_command(cmd_line.c_str(), context, false);
+      }
       /* Empty the line ready to start a new line */
       cmd_line.clear();
 
@@ -388,20 +424,30 @@ void Shell<T>::run_script_mode(const char* script_file_name,
        * if fatal error happened, we should abort immediately 
        */
       if (CMD_EXEC_FATAL_ERROR == status) {
-        VTR_LOG("Fatal error occurred!\n");
-        /* If in the batch mode, we will exit with errors */ 
-        VTR_LOGV(batch_mode, "%s Abort\n", name_.c_str());
-        if (batch_mode) {
-          exit(CMD_EXEC_FATAL_ERROR);
-        }
-        /* If not in the batch mode, we will got to interactive mode */ 
-        VTR_LOGV(!batch_mode, "Enter interactive mode\n");
+        fatal_error = true;
         break;
       }
     }
   }
   fp.close();
 
+  /* Finish the const commands at the end of the script */
+  if (false == fatal_error) {
+    int status = execute_const_commands(const_cmd_lines, const_cmd_ids, context);
+    fatal_error = (CMD_EXEC_FATAL_ERROR == status);
+  }
+
+  if (true == fatal_error) {
+    VTR_LOG("Fatal error occurred!\n");
+    /* If in the batch mode, we will exit with errors */ 
+    VTR_LOGV(batch_mode, "%s Abort\n", name_.c_str());
+    if (batch_mode) {
+      exit(CMD_EXEC_FATAL_ERROR);
+    }
+    /* If not in the batch mode, we will got to interactive mode */ 
+    VTR_LOGV(!batch_mode, "Enter interactive mode\n");
+  }
+
   /* If not in batch mode, switch to interactive mode, stay tuned */
   if (!batch_mode) {
     run_interactive_mode(context, true); 
@@ -510,27 +556,10 @@ void Shell<T>::exit(const int& init_err) const {
 template <class T>
 int Shell<T>::execute_command(const char* cmd_line,
                                T& common_context, const bool& allow_hidden_command) {
-  openfpga::StringToken tokenizer(cmd_line);  
-  tokenizer.add_delim(' ');
-  /* Do not split the string in each quote "", as they should be a piece */
-  std::vector<size_t> quote_anchors = tokenizer.find_positions('\"');
-  /* Quote should be not be started with! */
-  if (!quote_anchors.empty() && quote_anchors.front() == 0) {
-    VTR_LOG("Quotes (\") should NOT be the first charactor in command line: '%s'\n", cmd_line);
-    return CMD_EXEC_FATAL_ERROR;
-  }
-  /* Quotes must be in pairs! */
-  if (0 != quote_anchors.size() % 2) {
-    VTR_LOG("Quotes (\") are not in pair in command line: '%s'\n", cmd_line);
+  std::vector<std::string> tokens;
+  if (false == tokenize_command_line(cmd_line, tokens)) {
     return CMD_EXEC_FATAL_ERROR;
   }
-  /* Tokenize the line based on anchors */
-  std::vector<std::string> tokens;
-  if (quote_anchors.empty()) {
-    tokens = tokenizer.split(" ");
-  } else {
-    tokens = tokenizer.split_by_chunks('\"');
-  } 
 
   /* Find if the command name is valid */
   ShellCommandId cmd_id = command(tokens[0]);
@@ -549,16 +578,9 @@ int Shell<T>::execute_command(const char* cmd_line,
   }
 
   /* Check the dependency graph to see if all the prequistics have been met */
-  for (const ShellCommandId& dep_cmd : command_dependencies_[cmd_id]) {
-    if ( (CMD_EXEC_NONE == command_status_[dep_cmd])
-      || (CMD_EXEC_FATAL_ERROR == command_status_[dep_cmd]) ) {
-      VTR_LOG("Command '%s' is required to be executed before command '%s'!\n",
-              commands_[dep_cmd].name().c_str(), commands_[cmd_id].name().c_str());
-      /* Echo the command help desk */
-      print_command_options(commands_[cmd_id]);
-      command_status_[cmd_id] = CMD_EXEC_FATAL_ERROR;
-      return CMD_EXEC_FATAL_ERROR;
-    } 
+  if (false == check_command_dependency(cmd_id)) {
+    command_status_[cmd_id] = CMD_EXEC_FATAL_ERROR;
+    return CMD_EXEC_FATAL_ERROR;
   }
 
   /* Find the command! Parse the options 
@@ -641,6 +663,201 @@ int Shell<T>::execute_command(const char* cmd_line,
   return command_status_[cmd_id];
 }
 
+template <class T>
+bool Shell<T>::tokenize_command_line(const char* cmd_line,
+                                     std::vector<std::string>& tokens) const {
+  openfpga::StringToken tokenizer(cmd_line);  
+  tokenizer.add_delim(' ');
+  /* Do not split the string in each quote "", as they should be a piece */
+  std::vector<size_t> quote_anchors = tokenizer.find_positions('\"');
+  /* Quote should be not be started with! */
+  if (!quote_anchors.empty() && quote_anchors.front() == 0) {
+    VTR_LOG("Quotes (\") should NOT be the first charactor in command line: '%s'\n", cmd_line);
+    return false;
+  }
+  /* Quotes must be in pairs! */
+  if (0 != quote_anchors.size() % 2) {
+    VTR_LOG("Quotes (\") are not in pair in command line: '%s'\n", cmd_line);
+    return false;
+  }
+  /* Tokenize the line based on anchors */
+  if (quote_anchors.empty()) {
+    tokens = tokenizer.split(" ");
+  } else {
+    tokens = tokenizer.split_by_chunks('\"');
+  } 
+  return true;
+}
+
+template <class T>
+bool Shell<T>::check_command_dependency(const ShellCommandId& cmd_id) const {
+  for (const ShellCommandId& dep_cmd : command_dependencies_[cmd_id]) {
+    if ( (CMD_EXEC_NONE == command_status_[dep_cmd])
+      || (CMD_EXEC_FATAL_ERROR == command_status_[dep_cmd]) ) {
+      VTR_LOG("Command '%s' is required to be executed before command '%s'!\n",
+              commands_[dep_cmd].name().c_str(), commands_[cmd_id].name().c_str());
+      /* Echo the command help desk */
+      print_command_options(commands_[cmd_id]);
+      return false;
+    } 
+  }
+  return true;
+}
+
+template <class T>
+ShellCommandId Shell<T>::find_parallel_const_command(const std::string& cmd_line,
+                                                     const std::vector<ShellCommandId>& cmd_group) const {
+  /* The command name is the first token, which is never quoted */
+  ShellCommandId cmd_id = command(cmd_line.substr(0, cmd_line.find(' ')));
+  if (ShellCommandId::INVALID() == cmd_id) {
+    return ShellCommandId::INVALID();
+  }
+  /* Hidden commands are not allowed in script mode, leave the error to the normal execution */
+  if (command_hidden_[cmd_id]) {
+    return ShellCommandId::INVALID();
+  }
+  /* Only the commands which read the data exchange <T> are safe to run concurrently */
+  if ( (CONST_STANDARD != command_execute_function_types_[cmd_id])
+    && (CONST_SHORT != command_execute_function_types_[cmd_id]) ) {
+    return ShellCommandId::INVALID();
+  }
+  /* A command must wait for the commands it depends on */
+  for (const ShellCommandId& dep_cmd : command_dependencies_[cmd_id]) {
+    if (cmd_group.end() != std::find(cmd_group.begin(), cmd_group.end(), dep_cmd)) {
+      return ShellCommandId::INVALID();
+    }
+  }
+  /* A command running its own threads is executed alone, as the logs of its threads cannot be captured */
+  CommandOptionId opt_jobs = commands_[cmd_id].option("jobs");
+  if (CommandOptionId::INVALID() != opt_jobs) {
+    std::vector<std::string> tokens;
+    if (false == tokenize_command_line(cmd_line.c_str(), tokens)) {
+      return ShellCommandId::INVALID();
+    }
+    std::vector<std::string> opt_jobs_names;
+    opt_jobs_names.push_back(std::string("--") + commands_[cmd_id].option_name(opt_jobs));
+    if (!commands_[cmd_id].option_short_name(opt_jobs).empty()) {
+      opt_jobs_names.push_back(std::string("-") + commands_[cmd_id].option_short_name(opt_jobs));
+    }
+    for (const std::string& token : tokens) {
+      if (opt_jobs_names.end() != std::find(opt_jobs_names.begin(), opt_jobs_names.end(), token)) {
+        return ShellCommandId::INVALID();
+      }
+    }
+  }
+  return cmd_id;
+}
+
+template <class T>
+int Shell<T>::execute_const_command(const char* cmd_line,
+                                    const T& common_context,
+                                    const ShellCommandId& cmd_id,
+                                    CommandContext& cmd_context) const {
+  std::vector<std::string> tokens;
+  if (false == tokenize_command_line(cmd_line, tokens)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  /* Check the dependency graph to see if all the prequistics have been met */
+  if (false == check_command_dependency(cmd_id)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  /* Parse the options to the context owned by this execution */
+  if (false == parse_command(tokens, commands_[cmd_id], cmd_context)) {
+    /* Echo the command */
+    print_command_options(commands_[cmd_id]);
+    return CMD_EXEC_FATAL_ERROR;
+  }
+ 
+  /* Parse succeed. Let user to confirm selected options */ 
+  print_command_context(commands_[cmd_id], cmd_context);
+
+  int status = CMD_EXEC_NONE;
+  switch (command_execute_function_types_[cmd_id]) {
+  case CONST_STANDARD:
+    status = command_const_execute_functions_[cmd_id](common_context, commands_[cmd_id], cmd_context);
+    break;
+  case CONST_SHORT:
+    status = command_short_const_execute_functions_[cmd_id](common_context);
+    break;
+  default:
+    /* This is not allowed! Error out */
+    VTR_LOG_ERROR("Invalid type of execute function for const command '%s'!\n",
+                  commands_[cmd_id].name().c_str());
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  /* Forbid users to return the status CMD_EXEC_NONE */
+  if (CMD_EXEC_NONE == status) {
+    VTR_LOG_ERROR("It is illegal to return never-executed status for an executed command!\n");
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  return status;
+}
+
+template <class T>
+int Shell<T>::execute_const_commands(const std::vector<std::string>& cmd_lines,
+                                     const std::vector<ShellCommandId>& cmd_ids,
+                                     T& common_context) {
+  VTR_ASSERT(cmd_lines.size() == cmd_ids.size());
+  if (cmd_lines.empty()) {
+    return CMD_EXEC_SUCCESS;
+  }
+
+  /* A single command is executed as usual */
+  if (1 == cmd_lines.size()) {
+    VTR_LOG("\nCommand line to execute: %s\n", cmd_lines[0].c_str());
+    return execute_command(cmd_lines[0].c_str(), common_context, false);
+  }
+
+  /* Each command has its own parsing results and logs, as the same command may be called more than once */
+  std::vector<CommandContext> cmd_contexts;
+  cmd_contexts.reserve(cmd_ids.size());
+  for (const ShellCommandId& cmd_id : cmd_ids) {
+    cmd_contexts.emplace_back(commands_[cmd_id]);
+  }
+  std::vector<CommandLogBuffer> cmd_logs(cmd_lines.size());
+  std::vector<int> cmd_status(cmd_lines.size(), CMD_EXEC_NONE);
+
+  /* Commands which have not been started yet are skipped after a fatal error.
+   * Commands which have been started are finished */
+  std::atomic<bool> fatal_error(false);
+  const T& const_common_context = common_context;
+  /* Printers are redirected to the logs of each command before any thread starts */
+  install_command_log_printers();
+  parallel_for(cmd_lines.size(), parallel_const_command_threads_, [&](const size_t& icmd) {
+    if (true == fatal_error.load()) {
+      return;
+    }
+    CommandLogCapture cmd_log_capture(cmd_logs[icmd]);
+    VTR_LOG("\nCommand line to execute: %s\n", cmd_lines[icmd].c_str());
+    cmd_status[icmd] = execute_const_command(cmd_lines[icmd].c_str(), const_common_context, cmd_ids[icmd], cmd_contexts[icmd]);
+    if (CMD_EXEC_FATAL_ERROR == cmd_status[icmd]) {
+      fatal_error.store(true);
+    }
+  });
+
+  /* Print the logs and update the status as if the commands were executed one by one */
+  int status = CMD_EXEC_SUCCESS;
+  for (size_t icmd = 0; icmd < cmd_lines.size(); ++icmd) {
+    if (CMD_EXEC_NONE == cmd_status[icmd]) {
+      VTR_LOG("\nCommand line skipped due to a previous fatal error: %s\n", cmd_lines[icmd].c_str());
+      continue;
+    }
+    cmd_logs[icmd].flush();
+    command_contexts_[cmd_ids[icmd]] = cmd_contexts[icmd];
+    command_status_[cmd_ids[icmd]] = cmd_status[icmd];
+    if ( (CMD_EXEC_FATAL_ERROR == cmd_status[icmd])
+      || ( (CMD_EXEC_MINOR_ERROR == cmd_status[icmd]) && (CMD_EXEC_SUCCESS == status) ) ) {
+      status = cmd_status[icmd];
+    }
+  }
+
+  return status;
+}
+
 /************************************************************************
  * Public invalidators/validators 
  ***********************************************************************/
@@ -5,6 +5,9 @@
 #include <sys/stat.h>
 
 #include <algorithm>
+#include <chrono>
+#include <ctime>
+#include <mutex>
 #include <vector>
 
 /* Headers from vtrutil library */
@@ -264,4 +267,18 @@ bool write_tab_to_file(std::fstream& fp, const size_t& num_tab) {
   return true;
 }
 
+/********************************************************************
+ * Return the current date and time in the format of std::ctime(),
+ * including the ending newline, e.g., "Sun Oct  7 10:00:00 2026\n"
+ * std::ctime() returns a buffer shared by all the threads, which is
+ * guarded here as file headers may be written by concurrent commands
+ ********************************************************************/
+std::string get_current_time_stamp() {
+  static std::mutex ctime_mutex;
+  auto now = std::chrono::system_clock::now();
+  std::time_t now_time = std::chrono::system_clock::to_time_t(now);
+  std::lock_guard<std::mutex> ctime_lock(ctime_mutex);
+  return std::string(std::ctime(&now_time));
+}
+
 }  // namespace openfpga
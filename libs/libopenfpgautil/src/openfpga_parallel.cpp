@@ -0,0 +1,121 @@
+/********************************************************************
+ * This file includes functions that run independent jobs on multiple
+ * threads in OpenFPGA framework
+ *******************************************************************/
+#include <atomic>
+#include <cerrno>
+#include <cstdlib>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/* Headers from vtrutil library */
+#include "vtr_log.h"
+
+/* Headers from openfpgautil library */
+#include "openfpga_parallel.h"
+
+namespace openfpga {
+
+/********************************************************************
+ * Find the number of threads to be used for a given number of jobs
+ * - A zero request means using all the hardware threads
+ * - There is no need to have more threads than jobs
+ * The result is at least 1
+ *******************************************************************/
+size_t find_num_threads(const size_t& num_threads_requested,
+                        const size_t& num_jobs) {
+  size_t num_threads = num_threads_requested;
+  if (0 == num_threads) {
+    num_threads = std::thread::hardware_concurrency();
+  }
+  if (num_threads > num_jobs) {
+    num_threads = num_jobs;
+  }
+  if (0 == num_threads) {
+    num_threads = 1;
+  }
+  return num_threads;
+}
+
+/********************************************************************
+ * Parse the value of an option '--jobs' to a number of threads, where
+ * 0 means all the hardware threads.
+ * An empty value (the option is not specified) keeps the given number.
+ * Return false if the value is not a non-negative integer
+ *******************************************************************/
+bool parse_num_threads(const std::string& jobs, size_t& num_threads) {
+  if (jobs.empty()) {
+    return true;
+  }
+  char* end = nullptr;
+  errno = 0;
+  long num_jobs = std::strtol(jobs.c_str(), &end, 10);
+  if ((0 != errno) || ('\0' != *end) || (0 > num_jobs)) {
+    VTR_LOG_ERROR(
+      "Invalid number of jobs '%s'! Expect a non-negative integer\n",
+      jobs.c_str());
+    return false;
+  }
+  num_threads = num_jobs;
+  return true;
+}
+
+/********************************************************************
+ * Run the jobs [0, num_jobs) on a number of threads.
+ * Jobs are picked up dynamically, so the execution order is NOT
+ * deterministic. Each job should write its results to its own storage
+ * (e.g., indexed by the job id), so that the results can be merged in a
+ * deterministic order afterwards.
+ * When there is only one thread, jobs are executed in order on the
+ * calling thread. An exception thrown by any job is rethrown to the caller
+ * after all the threads are finished.
+ *******************************************************************/
+void parallel_for(const size_t& num_jobs, const size_t& num_threads,
+                  const std::function<void(const size_t&)>& job) {
+  size_t num_workers = find_num_threads(num_threads, num_jobs);
+  if (1 == num_workers) {
+    for (size_t ijob = 0; ijob < num_jobs; ++ijob) {
+      job(ijob);
+    }
+    return;
+  }
+
+  std::atomic<size_t> next_job(0);
+  std::exception_ptr first_exception = nullptr;
+  std::mutex exception_mutex;
+
+  auto worker = [&]() {
+    size_t ijob;
+    while ((ijob = next_job.fetch_add(1)) < num_jobs) {
+      try {
+        job(ijob);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(exception_mutex);
+        if (nullptr == first_exception) {
+          first_exception = std::current_exception();
+        }
+        /* Stop picking up new jobs */
+        next_job.store(num_jobs);
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_workers - 1);
+  for (size_t ithread = 0; ithread < num_workers - 1; ++ithread) {
+    threads.emplace_back(worker);
+  }
+  /* The calling thread works as well */
+  worker();
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+
+  if (nullptr != first_exception) {
+    std::rethrow_exception(first_exception);
+  }
+}
+
+}  // namespace openfpga
@@ -0,0 +1,27 @@
+#ifndef OPENFPGA_PARALLEL_H
+#define OPENFPGA_PARALLEL_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include <cstddef>
+#include <functional>
+#include <string>
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+/* namespace openfpga begins */
+namespace openfpga {
+
+size_t find_num_threads(const size_t& num_threads_requested,
+                        const size_t& num_jobs);
+
+bool parse_num_threads(const std::string& jobs, size_t& num_threads);
+
+void parallel_for(const size_t& num_jobs, const size_t& num_threads,
+                  const std::function<void(const size_t&)>& job);
+
+}  // namespace openfpga
+
+#endif
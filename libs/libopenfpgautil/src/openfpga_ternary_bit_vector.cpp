@@ -0,0 +1,202 @@
+/********************************************************************
+ * Member functions for the data structure TernaryBitVector
+ *******************************************************************/
+#include "openfpga_ternary_bit_vector.h"
+
+#include <algorithm>
+
+#include "openfpga_decode.h"
+#include "vtr_assert.h"
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/* Number of bits encoded by each 64-bit number */
+constexpr size_t TERNARY_BIT_VECTOR_WORD_SIZE = 64;
+
+static size_t find_ternary_bit_vector_num_words(const size_t& size) {
+  return (size + TERNARY_BIT_VECTOR_WORD_SIZE - 1) /
+         TERNARY_BIT_VECTOR_WORD_SIZE;
+}
+
+/* Rank of a bit in ordering, which follows the order of characters */
+static size_t find_ternary_bit_rank(const bool& one_bit, const bool& x_bit) {
+  if (true == x_bit) {
+    return 2;
+  }
+  if (true == one_bit) {
+    return 1;
+  }
+  return 0;
+}
+
+/************************************************************************
+ * Constructors
+ ***********************************************************************/
+TernaryBitVector::TernaryBitVector() { size_ = 0; }
+
+TernaryBitVector::TernaryBitVector(const size_t& size, const char& bit) {
+  size_ = size;
+  one_bits_.resize(find_ternary_bit_vector_num_words(size), 0);
+  x_bits_.resize(find_ternary_bit_vector_num_words(size), 0);
+  replace_bits('0', bit);
+}
+
+TernaryBitVector::TernaryBitVector(const std::string& bits)
+  : TernaryBitVector(bits.size(), '0') {
+  for (size_t ibit = 0; ibit < bits.size(); ++ibit) {
+    set_bit(ibit, bits[ibit]);
+  }
+}
+
+TernaryBitVector::TernaryBitVector(const std::vector<char>& bits)
+  : TernaryBitVector(bits.size(), '0') {
+  for (size_t ibit = 0; ibit < bits.size(); ++ibit) {
+    set_bit(ibit, bits[ibit]);
+  }
+}
+
+/************************************************************************
+ * Overloaded operators
+ ***********************************************************************/
+bool TernaryBitVector::operator==(const TernaryBitVector& other) const {
+  return (size_ == other.size_) && (one_bits_ == other.one_bits_) &&
+         (x_bits_ == other.x_bits_);
+}
+
+bool TernaryBitVector::operator!=(const TernaryBitVector& other) const {
+  return !(*this == other);
+}
+
+/* Compare the first different bit, as the comparison of strings */
+bool TernaryBitVector::operator<(const TernaryBitVector& other) const {
+  size_t common_size = std::min(size_, other.size_);
+  for (size_t iword = 0;
+       iword < find_ternary_bit_vector_num_words(common_size); ++iword) {
+    uint64_t diff = (one_bits_[iword] ^ other.one_bits_[iword]) |
+                    (x_bits_[iword] ^ other.x_bits_[iword]);
+    /* Bits beyond the common size do not count */
+    size_t num_common_bits = common_size - iword * TERNARY_BIT_VECTOR_WORD_SIZE;
+    if (num_common_bits < TERNARY_BIT_VECTOR_WORD_SIZE) {
+      diff &= ((uint64_t)1 << num_common_bits) - 1;
+    }
+    if (0 == diff) {
+      continue;
+    }
+    size_t offset = 0;
+    while (0 == ((diff >> offset) & 1)) {
+      offset++;
+    }
+    return find_ternary_bit_rank((one_bits_[iword] >> offset) & 1,
+                                 (x_bits_[iword] >> offset) & 1) <
+           find_ternary_bit_rank((other.one_bits_[iword] >> offset) & 1,
+                                 (other.x_bits_[iword] >> offset) & 1);
+  }
+  return size_ < other.size_;
+}
+
+/************************************************************************
+ * Accessors
+ ***********************************************************************/
+size_t TernaryBitVector::size() const { return size_; }
+
+bool TernaryBitVector::empty() const { return 0 == size_; }
+
+char TernaryBitVector::bit(const size_t& index) const {
+  VTR_ASSERT(index < size_);
+  size_t iword = index / TERNARY_BIT_VECTOR_WORD_SIZE;
+  size_t offset = index % TERNARY_BIT_VECTOR_WORD_SIZE;
+  if (1 == ((x_bits_[iword] >> offset) & 1)) {
+    return DONT_CARE_CHAR;
+  }
+  if (1 == ((one_bits_[iword] >> offset) & 1)) {
+    return '1';
+  }
+  return '0';
+}
+
+bool TernaryBitVector::all(const char& bit) const {
+  for (size_t iword = 0; iword < one_bits_.size(); ++iword) {
+    if (match_mask(iword, bit) != valid_mask(iword)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::string TernaryBitVector::to_string() const {
+  std::string bits(size_, '0');
+  for (size_t ibit = 0; ibit < size_; ++ibit) {
+    bits[ibit] = bit(ibit);
+  }
+  return bits;
+}
+
+/************************************************************************
+ * Mutators
+ ***********************************************************************/
+void TernaryBitVector::set_bit(const size_t& index, const char& bit) {
+  VTR_ASSERT(index < size_);
+  VTR_ASSERT('0' == bit || '1' == bit || DONT_CARE_CHAR == bit);
+  size_t iword = index / TERNARY_BIT_VECTOR_WORD_SIZE;
+  uint64_t mask = (uint64_t)1 << (index % TERNARY_BIT_VECTOR_WORD_SIZE);
+  one_bits_[iword] &= ~mask;
+  x_bits_[iword] &= ~mask;
+  if ('1' == bit) {
+    one_bits_[iword] |= mask;
+  } else if (DONT_CARE_CHAR == bit) {
+    x_bits_[iword] |= mask;
+  }
+}
+
+void TernaryBitVector::replace_bits(const char& bit_in_place,
+                                    const char& bit_to_replace) {
+  VTR_ASSERT('0' == bit_to_replace || '1' == bit_to_replace ||
+             DONT_CARE_CHAR == bit_to_replace);
+  for (size_t iword = 0; iword < one_bits_.size(); ++iword) {
+    uint64_t mask = match_mask(iword, bit_in_place);
+    one_bits_[iword] &= ~mask;
+    x_bits_[iword] &= ~mask;
+    if ('1' == bit_to_replace) {
+      one_bits_[iword] |= mask;
+    } else if (DONT_CARE_CHAR == bit_to_replace) {
+      x_bits_[iword] |= mask;
+    }
+  }
+}
+
+void TernaryBitVector::combine_1hot(const TernaryBitVector& other) {
+  VTR_ASSERT(size_ == other.size_);
+  for (size_t iword = 0; iword < one_bits_.size(); ++iword) {
+    /* The '0' and '1' bits of the other vector overwrite */
+    uint64_t mask = ~other.x_bits_[iword] & valid_mask(iword);
+    one_bits_[iword] = (one_bits_[iword] & ~mask) | other.one_bits_[iword];
+    x_bits_[iword] &= ~mask;
+  }
+}
+
+/************************************************************************
+ * Internal utility
+ ***********************************************************************/
+uint64_t TernaryBitVector::match_mask(const size_t& iword,
+                                      const char& bit) const {
+  uint64_t mask = 0;
+  if ('1' == bit) {
+    mask = one_bits_[iword];
+  } else if (DONT_CARE_CHAR == bit) {
+    mask = x_bits_[iword];
+  } else if ('0' == bit) {
+    mask = ~(one_bits_[iword] | x_bits_[iword]);
+  }
+  return mask & valid_mask(iword);
+}
+
+uint64_t TernaryBitVector::valid_mask(const size_t& iword) const {
+  size_t num_bits = size_ - iword * TERNARY_BIT_VECTOR_WORD_SIZE;
+  if (num_bits >= TERNARY_BIT_VECTOR_WORD_SIZE) {
+    return ~(uint64_t)0;
+  }
+  return ((uint64_t)1 << num_bits) - 1;
+}
+
+}  // namespace openfpga
@@ -0,0 +1,73 @@
+#ifndef OPENFPGA_TERNARY_BIT_VECTOR_H
+#define OPENFPGA_TERNARY_BIT_VECTOR_H
+
+/********************************************************************
+ * Include header files that are required by data structure declaration
+ *******************************************************************/
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+/* namespace openfpga begins */
+namespace openfpga {
+
+/********************************************************************
+ * A vector of bits which may be '0', '1' or don't care 'x', e.g., the
+ * BL/WL vectors of memory banks.
+ *
+ * Each bit costs 2 bits of memory rather than a character:
+ * - a bit-one number: which encodes the '1' bits, e.g., 101x1 -> 10101
+ * - a bit-x number: which encodes the 'x' bits, e.g., 101x1 -> 00010
+ * The bit of index i is stored at the bit (i % 64) of the (i / 64)-th
+ * 64-bit number, so that operations on a vector are done by words.
+ *
+ * The vectors are ordered in the same way as strings, where the bits
+ * are ordered as '0' < '1' < 'x'
+ *******************************************************************/
+class TernaryBitVector {
+ public: /* Constructors */
+  TernaryBitVector();
+  /* Create a vector filled with a bit */
+  TernaryBitVector(const size_t& size, const char& bit);
+  explicit TernaryBitVector(const std::string& bits);
+  explicit TernaryBitVector(const std::vector<char>& bits);
+
+ public: /* Overloaded operators */
+  bool operator==(const TernaryBitVector& other) const;
+  bool operator!=(const TernaryBitVector& other) const;
+  bool operator<(const TernaryBitVector& other) const;
+
+ public: /* Accessors */
+  size_t size() const;
+  bool empty() const;
+  /* Return the bit at a given index as a character: '0', '1' or 'x' */
+  char bit(const size_t& index) const;
+  /* Check if all the bits are the same as a given bit */
+  bool all(const char& bit) const;
+  std::string to_string() const;
+
+ public: /* Mutators */
+  void set_bit(const size_t& index, const char& bit);
+  /* Replace all the bits which are the same as bit_in_place by
+   * bit_to_replace, same as replace_str_bits() */
+  void replace_bits(const char& bit_in_place, const char& bit_to_replace);
+  /* Merge the '0' and '1' bits of another vector in the same size, which
+   * overwrite the bits in this vector, same as combine_two_1hot_str() */
+  void combine_1hot(const TernaryBitVector& other);
+
+ private: /* Internal utility */
+  /* Mask of the bits in a word which are the same as a given bit */
+  uint64_t match_mask(const size_t& iword, const char& bit) const;
+  /* Mask of the valid bits in a word */
+  uint64_t valid_mask(const size_t& iword) const;
+
+ private: /* Internal Data */
+  size_t size_;
+  std::vector<uint64_t> one_bits_;
+  std::vector<uint64_t> x_bits_;
+};
+
+}  // namespace openfpga
+
+#endif
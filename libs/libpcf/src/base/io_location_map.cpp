@@ -127,10 +127,8 @@ int IoLocationMap::write_to_xml_file(const std::string& fname,
   fp << "\t- FPGA Fabric I/O Information" << std::endl;
   fp << "\t- Generated by OpenFPGA" << std::endl;
 
-  auto end = std::chrono::system_clock::now();
-  std::time_t end_time = std::chrono::system_clock::to_time_t(end);
   if (include_time_stamp) {
-    fp << "\t- Date: " << std::ctime(&end_time);
+    fp << "\t- Date: " << get_current_time_stamp();
   }
 
   fp << "-->" << std::endl;
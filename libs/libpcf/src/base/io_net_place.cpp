@@ -91,10 +91,8 @@ int IoNetPlace::write_to_place_file(const std::string& fname,
   fp << "# FPGA Fixed I/O placement file" << std::endl;
   fp << "# Generated by OpenFPGA" << std::endl;
 
-  auto end = std::chrono::system_clock::now();
-  std::time_t end_time = std::chrono::system_clock::to_time_t(end);
   if (include_time_stamp) {
-    fp << "# Date: " << std::ctime(&end_time);
+    fp << "# Date: " << get_current_time_stamp();
   }
 
   fp << "#Block Name\tx\ty\tz" << std::endl;
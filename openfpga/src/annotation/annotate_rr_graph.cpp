@@ -8,6 +8,7 @@
 #include "vtr_time.h"
 
 /* Headers from openfpgautil library */
+#include "openfpga_parallel.h"
 #include "openfpga_side_manager.h"
 
 /* Headers from vpr library */
@@ -403,10 +404,13 @@ static RRGSB build_rr_gsb(const DeviceContext& vpr_device_ctx,
 /********************************************************************
  * Build the annotation for the routing resource graph
  * by collecting the nodes to the General Switch Block context
+ * Each GSB is built independently from the routing resource graph, so
+ * that the columns of GSBs are built on multiple threads
  *******************************************************************/
 void annotate_device_rr_gsb(const DeviceContext& vpr_device_ctx,
                             DeviceRRGSB& device_rr_gsb,
                             const bool& include_clock,
+                            const size_t& num_threads,
                             const bool& verbose_output) {
   vtr::ScopedStartFinishTimer timer(
     "Build General Switch Block(GSB) annotation on top of routing resource "
@@ -416,14 +420,16 @@ void annotate_device_rr_gsb(const DeviceContext& vpr_device_ctx,
    */
   vtr::Point<size_t> gsb_range(vpr_device_ctx.grid.width() - 1,
                                vpr_device_ctx.grid.height() - 1);
+  /* The array is allocated here, so that each GSB is added in place */
   device_rr_gsb.reserve(gsb_range);
 
-  VTR_LOGV(verbose_output, "Start annotation GSB up to [%lu][%lu]\n",
-           gsb_range.x(), gsb_range.y());
+  VTR_LOGV(verbose_output,
+           "Start annotation GSB up to [%lu][%lu] with %lu threads\n",
+           gsb_range.x(), gsb_range.y(),
+           find_num_threads(num_threads, gsb_range.x()));
 
-  size_t gsb_cnt = 0;
   /* For each switch block, determine the size of array */
-  for (size_t ix = 0; ix < gsb_range.x(); ++ix) {
+  parallel_for(gsb_range.x(), num_threads, [&](const size_t& ix) {
     for (size_t iy = 0; iy < gsb_range.y(); ++iy) {
       /* Here we give the builder the fringe coordinates so that it can handle
        * the GSBs at the borderside correctly sort drive_rr_nodes should be
@@ -437,13 +443,11 @@ void annotate_device_rr_gsb(const DeviceContext& vpr_device_ctx,
 
       /* Add to device_rr_gsb */
       vtr::Point<size_t> gsb_coordinate = rr_gsb.get_sb_coordinate();
+      VTR_ASSERT(gsb_coordinate.x() < gsb_range.x());
+      VTR_ASSERT(gsb_coordinate.y() < gsb_range.y());
       device_rr_gsb.add_rr_gsb(gsb_coordinate, rr_gsb);
-      gsb_cnt++; /* Update counter */
-      /* Print info */
-      VTR_LOG("[%lu%] Backannotated GSB[%lu][%lu]\r",
-              100 * gsb_cnt / (gsb_range.x() * gsb_range.y()), ix, iy);
     }
-  }
+  });
   /* Report number of unique mirrors */
   VTR_LOG("Backannotated %d General Switch Blocks (GSBs).\n",
           gsb_range.x() * gsb_range.y());
@@ -452,9 +456,11 @@ void annotate_device_rr_gsb(const DeviceContext& vpr_device_ctx,
 /********************************************************************
  * Sort all the incoming edges for each channel node which are
  * output ports of the GSB
+ * The GSBs are sorted independently, column by column on multiple threads
  *******************************************************************/
 void sort_device_rr_gsb_chan_node_in_edges(const RRGraphView& rr_graph,
                                            DeviceRRGSB& device_rr_gsb,
+                                           const size_t& num_threads,
                                            const bool& verbose_output) {
   vtr::ScopedStartFinishTimer timer(
     "Sort incoming edges for each routing track output node of General Switch "
@@ -467,24 +473,14 @@ void sort_device_rr_gsb_chan_node_in_edges(const RRGraphView& rr_graph,
   VTR_LOGV(verbose_output, "Start sorting edges for GSBs up to [%lu][%lu]\n",
            gsb_range.x(), gsb_range.y());
 
-  size_t gsb_cnt = 0;
-
   /* For each switch block, determine the size of array */
-  for (size_t ix = 0; ix < gsb_range.x(); ++ix) {
+  parallel_for(gsb_range.x(), num_threads, [&](const size_t& ix) {
     for (size_t iy = 0; iy < gsb_range.y(); ++iy) {
       vtr::Point<size_t> gsb_coordinate(ix, iy);
       RRGSB& rr_gsb = device_rr_gsb.get_mutable_gsb(gsb_coordinate);
       rr_gsb.sort_chan_node_in_edges(rr_graph);
-
-      gsb_cnt++; /* Update counter */
-
-      /* Print info */
-      VTR_LOG(
-        "[%lu%] Sorted incoming edges for each routing track output node of "
-        "GSB[%lu][%lu]\r",
-        100 * gsb_cnt / (gsb_range.x() * gsb_range.y()), ix, iy);
     }
-  }
+  });
 
   /* Report number of unique mirrors */
   VTR_LOG(
@@ -496,9 +492,11 @@ void sort_device_rr_gsb_chan_node_in_edges(const RRGraphView& rr_graph,
 /********************************************************************
  * Sort all the incoming edges for each input pin node which are
  * output ports of the GSB
+ * The GSBs are sorted independently, column by column on multiple threads
  *******************************************************************/
 void sort_device_rr_gsb_ipin_node_in_edges(const RRGraphView& rr_graph,
                                            DeviceRRGSB& device_rr_gsb,
+                                           const size_t& num_threads,
                                            const bool& verbose_output) {
   vtr::ScopedStartFinishTimer timer(
     "Sort incoming edges for each input pin node of General Switch Block(GSB)");
@@ -510,24 +508,14 @@ void sort_device_rr_gsb_ipin_node_in_edges(const RRGraphView& rr_graph,
   VTR_LOGV(verbose_output, "Start sorting edges for GSBs up to [%lu][%lu]\n",
            gsb_range.x(), gsb_range.y());
 
-  size_t gsb_cnt = 0;
-
   /* For each switch block, determine the size of array */
-  for (size_t ix = 0; ix < gsb_range.x(); ++ix) {
+  parallel_for(gsb_range.x(), num_threads, [&](const size_t& ix) {
     for (size_t iy = 0; iy < gsb_range.y(); ++iy) {
       vtr::Point<size_t> gsb_coordinate(ix, iy);
       RRGSB& rr_gsb = device_rr_gsb.get_mutable_gsb(gsb_coordinate);
       rr_gsb.sort_ipin_node_in_edges(rr_graph);
-
-      gsb_cnt++; /* Update counter */
-
-      /* Print info */
-      VTR_LOG(
-        "[%lu%] Sorted incoming edges for each input pin node of "
-        "GSB[%lu][%lu]\r",
-        100 * gsb_cnt / (gsb_range.x() * gsb_range.y()), ix, iy);
     }
-  }
+  });
 
   /* Report number of unique mirrors */
   VTR_LOG(
@@ -1,6 +1,9 @@
 #include "append_clock_rr_graph.h"
 
+#include <map>
+
 #include "command_exit_codes.h"
+#include "openfpga_parallel.h"
 #include "openfpga_physical_tile_utils.h"
 #include "rr_graph_builder_utils.h"
 #include "rr_graph_cost.h"
@@ -12,6 +15,13 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
+/* Indices of the pins which are clock taps in each type of physical tile:
+ * [clock_tree][clock_pin][physical_tile] -> list of pin indices */
+typedef std::map<
+  ClockTreeId,
+  std::vector<std::map<t_physical_tile_type_ptr, std::vector<int>>>>
+  ClockTapPinLookup;
+
 /********************************************************************
  * Estimate the number of clock nodes to be added for a given tile and clock
  *structure For each layer/level of a clock network, we need
@@ -385,6 +395,37 @@ static std::vector<RRNodeId> find_clock_track2track_node(
   return des_nodes;
 }
 
+/********************************************************************
+ * Build the lookup for the clock tap pins of each type of physical tile.
+ * This avoids parsing the tap pin names at each grid when adding edges
+ *******************************************************************/
+static ClockTapPinLookup build_clock_tap_pin_lookup(
+  const std::vector<t_physical_tile_type>& physical_tile_types,
+  const ClockNetwork& clk_ntwk) {
+  ClockTapPinLookup tap_pin_lookup;
+  for (auto itree : clk_ntwk.trees()) {
+    std::vector<std::map<t_physical_tile_type_ptr, std::vector<int>>>&
+      tree_tap_pins = tap_pin_lookup[itree];
+    tree_tap_pins.resize(clk_ntwk.tree_width(itree));
+    for (auto ipin : clk_ntwk.pins(itree)) {
+      std::vector<std::string> tap_pin_names =
+        clk_ntwk.tree_flatten_taps(itree, ipin);
+      for (const t_physical_tile_type& physical_tile : physical_tile_types) {
+        for (std::string tap_pin_name : tap_pin_names) {
+          /* tap pin name could be 'io[5:5].a2f[0]' */
+          int grid_pin_idx =
+            find_physical_tile_pin_index(&physical_tile, tap_pin_name);
+          if (grid_pin_idx == physical_tile.num_pins) {
+            continue;
+          }
+          tree_tap_pins[size_t(ipin)][&physical_tile].push_back(grid_pin_idx);
+        }
+      }
+    }
+  }
+  return tap_pin_lookup;
+}
+
 /********************************************************************
  * Try to find an IPIN of a grid which satisfy the requirement of clock pins
  * that has been defined in clock network. If the IPIN does exist in a
@@ -393,17 +434,17 @@ static std::vector<RRNodeId> find_clock_track2track_node(
 static void try_find_and_add_clock_track2ipin_node(
   std::vector<RRNodeId>& des_nodes, const DeviceGrid& grids,
   const RRGraphView& rr_graph_view, const vtr::Point<size_t>& grid_coord,
-  const e_side& pin_side, const ClockNetwork& clk_ntwk,
+  const e_side& pin_side, const ClockTapPinLookup& tap_pin_lookup,
   const ClockTreeId& clk_tree, const ClockTreePinId& clk_pin) {
   t_physical_tile_type_ptr grid_type =
     grids[grid_coord.x()][grid_coord.y()].type;
-  for (std::string tap_pin_name :
-       clk_ntwk.tree_flatten_taps(clk_tree, clk_pin)) {
-    /* tap pin name could be 'io[5:5].a2f[0]' */
-    int grid_pin_idx = find_physical_tile_pin_index(grid_type, tap_pin_name);
-    if (grid_pin_idx == grid_type->num_pins) {
-      continue;
-    }
+  const std::map<t_physical_tile_type_ptr, std::vector<int>>& tile_tap_pins =
+    tap_pin_lookup.at(clk_tree)[size_t(clk_pin)];
+  auto result = tile_tap_pins.find(grid_type);
+  if (result == tile_tap_pins.end()) {
+    return;
+  }
+  for (int grid_pin_idx : result->second) {
     RRNodeId des_node = rr_graph_view.node_lookup().find_node(
       grid_coord.x(), grid_coord.y(), IPIN, grid_pin_idx, pin_side);
     if (rr_graph_view.valid_node(des_node)) {
@@ -441,7 +482,7 @@ static void try_find_and_add_clock_track2ipin_node(
 static std::vector<RRNodeId> find_clock_track2ipin_node(
   const DeviceGrid& grids, const RRGraphView& rr_graph_view,
   const t_rr_type& chan_type, const vtr::Point<size_t>& chan_coord,
-  const ClockNetwork& clk_ntwk, const ClockTreeId& clk_tree,
+  const ClockTapPinLookup& tap_pin_lookup, const ClockTreeId& clk_tree,
   const ClockTreePinId& clk_pin) {
   std::vector<RRNodeId> des_nodes;
 
@@ -449,42 +490,43 @@ static std::vector<RRNodeId> find_clock_track2ipin_node(
     /* Get the clock IPINs at the BOTTOM side of adjacent grids [x][y+1] */
     vtr::Point<size_t> bot_grid_coord(chan_coord.x(), chan_coord.y() + 1);
     try_find_and_add_clock_track2ipin_node(des_nodes, grids, rr_graph_view,
-                                           bot_grid_coord, BOTTOM, clk_ntwk,
-                                           clk_tree, clk_pin);
+                                           bot_grid_coord, BOTTOM,
+                                           tap_pin_lookup, clk_tree, clk_pin);
 
     /* Get the clock IPINs at the TOP side of adjacent grids [x][y] */
     vtr::Point<size_t> top_grid_coord(chan_coord.x(), chan_coord.y());
     try_find_and_add_clock_track2ipin_node(des_nodes, grids, rr_graph_view,
-                                           top_grid_coord, TOP, clk_ntwk,
+                                           top_grid_coord, TOP, tap_pin_lookup,
                                            clk_tree, clk_pin);
   } else {
     VTR_ASSERT(chan_type == CHANY);
     /* Get the clock IPINs at the LEFT side of adjacent grids [x][y+1] */
     vtr::Point<size_t> left_grid_coord(chan_coord.x() + 1, chan_coord.y());
     try_find_and_add_clock_track2ipin_node(des_nodes, grids, rr_graph_view,
-                                           left_grid_coord, LEFT, clk_ntwk,
-                                           clk_tree, clk_pin);
+                                           left_grid_coord, LEFT,
+                                           tap_pin_lookup, clk_tree, clk_pin);
 
     /* Get the clock IPINs at the RIGHT side of adjacent grids [x][y] */
     vtr::Point<size_t> right_grid_coord(chan_coord.x(), chan_coord.y());
     try_find_and_add_clock_track2ipin_node(des_nodes, grids, rr_graph_view,
-                                           right_grid_coord, RIGHT, clk_ntwk,
-                                           clk_tree, clk_pin);
+                                           right_grid_coord, RIGHT,
+                                           tap_pin_lookup, clk_tree, clk_pin);
   }
 
   return des_nodes;
 }
 
 /********************************************************************
- * Add edges for the clock nodes in a given connection block
+ * Find the edges for the clock nodes in a given connection block
+ * Note that this function only reads the routing resource graph, so that
+ * the connection blocks can be visited in parallel
  *******************************************************************/
-static void add_rr_graph_block_clock_edges(
-  RRGraphBuilder& rr_graph_builder, size_t& num_edges_to_create,
+static void find_rr_graph_block_clock_edges(
+  std::vector<std::pair<RRNodeId, RRNodeId>>& clock_edges,
   const RRClockSpatialLookup& clk_rr_lookup, const RRGraphView& rr_graph_view,
   const DeviceGrid& grids, const ClockNetwork& clk_ntwk,
-  const vtr::Point<size_t>& chan_coord, const t_rr_type& chan_type,
-  const bool& verbose) {
-  size_t edge_count = 0;
+  const ClockTapPinLookup& tap_pin_lookup,
+  const vtr::Point<size_t>& chan_coord, const t_rr_type& chan_type) {
   for (auto itree : clk_ntwk.trees()) {
     for (auto ilvl : clk_ntwk.levels(itree)) {
       /* As we want to keep uni-directional wires, clock routing tracks have to
@@ -508,51 +550,28 @@ static void add_rr_graph_block_clock_edges(
           RRNodeId src_node =
             clk_rr_lookup.find_node(chan_coord.x(), chan_coord.y(), itree, ilvl,
                                     ClockTreePinId(ipin), node_dir);
-          VTR_LOGV(verbose,
-                   "Try to find node '%lu' from clock node lookup (x='%lu' "
-                   "y='%lu' tree='%lu' level='%lu' pin='%lu' direction='%s')\n",
-                   size_t(src_node), chan_coord.x(), chan_coord.y(),
-                   size_t(itree), size_t(ilvl), size_t(ipin),
-                   DIRECTION_STRING[size_t(node_dir)]);
           VTR_ASSERT(rr_graph_view.valid_node(src_node));
           /* find the fan-out clock node through lookup */
-          {
-            size_t curr_edge_count = edge_count;
-            for (RRNodeId des_node : find_clock_track2track_node(
-                   rr_graph_view, clk_ntwk, clk_rr_lookup, chan_type,
-                   chan_coord, itree, ilvl, ClockTreePinId(ipin), node_dir)) {
-              /* Create edges */
-              VTR_ASSERT(rr_graph_view.valid_node(des_node));
-              rr_graph_builder.create_edge(src_node, des_node,
-                                           clk_ntwk.default_switch());
-              edge_count++;
-            }
-            VTR_LOGV(verbose, "\tWill add %lu edges to other clock nodes\n",
-                     edge_count - curr_edge_count);
+          for (RRNodeId des_node : find_clock_track2track_node(
+                 rr_graph_view, clk_ntwk, clk_rr_lookup, chan_type, chan_coord,
+                 itree, ilvl, ClockTreePinId(ipin), node_dir)) {
+            VTR_ASSERT(rr_graph_view.valid_node(des_node));
+            clock_edges.push_back(std::make_pair(src_node, des_node));
           }
           /* If this is the clock node at the last level of the tree,
            * should drive some grid IPINs which are clocks */
           if (clk_ntwk.is_last_level(itree, ilvl)) {
-            size_t curr_edge_count = edge_count;
             for (RRNodeId des_node : find_clock_track2ipin_node(
-                   grids, rr_graph_view, chan_type, chan_coord, clk_ntwk, itree,
-                   ClockTreePinId(ipin))) {
-              /* Create edges */
+                   grids, rr_graph_view, chan_type, chan_coord, tap_pin_lookup,
+                   itree, ClockTreePinId(ipin))) {
               VTR_ASSERT(rr_graph_view.valid_node(des_node));
-              rr_graph_builder.create_edge(src_node, des_node,
-                                           clk_ntwk.default_switch());
-              edge_count++;
+              clock_edges.push_back(std::make_pair(src_node, des_node));
             }
-            VTR_LOGV(verbose, "\tWill add %lu edges to other IPIN\n",
-                     edge_count - curr_edge_count);
           }
         }
       }
     }
   }
-  /* Allocate edges */
-  rr_graph_builder.build_edges(true);
-  num_edges_to_create += edge_count;
 }
 
 /********************************************************************
@@ -575,12 +594,21 @@ static void add_rr_graph_block_clock_edges(
  *                                     |
  *                                     v
  *                            clk0_lvl1_chany[1][1]
+ *
+ * The edges of each connection block are found in parallel and then
+ * created in the same order as the connection blocks are visited, so that
+ * the routing resource graph does not depend on the number of threads
  *******************************************************************/
 static void add_rr_graph_clock_edges(
   RRGraphBuilder& rr_graph_builder, size_t& num_edges_to_create,
   const RRClockSpatialLookup& clk_rr_lookup, const RRGraphView& rr_graph_view,
-  const DeviceGrid& grids, const bool& through_channel,
-  const ClockNetwork& clk_ntwk, const bool& verbose) {
+  const DeviceGrid& grids,
+  const std::vector<t_physical_tile_type>& physical_tile_types,
+  const bool& through_channel, const ClockNetwork& clk_ntwk,
+  const size_t& num_threads, const bool& verbose) {
+  /* Collect the connection blocks whose clock nodes drive edges */
+  std::vector<vtr::Point<size_t>> chan_coords;
+  std::vector<t_rr_type> chan_types;
   /* Add edges which is driven by X-direction clock routing tracks */
   for (size_t iy = 0; iy < grids.height() - 1; ++iy) {
     for (size_t ix = 1; ix < grids.width() - 1; ++ix) {
@@ -591,9 +619,8 @@ static void add_rr_graph_clock_edges(
           (false == is_chanx_exist(grids, chanx_coord))) {
         continue;
       }
-      add_rr_graph_block_clock_edges(rr_graph_builder, num_edges_to_create,
-                                     clk_rr_lookup, rr_graph_view, grids,
-                                     clk_ntwk, chanx_coord, CHANX, verbose);
+      chan_coords.push_back(chanx_coord);
+      chan_types.push_back(CHANX);
     }
   }
 
@@ -607,11 +634,43 @@ static void add_rr_graph_clock_edges(
           (false == is_chany_exist(grids, chany_coord))) {
         continue;
       }
-      add_rr_graph_block_clock_edges(rr_graph_builder, num_edges_to_create,
-                                     clk_rr_lookup, rr_graph_view, grids,
-                                     clk_ntwk, chany_coord, CHANY, verbose);
+      chan_coords.push_back(chany_coord);
+      chan_types.push_back(CHANY);
+    }
+  }
+
+  ClockTapPinLookup tap_pin_lookup =
+    build_clock_tap_pin_lookup(physical_tile_types, clk_ntwk);
+
+  VTR_LOGV(verbose,
+           "Find clock edges of %lu connection blocks with %lu threads\n",
+           chan_coords.size(),
+           find_num_threads(num_threads, chan_coords.size()));
+
+  std::vector<std::vector<std::pair<RRNodeId, RRNodeId>>> block_clock_edges(
+    chan_coords.size());
+  parallel_for(chan_coords.size(), num_threads, [&](const size_t& iblk) {
+    find_rr_graph_block_clock_edges(block_clock_edges[iblk], clk_rr_lookup,
+                                    rr_graph_view, grids, clk_ntwk,
+                                    tap_pin_lookup, chan_coords[iblk],
+                                    chan_types[iblk]);
+  });
+
+  /* Create edges */
+  for (size_t iblk = 0; iblk < chan_coords.size(); ++iblk) {
+    VTR_LOGV(verbose, "Will add %lu edges for clock nodes of %s[%lu][%lu]\n",
+             block_clock_edges[iblk].size(),
+             rr_node_typename[chan_types[iblk]], chan_coords[iblk].x(),
+             chan_coords[iblk].y());
+    for (const std::pair<RRNodeId, RRNodeId>& clock_edge :
+         block_clock_edges[iblk]) {
+      rr_graph_builder.create_edge(clock_edge.first, clock_edge.second,
+                                   clk_ntwk.default_switch());
     }
+    num_edges_to_create += block_clock_edges[iblk].size();
   }
+  /* Allocate edges */
+  rr_graph_builder.build_edges(true);
 }
 
 /********************************************************************
@@ -624,7 +683,8 @@ static void add_rr_graph_clock_edges(
  *******************************************************************/
 int append_clock_rr_graph(DeviceContext& vpr_device_ctx,
                           RRClockSpatialLookup& clk_rr_lookup,
-                          const ClockNetwork& clk_ntwk, const bool& verbose) {
+                          const ClockNetwork& clk_ntwk,
+                          const size_t& num_threads, const bool& verbose) {
   vtr::ScopedStartFinishTimer timer(
     "Appending programmable clock network to routing resource graph");
 
@@ -674,7 +734,8 @@ int append_clock_rr_graph(DeviceContext& vpr_device_ctx,
     vpr_device_ctx.rr_graph_builder, num_clock_edges,
     static_cast<const RRClockSpatialLookup&>(clk_rr_lookup),
     vpr_device_ctx.rr_graph, vpr_device_ctx.grid,
-    vpr_device_ctx.arch->through_channel, clk_ntwk, verbose);
+    vpr_device_ctx.physical_tile_types, vpr_device_ctx.arch->through_channel,
+    clk_ntwk, num_threads, verbose);
   VTR_LOGV(verbose,
            "Added %lu clock edges to routing "
            "resource graph.\n",
@@ -3,6 +3,10 @@
  ***********************************************************************/
 #include "device_rr_gsb.h"
 
+#include <algorithm>
+#include <functional>
+
+#include "openfpga_parallel.h"
 #include "rr_gsb_utils.h"
 #include "vtr_assert.h"
 #include "vtr_log.h"
@@ -175,6 +179,65 @@ const RRGSB& DeviceRRGSB::get_sb_unique_module(
   return get_sb_unique_module(sb_unique_module_id);
 }
 
+/* Get the index of the unique mirror of a GSB with a coordinate */
+size_t DeviceRRGSB::get_gsb_unique_module_index(
+  const vtr::Point<size_t>& coordinate) const {
+  VTR_ASSERT(validate_coordinate(coordinate));
+  return gsb_unique_module_id_[coordinate.x()][coordinate.y()];
+}
+
+/* Get the index of the unique mirror of a switch block with a coordinate */
+size_t DeviceRRGSB::get_sb_unique_module_index(
+  const vtr::Point<size_t>& coordinate) const {
+  VTR_ASSERT(validate_coordinate(coordinate));
+  return sb_unique_module_id_[coordinate.x()][coordinate.y()];
+}
+
+/* Get the index of the unique mirror of a connection block with a coordinate */
+size_t DeviceRRGSB::get_cb_unique_module_index(
+  const t_rr_type& cb_type, const vtr::Point<size_t>& coordinate) const {
+  VTR_ASSERT(validate_cb_type(cb_type));
+  VTR_ASSERT(validate_coordinate(coordinate));
+  switch (cb_type) {
+    case CHANX:
+      return cbx_unique_module_id_[coordinate.x()][coordinate.y()];
+    case CHANY:
+      return cby_unique_module_id_[coordinate.x()][coordinate.y()];
+    default:
+      VTR_LOG_ERROR("Invalid type of connection block!\n");
+      exit(1);
+  }
+}
+
+/* Get the coordinate of a unique mirror of GSB */
+vtr::Point<size_t> DeviceRRGSB::get_gsb_unique_module_coordinate(
+  const size_t& index) const {
+  VTR_ASSERT(validate_gsb_unique_module_index(index));
+  return gsb_unique_module_[index];
+}
+
+/* Get the coordinate of a unique mirror of switch block */
+vtr::Point<size_t> DeviceRRGSB::get_sb_unique_module_coordinate(
+  const size_t& index) const {
+  VTR_ASSERT(validate_sb_unique_module_index(index));
+  return sb_unique_module_[index];
+}
+
+/* Get the coordinate of a unique mirror of connection block */
+vtr::Point<size_t> DeviceRRGSB::get_cb_unique_module_coordinate(
+  const t_rr_type& cb_type, const size_t& index) const {
+  VTR_ASSERT(validate_cb_unique_module_index(cb_type, index));
+  switch (cb_type) {
+    case CHANX:
+      return cbx_unique_module_[index];
+    case CHANY:
+      return cby_unique_module_[index];
+    default:
+      VTR_LOG_ERROR("Invalid type of connection block!\n");
+      exit(1);
+  }
+}
+
 /************************************************************************
  * Public mutators
  ***********************************************************************/
@@ -245,83 +308,144 @@ RRGSB& DeviceRRGSB::get_mutable_gsb(const size_t& x, const size_t& y) {
   return get_mutable_gsb(coordinate);
 }
 
+/************************************************************************
+ * Identify the unique modules among a list of candidates.
+ * Candidates are visited in order. A candidate is a mirror of the first
+ * unique module (in the order of ids) which it matches, otherwise it becomes
+ * a new unique module. This is the same as a serial search, so that the
+ * unique modules and their ids do not depend on the number of threads.
+ *
+ * To run in parallel, candidates are processed in batches:
+ * - All the candidates of a batch are compared against the unique modules
+ *   found before the batch, concurrently.
+ * - The candidates which do not match any of them are then compared against
+ *   the unique modules found inside the batch, in order.
+ * A candidate matching any unique module found before the batch has the same
+ * result as a serial search, since those modules have smaller ids.
+ ***********************************************************************/
+static void find_unique_modules(
+  const std::vector<vtr::Point<size_t>>& candidates,
+  const std::function<bool(const vtr::Point<size_t>&,
+                           const vtr::Point<size_t>&)>& is_mirror,
+  const size_t& num_threads, std::vector<vtr::Point<size_t>>& unique_modules,
+  std::vector<size_t>& unique_module_ids) {
+  unique_modules.clear();
+  unique_module_ids.assign(candidates.size(), size_t(-1));
+
+  size_t num_workers = find_num_threads(num_threads, candidates.size());
+  /* Large batches keep the threads busy, while small batches limit the
+   * comparisons among the new unique modules in the serial part */
+  size_t batch_size = 1 == num_workers ? 1 : 16 * num_workers;
+
+  for (size_t batch_begin = 0; batch_begin < candidates.size();
+       batch_begin += batch_size) {
+    size_t batch_end = std::min(batch_begin + batch_size, candidates.size());
+    size_t num_prev_unique_modules = unique_modules.size();
+
+    parallel_for(
+      batch_end - batch_begin, num_workers, [&](const size_t& ijob) {
+        size_t icand = batch_begin + ijob;
+        for (size_t id = 0; id < num_prev_unique_modules; ++id) {
+          if (true == is_mirror(unique_modules[id], candidates[icand])) {
+            unique_module_ids[icand] = id;
+            break;
+          }
+        }
+      });
+
+    for (size_t icand = batch_begin; icand < batch_end; ++icand) {
+      if (size_t(-1) != unique_module_ids[icand]) {
+        continue;
+      }
+      for (size_t id = num_prev_unique_modules; id < unique_modules.size();
+           ++id) {
+        if (true == is_mirror(unique_modules[id], candidates[icand])) {
+          unique_module_ids[icand] = id;
+          break;
+        }
+      }
+      /* Add to list if this is a unique mirror*/
+      if (size_t(-1) == unique_module_ids[icand]) {
+        unique_modules.push_back(candidates[icand]);
+        unique_module_ids[icand] = unique_modules.size() - 1;
+      }
+    }
+  }
+}
+
 /* Add a switch block to the array, which will automatically identify and update
  * the lists of unique mirrors and rotatable mirrors */
 void DeviceRRGSB::build_cb_unique_module(const RRGraphView& rr_graph,
-                                         const t_rr_type& cb_type) {
+                                         const t_rr_type& cb_type,
+                                         const size_t& num_threads) {
   /* Make sure a clean start */
   clear_cb_unique_module(cb_type);
 
+  std::vector<vtr::Point<size_t>> candidates;
   for (size_t ix = 0; ix < rr_gsb_.size(); ++ix) {
     for (size_t iy = 0; iy < rr_gsb_[ix].size(); ++iy) {
-      bool is_unique_module = true;
-      vtr::Point<size_t> gsb_coordinate(ix, iy);
-
       /* Bypass non-exist CB */
       if (false == rr_gsb_[ix][iy].is_cb_exist(cb_type)) {
         continue;
       }
-
-      /* Traverse the unique_mirror list and check it is an mirror of another */
-      for (size_t id = 0; id < get_num_cb_unique_module(cb_type); ++id) {
-        const RRGSB& unique_module = get_cb_unique_module(cb_type, id);
-        if (true == is_cb_mirror(rr_graph, device_annotation_, rr_gsb_[ix][iy],
-                                 unique_module, cb_type)) {
-          /* This is a mirror, raise the flag and we finish */
-          is_unique_module = false;
-          /* Record the id of unique mirror */
-          set_cb_unique_module_id(cb_type, gsb_coordinate, id);
-          break;
-        }
-      }
-      /* Add to list if this is a unique mirror*/
-      if (true == is_unique_module) {
-        add_cb_unique_module(cb_type, gsb_coordinate);
-        /* Record the id of unique mirror */
-        set_cb_unique_module_id(cb_type, gsb_coordinate,
-                                get_num_cb_unique_module(cb_type) - 1);
-      }
+      candidates.push_back(vtr::Point<size_t>(ix, iy));
     }
   }
+
+  std::vector<vtr::Point<size_t>> unique_modules;
+  std::vector<size_t> unique_module_ids;
+  find_unique_modules(
+    candidates,
+    [&](const vtr::Point<size_t>& base, const vtr::Point<size_t>& cand) {
+      return is_cb_mirror(rr_graph, device_annotation_,
+                          rr_gsb_[base.x()][base.y()],
+                          rr_gsb_[cand.x()][cand.y()], cb_type);
+    },
+    num_threads, unique_modules, unique_module_ids);
+
+  for (const vtr::Point<size_t>& unique_module : unique_modules) {
+    add_cb_unique_module(cb_type, unique_module);
+  }
+  for (size_t icand = 0; icand < candidates.size(); ++icand) {
+    /* Record the id of unique mirror */
+    set_cb_unique_module_id(cb_type, candidates[icand],
+                            unique_module_ids[icand]);
+  }
 }
 
 /* Add a switch block to the array, which will automatically identify and update
  * the lists of unique mirrors and rotatable mirrors */
-void DeviceRRGSB::build_sb_unique_module(const RRGraphView& rr_graph) {
+void DeviceRRGSB::build_sb_unique_module(const RRGraphView& rr_graph,
+                                         const size_t& num_threads) {
   /* Make sure a clean start */
   clear_sb_unique_module();
 
-  /* Build the unique module */
+  std::vector<vtr::Point<size_t>> candidates;
   for (size_t ix = 0; ix < rr_gsb_.size(); ++ix) {
     for (size_t iy = 0; iy < rr_gsb_[ix].size(); ++iy) {
-      bool is_unique_module = true;
-      vtr::Point<size_t> sb_coordinate(ix, iy);
-
-      /* Traverse the unique_mirror list and check it is an mirror of another */
-      for (size_t id = 0; id < get_num_sb_unique_module(); ++id) {
-        /* Check if the two modules have the same submodules,
-         * if so, these two modules are the same, indicating the sb is not
-         * unique. else the sb is unique
-         */
-        const RRGSB& unique_module = get_sb_unique_module(id);
-        if (true == is_sb_mirror(rr_graph, device_annotation_, rr_gsb_[ix][iy],
-                                 unique_module)) {
-          /* This is a mirror, raise the flag and we finish */
-          is_unique_module = false;
-          /* Record the id of unique mirror */
-          sb_unique_module_id_[ix][iy] = id;
-          break;
-        }
-      }
-
-      /* Add to list if this is a unique mirror*/
-      if (true == is_unique_module) {
-        sb_unique_module_.push_back(sb_coordinate);
-        /* Record the id of unique mirror */
-        sb_unique_module_id_[ix][iy] = sb_unique_module_.size() - 1;
-      }
+      candidates.push_back(vtr::Point<size_t>(ix, iy));
     }
   }
+
+  /* Check if the two modules have the same submodules,
+   * if so, these two modules are the same, indicating the sb is not
+   * unique. else the sb is unique
+   */
+  std::vector<size_t> unique_module_ids;
+  find_unique_modules(
+    candidates,
+    [&](const vtr::Point<size_t>& base, const vtr::Point<size_t>& cand) {
+      return is_sb_mirror(rr_graph, device_annotation_,
+                          rr_gsb_[base.x()][base.y()],
+                          rr_gsb_[cand.x()][cand.y()]);
+    },
+    num_threads, sb_unique_module_, unique_module_ids);
+
+  for (size_t icand = 0; icand < candidates.size(); ++icand) {
+    /* Record the id of unique mirror */
+    sb_unique_module_id_[candidates[icand].x()][candidates[icand].y()] =
+      unique_module_ids[icand];
+  }
 }
 
 /* Add a switch block to the array, which will automatically identify and update
@@ -371,11 +495,12 @@ void DeviceRRGSB::build_gsb_unique_module() {
   }
 }
 
-void DeviceRRGSB::build_unique_module(const RRGraphView& rr_graph) {
-  build_sb_unique_module(rr_graph);
+void DeviceRRGSB::build_unique_module(const RRGraphView& rr_graph,
+                                      const size_t& num_threads) {
+  build_sb_unique_module(rr_graph, num_threads);
 
-  build_cb_unique_module(rr_graph, CHANX);
-  build_cb_unique_module(rr_graph, CHANY);
+  build_cb_unique_module(rr_graph, CHANX, num_threads);
+  build_cb_unique_module(rr_graph, CHANY, num_threads);
 
   build_gsb_unique_module();
 }
@@ -419,6 +544,55 @@ void DeviceRRGSB::set_cb_unique_module_id(const t_rr_type& cb_type,
   }
 }
 
+/* Restore the unique GSB list and the id matrix from an external source.
+ * Note that the GSB array should have been built and its size should be
+ * consistent with the id matrix */
+void DeviceRRGSB::preload_gsb_unique_module(
+  const std::vector<vtr::Point<size_t>>& unique_module_coords,
+  const std::vector<std::vector<size_t>>& unique_module_ids) {
+  VTR_ASSERT(unique_module_ids.size() == rr_gsb_.size());
+  for (const vtr::Point<size_t>& coord : unique_module_coords) {
+    VTR_ASSERT(validate_coordinate(coord));
+  }
+  gsb_unique_module_ = unique_module_coords;
+  gsb_unique_module_id_ = unique_module_ids;
+}
+
+void DeviceRRGSB::preload_sb_unique_module(
+  const std::vector<vtr::Point<size_t>>& unique_module_coords,
+  const std::vector<std::vector<size_t>>& unique_module_ids) {
+  VTR_ASSERT(unique_module_ids.size() == rr_gsb_.size());
+  for (const vtr::Point<size_t>& coord : unique_module_coords) {
+    VTR_ASSERT(validate_coordinate(coord));
+  }
+  sb_unique_module_ = unique_module_coords;
+  sb_unique_module_id_ = unique_module_ids;
+}
+
+void DeviceRRGSB::preload_cb_unique_module(
+  const t_rr_type& cb_type,
+  const std::vector<vtr::Point<size_t>>& unique_module_coords,
+  const std::vector<std::vector<size_t>>& unique_module_ids) {
+  VTR_ASSERT(validate_cb_type(cb_type));
+  VTR_ASSERT(unique_module_ids.size() == rr_gsb_.size());
+  for (const vtr::Point<size_t>& coord : unique_module_coords) {
+    VTR_ASSERT(validate_coordinate(coord));
+  }
+  switch (cb_type) {
+    case CHANX:
+      cbx_unique_module_ = unique_module_coords;
+      cbx_unique_module_id_ = unique_module_ids;
+      return;
+    case CHANY:
+      cby_unique_module_ = unique_module_coords;
+      cby_unique_module_id_ = unique_module_ids;
+      return;
+    default:
+      VTR_LOG_ERROR("Invalid type of connection block!\n");
+      exit(1);
+  }
+}
+
 /************************************************************************
  * Public clean-up functions:
  ***********************************************************************/
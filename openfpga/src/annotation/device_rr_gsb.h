@@ -59,6 +59,18 @@ class DeviceRRGSB {
   size_t get_num_cb_unique_module(const t_rr_type& cb_type)
     const; /* get the number of unique mirrors of CBs */
   bool is_gsb_exist(const vtr::Point<size_t> coord) const;
+  /* Get the index of the unique mirror of a GSB/SB/CB with a coordinate */
+  size_t get_gsb_unique_module_index(
+    const vtr::Point<size_t>& coordinate) const;
+  size_t get_sb_unique_module_index(const vtr::Point<size_t>& coordinate) const;
+  size_t get_cb_unique_module_index(const t_rr_type& cb_type,
+                                    const vtr::Point<size_t>& coordinate) const;
+  /* Get the coordinate of a unique mirror of GSB/SB/CB */
+  vtr::Point<size_t> get_gsb_unique_module_coordinate(
+    const size_t& index) const;
+  vtr::Point<size_t> get_sb_unique_module_coordinate(const size_t& index) const;
+  vtr::Point<size_t> get_cb_unique_module_coordinate(const t_rr_type& cb_type,
+                                                     const size_t& index) const;
 
  public: /* Mutators */
   void reserve(
@@ -82,10 +94,25 @@ class DeviceRRGSB {
   RRGSB& get_mutable_gsb(
     const size_t& x,
     const size_t& y); /* Get a rr switch block in the array with a coordinate */
-  void build_unique_module(
-    const RRGraphView& rr_graph); /* Add a switch block to the array, which will
-                                     automatically identify and update the lists
-                                     of unique mirrors and rotatable mirrors */
+  /* Identify the unique mirrors of switch blocks and connection blocks.
+   * Comparisons are run on a number of threads (0 means all the hardware
+   * threads), while the unique modules and their ids are the same as a serial
+   * run */
+  void build_unique_module(const RRGraphView& rr_graph,
+                           const size_t& num_threads);
+  /* Restore the unique module lists from a previous run (e.g., a fabric
+   * snapshot) instead of identifying them again. The GSB array must have been
+   * built already and the id matrix should be in the same size */
+  void preload_gsb_unique_module(
+    const std::vector<vtr::Point<size_t>>& unique_module_coords,
+    const std::vector<std::vector<size_t>>& unique_module_ids);
+  void preload_sb_unique_module(
+    const std::vector<vtr::Point<size_t>>& unique_module_coords,
+    const std::vector<std::vector<size_t>>& unique_module_ids);
+  void preload_cb_unique_module(
+    const t_rr_type& cb_type,
+    const std::vector<vtr::Point<size_t>>& unique_module_coords,
+    const std::vector<std::vector<size_t>>& unique_module_ids);
   void clear();                   /* clean the content */
  private:                         /* Internal cleaners */
   void clear_gsb();               /* clean the content */
@@ -117,14 +144,15 @@ class DeviceRRGSB {
   void set_cb_unique_module_id(const t_rr_type& cb_type,
                                const vtr::Point<size_t>& coordinate, size_t id);
   void build_sb_unique_module(
-    const RRGraphView& rr_graph); /* Add a switch block to the array, which will
-                                     automatically identify and update the lists
-                                     of unique mirrors and rotatable mirrors */
-  void build_cb_unique_module(
     const RRGraphView& rr_graph,
-    const t_rr_type&
-      cb_type); /* Add a switch block to the array, which will automatically
-                   identify and update the lists of unique side module */
+    const size_t& num_threads); /* Add a switch block to the array, which will
+                                   automatically identify and update the lists
+                                   of unique mirrors and rotatable mirrors */
+  void build_cb_unique_module(
+    const RRGraphView& rr_graph, const t_rr_type& cb_type,
+    const size_t& num_threads); /* Add a switch block to the array, which will
+                                   automatically identify and update the lists
+                                   of unique side module */
   void build_gsb_unique_module(); /* Add a switch block to the array, which will
                                      automatically identify and update the lists
                                      of unique mirrors and rotatable mirrors */
@@ -1,7 +1,12 @@
 #include "route_clock_rr_graph.h"
 
+#include <algorithm>
+#include <set>
+#include <tuple>
+
 #include "command_exit_codes.h"
 #include "openfpga_atom_netlist_utils.h"
+#include "vpr_utils.h"
 #include "vtr_assert.h"
 #include "vtr_geometry.h"
 #include "vtr_log.h"
@@ -10,6 +15,11 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
+/* A lookup from a pin of a placed block, i.e., (x, y, pin index), to the
+ * clock net mapped to it */
+typedef std::map<std::tuple<size_t, size_t, int>, ClusterNetId>
+  ClockTilePinNetMap;
+
 /********************************************************************
  * Build the lookup between clock name and pins and clock tree pins
  * This is required for routing clock nets in each clock tree
@@ -77,29 +87,166 @@ static int build_clock_tree_net_map(
   return CMD_EXEC_SUCCESS;
 }
 
+/********************************************************************
+ * Build the lookup between the pins of placed blocks and the clock nets,
+ * which is required to find the IPINs that are actually used by the clock
+ * nets. A pin is indexed by the root coordinate of its tile and its pin
+ * index in the physical tile
+ *******************************************************************/
+static ClockTilePinNetMap build_clock_tile_pin_net_map(
+  const DeviceGrid& grids, const ClusteredNetlist& cluster_nlist,
+  const PlacementContext& vpr_place_ctx,
+  const std::map<ClockTreePinId, ClusterNetId>& tree2clk_pin_map) {
+  ClockTilePinNetMap tile_pin_nets;
+  for (const auto& pin_net : tree2clk_pin_map) {
+    for (ClusterPinId sink_pin : cluster_nlist.net_sinks(pin_net.second)) {
+      ClusterBlockId blk_id = cluster_nlist.pin_block(sink_pin);
+      t_pl_loc blk_loc = vpr_place_ctx.block_locs[blk_id].loc;
+      t_physical_tile_type_ptr physical_tile = grids[blk_loc.x][blk_loc.y].type;
+      t_logical_block_type_ptr logical_block = cluster_nlist.block_type(blk_id);
+      /* Consider the z offset of the block in the tile, same as the pin
+       * mapping of the clustered blocks */
+      int physical_pin =
+        blk_loc.sub_tile * logical_block->pb_type->num_pins +
+        get_physical_pin(physical_tile, logical_block,
+                         cluster_nlist.pin_logical_index(sink_pin));
+      tile_pin_nets[std::make_tuple(size_t(blk_loc.x), size_t(blk_loc.y),
+                                    physical_pin)] = pin_net.second;
+    }
+  }
+  return tile_pin_nets;
+}
+
+/********************************************************************
+ * Identify if an IPIN is mapped to a given clock net
+ *******************************************************************/
+static bool is_clock_ipin_used(const RRGraphView& rr_graph,
+                               const DeviceGrid& grids,
+                               const ClockTilePinNetMap& tile_pin_nets,
+                               const RRNodeId& ipin_node,
+                               const ClusterNetId& clk_net) {
+  size_t x = rr_graph.node_xlow(ipin_node);
+  size_t y = rr_graph.node_ylow(ipin_node);
+  /* The pins are indexed by the root coordinate of a tile */
+  size_t root_x = x - grids[x][y].width_offset;
+  size_t root_y = y - grids[x][y].height_offset;
+  auto result = tile_pin_nets.find(
+    std::make_tuple(root_x, root_y, int(rr_graph.node_pin_num(ipin_node))));
+  if (result == tile_pin_nets.end()) {
+    return false;
+  }
+  return result->second == clk_net;
+}
+
+/********************************************************************
+ * Find the last coordinate of a spine which should be routed for a clock
+ * pin, so that the spine can reach all the used IPINs either directly or
+ * through the spines it switches to. Return -1 if the spine is not used.
+ * The results are cached as a spine can be visited through different paths
+ *******************************************************************/
+static int rec_find_clock_spine_usage(
+  std::map<ClockSpineId, int>& spine_usage, const RRGraphView& rr_graph,
+  const DeviceGrid& grids, const RRClockSpatialLookup& clk_rr_lookup,
+  const ClockTilePinNetMap& tile_pin_nets, const ClockNetwork& clk_ntwk,
+  const ClockTreeId& clk_tree, const ClockSpineId& clk_spine,
+  const ClockTreePinId& clk_pin, const ClusterNetId& clk_net) {
+  auto result = spine_usage.find(clk_spine);
+  if (result != spine_usage.end()) {
+    return result->second;
+  }
+  /* Mark as unused first, in case that there are loops between spines */
+  spine_usage[clk_spine] = -1;
+
+  int last_coord = -1;
+  std::vector<vtr::Point<int>> spine_coords =
+    clk_ntwk.spine_coordinates(clk_spine);
+  if (clk_ntwk.is_last_level(clk_spine)) {
+    for (size_t icoord = 0; icoord < spine_coords.size(); ++icoord) {
+      RRNodeId src_node = clk_rr_lookup.find_node(
+        spine_coords[icoord].x(), spine_coords[icoord].y(), clk_tree,
+        clk_ntwk.spine_level(clk_spine), clk_pin,
+        clk_ntwk.spine_direction(clk_spine));
+      for (RREdgeId edge : rr_graph.edge_range(src_node)) {
+        RRNodeId des_node = rr_graph.edge_sink_node(edge);
+        if (rr_graph.node_type(des_node) == IPIN &&
+            is_clock_ipin_used(rr_graph, grids, tile_pin_nets, des_node,
+                               clk_net)) {
+          last_coord = std::max(last_coord, int(icoord));
+          break;
+        }
+      }
+    }
+  }
+  for (ClockSwitchPointId switch_point_id :
+       clk_ntwk.spine_switch_points(clk_spine)) {
+    ClockSpineId des_spine =
+      clk_ntwk.spine_switch_point_tap(clk_spine, switch_point_id);
+    if (0 > rec_find_clock_spine_usage(spine_usage, rr_graph, grids,
+                                       clk_rr_lookup, tile_pin_nets, clk_ntwk,
+                                       clk_tree, des_spine, clk_pin, clk_net)) {
+      continue;
+    }
+    auto switch_coord = std::find(
+      spine_coords.begin(), spine_coords.end(),
+      clk_ntwk.spine_switch_point(clk_spine, switch_point_id));
+    VTR_ASSERT(switch_coord != spine_coords.end());
+    last_coord = std::max(
+      last_coord, int(std::distance(spine_coords.begin(), switch_coord)));
+  }
+
+  spine_usage[clk_spine] = last_coord;
+  return last_coord;
+}
+
 /********************************************************************
  * Route a clock tree on an existing routing resource graph
  * The strategy is to route spine one by one
  * - route the spine from the starting point to the ending point
  * - route the spine-to-spine switching points
  * - route the spine-to-IPIN connections (only for the last level)
+ * When unused spines are disabled, only the part of spines which reach the
+ * IPINs used by the clock nets is routed, while the other spines are left
+ * unconfigured. The number of spines which are not routed for each clock pin
+ * is accumulated to num_disabled_spines
  *******************************************************************/
 static int route_clock_tree_rr_graph(
   VprRoutingAnnotation& vpr_routing_annotation, const RRGraphView& rr_graph,
-  const RRClockSpatialLookup& clk_rr_lookup,
+  const DeviceGrid& grids, const RRClockSpatialLookup& clk_rr_lookup,
   const std::map<ClockTreePinId, ClusterNetId>& tree2clk_pin_map,
-  const ClockNetwork& clk_ntwk, const ClockTreeId& clk_tree,
+  const ClockTilePinNetMap& tile_pin_nets, const ClockNetwork& clk_ntwk,
+  const ClockTreeId& clk_tree, const bool& disable_unused_spines,
+  std::set<RRNodeId>& configured_nodes, size_t& num_disabled_spines,
   const bool& verbose) {
+  /* Usage of spines for each clock pin */
+  std::map<ClockTreePinId, std::map<ClockSpineId, int>> spine_usage;
   for (auto ispine : clk_ntwk.spines(clk_tree)) {
     VTR_LOGV(verbose, "Routing spine '%s'...\n",
              clk_ntwk.spine_name(ispine).c_str());
+    std::vector<vtr::Point<int>> spine_coords =
+      clk_ntwk.spine_coordinates(ispine);
     for (auto ipin : clk_ntwk.pins(clk_tree)) {
+      /* By default, route the full spine */
+      int last_coord = int(spine_coords.size()) - 1;
+      if (disable_unused_spines) {
+        /* No net is mapped to the clock pin, the spine is not used */
+        if (tree2clk_pin_map.find(ipin) == tree2clk_pin_map.end()) {
+          num_disabled_spines++;
+          continue;
+        }
+        last_coord = rec_find_clock_spine_usage(
+          spine_usage[ipin], rr_graph, grids, clk_rr_lookup, tile_pin_nets,
+          clk_ntwk, clk_tree, ispine, ipin, tree2clk_pin_map.at(ipin));
+        if (0 > last_coord) {
+          VTR_LOGV(verbose, "Skip unused spine '%s' for clock pin '%lu'\n",
+                   clk_ntwk.spine_name(ispine).c_str(), size_t(ipin));
+          num_disabled_spines++;
+          continue;
+        }
+      }
       /* Route the spine from starting point to ending point */
-      std::vector<vtr::Point<int>> spine_coords =
-        clk_ntwk.spine_coordinates(ispine);
       VTR_LOGV(verbose, "Routing backbone of spine '%s'...\n",
                clk_ntwk.spine_name(ispine).c_str());
-      for (size_t icoord = 0; icoord < spine_coords.size() - 1; ++icoord) {
+      for (int icoord = 0; icoord < last_coord; ++icoord) {
         vtr::Point<int> src_coord = spine_coords[icoord];
         vtr::Point<int> des_coord = spine_coords[icoord + 1];
         Direction src_spine_direction = clk_ntwk.spine_direction(ispine);
@@ -116,6 +263,7 @@ static int route_clock_tree_rr_graph(
         VTR_ASSERT(rr_graph.valid_node(des_node));
         vpr_routing_annotation.set_rr_node_prev_node(rr_graph, des_node,
                                                      src_node);
+        configured_nodes.insert(des_node);
       }
       /* Route the spine-to-spine switching points */
       VTR_LOGV(verbose, "Routing switch points of spine '%s'...\n",
@@ -126,6 +274,13 @@ static int route_clock_tree_rr_graph(
           clk_ntwk.spine_switch_point(ispine, switch_point_id);
         ClockSpineId des_spine =
           clk_ntwk.spine_switch_point_tap(ispine, switch_point_id);
+        if (disable_unused_spines &&
+            0 > rec_find_clock_spine_usage(
+                  spine_usage[ipin], rr_graph, grids, clk_rr_lookup,
+                  tile_pin_nets, clk_ntwk, clk_tree, des_spine, ipin,
+                  tree2clk_pin_map.at(ipin))) {
+          continue;
+        }
         vtr::Point<int> des_coord = clk_ntwk.spine_start_point(des_spine);
         Direction src_spine_direction = clk_ntwk.spine_direction(ispine);
         Direction des_spine_direction = clk_ntwk.spine_direction(des_spine);
@@ -141,6 +296,7 @@ static int route_clock_tree_rr_graph(
         VTR_ASSERT(rr_graph.valid_node(des_node));
         vpr_routing_annotation.set_rr_node_prev_node(rr_graph, des_node,
                                                      src_node);
+        configured_nodes.insert(des_node);
         /* It could happen that there is no net mapped some clock pin, skip the
          * net mapping */
         if (tree2clk_pin_map.find(ipin) != tree2clk_pin_map.end()) {
@@ -155,7 +311,7 @@ static int route_clock_tree_rr_graph(
         VTR_LOGV(verbose, "Routing clock taps of spine '%s'...\n",
                  clk_ntwk.spine_name(ispine).c_str());
         /* Connect to any fan-out node which is IPIN */
-        for (size_t icoord = 0; icoord < spine_coords.size(); ++icoord) {
+        for (int icoord = 0; icoord <= last_coord; ++icoord) {
           vtr::Point<int> src_coord = spine_coords[icoord];
           Direction src_spine_direction = clk_ntwk.spine_direction(ispine);
           ClockLevelId src_spine_level = clk_ntwk.spine_level(ispine);
@@ -165,10 +321,16 @@ static int route_clock_tree_rr_graph(
           for (RREdgeId edge : rr_graph.edge_range(src_node)) {
             RRNodeId des_node = rr_graph.edge_sink_node(edge);
             if (rr_graph.node_type(des_node) == IPIN) {
+              if (disable_unused_spines &&
+                  !is_clock_ipin_used(rr_graph, grids, tile_pin_nets, des_node,
+                                      tree2clk_pin_map.at(ipin))) {
+                continue;
+              }
               VTR_ASSERT(rr_graph.valid_node(src_node));
               VTR_ASSERT(rr_graph.valid_node(des_node));
               vpr_routing_annotation.set_rr_node_prev_node(rr_graph, des_node,
                                                            src_node);
+              configured_nodes.insert(des_node);
               if (tree2clk_pin_map.find(ipin) != tree2clk_pin_map.end()) {
                 vpr_routing_annotation.set_rr_node_net(
                   src_node, tree2clk_pin_map.at(ipin));
@@ -195,9 +357,11 @@ int route_clock_rr_graph(VprRoutingAnnotation& vpr_routing_annotation,
                          const AtomContext& atom_ctx,
                          const ClusteredNetlist& cluster_nlist,
                          const VprNetlistAnnotation& netlist_annotation,
+                         const PlacementContext& vpr_place_ctx,
                          const RRClockSpatialLookup& clk_rr_lookup,
                          const ClockNetwork& clk_ntwk,
                          const PinConstraints& pin_constraints,
+                         const bool& disable_unused_spines,
                          const bool& verbose) {
   vtr::ScopedStartFinishTimer timer(
     "Route programmable clock network based on routing resource graph");
@@ -237,6 +401,10 @@ int route_clock_rr_graph(VprRoutingAnnotation& vpr_routing_annotation,
   }
 
   /* Route spines one by one */
+  std::set<RRNodeId> configured_nodes;
+  /* Spines are counted once per clock pin */
+  size_t num_spines = 0;
+  size_t num_disabled_spines = 0;
   for (auto itree : clk_ntwk.trees()) {
     VTR_LOGV(verbose, "Build clock name to clock tree '%s' pin mapping...\n",
              clk_ntwk.tree_name(itree).c_str());
@@ -249,17 +417,30 @@ int route_clock_rr_graph(VprRoutingAnnotation& vpr_routing_annotation,
       return status;
     }
 
+    ClockTilePinNetMap tile_pin_nets;
+    if (disable_unused_spines) {
+      tile_pin_nets = build_clock_tile_pin_net_map(
+        vpr_device_ctx.grid, cluster_nlist, vpr_place_ctx, tree2clk_pin_map);
+    }
+
     VTR_LOGV(verbose, "Routing clock tree '%s'...\n",
              clk_ntwk.tree_name(itree).c_str());
     status = route_clock_tree_rr_graph(
-      vpr_routing_annotation, vpr_device_ctx.rr_graph, clk_rr_lookup,
-      tree2clk_pin_map, clk_ntwk, itree, verbose);
+      vpr_routing_annotation, vpr_device_ctx.rr_graph, vpr_device_ctx.grid,
+      clk_rr_lookup, tree2clk_pin_map, tile_pin_nets, clk_ntwk, itree,
+      disable_unused_spines, configured_nodes, num_disabled_spines, verbose);
     if (status == CMD_EXEC_FATAL_ERROR) {
       return status;
     }
+    num_spines += clk_ntwk.spines(itree).size() * clk_ntwk.pins(itree).size();
     VTR_LOGV(verbose, "Done\n");
   }
 
+  VTR_LOG("Configured %lu clock routing multiplexers\n",
+          configured_nodes.size());
+  VTR_LOG("Disabled %lu unused spines out of %lu\n", num_disabled_spines,
+          num_spines);
+
   /* TODO: Sanity checks */
 
   return CMD_EXEC_SUCCESS;
@@ -23,9 +23,11 @@ int route_clock_rr_graph(VprRoutingAnnotation& vpr_routing_annotation,
                          const AtomContext& atom_ctx,
                          const ClusteredNetlist& cluster_nlist,
                          const VprNetlistAnnotation& netlist_annotation,
+                         const PlacementContext& vpr_place_ctx,
                          const RRClockSpatialLookup& clk_rr_lookup,
                          const ClockNetwork& clk_ntwk,
                          const PinConstraints& pin_constraints,
+                         const bool& disable_unused_spines,
                          const bool& verbose);
 
 } /* end namespace openfpga */
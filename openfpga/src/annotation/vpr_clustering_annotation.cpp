@@ -3,6 +3,8 @@
  ***********************************************************************/
 #include "vpr_clustering_annotation.h"
 
+#include <utility>
+
 #include "vtr_assert.h"
 #include "vtr_log.h"
 
@@ -20,17 +22,17 @@ VprClusteringAnnotation::VprClusteringAnnotation() { return; }
 bool VprClusteringAnnotation::is_net_renamed(const ClusterBlockId& block_id,
                                              const int& pin_index) const {
   /* Ensure that the block_id is in the list */
-  if (net_names_.end() == net_names_.find(block_id)) {
+  if ((size_t(block_id) >= net_renamed_.size()) || (0 > pin_index) ||
+      (size_t(pin_index) >= net_renamed_[block_id].size())) {
     return false;
   }
-  return (net_names_.at(block_id).end() !=
-          net_names_.at(block_id).find(pin_index));
+  return net_renamed_[block_id][pin_index];
 }
 
 ClusterNetId VprClusteringAnnotation::net(const ClusterBlockId& block_id,
                                           const int& pin_index) const {
   VTR_ASSERT(true == is_net_renamed(block_id, pin_index));
-  return net_names_.at(block_id).at(pin_index);
+  return net_names_[block_id][pin_index];
 }
 
 bool VprClusteringAnnotation::is_truth_table_adapted(t_pb* pb) const {
@@ -43,13 +45,13 @@ AtomNetlist::TruthTable VprClusteringAnnotation::truth_table(t_pb* pb) const {
   return block_truth_tables_.at(pb);
 }
 
-PhysicalPb VprClusteringAnnotation::physical_pb(
+const PhysicalPb& VprClusteringAnnotation::physical_pb(
   const ClusterBlockId& block_id) const {
-  if (physical_pbs_.end() == physical_pbs_.find(block_id)) {
-    return PhysicalPb();
+  if (false == valid_physical_pb(block_id)) {
+    return empty_physical_pb_;
   }
 
-  return physical_pbs_.at(block_id);
+  return physical_pbs_[block_id];
 }
 
 /************************************************************************
@@ -58,16 +60,24 @@ PhysicalPb VprClusteringAnnotation::physical_pb(
 void VprClusteringAnnotation::rename_net(const ClusterBlockId& block_id,
                                          const int& pin_index,
                                          const ClusterNetId& net_id) {
+  VTR_ASSERT(0 <= pin_index);
   /* Warn any override attempt */
-  if ((net_names_.end() != net_names_.find(block_id)) &&
-      (net_names_.at(block_id).end() !=
-       net_names_.at(block_id).find(pin_index))) {
+  if (true == is_net_renamed(block_id, pin_index)) {
     VTR_LOG_WARN(
       "Override the net '%ld' for block '%ld' pin '%d' with in clustering "
       "context annotation!\n",
       size_t(net_id), size_t(block_id), pin_index);
   }
 
+  if (size_t(block_id) >= net_names_.size()) {
+    net_renamed_.resize(size_t(block_id) + 1);
+    net_names_.resize(size_t(block_id) + 1);
+  }
+  if (size_t(pin_index) >= net_names_[block_id].size()) {
+    net_renamed_[block_id].resize(pin_index + 1, false);
+    net_names_[block_id].resize(pin_index + 1, ClusterNetId::INVALID());
+  }
+  net_renamed_[block_id][pin_index] = true;
   net_names_[block_id][pin_index] = net_id;
 }
 
@@ -86,24 +96,46 @@ void VprClusteringAnnotation::adapt_truth_table(
 
 void VprClusteringAnnotation::add_physical_pb(const ClusterBlockId& block_id,
                                               const PhysicalPb& physical_pb) {
+  add_physical_pb(block_id, PhysicalPb(physical_pb));
+}
+
+void VprClusteringAnnotation::add_physical_pb(const ClusterBlockId& block_id,
+                                              PhysicalPb&& physical_pb) {
   /* Warn any override attempt */
-  if (physical_pbs_.end() != physical_pbs_.find(block_id)) {
+  if (true == valid_physical_pb(block_id)) {
     VTR_LOG_WARN(
       "Override the physical pb for clustered block %lu in clustering context "
       "annotation!\n",
       size_t(block_id));
   }
 
-  physical_pbs_[block_id] = physical_pb;
+  if (size_t(block_id) >= physical_pbs_.size()) {
+    physical_pb_added_.resize(size_t(block_id) + 1, false);
+    physical_pbs_.resize(size_t(block_id) + 1);
+  }
+  physical_pb_added_[block_id] = true;
+  physical_pbs_[block_id] = std::move(physical_pb);
 }
 
 PhysicalPb& VprClusteringAnnotation::mutable_physical_pb(
   const ClusterBlockId& block_id) {
-  VTR_ASSERT(physical_pbs_.end() != physical_pbs_.find(block_id));
+  VTR_ASSERT(true == valid_physical_pb(block_id));
 
-  return physical_pbs_.at(block_id);
+  return physical_pbs_[block_id];
 }
 
-void VprClusteringAnnotation::clear_net_remapping() { net_names_.clear(); }
+void VprClusteringAnnotation::clear_net_remapping() {
+  net_renamed_.clear();
+  net_names_.clear();
+}
+
+/************************************************************************
+ * Internal validators
+ ***********************************************************************/
+bool VprClusteringAnnotation::valid_physical_pb(
+  const ClusterBlockId& block_id) const {
+  return (size_t(block_id) < physical_pb_added_.size()) &&
+         (true == physical_pb_added_[block_id]);
+}
 
 } /* End namespace openfpga*/
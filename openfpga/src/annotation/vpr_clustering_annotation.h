@@ -4,7 +4,11 @@
 /********************************************************************
  * Include header files required by the data structure definition
  *******************************************************************/
-#include <map>
+#include <unordered_map>
+#include <vector>
+
+/* Header from vtr util library */
+#include "vtr_vector.h"
 
 /* Header from vpr library */
 #include "clustered_netlist.h"
@@ -37,7 +41,7 @@ class VprClusteringAnnotation {
   ClusterNetId net(const ClusterBlockId& block_id, const int& pin_index) const;
   bool is_truth_table_adapted(t_pb* pb) const;
   AtomNetlist::TruthTable truth_table(t_pb* pb) const;
-  PhysicalPb physical_pb(const ClusterBlockId& block_id) const;
+  const PhysicalPb& physical_pb(const ClusterBlockId& block_id) const;
 
  public: /* Public mutators */
   void rename_net(const ClusterBlockId& block_id, const int& pin_index,
@@ -45,18 +49,29 @@ class VprClusteringAnnotation {
   void adapt_truth_table(t_pb* pb, const AtomNetlist::TruthTable& tt);
   void add_physical_pb(const ClusterBlockId& block_id,
                        const PhysicalPb& physical_pb);
+  void add_physical_pb(const ClusterBlockId& block_id,
+                       PhysicalPb&& physical_pb);
   PhysicalPb& mutable_physical_pb(const ClusterBlockId& block_id);
 
  public: /* Clean-up */
   void clear_net_remapping();
 
+ private: /* Internal validators */
+  bool valid_physical_pb(const ClusterBlockId& block_id) const;
+
  private: /* Internal data */
-  /* Pair a regular pb_type to its physical pb_type */
-  std::map<ClusterBlockId, std::map<int, ClusterNetId>> net_names_;
-  std::map<t_pb*, AtomNetlist::TruthTable> block_truth_tables_;
+  /* Renamed nets of each clustered block, indexed by the pin index.
+   * A net may be renamed to an invalid id, so the flags tell which pins have
+   * been renamed */
+  vtr::vector<ClusterBlockId, std::vector<bool>> net_renamed_;
+  vtr::vector<ClusterBlockId, std::vector<ClusterNetId>> net_names_;
+  std::unordered_map<t_pb*, AtomNetlist::TruthTable> block_truth_tables_;
 
   /* Link clustered blocks to physical pb (mapping results) */
-  std::map<ClusterBlockId, PhysicalPb> physical_pbs_;
+  vtr::vector<ClusterBlockId, bool> physical_pb_added_;
+  vtr::vector<ClusterBlockId, PhysicalPb> physical_pbs_;
+  /* An empty physical pb returned for blocks without mapping results */
+  PhysicalPb empty_physical_pb_;
 };
 
 } /* End namespace openfpga*/
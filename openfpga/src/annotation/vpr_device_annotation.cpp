@@ -3,8 +3,6 @@
  ***********************************************************************/
 #include "vpr_device_annotation.h"
 
-#include <algorithm>
-
 #include "vtr_assert.h"
 #include "vtr_log.h"
 
@@ -21,156 +19,126 @@ VprDeviceAnnotation::VprDeviceAnnotation() { return; }
  ***********************************************************************/
 bool VprDeviceAnnotation::is_physical_pb_type(t_pb_type* pb_type) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, t_pb_type*>::const_iterator it =
-    physical_pb_types_.find(pb_type);
-  if (it == physical_pb_types_.end()) {
+  size_t index = pb_type_index(pb_type);
+  if (size_t(-1) == index) {
     return false;
   }
   /* A physical pb_type should be mapped to itself! Otherwise, it is an
    * operating pb_type */
-  return pb_type == physical_pb_types_.at(pb_type);
+  return pb_type == physical_pb_types_[index];
 }
 
 t_mode* VprDeviceAnnotation::physical_mode(t_pb_type* pb_type) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, t_mode*>::const_iterator it =
-    physical_pb_modes_.find(pb_type);
-  if (it == physical_pb_modes_.end()) {
+  size_t index = pb_type_index(pb_type);
+  if (size_t(-1) == index) {
     return nullptr;
   }
-  return physical_pb_modes_.at(pb_type);
+  return physical_pb_modes_[index];
 }
 
 t_pb_type* VprDeviceAnnotation::physical_pb_type(t_pb_type* pb_type) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, t_pb_type*>::const_iterator it =
-    physical_pb_types_.find(pb_type);
-  if (it == physical_pb_types_.end()) {
+  size_t index = pb_type_index(pb_type);
+  if (size_t(-1) == index) {
     return nullptr;
   }
-  return physical_pb_types_.at(pb_type);
+  return physical_pb_types_[index];
 }
 
 std::vector<t_port*> VprDeviceAnnotation::physical_pb_port(
   t_port* pb_port) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_port*, std::vector<t_port*>>::const_iterator it =
-    physical_pb_ports_.find(pb_port);
-  if (it == physical_pb_ports_.end()) {
+  size_t index = pb_port_index(pb_port);
+  if (size_t(-1) == index) {
     return std::vector<t_port*>();
   }
-  return physical_pb_ports_.at(pb_port);
+  return physical_pb_ports_[index];
 }
 
 BasicPort VprDeviceAnnotation::physical_pb_port_range(
   t_port* operating_pb_port, t_port* physical_pb_port) const {
-  /* Ensure that the pb_type is in the list */
-  std::map<t_port*, std::map<t_port*, BasicPort>>::const_iterator it =
-    physical_pb_port_ranges_.find(operating_pb_port);
-  if (it == physical_pb_port_ranges_.end()) {
-    /* Return an invalid port. As such the port width will be 0, which is an
-     * invalid value */
-    return BasicPort();
-  }
-  if (0 ==
-      physical_pb_port_ranges_.at(operating_pb_port).count(physical_pb_port)) {
+  const PhysicalPbPortPair* port_pair =
+    find_physical_pb_port_pair(operating_pb_port, physical_pb_port);
+  if ((nullptr == port_pair) || (false == port_pair->has_port_range)) {
     /* Return an invalid port. As such the port width will be 0, which is an
      * invalid value */
     return BasicPort();
   }
-  return physical_pb_port_ranges_.at(operating_pb_port).at(physical_pb_port);
+  return port_pair->port_range;
 }
 
 CircuitModelId VprDeviceAnnotation::pb_type_circuit_model(
   t_pb_type* physical_pb_type) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, CircuitModelId>::const_iterator it =
-    pb_type_circuit_models_.find(physical_pb_type);
-  if (it == pb_type_circuit_models_.end()) {
+  size_t index = pb_type_index(physical_pb_type);
+  if (size_t(-1) == index) {
     /* Return an invalid circuit model id */
     return CircuitModelId::INVALID();
   }
-  return pb_type_circuit_models_.at(physical_pb_type);
+  return pb_type_circuit_models_[index];
 }
 
 CircuitModelId VprDeviceAnnotation::interconnect_circuit_model(
   t_interconnect* pb_interconnect) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_interconnect*, CircuitModelId>::const_iterator it =
-    interconnect_circuit_models_.find(pb_interconnect);
-  if (it == interconnect_circuit_models_.end()) {
+  size_t index = interconnect_index(pb_interconnect);
+  if (size_t(-1) == index) {
     /* Return an invalid circuit model id */
     return CircuitModelId::INVALID();
   }
-  return interconnect_circuit_models_.at(pb_interconnect);
+  return interconnect_circuit_models_[index];
 }
 
 e_interconnect VprDeviceAnnotation::interconnect_physical_type(
   t_interconnect* pb_interconnect) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_interconnect*, e_interconnect>::const_iterator it =
-    interconnect_physical_types_.find(pb_interconnect);
-  if (it == interconnect_physical_types_.end()) {
+  size_t index = interconnect_index(pb_interconnect);
+  if (size_t(-1) == index) {
     /* Return an invalid interconnect type */
     return NUM_INTERC_TYPES;
   }
-  return interconnect_physical_types_.at(pb_interconnect);
+  return interconnect_physical_types_[index];
 }
 
 CircuitPortId VprDeviceAnnotation::pb_circuit_port(t_port* pb_port) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_port*, CircuitPortId>::const_iterator it =
-    pb_circuit_ports_.find(pb_port);
-  if (it == pb_circuit_ports_.end()) {
+  size_t index = pb_port_index(pb_port);
+  if (size_t(-1) == index) {
     /* Return an invalid circuit port id */
     return CircuitPortId::INVALID();
   }
-  return pb_circuit_ports_.at(pb_port);
+  return pb_circuit_ports_[index];
 }
 
 std::vector<size_t> VprDeviceAnnotation::pb_type_mode_bits(
   t_pb_type* pb_type) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, std::vector<size_t>>::const_iterator it =
-    pb_type_mode_bits_.find(pb_type);
-  if (it == pb_type_mode_bits_.end()) {
+  size_t index = pb_type_index(pb_type);
+  if (size_t(-1) == index) {
     /* Return an empty vector */
     return std::vector<size_t>();
   }
-  return pb_type_mode_bits_.at(pb_type);
+  return pb_type_mode_bits_[index];
 }
 
 PbGraphNodeId VprDeviceAnnotation::pb_graph_node_unique_index(
   t_pb_graph_node* pb_graph_node) const {
-  /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, std::vector<t_pb_graph_node*>>::const_iterator it =
-    pb_graph_node_unique_index_.find(pb_graph_node->pb_type);
-  if (it == pb_graph_node_unique_index_.end()) {
-    /* Invalid pb_type, return a null pointer */
-    return PbGraphNodeId::INVALID();
-  }
-
-  /* Try to find the pb_graph_node in the vector */
-  std::vector<t_pb_graph_node*>::const_iterator it_node =
-    std::find(pb_graph_node_unique_index_.at(pb_graph_node->pb_type).begin(),
-              pb_graph_node_unique_index_.at(pb_graph_node->pb_type).end(),
-              pb_graph_node);
-  /* If it exists, return the index
+  /* Ensure that the pb_graph_node is in the list
    * Otherwise, return an invalid id
    */
-  if (it_node == pb_graph_node_unique_index_.at(pb_graph_node->pb_type).end()) {
+  size_t index = pb_graph_node_index(pb_graph_node);
+  if (size_t(-1) == index) {
     return PbGraphNodeId::INVALID();
   }
-  return PbGraphNodeId(
-    it_node - pb_graph_node_unique_index_.at(pb_graph_node->pb_type).begin());
+  return pb_graph_node_unique_ids_[index];
 }
 
 t_pb_graph_node* VprDeviceAnnotation::pb_graph_node(
   t_pb_type* pb_type, const PbGraphNodeId& unique_index) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, std::vector<t_pb_graph_node*>>::const_iterator it =
-    pb_graph_node_unique_index_.find(pb_type);
-  if (it == pb_graph_node_unique_index_.end()) {
+  size_t index = pb_type_index(pb_type);
+  if (size_t(-1) == index) {
     /* Invalid pb_type, return a null pointer */
     return nullptr;
   }
@@ -178,177 +146,135 @@ t_pb_graph_node* VprDeviceAnnotation::pb_graph_node(
    *  - Out of range: return a null pointer
    *  - In range: return the pointer
    */
-  if ((size_t)unique_index >
-      pb_graph_node_unique_index_.at(pb_type).size() - 1) {
+  if ((size_t)unique_index >= pb_graph_node_unique_index_[index].size()) {
     return nullptr;
   }
 
-  return pb_graph_node_unique_index_.at(pb_type)[size_t(unique_index)];
+  return pb_graph_node_unique_index_[index][size_t(unique_index)];
 }
 
 t_pb_graph_node* VprDeviceAnnotation::physical_pb_graph_node(
   t_pb_graph_node* pb_graph_node) const {
   /* Ensure that the pb_graph_node is in the list */
-  std::map<t_pb_graph_node*, t_pb_graph_node*>::const_iterator it =
-    physical_pb_graph_nodes_.find(pb_graph_node);
-  if (it == physical_pb_graph_nodes_.end()) {
+  size_t index = pb_graph_node_index(pb_graph_node);
+  if (size_t(-1) == index) {
     return nullptr;
   }
-  return physical_pb_graph_nodes_.at(pb_graph_node);
+  return physical_pb_graph_nodes_[index];
 }
 
 float VprDeviceAnnotation::physical_pb_type_index_factor(
   t_pb_type* pb_type) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, float>::const_iterator it =
-    physical_pb_type_index_factors_.find(pb_type);
-  if (it == physical_pb_type_index_factors_.end()) {
+  size_t index = pb_type_index(pb_type);
+  if (size_t(-1) == index) {
     /* Default value is 1 */
     return 1.;
   }
-  return physical_pb_type_index_factors_.at(pb_type);
+  return physical_pb_type_index_factors_[index];
 }
 
 int VprDeviceAnnotation::physical_pb_type_index_offset(
   t_pb_type* pb_type) const {
   /* Ensure that the pb_type is in the list */
-  std::map<t_pb_type*, int>::const_iterator it =
-    physical_pb_type_index_offsets_.find(pb_type);
-  if (it == physical_pb_type_index_offsets_.end()) {
+  size_t index = pb_type_index(pb_type);
+  if (size_t(-1) == index) {
     /* Default value is 0 */
     return 0;
   }
-  return physical_pb_type_index_offsets_.at(pb_type);
+  return physical_pb_type_index_offsets_[index];
 }
 
 int VprDeviceAnnotation::physical_pb_pin_initial_offset(
   t_port* operating_pb_port, t_port* physical_pb_port) const {
-  /* Ensure that the pb_type is in the list */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_pin_initial_offsets_.find(operating_pb_port);
-  if (it == physical_pb_pin_initial_offsets_.end()) {
+  const PhysicalPbPortPair* port_pair =
+    find_physical_pb_port_pair(operating_pb_port, physical_pb_port);
+  if (nullptr == port_pair) {
     /* Default value is 0 */
     return 0;
   }
-  if (0 == physical_pb_pin_initial_offsets_.at(operating_pb_port)
-             .count(physical_pb_port)) {
-    /* Default value is 0 */
-    return 0;
-  }
-  return physical_pb_pin_initial_offsets_.at(operating_pb_port)
-    .at(physical_pb_port);
+  return port_pair->pin_initial_offset;
 }
 
 int VprDeviceAnnotation::physical_pb_pin_rotate_offset(
   t_port* operating_pb_port, t_port* physical_pb_port) const {
-  /* Ensure that the pb_type is in the list */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_pin_rotate_offsets_.find(operating_pb_port);
-  if (it == physical_pb_pin_rotate_offsets_.end()) {
+  const PhysicalPbPortPair* port_pair =
+    find_physical_pb_port_pair(operating_pb_port, physical_pb_port);
+  if (nullptr == port_pair) {
     /* Default value is 0 */
     return 0;
   }
-  if (0 == physical_pb_pin_rotate_offsets_.at(operating_pb_port)
-             .count(physical_pb_port)) {
-    /* Default value is 0 */
-    return 0;
-  }
-  return physical_pb_pin_rotate_offsets_.at(operating_pb_port)
-    .at(physical_pb_port);
+  return port_pair->pin_rotate_offset;
 }
 
 int VprDeviceAnnotation::physical_pb_port_rotate_offset(
   t_port* operating_pb_port, t_port* physical_pb_port) const {
-  /* Ensure that the pb_type is in the list */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_port_rotate_offsets_.find(operating_pb_port);
-  if (it == physical_pb_port_rotate_offsets_.end()) {
+  const PhysicalPbPortPair* port_pair =
+    find_physical_pb_port_pair(operating_pb_port, physical_pb_port);
+  if (nullptr == port_pair) {
     /* Default value is 0 */
     return 0;
   }
-  if (0 == physical_pb_port_rotate_offsets_.at(operating_pb_port)
-             .count(physical_pb_port)) {
-    /* Default value is 0 */
-    return 0;
-  }
-  return physical_pb_port_rotate_offsets_.at(operating_pb_port)
-    .at(physical_pb_port);
+  return port_pair->port_rotate_offset;
 }
 
 int VprDeviceAnnotation::physical_pb_pin_offset(
   t_port* operating_pb_port, t_port* physical_pb_port) const {
-  /* Ensure that the pb_type is in the list */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_pin_offsets_.find(operating_pb_port);
-  if (it == physical_pb_pin_offsets_.end()) {
+  const PhysicalPbPortPair* port_pair =
+    find_physical_pb_port_pair(operating_pb_port, physical_pb_port);
+  if (nullptr == port_pair) {
     /* Default value is 0 */
     return 0;
   }
-  if (0 ==
-      physical_pb_pin_offsets_.at(operating_pb_port).count(physical_pb_port)) {
-    /* Default value is 0 */
-    return 0;
-  }
-  return physical_pb_pin_offsets_.at(operating_pb_port).at(physical_pb_port);
+  return port_pair->pin_offset;
 }
 
 int VprDeviceAnnotation::physical_pb_port_offset(
   t_port* operating_pb_port, t_port* physical_pb_port) const {
-  /* Ensure that the pb_type is in the list */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_port_offsets_.find(operating_pb_port);
-  if (it == physical_pb_port_offsets_.end()) {
-    /* Default value is 0 */
-    return 0;
-  }
-  if (0 ==
-      physical_pb_port_offsets_.at(operating_pb_port).count(physical_pb_port)) {
+  const PhysicalPbPortPair* port_pair =
+    find_physical_pb_port_pair(operating_pb_port, physical_pb_port);
+  if (nullptr == port_pair) {
     /* Default value is 0 */
     return 0;
   }
-  return physical_pb_port_offsets_.at(operating_pb_port).at(physical_pb_port);
+  return port_pair->port_offset;
 }
 
 t_pb_graph_pin* VprDeviceAnnotation::physical_pb_graph_pin(
   const t_pb_graph_pin* pb_graph_pin) const {
   /* Ensure that the pb_type is in the list */
-  std::map<const t_pb_graph_pin*, t_pb_graph_pin*>::const_iterator it =
-    physical_pb_graph_pins_.find(pb_graph_pin);
-  if (it == physical_pb_graph_pins_.end()) {
+  size_t index = pb_graph_pin_index(pb_graph_pin);
+  if (size_t(-1) == index) {
     return nullptr;
   }
-  return physical_pb_graph_pins_.at(pb_graph_pin);
+  return physical_pb_graph_pins_[index];
 }
 
 CircuitModelId VprDeviceAnnotation::rr_switch_circuit_model(
   const RRSwitchId& rr_switch) const {
   /* Ensure that the rr_switch is in the list */
-  std::map<RRSwitchId, CircuitModelId>::const_iterator it =
-    rr_switch_circuit_models_.find(rr_switch);
-  if (it == rr_switch_circuit_models_.end()) {
+  if (size_t(rr_switch) >= rr_switch_circuit_models_.size()) {
     return CircuitModelId::INVALID();
   }
-  return rr_switch_circuit_models_.at(rr_switch);
+  return rr_switch_circuit_models_[rr_switch];
 }
 
 CircuitModelId VprDeviceAnnotation::rr_segment_circuit_model(
   const RRSegmentId& rr_segment) const {
   /* Ensure that the rr_switch is in the list */
-  std::map<RRSegmentId, CircuitModelId>::const_iterator it =
-    rr_segment_circuit_models_.find(rr_segment);
-  if (it == rr_segment_circuit_models_.end()) {
+  if (size_t(rr_segment) >= rr_segment_circuit_models_.size()) {
     return CircuitModelId::INVALID();
   }
-  return rr_segment_circuit_models_.at(rr_segment);
+  return rr_segment_circuit_models_[rr_segment];
 }
 
 ArchDirectId VprDeviceAnnotation::direct_annotation(
   const size_t& direct) const {
   /* Ensure that the rr_switch is in the list */
-  if (0 == direct_annotations_.count(direct)) {
+  if (direct >= direct_annotations_.size()) {
     return ArchDirectId::INVALID();
   }
-  return direct_annotations_.at(direct);
+  return direct_annotations_[direct];
 }
 
 LbRRGraph VprDeviceAnnotation::physical_lb_rr_graph(
@@ -363,87 +289,59 @@ LbRRGraph VprDeviceAnnotation::physical_lb_rr_graph(
 BasicPort VprDeviceAnnotation::physical_tile_pin_port_info(
   t_physical_tile_type_ptr physical_tile, const int& pin_index) const {
   /* Try to find the physical tile in the fast look-up */
-  auto physical_tile_search_result =
-    physical_tile_pin2port_info_map_.find(physical_tile);
-  if (physical_tile_search_result == physical_tile_pin2port_info_map_.end()) {
-    /* Not found. Return an invalid port */
-    return BasicPort();
-  }
-
-  /* Try to find the physical tile port info with pin index */
-  auto pin_search_result = physical_tile_search_result->second.find(pin_index);
-  if (pin_search_result == physical_tile_search_result->second.end()) {
+  size_t index = physical_tile_index(physical_tile);
+  if ((size_t(-1) == index) || (0 > pin_index) ||
+      (size_t(pin_index) >= physical_tile_pin2port_info_map_[index].size())) {
     /* Not found. Return an invalid port */
     return BasicPort();
   }
 
   /* Reach here, we should find a port. Return the port information */
-  return pin_search_result->second;
+  return physical_tile_pin2port_info_map_[index][pin_index];
 }
 
 int VprDeviceAnnotation::physical_tile_pin_subtile_index(
   t_physical_tile_type_ptr physical_tile, const int& pin_index) const {
   /* Try to find the physical tile in the fast look-up */
-  auto physical_tile_search_result =
-    physical_tile_pin_subtile_indices_.find(physical_tile);
-  if (physical_tile_search_result == physical_tile_pin_subtile_indices_.end()) {
-    /* Not found. Return an invalid index */
-    return -1;
-  }
-
-  /* Try to find the physical tile port info with pin index */
-  auto pin_search_result = physical_tile_search_result->second.find(pin_index);
-  if (pin_search_result == physical_tile_search_result->second.end()) {
+  size_t index = physical_tile_index(physical_tile);
+  if ((size_t(-1) == index) || (0 > pin_index) ||
+      (size_t(pin_index) >= physical_tile_pin_subtile_indices_[index].size())) {
     /* Not found. Return an invalid index */
     return -1;
   }
 
   /* Reach here, we should find a port. Return the port information */
-  return pin_search_result->second;
+  return physical_tile_pin_subtile_indices_[index][pin_index];
 }
 
 int VprDeviceAnnotation::physical_tile_z_to_subtile_index(
   t_physical_tile_type_ptr physical_tile, const int& sub_tile_z) const {
   /* Try to find the physical tile in the fast look-up */
-  auto physical_tile_search_result =
-    physical_tile_z_to_subtile_indices_.find(physical_tile);
-  if (physical_tile_search_result ==
-      physical_tile_z_to_subtile_indices_.end()) {
-    /* Not found. Return an invalid index */
-    return -1;
-  }
-
-  /* Try to find the physical tile port info with pin index */
-  auto pin_search_result = physical_tile_search_result->second.find(sub_tile_z);
-  if (pin_search_result == physical_tile_search_result->second.end()) {
+  size_t index = physical_tile_index(physical_tile);
+  if ((size_t(-1) == index) || (0 > sub_tile_z) ||
+      (size_t(sub_tile_z) >=
+       physical_tile_z_to_subtile_indices_[index].size())) {
     /* Not found. Return an invalid index */
     return -1;
   }
 
   /* Reach here, we should find a port. Return the port information */
-  return pin_search_result->second;
+  return physical_tile_z_to_subtile_indices_[index][sub_tile_z];
 }
 
 int VprDeviceAnnotation::physical_tile_z_to_start_pin_index(
   t_physical_tile_type_ptr physical_tile, const int& sub_tile_z) const {
   /* Try to find the physical tile in the fast look-up */
-  auto physical_tile_search_result =
-    physical_tile_z_to_start_pin_indices_.find(physical_tile);
-  if (physical_tile_search_result ==
-      physical_tile_z_to_start_pin_indices_.end()) {
-    /* Not found. Return an invalid index */
-    return -1;
-  }
-
-  /* Try to find the physical tile port info with pin index */
-  auto pin_search_result = physical_tile_search_result->second.find(sub_tile_z);
-  if (pin_search_result == physical_tile_search_result->second.end()) {
+  size_t index = physical_tile_index(physical_tile);
+  if ((size_t(-1) == index) || (0 > sub_tile_z) ||
+      (size_t(sub_tile_z) >=
+       physical_tile_z_to_start_pin_indices_[index].size())) {
     /* Not found. Return an invalid index */
     return -1;
   }
 
   /* Reach here, we should find a port. Return the port information */
-  return pin_search_result->second;
+  return physical_tile_z_to_start_pin_indices_[index][sub_tile_z];
 }
 
 /************************************************************************
@@ -451,37 +349,36 @@ int VprDeviceAnnotation::physical_tile_z_to_start_pin_index(
  ***********************************************************************/
 void VprDeviceAnnotation::add_pb_type_physical_mode(t_pb_type* pb_type,
                                                     t_mode* physical_mode) {
+  size_t index = register_pb_type(pb_type);
   /* Warn any override attempt */
-  std::map<t_pb_type*, t_mode*>::const_iterator it =
-    physical_pb_modes_.find(pb_type);
-  if (it != physical_pb_modes_.end()) {
+  if (nullptr != physical_pb_modes_[index]) {
     VTR_LOG_WARN(
       "Override the annotation between pb_type '%s' and it physical mode "
       "'%s'!\n",
       pb_type->name, physical_mode->name);
   }
 
-  physical_pb_modes_[pb_type] = physical_mode;
+  physical_pb_modes_[index] = physical_mode;
 }
 
 void VprDeviceAnnotation::add_physical_pb_type(t_pb_type* operating_pb_type,
                                                t_pb_type* physical_pb_type) {
+  size_t index = register_pb_type(operating_pb_type);
   /* Warn any override attempt */
-  std::map<t_pb_type*, t_pb_type*>::const_iterator it =
-    physical_pb_types_.find(operating_pb_type);
-  if (it != physical_pb_types_.end()) {
+  if (nullptr != physical_pb_types_[index]) {
     VTR_LOG_WARN(
       "Override the annotation between operating pb_type '%s' and it physical "
       "pb_type '%s'!\n",
       operating_pb_type->name, physical_pb_type->name);
   }
 
-  physical_pb_types_[operating_pb_type] = physical_pb_type;
+  physical_pb_types_[index] = physical_pb_type;
 }
 
 void VprDeviceAnnotation::add_physical_pb_port(t_port* operating_pb_port,
                                                t_port* physical_pb_port) {
-  physical_pb_ports_[operating_pb_port].push_back(physical_pb_port);
+  physical_pb_ports_[register_pb_port(operating_pb_port)].push_back(
+    physical_pb_port);
 }
 
 void VprDeviceAnnotation::add_physical_pb_port_range(
@@ -490,12 +387,10 @@ void VprDeviceAnnotation::add_physical_pb_port_range(
   /* The port range must satify the port width*/
   VTR_ASSERT((size_t)operating_pb_port->num_pins >= port_range.get_width());
 
+  PhysicalPbPortPair& port_pair =
+    register_physical_pb_port_pair(operating_pb_port, physical_pb_port);
   /* Warn any override attempt */
-  std::map<t_port*, std::map<t_port*, BasicPort>>::const_iterator it =
-    physical_pb_port_ranges_.find(operating_pb_port);
-  if ((it != physical_pb_port_ranges_.end()) &&
-      (0 <
-       physical_pb_port_ranges_[operating_pb_port].count(physical_pb_port))) {
+  if (true == port_pair.has_port_range) {
     VTR_LOG_WARN(
       "Override the annotation between operating pb_port '%s' and it physical "
       "pb_port range '%s[%ld:%ld]'!\n",
@@ -503,86 +398,90 @@ void VprDeviceAnnotation::add_physical_pb_port_range(
       port_range.get_msb());
   }
 
-  physical_pb_port_ranges_[operating_pb_port][physical_pb_port] = port_range;
+  port_pair.has_port_range = true;
+  port_pair.port_range = port_range;
 }
 
 void VprDeviceAnnotation::add_pb_type_circuit_model(
   t_pb_type* physical_pb_type, const CircuitModelId& circuit_model) {
+  size_t index = register_pb_type(physical_pb_type);
   /* Warn any override attempt */
-  std::map<t_pb_type*, CircuitModelId>::const_iterator it =
-    pb_type_circuit_models_.find(physical_pb_type);
-  if (it != pb_type_circuit_models_.end()) {
+  if (CircuitModelId::INVALID() != pb_type_circuit_models_[index]) {
     VTR_LOG_WARN("Override the circuit model for physical pb_type '%s'!\n",
                  physical_pb_type->name);
   }
 
-  pb_type_circuit_models_[physical_pb_type] = circuit_model;
+  pb_type_circuit_models_[index] = circuit_model;
 }
 
 void VprDeviceAnnotation::add_interconnect_circuit_model(
   t_interconnect* pb_interconnect, const CircuitModelId& circuit_model) {
+  size_t index = register_interconnect(pb_interconnect);
   /* Warn any override attempt */
-  std::map<t_interconnect*, CircuitModelId>::const_iterator it =
-    interconnect_circuit_models_.find(pb_interconnect);
-  if (it != interconnect_circuit_models_.end()) {
+  if (CircuitModelId::INVALID() != interconnect_circuit_models_[index]) {
     VTR_LOG_WARN("Override the circuit model for interconnect '%s'!\n",
                  pb_interconnect->name);
   }
 
-  interconnect_circuit_models_[pb_interconnect] = circuit_model;
+  interconnect_circuit_models_[index] = circuit_model;
 }
 
 void VprDeviceAnnotation::add_interconnect_physical_type(
   t_interconnect* pb_interconnect, const e_interconnect& physical_type) {
+  size_t index = register_interconnect(pb_interconnect);
   /* Warn any override attempt */
-  std::map<t_interconnect*, e_interconnect>::const_iterator it =
-    interconnect_physical_types_.find(pb_interconnect);
-  if (it != interconnect_physical_types_.end()) {
+  if (NUM_INTERC_TYPES != interconnect_physical_types_[index]) {
     VTR_LOG_WARN("Override the physical interconnect for interconnect '%s'!\n",
                  pb_interconnect->name);
   }
 
-  interconnect_physical_types_[pb_interconnect] = physical_type;
+  interconnect_physical_types_[index] = physical_type;
 }
 
 void VprDeviceAnnotation::add_pb_circuit_port(
   t_port* pb_port, const CircuitPortId& circuit_port) {
+  size_t index = register_pb_port(pb_port);
   /* Warn any override attempt */
-  std::map<t_port*, CircuitPortId>::const_iterator it =
-    pb_circuit_ports_.find(pb_port);
-  if (it != pb_circuit_ports_.end()) {
+  if (CircuitPortId::INVALID() != pb_circuit_ports_[index]) {
     VTR_LOG_WARN("Override the circuit port mapping for pb_type port '%s'!\n",
                  pb_port->name);
   }
 
-  pb_circuit_ports_[pb_port] = circuit_port;
+  pb_circuit_ports_[index] = circuit_port;
 }
 
 void VprDeviceAnnotation::add_pb_type_mode_bits(
   t_pb_type* pb_type, const std::vector<size_t>& mode_bits) {
+  size_t index = register_pb_type(pb_type);
   /* Warn any override attempt */
-  std::map<t_pb_type*, std::vector<size_t>>::const_iterator it =
-    pb_type_mode_bits_.find(pb_type);
-  if (it != pb_type_mode_bits_.end()) {
+  if (true == pb_type_mode_bits_annotated_[index]) {
     VTR_LOG_WARN("Override the mode bits mapping for pb_type '%s'!\n",
                  pb_type->name);
   }
 
-  pb_type_mode_bits_[pb_type] = mode_bits;
+  pb_type_mode_bits_annotated_[index] = true;
+  pb_type_mode_bits_[index] = mode_bits;
 }
 
 void VprDeviceAnnotation::add_pb_graph_node_unique_index(
   t_pb_graph_node* pb_graph_node) {
-  pb_graph_node_unique_index_[pb_graph_node->pb_type].push_back(pb_graph_node);
+  size_t pb_type_id = register_pb_type(pb_graph_node->pb_type);
+  size_t index = register_pb_graph_node(pb_graph_node);
+  /* Only the first index is kept for a pb_graph_node, which is the one
+   * found by searching the array of t_pb_graph_node* */
+  if (PbGraphNodeId::INVALID() == pb_graph_node_unique_ids_[index]) {
+    pb_graph_node_unique_ids_[index] =
+      PbGraphNodeId(pb_graph_node_unique_index_[pb_type_id].size());
+  }
+  pb_graph_node_unique_index_[pb_type_id].push_back(pb_graph_node);
 }
 
 void VprDeviceAnnotation::add_physical_pb_graph_node(
   t_pb_graph_node* operating_pb_graph_node,
   t_pb_graph_node* physical_pb_graph_node) {
+  size_t index = register_pb_graph_node(operating_pb_graph_node);
   /* Warn any override attempt */
-  std::map<t_pb_graph_node*, t_pb_graph_node*>::const_iterator it =
-    physical_pb_graph_nodes_.find(operating_pb_graph_node);
-  if (it != physical_pb_graph_nodes_.end()) {
+  if (nullptr != physical_pb_graph_nodes_[index]) {
     VTR_LOG_WARN(
       "Override the annotation between operating pb_graph_node '%s[%d]' and it "
       "physical pb_graph_node '%s[%d]'!\n",
@@ -592,116 +491,111 @@ void VprDeviceAnnotation::add_physical_pb_graph_node(
       physical_pb_graph_node->placement_index);
   }
 
-  physical_pb_graph_nodes_[operating_pb_graph_node] = physical_pb_graph_node;
+  physical_pb_graph_nodes_[index] = physical_pb_graph_node;
 }
 
 void VprDeviceAnnotation::add_physical_pb_type_index_factor(
   t_pb_type* pb_type, const float& factor) {
+  size_t index = register_pb_type(pb_type);
   /* Warn any override attempt */
-  std::map<t_pb_type*, float>::const_iterator it =
-    physical_pb_type_index_factors_.find(pb_type);
-  if (it != physical_pb_type_index_factors_.end()) {
+  if (true == pb_type_index_factor_annotated_[index]) {
     VTR_LOG_WARN(
       "Override the annotation between operating pb_type '%s' and it physical "
       "pb_type index factor '%f'!\n",
       pb_type->name, factor);
   }
 
-  physical_pb_type_index_factors_[pb_type] = factor;
+  pb_type_index_factor_annotated_[index] = true;
+  physical_pb_type_index_factors_[index] = factor;
 }
 
 void VprDeviceAnnotation::add_physical_pb_type_index_offset(t_pb_type* pb_type,
                                                             const int& offset) {
+  size_t index = register_pb_type(pb_type);
   /* Warn any override attempt */
-  std::map<t_pb_type*, int>::const_iterator it =
-    physical_pb_type_index_offsets_.find(pb_type);
-  if (it != physical_pb_type_index_offsets_.end()) {
+  if (true == pb_type_index_offset_annotated_[index]) {
     VTR_LOG_WARN(
       "Override the annotation between operating pb_type '%s' and it physical "
       "pb_type index offset '%d'!\n",
       pb_type->name, offset);
   }
 
-  physical_pb_type_index_offsets_[pb_type] = offset;
+  pb_type_index_offset_annotated_[index] = true;
+  physical_pb_type_index_offsets_[index] = offset;
 }
 
 void VprDeviceAnnotation::add_physical_pb_pin_initial_offset(
   t_port* operating_pb_port, t_port* physical_pb_port, const int& offset) {
+  PhysicalPbPortPair& port_pair =
+    register_physical_pb_port_pair(operating_pb_port, physical_pb_port);
   /* Warn any override attempt */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_pin_initial_offsets_.find(operating_pb_port);
-  if ((it != physical_pb_pin_initial_offsets_.end()) &&
-      (0 < physical_pb_pin_initial_offsets_[operating_pb_port].count(
-             physical_pb_port))) {
+  if (true == port_pair.has_pin_initial_offset) {
     VTR_LOG_WARN(
       "Override the annotation between operating pb_port '%s' and it physical "
       "pb_port '%s' pin rotate offset '%d'!\n",
-      operating_pb_port->name, offset);
+      operating_pb_port->name, physical_pb_port->name, offset);
   }
 
-  physical_pb_pin_initial_offsets_[operating_pb_port][physical_pb_port] =
-    offset;
+  port_pair.has_pin_initial_offset = true;
+  port_pair.pin_initial_offset = offset;
 }
 
 void VprDeviceAnnotation::add_physical_pb_port_rotate_offset(
   t_port* operating_pb_port, t_port* physical_pb_port, const int& offset) {
+  PhysicalPbPortPair& port_pair =
+    register_physical_pb_port_pair(operating_pb_port, physical_pb_port);
   /* Warn any override attempt */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_port_rotate_offsets_.find(operating_pb_port);
-  if ((it != physical_pb_port_rotate_offsets_.end()) &&
-      (0 < physical_pb_port_rotate_offsets_[operating_pb_port].count(
-             physical_pb_port))) {
+  if (true == port_pair.has_port_rotate_offset) {
     VTR_LOG_WARN(
       "Override the annotation between operating pb_port '%s' and it physical "
       "pb_port '%s' port rotate offset '%d'!\n",
-      operating_pb_port->name, offset);
+      operating_pb_port->name, physical_pb_port->name, offset);
   }
 
-  physical_pb_port_rotate_offsets_[operating_pb_port][physical_pb_port] =
-    offset;
+  port_pair.has_port_rotate_offset = true;
+  port_pair.port_rotate_offset = offset;
   /* We initialize the accumulated offset to 0 */
-  physical_pb_port_offsets_[operating_pb_port][physical_pb_port] = 0;
+  port_pair.port_offset = 0;
 }
 
 void VprDeviceAnnotation::accumulate_physical_pb_port_rotate_offset(
   t_port* operating_pb_port, t_port* physical_pb_port) {
-  physical_pb_port_offsets_[operating_pb_port][physical_pb_port] +=
-    physical_pb_port_rotate_offsets_[operating_pb_port][physical_pb_port];
+  PhysicalPbPortPair& port_pair =
+    register_physical_pb_port_pair(operating_pb_port, physical_pb_port);
+  port_pair.port_offset += port_pair.port_rotate_offset;
 }
 
 void VprDeviceAnnotation::add_physical_pb_pin_rotate_offset(
   t_port* operating_pb_port, t_port* physical_pb_port, const int& offset) {
+  PhysicalPbPortPair& port_pair =
+    register_physical_pb_port_pair(operating_pb_port, physical_pb_port);
   /* Warn any override attempt */
-  std::map<t_port*, std::map<t_port*, int>>::const_iterator it =
-    physical_pb_pin_rotate_offsets_.find(operating_pb_port);
-  if ((it != physical_pb_pin_rotate_offsets_.end()) &&
-      (0 < physical_pb_pin_rotate_offsets_[operating_pb_port].count(
-             physical_pb_port))) {
+  if (true == port_pair.has_pin_rotate_offset) {
     VTR_LOG_WARN(
       "Override the annotation between operating pb_port '%s' and it physical "
       "pb_port '%s' pin rotate offset '%d'!\n",
-      operating_pb_port->name, offset);
+      operating_pb_port->name, physical_pb_port->name, offset);
   }
 
-  physical_pb_pin_rotate_offsets_[operating_pb_port][physical_pb_port] = offset;
+  port_pair.has_pin_rotate_offset = true;
+  port_pair.pin_rotate_offset = offset;
   /* We initialize the accumulated offset to 0 */
-  physical_pb_pin_offsets_[operating_pb_port][physical_pb_port] = 0;
+  port_pair.pin_offset = 0;
 }
 
 void VprDeviceAnnotation::add_physical_pb_graph_pin(
   const t_pb_graph_pin* operating_pb_graph_pin,
   t_pb_graph_pin* physical_pb_graph_pin) {
+  size_t index = register_pb_graph_pin(operating_pb_graph_pin);
   /* Warn any override attempt */
-  std::map<const t_pb_graph_pin*, t_pb_graph_pin*>::const_iterator it =
-    physical_pb_graph_pins_.find(operating_pb_graph_pin);
-  if (it != physical_pb_graph_pins_.end()) {
+  if (nullptr != physical_pb_graph_pins_[index]) {
     VTR_LOG_WARN(
       "Override the annotation between operating pb_graph_pin '%s' and it "
       "physical pb_graph_pin '%s'!\n",
       operating_pb_graph_pin->port->name, physical_pb_graph_pin->port->name);
   }
 
-  physical_pb_graph_pins_[operating_pb_graph_pin] = physical_pb_graph_pin;
+  physical_pb_graph_pins_[index] = physical_pb_graph_pin;
 
   /* Update the accumulated offsets for the operating port
    * Each time we pair two pins, we update the offset by the pin rotate offset
@@ -718,29 +612,28 @@ void VprDeviceAnnotation::add_physical_pb_graph_pin(
     return;
   }
 
-  physical_pb_pin_offsets_[operating_pb_graph_pin->port]
-                          [physical_pb_graph_pin->port] +=
-    physical_pb_pin_rotate_offset(operating_pb_graph_pin->port,
-                                  physical_pb_graph_pin->port);
+  PhysicalPbPortPair& port_pair = register_physical_pb_port_pair(
+    operating_pb_graph_pin->port, physical_pb_graph_pin->port);
+  port_pair.pin_offset += port_pair.pin_rotate_offset;
 
   if ((size_t)physical_pb_graph_pin->port->num_pins - 1 <
       operating_pb_graph_pin->pin_number +
         physical_pb_port_range(operating_pb_graph_pin->port,
                                physical_pb_graph_pin->port)
           .get_lsb() +
-        physical_pb_pin_offsets_[operating_pb_graph_pin->port]
-                                [physical_pb_graph_pin->port]) {
-    physical_pb_pin_offsets_[operating_pb_graph_pin->port]
-                            [physical_pb_graph_pin->port] = 0;
+        port_pair.pin_offset) {
+    port_pair.pin_offset = 0;
   }
 }
 
 void VprDeviceAnnotation::add_rr_switch_circuit_model(
   const RRSwitchId& rr_switch, const CircuitModelId& circuit_model) {
+  if (size_t(rr_switch) >= rr_switch_circuit_models_.size()) {
+    rr_switch_circuit_models_.resize(size_t(rr_switch) + 1,
+                                     CircuitModelId::INVALID());
+  }
   /* Warn any override attempt */
-  std::map<RRSwitchId, CircuitModelId>::const_iterator it =
-    rr_switch_circuit_models_.find(rr_switch);
-  if (it != rr_switch_circuit_models_.end()) {
+  if (CircuitModelId::INVALID() != rr_switch_circuit_models_[rr_switch]) {
     VTR_LOG_WARN(
       "Override the annotation between rr_switch '%ld' and its circuit_model "
       "'%ld'!\n",
@@ -752,10 +645,12 @@ void VprDeviceAnnotation::add_rr_switch_circuit_model(
 
 void VprDeviceAnnotation::add_rr_segment_circuit_model(
   const RRSegmentId& rr_segment, const CircuitModelId& circuit_model) {
+  if (size_t(rr_segment) >= rr_segment_circuit_models_.size()) {
+    rr_segment_circuit_models_.resize(size_t(rr_segment) + 1,
+                                      CircuitModelId::INVALID());
+  }
   /* Warn any override attempt */
-  std::map<RRSegmentId, CircuitModelId>::const_iterator it =
-    rr_segment_circuit_models_.find(rr_segment);
-  if (it != rr_segment_circuit_models_.end()) {
+  if (CircuitModelId::INVALID() != rr_segment_circuit_models_[rr_segment]) {
     VTR_LOG_WARN(
       "Override the annotation between rr_segment '%ld' and its circuit_model "
       "'%ld'!\n",
@@ -767,8 +662,11 @@ void VprDeviceAnnotation::add_rr_segment_circuit_model(
 
 void VprDeviceAnnotation::add_direct_annotation(
   const size_t& direct, const ArchDirectId& arch_direct_id) {
+  if (direct >= direct_annotations_.size()) {
+    direct_annotations_.resize(direct + 1, ArchDirectId::INVALID());
+  }
   /* Warn any override attempt */
-  if (0 < direct_annotations_.count(direct)) {
+  if (ArchDirectId::INVALID() != direct_annotations_[direct]) {
     VTR_LOG_WARN(
       "Override the annotation between direct '%ld' and its annotation "
       "'%ld'!\n",
@@ -792,26 +690,354 @@ void VprDeviceAnnotation::add_physical_lb_rr_graph(
 void VprDeviceAnnotation::add_physical_tile_pin2port_info_pair(
   t_physical_tile_type_ptr physical_tile, const int& pin_index,
   const BasicPort& port) {
-  physical_tile_pin2port_info_map_[physical_tile][pin_index] = port;
+  VTR_ASSERT(0 <= pin_index);
+  std::vector<BasicPort>& pin2port_info =
+    physical_tile_pin2port_info_map_[register_physical_tile(physical_tile)];
+  if (size_t(pin_index) >= pin2port_info.size()) {
+    pin2port_info.resize(pin_index + 1);
+  }
+  pin2port_info[pin_index] = port;
 }
 
 void VprDeviceAnnotation::add_physical_tile_pin_subtile_index(
   t_physical_tile_type_ptr physical_tile, const int& pin_index,
   const int& subtile_index) {
-  physical_tile_pin_subtile_indices_[physical_tile][pin_index] = subtile_index;
+  VTR_ASSERT(0 <= pin_index);
+  std::vector<int>& pin_subtile_indices =
+    physical_tile_pin_subtile_indices_[register_physical_tile(physical_tile)];
+  if (size_t(pin_index) >= pin_subtile_indices.size()) {
+    pin_subtile_indices.resize(pin_index + 1, -1);
+  }
+  pin_subtile_indices[pin_index] = subtile_index;
 }
 
 void VprDeviceAnnotation::add_physical_tile_z_to_subtile_index(
   t_physical_tile_type_ptr physical_tile, const int& subtile_z,
   const int& subtile_index) {
-  physical_tile_z_to_subtile_indices_[physical_tile][subtile_z] = subtile_index;
+  VTR_ASSERT(0 <= subtile_z);
+  std::vector<int>& z_to_subtile_indices =
+    physical_tile_z_to_subtile_indices_[register_physical_tile(physical_tile)];
+  if (size_t(subtile_z) >= z_to_subtile_indices.size()) {
+    z_to_subtile_indices.resize(subtile_z + 1, -1);
+  }
+  z_to_subtile_indices[subtile_z] = subtile_index;
 }
 
 void VprDeviceAnnotation::add_physical_tile_z_to_start_pin_index(
   t_physical_tile_type_ptr physical_tile, const int& subtile_z,
   const int& start_pin_index) {
-  physical_tile_z_to_start_pin_indices_[physical_tile][subtile_z] =
-    start_pin_index;
+  VTR_ASSERT(0 <= subtile_z);
+  std::vector<int>& z_to_start_pin_indices =
+    physical_tile_z_to_start_pin_indices_[register_physical_tile(
+      physical_tile)];
+  if (size_t(subtile_z) >= z_to_start_pin_indices.size()) {
+    z_to_start_pin_indices.resize(subtile_z + 1, -1);
+  }
+  z_to_start_pin_indices[subtile_z] = start_pin_index;
+}
+
+/************************************************************************
+ * Internal functions
+ ***********************************************************************/
+/* Find the dense index of a top-level object in a short list, or size_t(-1)
+ * if the object has never been annotated */
+template <class T>
+static size_t find_top_vpr_object_index(const std::vector<const T*>& objects,
+                                        const std::vector<size_t>& indices,
+                                        const T* object) {
+  for (size_t iobj = 0; iobj < objects.size(); ++iobj) {
+    if (object == objects[iobj]) {
+      return indices[iobj];
+    }
+  }
+  return size_t(-1);
+}
+
+size_t VprDeviceAnnotation::pb_type_index(const t_pb_type* pb_type) const {
+  const t_mode* parent_mode = pb_type->parent_mode;
+  if (nullptr == parent_mode) {
+    return find_top_vpr_object_index(top_pb_types_, top_pb_type_indices_,
+                                     pb_type);
+  }
+  size_t parent_index = pb_type_index(parent_mode->parent_pb_type);
+  if (size_t(-1) == parent_index) {
+    return size_t(-1);
+  }
+  return pb_type_first_child_indices_[parent_index][parent_mode->index] +
+         (pb_type - parent_mode->pb_type_children);
+}
+
+size_t VprDeviceAnnotation::pb_port_index(const t_port* pb_port) const {
+  size_t parent_index = pb_type_index(pb_port->parent_pb_type);
+  if (size_t(-1) == parent_index) {
+    return size_t(-1);
+  }
+  return pb_type_first_port_indices_[parent_index] +
+         (pb_port - pb_port->parent_pb_type->ports);
+}
+
+size_t VprDeviceAnnotation::interconnect_index(
+  const t_interconnect* pb_interconnect) const {
+  const t_mode* parent_mode = pb_interconnect->parent_mode;
+  size_t parent_index = pb_type_index(parent_mode->parent_pb_type);
+  if (size_t(-1) == parent_index) {
+    return size_t(-1);
+  }
+  return pb_type_first_interconnect_indices_[parent_index][parent_mode->index] +
+         (pb_interconnect - parent_mode->interconnect);
+}
+
+size_t VprDeviceAnnotation::pb_graph_node_index(
+  const t_pb_graph_node* pb_graph_node) const {
+  const t_pb_graph_node* parent_node = pb_graph_node->parent_pb_graph_node;
+  if (nullptr == parent_node) {
+    return find_top_vpr_object_index(
+      top_pb_graph_nodes_, top_pb_graph_node_indices_, pb_graph_node);
+  }
+  size_t parent_index = pb_graph_node_index(parent_node);
+  if (size_t(-1) == parent_index) {
+    return size_t(-1);
+  }
+  const t_pb_type* pb_type = pb_graph_node->pb_type;
+  const t_mode* parent_mode = pb_type->parent_mode;
+  size_t parent_pb_type_index = pb_type_index(parent_node->pb_type);
+  return pb_graph_node_first_child_indices_[parent_index] +
+         pb_type_child_node_offsets_[parent_pb_type_index][parent_mode->index]
+                                    [pb_type - parent_mode->pb_type_children] +
+         pb_graph_node->placement_index;
+}
+
+size_t VprDeviceAnnotation::pb_graph_pin_index(
+  const t_pb_graph_pin* pb_graph_pin) const {
+  size_t node_index = pb_graph_node_index(pb_graph_pin->parent_node);
+  if (size_t(-1) == node_index) {
+    return size_t(-1);
+  }
+  return pb_graph_node_first_pin_indices_[node_index] +
+         pb_port_pin_offsets_[pb_port_index(pb_graph_pin->port)] +
+         pb_graph_pin->pin_number;
+}
+
+size_t VprDeviceAnnotation::physical_tile_index(
+  t_physical_tile_type_ptr physical_tile) const {
+  if ((0 > physical_tile->index) ||
+      (size_t(physical_tile->index) >=
+       physical_tile_pin2port_info_map_.size())) {
+    return size_t(-1);
+  }
+  return physical_tile->index;
+}
+
+const VprDeviceAnnotation::PhysicalPbPortPair*
+VprDeviceAnnotation::find_physical_pb_port_pair(
+  t_port* operating_pb_port, t_port* physical_pb_port) const {
+  size_t index = pb_port_index(operating_pb_port);
+  if (size_t(-1) == index) {
+    return nullptr;
+  }
+  for (const PhysicalPbPortPair& port_pair : physical_pb_port_pairs_[index]) {
+    if (physical_pb_port == port_pair.physical_pb_port) {
+      return &port_pair;
+    }
+  }
+  return nullptr;
+}
+
+size_t VprDeviceAnnotation::register_pb_type(t_pb_type* pb_type) {
+  size_t index = pb_type_index(pb_type);
+  if (size_t(-1) != index) {
+    return index;
+  }
+  const t_pb_type* top_pb_type = pb_type;
+  while (nullptr != top_pb_type->parent_mode) {
+    top_pb_type = top_pb_type->parent_mode->parent_pb_type;
+  }
+  size_t top_index = allocate_pb_type(top_pb_type);
+  top_pb_types_.push_back(top_pb_type);
+  top_pb_type_indices_.push_back(top_index);
+  allocate_pb_type_children(top_index, top_pb_type);
+  return pb_type_index(pb_type);
+}
+
+size_t VprDeviceAnnotation::register_pb_port(t_port* pb_port) {
+  register_pb_type(pb_port->parent_pb_type);
+  return pb_port_index(pb_port);
+}
+
+size_t VprDeviceAnnotation::register_interconnect(
+  t_interconnect* pb_interconnect) {
+  register_pb_type(pb_interconnect->parent_mode->parent_pb_type);
+  return interconnect_index(pb_interconnect);
+}
+
+size_t VprDeviceAnnotation::register_pb_graph_node(
+  t_pb_graph_node* pb_graph_node) {
+  size_t index = pb_graph_node_index(pb_graph_node);
+  if (size_t(-1) != index) {
+    return index;
+  }
+  const t_pb_graph_node* top_node = pb_graph_node;
+  while (nullptr != top_node->parent_pb_graph_node) {
+    top_node = top_node->parent_pb_graph_node;
+  }
+  /* The offsets of children and pins are found from the pb_types */
+  register_pb_type(top_node->pb_type);
+  size_t top_index = allocate_pb_graph_node(top_node);
+  top_pb_graph_nodes_.push_back(top_node);
+  top_pb_graph_node_indices_.push_back(top_index);
+  allocate_pb_graph_node_children(top_index, top_node);
+  return pb_graph_node_index(pb_graph_node);
+}
+
+size_t VprDeviceAnnotation::register_pb_graph_pin(
+  const t_pb_graph_pin* pb_graph_pin) {
+  register_pb_graph_node(pb_graph_pin->parent_node);
+  return pb_graph_pin_index(pb_graph_pin);
+}
+
+size_t VprDeviceAnnotation::register_physical_tile(
+  t_physical_tile_type_ptr physical_tile) {
+  VTR_ASSERT(0 <= physical_tile->index);
+  size_t index = physical_tile->index;
+  if (index >= physical_tile_pin2port_info_map_.size()) {
+    physical_tile_pin2port_info_map_.resize(index + 1);
+    physical_tile_pin_subtile_indices_.resize(index + 1);
+    physical_tile_z_to_subtile_indices_.resize(index + 1);
+    physical_tile_z_to_start_pin_indices_.resize(index + 1);
+  }
+  return index;
+}
+
+VprDeviceAnnotation::PhysicalPbPortPair&
+VprDeviceAnnotation::register_physical_pb_port_pair(t_port* operating_pb_port,
+                                                    t_port* physical_pb_port) {
+  std::vector<PhysicalPbPortPair>& port_pairs =
+    physical_pb_port_pairs_[register_pb_port(operating_pb_port)];
+  for (PhysicalPbPortPair& port_pair : port_pairs) {
+    if (physical_pb_port == port_pair.physical_pb_port) {
+      return port_pair;
+    }
+  }
+  port_pairs.emplace_back();
+  port_pairs.back().physical_pb_port = physical_pb_port;
+  return port_pairs.back();
+}
+
+/* Allocate the annotation storage of a pb_type, as well as its ports and
+ * interconnects, which are indexed contiguously */
+size_t VprDeviceAnnotation::allocate_pb_type(const t_pb_type* pb_type) {
+  size_t index = physical_pb_types_.size();
+  physical_pb_types_.push_back(nullptr);
+  pb_type_index_factor_annotated_.push_back(false);
+  physical_pb_type_index_factors_.push_back(1.);
+  pb_type_index_offset_annotated_.push_back(false);
+  physical_pb_type_index_offsets_.push_back(0);
+  physical_pb_modes_.push_back(nullptr);
+  pb_type_circuit_models_.push_back(CircuitModelId::INVALID());
+  pb_type_mode_bits_annotated_.push_back(false);
+  pb_type_mode_bits_.emplace_back();
+  pb_graph_node_unique_index_.emplace_back();
+
+  pb_type_first_port_indices_.push_back(physical_pb_ports_.size());
+  size_t num_pins = 0;
+  for (int iport = 0; iport < pb_type->num_ports; ++iport) {
+    physical_pb_ports_.emplace_back();
+    physical_pb_port_pairs_.emplace_back();
+    pb_circuit_ports_.push_back(CircuitPortId::INVALID());
+    pb_port_pin_offsets_.push_back(num_pins);
+    num_pins += pb_type->ports[iport].num_pins;
+  }
+  pb_type_num_pins_.push_back(num_pins);
+
+  pb_type_first_interconnect_indices_.emplace_back();
+  pb_type_child_node_offsets_.emplace_back();
+  size_t num_child_nodes = 0;
+  for (int imode = 0; imode < pb_type->num_modes; ++imode) {
+    const t_mode& mode = pb_type->modes[imode];
+    pb_type_first_interconnect_indices_[index].push_back(
+      interconnect_circuit_models_.size());
+    interconnect_circuit_models_.resize(
+      interconnect_circuit_models_.size() + mode.num_interconnect,
+      CircuitModelId::INVALID());
+    interconnect_physical_types_.resize(
+      interconnect_physical_types_.size() + mode.num_interconnect,
+      NUM_INTERC_TYPES);
+    pb_type_child_node_offsets_[index].emplace_back();
+    for (int ichild = 0; ichild < mode.num_pb_type_children; ++ichild) {
+      pb_type_child_node_offsets_[index][imode].push_back(num_child_nodes);
+      num_child_nodes += mode.pb_type_children[ichild].num_pb;
+    }
+  }
+  /* The child pb_types are indexed when they are allocated */
+  pb_type_first_child_indices_.emplace_back(pb_type->num_modes, size_t(-1));
+  return index;
+}
+
+/* Allocate the child pb_types of each mode contiguously, then go down the
+ * hierarchy */
+void VprDeviceAnnotation::allocate_pb_type_children(const size_t& index,
+                                                    const t_pb_type* pb_type) {
+  for (int imode = 0; imode < pb_type->num_modes; ++imode) {
+    const t_mode& mode = pb_type->modes[imode];
+    pb_type_first_child_indices_[index][imode] = physical_pb_types_.size();
+    for (int ichild = 0; ichild < mode.num_pb_type_children; ++ichild) {
+      allocate_pb_type(&(mode.pb_type_children[ichild]));
+    }
+  }
+  for (int imode = 0; imode < pb_type->num_modes; ++imode) {
+    const t_mode& mode = pb_type->modes[imode];
+    for (int ichild = 0; ichild < mode.num_pb_type_children; ++ichild) {
+      allocate_pb_type_children(
+        pb_type_first_child_indices_[index][imode] + ichild,
+        &(mode.pb_type_children[ichild]));
+    }
+  }
+}
+
+/* Allocate the annotation storage of a pb_graph_node and its pins, which are
+ * indexed contiguously */
+size_t VprDeviceAnnotation::allocate_pb_graph_node(
+  const t_pb_graph_node* pb_graph_node) {
+  size_t index = physical_pb_graph_nodes_.size();
+  physical_pb_graph_nodes_.push_back(nullptr);
+  pb_graph_node_unique_ids_.push_back(PbGraphNodeId::INVALID());
+  pb_graph_node_first_child_indices_.push_back(size_t(-1));
+  pb_graph_node_first_pin_indices_.push_back(physical_pb_graph_pins_.size());
+  physical_pb_graph_pins_.resize(
+    physical_pb_graph_pins_.size() +
+      pb_type_num_pins_[pb_type_index(pb_graph_node->pb_type)],
+    nullptr);
+  return index;
+}
+
+/* Allocate the child pb_graph_nodes of a pb_graph_node contiguously, in the
+ * order of the modes, the child pb_types and the placement indices, then go
+ * down the hierarchy */
+void VprDeviceAnnotation::allocate_pb_graph_node_children(
+  const size_t& index, const t_pb_graph_node* pb_graph_node) {
+  const t_pb_type* pb_type = pb_graph_node->pb_type;
+  pb_graph_node_first_child_indices_[index] = physical_pb_graph_nodes_.size();
+  for (int imode = 0; imode < pb_type->num_modes; ++imode) {
+    const t_mode& mode = pb_type->modes[imode];
+    for (int ichild = 0; ichild < mode.num_pb_type_children; ++ichild) {
+      for (int ipb = 0; ipb < mode.pb_type_children[ichild].num_pb; ++ipb) {
+        allocate_pb_graph_node(
+          &(pb_graph_node->child_pb_graph_nodes[imode][ichild][ipb]));
+      }
+    }
+  }
+  size_t child_index = pb_graph_node_first_child_indices_[index];
+  for (int imode = 0; imode < pb_type->num_modes; ++imode) {
+    const t_mode& mode = pb_type->modes[imode];
+    for (int ichild = 0; ichild < mode.num_pb_type_children; ++ichild) {
+      for (int ipb = 0; ipb < mode.pb_type_children[ichild].num_pb; ++ipb) {
+        allocate_pb_graph_node_children(
+          child_index,
+          &(pb_graph_node->child_pb_graph_nodes[imode][ichild][ipb]));
+        child_index++;
+      }
+    }
+  }
 }
 
 } /* End namespace openfpga*/
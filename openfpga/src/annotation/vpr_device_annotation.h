@@ -5,9 +5,11 @@
  * Include header files required by the data structure definition
  *******************************************************************/
 #include <map>
+#include <vector>
 
 /* Header from vtrutil library */
 #include "vtr_strong_id.h"
+#include "vtr_vector.h"
 
 /* Header from archfpga library */
 #include "physical_types.h"
@@ -156,36 +158,124 @@ class VprDeviceAnnotation {
     t_physical_tile_type_ptr physical_tile, const int& subtile_z,
     const int& start_pin_index);
 
+ private: /* Internal types */
+  /* Annotation between an operating pb_port and one of its physical pb_port */
+  struct PhysicalPbPortPair {
+    t_port* physical_pb_port = nullptr;
+    /* LSB and MSB of the physical pb_port
+     * Note:
+     * - the LSB and MSB MUST be in range of the physical pb_port
+     */
+    bool has_port_range = false;
+    BasicPort port_range;
+    bool has_pin_initial_offset = false;
+    int pin_initial_offset = 0;
+    bool has_pin_rotate_offset = false;
+    int pin_rotate_offset = 0;
+    bool has_port_rotate_offset = false;
+    int port_rotate_offset = 0;
+    /* Accumulated offsets for a physical pb port, just for internal usage */
+    int port_offset = 0;
+    /* Accumulated offsets for a physical pb_graph_pin, just for internal usage
+     */
+    int pin_offset = 0;
+  };
+
+ private: /* Internal functions */
+  /* Find the dense index of an annotated object of VPR.
+   * Return size_t(-1) if the object has never been annotated */
+  size_t pb_type_index(const t_pb_type* pb_type) const;
+  size_t pb_port_index(const t_port* pb_port) const;
+  size_t interconnect_index(const t_interconnect* pb_interconnect) const;
+  size_t pb_graph_node_index(const t_pb_graph_node* pb_graph_node) const;
+  size_t pb_graph_pin_index(const t_pb_graph_pin* pb_graph_pin) const;
+  size_t physical_tile_index(t_physical_tile_type_ptr physical_tile) const;
+  const PhysicalPbPortPair* find_physical_pb_port_pair(
+    t_port* operating_pb_port, t_port* physical_pb_port) const;
+
+  /* Assign dense indices to all the pb_types (pb_graph_nodes) of a logical
+   * block when any of them is annotated for the first time, and allocate
+   * the annotation storage */
+  size_t register_pb_type(t_pb_type* pb_type);
+  size_t register_pb_port(t_port* pb_port);
+  size_t register_interconnect(t_interconnect* pb_interconnect);
+  size_t register_pb_graph_node(t_pb_graph_node* pb_graph_node);
+  size_t register_pb_graph_pin(const t_pb_graph_pin* pb_graph_pin);
+  size_t register_physical_tile(t_physical_tile_type_ptr physical_tile);
+  PhysicalPbPortPair& register_physical_pb_port_pair(t_port* operating_pb_port,
+                                                     t_port* physical_pb_port);
+  size_t allocate_pb_type(const t_pb_type* pb_type);
+  void allocate_pb_type_children(const size_t& index,
+                                 const t_pb_type* pb_type);
+  size_t allocate_pb_graph_node(const t_pb_graph_node* pb_graph_node);
+  void allocate_pb_graph_node_children(const size_t& index,
+                                       const t_pb_graph_node* pb_graph_node);
+
  private: /* Internal data */
+  /* Dense indices of the objects of VPR, by which all the annotations below
+   * are stored in arrays.
+   * - Physical tiles are indexed by t_physical_tile_type::index
+   * - The top-level pb_type (pb_graph_node) of each logical block is found in
+   *   a short list. Its index is assigned when any object of the logical
+   *   block is annotated for the first time, along with the indices of all
+   *   the objects under it. The objects under the same parent are indexed
+   *   contiguously, in the order of the arrays of VPR.
+   * - Any other object is indexed by its position in the arrays of its
+   *   parent, e.g., the index of a child pb_type is the index of the first
+   *   child of its parent mode plus its offset in t_mode::pb_type_children
+   */
+  std::vector<const t_pb_type*> top_pb_types_;
+  std::vector<size_t> top_pb_type_indices_;
+  /* Indices of the first child pb_type and of the first interconnect of each
+   * mode of a pb_type */
+  std::vector<std::vector<size_t>> pb_type_first_child_indices_;
+  std::vector<std::vector<size_t>> pb_type_first_interconnect_indices_;
+  std::vector<size_t> pb_type_first_port_indices_;
+  /* Offsets of the child pb_graph_nodes of a pb_graph_node, per mode and per
+   * child pb_type of its pb_type */
+  std::vector<std::vector<std::vector<size_t>>> pb_type_child_node_offsets_;
+  /* Offsets of the pins of a pb_graph_node, per port of its pb_type, and the
+   * number of all the pins */
+  std::vector<size_t> pb_port_pin_offsets_;
+  std::vector<size_t> pb_type_num_pins_;
+
+  std::vector<const t_pb_graph_node*> top_pb_graph_nodes_;
+  std::vector<size_t> top_pb_graph_node_indices_;
+  /* Indices of the first child and of the first pin of a pb_graph_node */
+  std::vector<size_t> pb_graph_node_first_child_indices_;
+  std::vector<size_t> pb_graph_node_first_pin_indices_;
+
   /* Pair a regular pb_type to its physical pb_type */
-  std::map<t_pb_type*, t_pb_type*> physical_pb_types_;
-  std::map<t_pb_type*, float> physical_pb_type_index_factors_;
-  std::map<t_pb_type*, int> physical_pb_type_index_offsets_;
+  std::vector<t_pb_type*> physical_pb_types_;
+  std::vector<bool> pb_type_index_factor_annotated_;
+  std::vector<float> physical_pb_type_index_factors_;
+  std::vector<bool> pb_type_index_offset_annotated_;
+  std::vector<int> physical_pb_type_index_offsets_;
 
   /* Pair a physical mode for a pb_type
    * Note:
    * - the physical mode MUST be a child mode of the pb_type
    * - the pb_type MUST be a physical pb_type itself
    */
-  std::map<t_pb_type*, t_mode*> physical_pb_modes_;
+  std::vector<t_mode*> physical_pb_modes_;
 
   /* Pair a physical pb_type to its circuit model
    * Note:
    * - the pb_type MUST be a physical pb_type itself
    */
-  std::map<t_pb_type*, CircuitModelId> pb_type_circuit_models_;
+  std::vector<CircuitModelId> pb_type_circuit_models_;
 
   /* Pair a interconnect of a physical pb_type to its circuit model
    * Note:
    * - the pb_type MUST be a physical pb_type itself
    */
-  std::map<t_interconnect*, CircuitModelId> interconnect_circuit_models_;
+  std::vector<CircuitModelId> interconnect_circuit_models_;
 
   /* Physical type of interconnect
    * Note:
    * - only applicable to an interconnect belongs to physical mode
    */
-  std::map<t_interconnect*, e_interconnect> interconnect_physical_types_;
+  std::vector<e_interconnect> interconnect_physical_types_;
 
   /* Pair a pb_type to its mode selection bits
    * - if the pb_type is a physical pb_type, the mode bits are the default mode
@@ -193,81 +283,67 @@ class VprDeviceAnnotation {
    * - if the pb_type is an operating pb_type, the mode bits will be applied
    *   when the operating pb_type is used by packer
    */
-  std::map<t_pb_type*, std::vector<size_t>> pb_type_mode_bits_;
+  std::vector<bool> pb_type_mode_bits_annotated_;
+  std::vector<std::vector<size_t>> pb_type_mode_bits_;
 
-  /* Pair a pb_port to its physical pb_port
+  /* Pair a pb_port to its physical pb_ports
    * Note:
    * - the parent of physical pb_port MUST be a physical pb_type
+   * - an operating pb_port is paired with only a few physical pb_ports,
+   *   so that a linear search is faster than any tree
    */
-  std::map<t_port*, std::vector<t_port*>> physical_pb_ports_;
-  std::map<t_port*, std::map<t_port*, int>> physical_pb_pin_initial_offsets_;
-  std::map<t_port*, std::map<t_port*, int>> physical_pb_pin_rotate_offsets_;
-  std::map<t_port*, std::map<t_port*, int>> physical_pb_port_rotate_offsets_;
-
-  /* Accumulated offsets for a physical pb port, just for internal usage */
-  std::map<t_port*, std::map<t_port*, int>> physical_pb_port_offsets_;
-  /* Accumulated offsets for a physical pb_graph_pin, just for internal usage */
-  std::map<t_port*, std::map<t_port*, int>> physical_pb_pin_offsets_;
-
-  /* Pair a pb_port to its LSB and MSB of a physical pb_port
-   * Note:
-   * - the LSB and MSB MUST be in range of the physical pb_port
-   */
-  std::map<t_port*, std::map<t_port*, BasicPort>> physical_pb_port_ranges_;
+  std::vector<std::vector<t_port*>> physical_pb_ports_;
+  std::vector<std::vector<PhysicalPbPortPair>> physical_pb_port_pairs_;
 
   /* Pair a pb_port to a circuit port in circuit model
    * Note:
    * - the parent of physical pb_port MUST be a physical pb_type
    */
-  std::map<t_port*, CircuitPortId> pb_circuit_ports_;
+  std::vector<CircuitPortId> pb_circuit_ports_;
 
   /* Pair each pb_graph_node to an unique index in the graph
    * The unique index if the index in the array of t_pb_graph_node*
    */
-  std::map<t_pb_type*, std::vector<t_pb_graph_node*>>
-    pb_graph_node_unique_index_;
+  std::vector<std::vector<t_pb_graph_node*>> pb_graph_node_unique_index_;
+  std::vector<PbGraphNodeId> pb_graph_node_unique_ids_;
 
   /* Pair a pb_graph_node to a physical pb_graph_node
    * Note:
    * - the pb_type of physical pb_graph_node must be a physical pb_type
    */
-  std::map<t_pb_graph_node*, t_pb_graph_node*> physical_pb_graph_nodes_;
+  std::vector<t_pb_graph_node*> physical_pb_graph_nodes_;
 
   /* Pair a pb_graph_pin to a physical pb_graph_pin */
-  std::map<const t_pb_graph_pin*, t_pb_graph_pin*> physical_pb_graph_pins_;
+  std::vector<t_pb_graph_pin*> physical_pb_graph_pins_;
 
   /* Pair a Routing Resource Switch (rr_switch) to a circuit model */
-  std::map<RRSwitchId, CircuitModelId> rr_switch_circuit_models_;
+  vtr::vector<RRSwitchId, CircuitModelId> rr_switch_circuit_models_;
 
   /* Pair a Routing Segment (rr_segment) to a circuit model */
-  std::map<RRSegmentId, CircuitModelId> rr_segment_circuit_models_;
+  vtr::vector<RRSegmentId, CircuitModelId> rr_segment_circuit_models_;
 
   /* Pair a direct connection (direct) to a annotation which contains circuit
    * model id */
-  std::map<size_t, ArchDirectId> direct_annotations_;
+  std::vector<ArchDirectId> direct_annotations_;
 
   /* Logical type routing resource graphs built from physical modes */
   std::map<t_pb_graph_node*, LbRRGraph> physical_lb_rr_graphs_;
 
   /* A fast look-up from pin index in physical tile to physical tile port */
-  std::map<t_physical_tile_type_ptr, std::map<int, BasicPort>>
-    physical_tile_pin2port_info_map_;
+  std::vector<std::vector<BasicPort>> physical_tile_pin2port_info_map_;
   /* A fast look-up from pin index in physical tile to sub tile index */
-  std::map<t_physical_tile_type_ptr, std::map<int, int>>
-    physical_tile_pin_subtile_indices_;
+  std::vector<std::vector<int>> physical_tile_pin_subtile_indices_;
   /* A fast look-up from z (a valid instance index considering all the sub tiles
    * in a given physical tile) to the index in sub tile array The instance index
    * starts from 0 to the sum of the capacity of each sub tile
    */
-  std::map<t_physical_tile_type_ptr, std::map<int, int>>
-    physical_tile_z_to_subtile_indices_;
+  std::vector<std::vector<int>> physical_tile_z_to_subtile_indices_;
   /* A fast look-up from z (a valid instance index considering all the sub tiles
    * in a given physical tile) to the index of the first pin in a given physcial
    * tile The instance index starts from 0 to the sum of the capacity of each
    * sub tile
    */
-  std::map<t_physical_tile_type_ptr, std::map<int, int>>
-    physical_tile_z_to_start_pin_indices_;
+  std::vector<std::vector<int>> physical_tile_z_to_start_pin_indices_;
 };
 
 } /* End namespace openfpga*/
@@ -0,0 +1,147 @@
+/********************************************************************
+ * This file includes functions to read the list of designs whose
+ * bitstreams are built in a batch on the same FPGA fabric, and to find
+ * the commands which build the bitstream of each design
+ *******************************************************************/
+#include <fstream>
+#include <sstream>
+
+/* Headers from vtrutil library */
+#include "vtr_log.h"
+
+/* Headers from openfpgashell library */
+#include "command_exit_codes.h"
+
+/* Headers from openfpgautil library */
+#include "openfpga_tokenizer.h"
+
+#include "openfpga_bitstream_batch.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/**************************************************
+ * Constants
+ *************************************************/
+constexpr const char BITSTREAM_BATCH_COMMENT = '#';
+
+/********************************************************************
+ * Read a list of designs from a plain text file. Each line describes a
+ * design, in the format of
+ *   <design_name> <vpr_options>
+ * where the VPR options are the same as those given to the 'vpr' command.
+ * Empty lines and lines starting with '#' are skipped.
+ *
+ * Return CMD_EXEC_SUCCESS if all the designs are read
+ * Return CMD_EXEC_FATAL_ERROR otherwise
+ *******************************************************************/
+int read_bitstream_batch_designs(const std::string& fname,
+                                 std::vector<BitstreamBatchDesign>& designs) {
+  std::ifstream fp(fname);
+  if (!fp.is_open()) {
+    VTR_LOG_ERROR("Fail to open design list file '%s'!\n", fname.c_str());
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  int num_err = 0;
+  size_t line_num = 0;
+  std::string line;
+  while (std::getline(fp, line)) {
+    line_num++;
+    std::stringstream ss(line);
+    BitstreamBatchDesign design;
+    if (!(ss >> design.name) || (BITSTREAM_BATCH_COMMENT == design.name[0])) {
+      continue;
+    }
+    std::getline(ss, design.vpr_options);
+    /* Remove the leading spaces, the rest is passed to VPR as it is */
+    size_t options_start = design.vpr_options.find_first_not_of(" \t");
+    if (std::string::npos == options_start) {
+      VTR_LOG_ERROR(
+        "Missing VPR options for design '%s' at line %lu of '%s'!\n",
+        design.name.c_str(), line_num, fname.c_str());
+      num_err++;
+      continue;
+    }
+    design.vpr_options.erase(0, options_start);
+
+    for (const BitstreamBatchDesign& existing_design : designs) {
+      if (existing_design.name == design.name) {
+        VTR_LOG_ERROR("Duplicated design '%s' at line %lu of '%s'!\n",
+                      design.name.c_str(), line_num, fname.c_str());
+        num_err++;
+      }
+    }
+    designs.push_back(design);
+  }
+
+  if (num_err) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+  return CMD_EXEC_SUCCESS;
+}
+
+/********************************************************************
+ * Find the commands to build and write the bitstream of a design from the
+ * options of a command, which may include
+ * - '--design_commands': fix-up commands separated by ';'
+ * - '--format': file format of the fabric bitstream
+ * - '--no_time_stamp' and '--verbose'
+ *
+ * Return CMD_EXEC_SUCCESS if the options are valid
+ * Return CMD_EXEC_FATAL_ERROR otherwise
+ *******************************************************************/
+int find_design_bitstream_commands(const Command& cmd,
+                                   const CommandContext& cmd_context,
+                                   DesignBitstreamCommands& design_cmds) {
+  CommandOptionId opt_design_cmds = cmd.option("design_commands");
+  CommandOptionId opt_file_format = cmd.option("format");
+  CommandOptionId opt_no_time_stamp = cmd.option("no_time_stamp");
+  CommandOptionId opt_verbose = cmd.option("verbose");
+
+  /* Check file format requirements */
+  std::string file_format("plain_text");
+  if (true == cmd_context.option_enable(cmd, opt_file_format)) {
+    file_format = cmd_context.option_value(cmd, opt_file_format);
+  }
+  if ((std::string("plain_text") != file_format) &&
+      (std::string("xml") != file_format)) {
+    VTR_LOG_ERROR("Invalid file format '%s' for fabric bitstream!\n",
+                  file_format.c_str());
+    return CMD_EXEC_FATAL_ERROR;
+  }
+  design_cmds.file_suffix = std::string(".bit");
+  if (std::string("xml") == file_format) {
+    design_cmds.file_suffix = std::string(".xml");
+  }
+
+  /* Commands which are executed for each design after re-linking */
+  design_cmds.build_commands.clear();
+  if (true == cmd_context.option_enable(cmd, opt_design_cmds)) {
+    StringToken cmd_ss_tokenizer(
+      cmd_context.option_value(cmd, opt_design_cmds));
+    for (std::string cmd_part : cmd_ss_tokenizer.split(";")) {
+      StringToken cmd_part_tokenizer(cmd_part);
+      cmd_part_tokenizer.trim();
+      if (!cmd_part_tokenizer.data().empty()) {
+        design_cmds.build_commands.push_back(cmd_part_tokenizer.data());
+      }
+    }
+  }
+  design_cmds.build_commands.push_back(std::string("repack"));
+  design_cmds.build_commands.push_back(
+    std::string("build_architecture_bitstream"));
+  design_cmds.build_commands.push_back(std::string("build_fabric_bitstream"));
+
+  design_cmds.write_options = std::string(" --format ") + file_format;
+  if (true == cmd_context.option_enable(cmd, opt_no_time_stamp)) {
+    design_cmds.write_options += std::string(" --no_time_stamp");
+  }
+  if (true == cmd_context.option_enable(cmd, opt_verbose)) {
+    design_cmds.write_options += std::string(" --verbose");
+  }
+
+  return CMD_EXEC_SUCCESS;
+}
+
+} /* end namespace openfpga */
@@ -0,0 +1,50 @@
+#ifndef OPENFPGA_BITSTREAM_BATCH_H
+#define OPENFPGA_BITSTREAM_BATCH_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include <string>
+#include <vector>
+
+#include "command.h"
+#include "command_context.h"
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/* A design to be processed in a batch of bitstream generation:
+ * - the name of the design, used to name the output files
+ * - the options to run VPR on the design
+ */
+struct BitstreamBatchDesign {
+  std::string name;
+  std::string vpr_options;
+};
+
+/* The commands to build and write the bitstream of a design, once the
+ * VPR results of the design are linked:
+ * - the commands to build the bitstream, including the fix-up commands
+ * - the options of the 'write_fabric_bitstream' command, except the file path
+ * - the suffix of the bitstream file name
+ */
+struct DesignBitstreamCommands {
+  std::vector<std::string> build_commands;
+  std::string write_options;
+  std::string file_suffix;
+};
+
+int read_bitstream_batch_designs(const std::string& fname,
+                                 std::vector<BitstreamBatchDesign>& designs);
+
+int find_design_bitstream_commands(const Command& cmd,
+                                   const CommandContext& cmd_context,
+                                   DesignBitstreamCommands& design_cmds);
+
+} /* end namespace openfpga */
+
+#endif
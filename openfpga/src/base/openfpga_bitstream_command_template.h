@@ -74,6 +74,12 @@ ShellCommandId add_build_arch_bitstream_command_template(
     "read_file", false, "file path to read the bitstream database");
   shell_cmd.set_option_require_value(opt_read_file, openfpga::OPT_STRING);
 
+  /* Add an option '--stream_read' */
+  shell_cmd.add_option("stream_read", false,
+                       "Read the bitstream database with a streaming parser, "
+                       "which uses less memory and accepts gzip-compressed "
+                       "files");
+
   /* Add an option '--no_time_stamp' */
   shell_cmd.add_option("no_time_stamp", false,
                        "Do not print time stamp in output files");
@@ -257,6 +263,125 @@ ShellCommandId add_write_io_mapping_command_template(
   return shell_cmd_id;
 }
 
+/********************************************************************
+ * - Add a command to Shell environment: build_bitstreams_batch
+ * - Add associated options
+ * - Add command dependency
+ *******************************************************************/
+template <class T>
+ShellCommandId add_build_bitstreams_batch_command_template(
+  openfpga::Shell<T>& shell, const ShellCommandClassId& cmd_class_id,
+  const std::vector<ShellCommandId>& dependent_cmds, const bool& hidden) {
+  Command shell_cmd("build_bitstreams_batch");
+
+  /* Add an option '--designs' */
+  CommandOptionId opt_designs = shell_cmd.add_option(
+    "designs", true,
+    "file path to the list of designs, each line in the format of "
+    "'<design_name> <vpr_options>'");
+  shell_cmd.set_option_require_value(opt_designs, openfpga::OPT_STRING);
+
+  /* Add an option '--output_dir' */
+  CommandOptionId opt_output_dir = shell_cmd.add_option(
+    "output_dir", false,
+    "directory to output the fabric bitstreams. Default: current directory");
+  shell_cmd.set_option_require_value(opt_output_dir, openfpga::OPT_STRING);
+
+  /* Add an option '--design_commands' */
+  CommandOptionId opt_design_cmds = shell_cmd.add_option(
+    "design_commands", false,
+    "commands separated by ';' to be executed for each design before "
+    "repacking, e.g., 'pb_pin_fixup;lut_truth_table_fixup'");
+  shell_cmd.set_option_require_value(opt_design_cmds, openfpga::OPT_STRING);
+
+  /* Add an option '--format'*/
+  CommandOptionId opt_file_format = shell_cmd.add_option(
+    "format", false,
+    "file format of fabric bitstream [plain_text|xml]. Default: plain_text");
+  shell_cmd.set_option_require_value(opt_file_format, openfpga::OPT_STRING);
+
+  /* Add an option '--no_time_stamp' */
+  shell_cmd.add_option("no_time_stamp", false,
+                       "Do not print time stamp in output files");
+
+  /* Add an option '--verbose' */
+  shell_cmd.add_option("verbose", false, "Enable verbose output");
+
+  /* Add command 'build_bitstreams_batch' to the Shell */
+  ShellCommandId shell_cmd_id = shell.add_command(
+    shell_cmd,
+    "Build and write the fabric bitstreams of a list of designs, reusing the "
+    "FPGA fabric which has been built",
+    hidden);
+  shell.set_command_class(shell_cmd_id, cmd_class_id);
+  shell.set_command_execute_function(shell_cmd_id,
+                                     build_bitstreams_batch_template<T>);
+
+  /* Add command dependency to the Shell */
+  shell.set_command_dependency(shell_cmd_id, dependent_cmds);
+
+  return shell_cmd_id;
+}
+
+/********************************************************************
+ * - Add a command to Shell environment: start_bitstream_server
+ * - Add associated options
+ * - Add command dependency
+ *******************************************************************/
+template <class T>
+ShellCommandId add_start_bitstream_server_command_template(
+  openfpga::Shell<T>& shell, const ShellCommandClassId& cmd_class_id,
+  const std::vector<ShellCommandId>& dependent_cmds, const bool& hidden) {
+  Command shell_cmd("start_bitstream_server");
+
+  /* Add an option '--socket' */
+  CommandOptionId opt_socket = shell_cmd.add_option(
+    "socket", true, "file path of the Unix domain socket to listen at");
+  shell_cmd.set_option_require_value(opt_socket, openfpga::OPT_STRING);
+
+  /* Add an option '--queue_size' */
+  CommandOptionId opt_queue_size = shell_cmd.add_option(
+    "queue_size", false,
+    "maximum number of jobs waiting in the queue. Default: 16");
+  shell_cmd.set_option_require_value(opt_queue_size, openfpga::OPT_INT);
+
+  /* Add an option '--design_commands' */
+  CommandOptionId opt_design_cmds = shell_cmd.add_option(
+    "design_commands", false,
+    "commands separated by ';' to be executed for each design before "
+    "repacking, e.g., 'pb_pin_fixup;lut_truth_table_fixup'");
+  shell_cmd.set_option_require_value(opt_design_cmds, openfpga::OPT_STRING);
+
+  /* Add an option '--format'*/
+  CommandOptionId opt_file_format = shell_cmd.add_option(
+    "format", false,
+    "file format of fabric bitstream [plain_text|xml]. Default: plain_text");
+  shell_cmd.set_option_require_value(opt_file_format, openfpga::OPT_STRING);
+
+  /* Add an option '--no_time_stamp' */
+  shell_cmd.add_option("no_time_stamp", false,
+                       "Do not print time stamp in output files");
+
+  /* Add an option '--verbose' */
+  shell_cmd.add_option("verbose", false, "Enable verbose output");
+
+  /* Add command 'start_bitstream_server' to the Shell */
+  ShellCommandId shell_cmd_id = shell.add_command(
+    shell_cmd,
+    "Start a server building the fabric bitstreams of the designs requested "
+    "through a Unix domain socket, reusing the FPGA fabric which has been "
+    "built",
+    hidden);
+  shell.set_command_class(shell_cmd_id, cmd_class_id);
+  shell.set_command_execute_function(shell_cmd_id,
+                                     start_bitstream_server_template<T>);
+
+  /* Add command dependency to the Shell */
+  shell.set_command_dependency(shell_cmd_id, dependent_cmds);
+
+  return shell_cmd_id;
+}
+
 /********************************************************************
  * Top-level function to add all the commands related to FPGA-Bitstream
  *******************************************************************/
@@ -340,6 +465,28 @@ void add_bitstream_command_templates(openfpga::Shell<T>& shell,
   add_write_io_mapping_command_template(shell, openfpga_bitstream_cmd_class,
                                         cmd_dependency_write_io_mapping,
                                         hidden);
+
+  /********************************
+   * Command 'build_bitstreams_batch'
+   */
+  /* The 'build_bitstreams_batch' command should NOT be executed before
+   * 'build_fabric' */
+  std::vector<ShellCommandId> cmd_dependency_build_bitstreams_batch;
+  cmd_dependency_build_bitstreams_batch.push_back(shell_cmd_build_fabric_id);
+  add_build_bitstreams_batch_command_template(
+    shell, openfpga_bitstream_cmd_class, cmd_dependency_build_bitstreams_batch,
+    hidden);
+
+  /********************************
+   * Command 'start_bitstream_server'
+   */
+  /* The 'start_bitstream_server' command should NOT be executed before
+   * 'build_fabric' */
+  std::vector<ShellCommandId> cmd_dependency_start_bitstream_server;
+  cmd_dependency_start_bitstream_server.push_back(shell_cmd_build_fabric_id);
+  add_start_bitstream_server_command_template(
+    shell, openfpga_bitstream_cmd_class, cmd_dependency_start_bitstream_server,
+    hidden);
 }
 
 } /* end namespace openfpga */
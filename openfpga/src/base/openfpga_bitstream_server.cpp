@@ -0,0 +1,295 @@
+/********************************************************************
+ * This file includes functions of the bitstream server, which receives
+ * bitstream jobs from local clients through a Unix domain socket.
+ *
+ * A client sends one request per connection, as a line of text:
+ * - '<bitstream_file> <vpr_options>' to build the fabric bitstream of a
+ *   design and write it to the given file. The reply is
+ *   'OK <bitstream_file>' or 'ERROR <bitstream_file>' once the job is done,
+ *   or 'BUSY' if the job queue is full.
+ * - 'shutdown' to stop the server once the queued jobs are done.
+ *******************************************************************/
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <sstream>
+
+#ifndef _WIN32
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+/* Headers from vtrutil library */
+#include "vtr_log.h"
+
+/* Headers from openfpgashell library */
+#include "command_exit_codes.h"
+
+#include "openfpga_bitstream_server.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/**************************************************
+ * Constants
+ *************************************************/
+constexpr size_t BITSTREAM_SERVER_MAX_REQUEST_SIZE = 1 << 16;
+constexpr int BITSTREAM_SERVER_BACKLOG = 16;
+/* Time given to a client to send its request, in milliseconds. Requests are
+ * read by the thread accepting clients, which must not be held by a client */
+constexpr int BITSTREAM_SERVER_REQUEST_TIMEOUT = 5000;
+constexpr const char* BITSTREAM_SERVER_SHUTDOWN_REQUEST = "shutdown";
+
+/************************************************************************
+ * Member functions of class BitstreamServerJobQueue
+ ***********************************************************************/
+BitstreamServerJobQueue::BitstreamServerJobQueue(const size_t& capacity)
+  : capacity_(capacity), closed_(false) {}
+
+bool BitstreamServerJobQueue::push(const BitstreamServerJob& job) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (closed_ || jobs_.size() >= capacity_) {
+      return false;
+    }
+    jobs_.push_back(job);
+  }
+  job_ready_.notify_one();
+  return true;
+}
+
+bool BitstreamServerJobQueue::pop(BitstreamServerJob& job) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  job_ready_.wait(lock, [this] { return closed_ || !jobs_.empty(); });
+  if (jobs_.empty()) {
+    return false;
+  }
+  job = jobs_.front();
+  jobs_.pop_front();
+  return true;
+}
+
+void BitstreamServerJobQueue::close() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    closed_ = true;
+  }
+  job_ready_.notify_all();
+}
+
+#ifndef _WIN32
+/********************************************************************
+ * Send a message to a client, ignoring a client which has gone away
+ *******************************************************************/
+static void send_bitstream_server_message(const int& client,
+                                          const std::string& msg) {
+  int flags = 0;
+#ifdef MSG_NOSIGNAL
+  flags = MSG_NOSIGNAL;
+#endif
+  size_t num_sent = 0;
+  while (num_sent < msg.size()) {
+    ssize_t ret =
+      send(client, msg.data() + num_sent, msg.size() - num_sent, flags);
+    if (ret < 0 && EINTR == errno) {
+      continue;
+    }
+    if (ret <= 0) {
+      return;
+    }
+    num_sent += ret;
+  }
+}
+
+/********************************************************************
+ * Read a request line from a client
+ * Return false if the connection fails, the request is too long or the
+ * client does not complete its request in time
+ *******************************************************************/
+static bool read_bitstream_server_request(const int& client,
+                                          std::string& request) {
+  request.clear();
+  char buffer[4096];
+  std::chrono::steady_clock::time_point deadline =
+    std::chrono::steady_clock::now() +
+    std::chrono::milliseconds(BITSTREAM_SERVER_REQUEST_TIMEOUT);
+  while (request.size() < BITSTREAM_SERVER_MAX_REQUEST_SIZE) {
+    int timeout = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    deadline - std::chrono::steady_clock::now())
+                    .count();
+    if (timeout <= 0) {
+      return false;
+    }
+    struct pollfd client_fd;
+    client_fd.fd = client;
+    client_fd.events = POLLIN;
+    client_fd.revents = 0;
+    int num_ready = poll(&client_fd, 1, timeout);
+    if (num_ready < 0 && EINTR == errno) {
+      continue;
+    }
+    if (num_ready <= 0) {
+      return false;
+    }
+    ssize_t ret = recv(client, buffer, sizeof(buffer), 0);
+    if (ret < 0 && EINTR == errno) {
+      continue;
+    }
+    if (ret < 0) {
+      return false;
+    }
+    if (0 == ret) {
+      /* The client has closed its side without a new line */
+      return true;
+    }
+    request.append(buffer, ret);
+    size_t line_end = request.find('\n');
+    if (std::string::npos != line_end) {
+      request.resize(line_end);
+      return true;
+    }
+  }
+  return false;
+}
+
+static void close_bitstream_server_client(const int& client,
+                                          const std::string& msg) {
+  send_bitstream_server_message(client, msg);
+  ::close(client);
+}
+#endif
+
+/********************************************************************
+ * Create a Unix domain socket listening at a given path
+ * Return the socket, or -1 if it fails
+ *******************************************************************/
+int open_bitstream_server_socket(const std::string& socket_path) {
+#ifdef _WIN32
+  VTR_LOG_ERROR("Bitstream server is not supported on Windows!\n");
+  return -1;
+#else
+  struct sockaddr_un addr;
+  std::memset(&addr, 0, sizeof(addr));
+  addr.sun_family = AF_UNIX;
+  if (socket_path.size() >= sizeof(addr.sun_path)) {
+    VTR_LOG_ERROR("Socket path '%s' is too long!\n", socket_path.c_str());
+    return -1;
+  }
+  std::strncpy(addr.sun_path, socket_path.c_str(), sizeof(addr.sun_path) - 1);
+
+  int server_socket = socket(AF_UNIX, SOCK_STREAM, 0);
+  if (server_socket < 0) {
+    VTR_LOG_ERROR("Fail to create socket: %s!\n", std::strerror(errno));
+    return -1;
+  }
+  /* Remove the socket file left by a previous server. Any other kind of file
+   * is kept and reported */
+  struct stat path_stat;
+  if (0 == lstat(socket_path.c_str(), &path_stat)) {
+    if (!S_ISSOCK(path_stat.st_mode)) {
+      VTR_LOG_ERROR("Path '%s' already exists and is not a socket!\n",
+                    socket_path.c_str());
+      ::close(server_socket);
+      return -1;
+    }
+    unlink(socket_path.c_str());
+  }
+  if ((0 != bind(server_socket, reinterpret_cast<struct sockaddr*>(&addr),
+                 sizeof(addr))) ||
+      (0 != listen(server_socket, BITSTREAM_SERVER_BACKLOG))) {
+    VTR_LOG_ERROR("Fail to listen at socket '%s': %s!\n", socket_path.c_str(),
+                  std::strerror(errno));
+    ::close(server_socket);
+    return -1;
+  }
+  return server_socket;
+#endif
+}
+
+void close_bitstream_server_socket(const int& server_socket,
+                                   const std::string& socket_path) {
+#ifndef _WIN32
+  ::close(server_socket);
+  unlink(socket_path.c_str());
+#endif
+}
+
+/********************************************************************
+ * Accept clients and add their jobs to the queue, until a client requests
+ * to shut down the server. The queue is closed when returning.
+ * This function is executed by a thread dedicated to clients, so that
+ * clients are served while bitstreams are being built.
+ *******************************************************************/
+void accept_bitstream_server_jobs(const int& server_socket,
+                                  BitstreamServerJobQueue& job_queue,
+                                  const bool& verbose) {
+#ifndef _WIN32
+  while (true) {
+    int client = accept(server_socket, nullptr, nullptr);
+    if (client < 0 && EINTR == errno) {
+      continue;
+    }
+    if (client < 0) {
+      VTR_LOG_ERROR("Fail to accept client: %s!\n", std::strerror(errno));
+      break;
+    }
+
+    std::string request;
+    if (false == read_bitstream_server_request(client, request)) {
+      close_bitstream_server_client(client, "ERROR invalid request\n");
+      continue;
+    }
+
+    std::stringstream ss(request);
+    BitstreamServerJob job;
+    job.client = client;
+    if (!(ss >> job.bitstream_file)) {
+      close_bitstream_server_client(client, "ERROR invalid request\n");
+      continue;
+    }
+    if (BITSTREAM_SERVER_SHUTDOWN_REQUEST == job.bitstream_file) {
+      VTR_LOGV(verbose, "Received shutdown request\n");
+      close_bitstream_server_client(client, "OK shutdown\n");
+      break;
+    }
+    std::getline(ss, job.vpr_options);
+    /* Remove the leading spaces, the rest is passed to VPR as it is */
+    size_t options_start = job.vpr_options.find_first_not_of(" \t");
+    if (std::string::npos == options_start) {
+      close_bitstream_server_client(client, "ERROR missing VPR options\n");
+      continue;
+    }
+    job.vpr_options.erase(0, options_start);
+
+    if (false == job_queue.push(job)) {
+      VTR_LOGV(verbose, "Job queue is full; rejected job '%s'\n",
+               job.bitstream_file.c_str());
+      close_bitstream_server_client(client, "BUSY\n");
+      continue;
+    }
+    VTR_LOGV(verbose, "Queued job '%s'\n", job.bitstream_file.c_str());
+  }
+#endif
+  job_queue.close();
+}
+
+/********************************************************************
+ * Reply the status of a job to its client and close the connection
+ *******************************************************************/
+void reply_bitstream_server_job(const BitstreamServerJob& job,
+                                const int& status) {
+#ifndef _WIN32
+  if (CMD_EXEC_FATAL_ERROR == status) {
+    close_bitstream_server_client(job.client,
+                                  "ERROR " + job.bitstream_file + "\n");
+  } else {
+    close_bitstream_server_client(job.client,
+                                  "OK " + job.bitstream_file + "\n");
+  }
+#endif
+}
+
+} /* end namespace openfpga */
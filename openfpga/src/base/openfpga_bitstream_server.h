@@ -0,0 +1,69 @@
+#ifndef OPENFPGA_BITSTREAM_SERVER_H
+#define OPENFPGA_BITSTREAM_SERVER_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/* A bitstream job received by the bitstream server:
+ * - the client connection, to which the job status is replied
+ * - the file path to write the fabric bitstream
+ * - the options to run VPR on the design
+ */
+struct BitstreamServerJob {
+  int client;
+  std::string bitstream_file;
+  std::string vpr_options;
+};
+
+/********************************************************************
+ * A bounded queue of bitstream jobs, filled by the thread accepting
+ * clients and drained by the thread building the bitstreams.
+ * Once closed, the queue accepts no more jobs, but the jobs in the queue
+ * can still be popped.
+ *******************************************************************/
+class BitstreamServerJobQueue {
+ public: /* Constructors */
+  BitstreamServerJobQueue(const size_t& capacity);
+
+ public: /* Public mutators */
+  /* Add a job to the queue. Return false if the queue is full or closed */
+  bool push(const BitstreamServerJob& job);
+  /* Wait for a job. Return false if the queue is closed and empty */
+  bool pop(BitstreamServerJob& job);
+  void close();
+
+ private: /* Internal data */
+  size_t capacity_;
+  bool closed_;
+  std::deque<BitstreamServerJob> jobs_;
+  std::mutex mutex_;
+  std::condition_variable job_ready_;
+};
+
+int open_bitstream_server_socket(const std::string& socket_path);
+
+void close_bitstream_server_socket(const int& server_socket,
+                                   const std::string& socket_path);
+
+void accept_bitstream_server_jobs(const int& server_socket,
+                                  BitstreamServerJobQueue& job_queue,
+                                  const bool& verbose);
+
+void reply_bitstream_server_job(const BitstreamServerJob& job,
+                                const int& status);
+
+} /* end namespace openfpga */
+
+#endif
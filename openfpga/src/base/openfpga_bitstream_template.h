@@ -4,6 +4,8 @@
 /********************************************************************
  * This file includes functions to build bitstream database
  *******************************************************************/
+#include <thread>
+
 #include "build_device_bitstream.h"
 #include "build_fabric_bitstream.h"
 #include "build_io_mapping_info.h"
@@ -11,11 +13,16 @@
 #include "command_context.h"
 #include "command_exit_codes.h"
 #include "globals.h"
+#include "openfpga_bitstream_batch.h"
+#include "openfpga_bitstream_server.h"
 #include "openfpga_digest.h"
+#include "openfpga_link_arch_template.h"
 #include "openfpga_naming.h"
 #include "openfpga_reserved_words.h"
 #include "read_xml_arch_bitstream.h"
 #include "report_bitstream_distribution.h"
+#include "shell.h"
+#include "stream_read_xml_arch_bitstream.h"
 #include "vtr_log.h"
 #include "vtr_time.h"
 #include "write_text_fabric_bitstream.h"
@@ -36,10 +43,18 @@ int fpga_bitstream_template(T& openfpga_ctx, const Command& cmd,
   CommandOptionId opt_no_time_stamp = cmd.option("no_time_stamp");
   CommandOptionId opt_write_file = cmd.option("write_file");
   CommandOptionId opt_read_file = cmd.option("read_file");
+  CommandOptionId opt_stream_read = cmd.option("stream_read");
 
   if (true == cmd_context.option_enable(cmd, opt_read_file)) {
-    openfpga_ctx.mutable_bitstream_manager() = read_xml_architecture_bitstream(
-      cmd_context.option_value(cmd, opt_read_file).c_str());
+    if (true == cmd_context.option_enable(cmd, opt_stream_read)) {
+      openfpga_ctx.mutable_bitstream_manager() =
+        stream_read_xml_architecture_bitstream(
+          cmd_context.option_value(cmd, opt_read_file).c_str());
+    } else {
+      openfpga_ctx.mutable_bitstream_manager() =
+        read_xml_architecture_bitstream(
+          cmd_context.option_value(cmd, opt_read_file).c_str());
+    }
   } else {
     openfpga_ctx.mutable_bitstream_manager() = build_device_bitstream(
       g_vpr_ctx, openfpga_ctx, cmd_context.option_enable(cmd, opt_verbose));
@@ -120,8 +135,7 @@ int write_fabric_bitstream_template(const T& openfpga_ctx, const Command& cmd,
   } else {
     /* By default, output in plain text format */
     status = write_fabric_bitstream_to_text_file(
-      openfpga_ctx.bitstream_manager(), openfpga_ctx.fabric_bitstream(),
-      openfpga_ctx.blwl_shift_register_banks(),
+      openfpga_ctx.bitstream_manager(), openfpga_ctx.fabric_bitstream_view(),
       openfpga_ctx.arch().config_protocol,
       openfpga_ctx.fabric_global_port_info(),
       cmd_context.option_value(cmd, opt_file),
@@ -223,6 +237,181 @@ int report_bitstream_distribution_template(const T& openfpga_ctx,
   return status;
 }
 
+/********************************************************************
+ * Build the bitstream of a design on the FPGA fabric which has been built,
+ * and write it to a given file:
+ * - run VPR with the given options to load the design
+ * - re-link the openfpga architecture to the new VPR results
+ * - run the commands to build the bitstream, including the fix-up commands
+ * - write the fabric bitstream
+ *******************************************************************/
+template <class T>
+int build_design_bitstream_template(openfpga::Shell<T>* shell, T& openfpga_ctx,
+                                    const std::string& vpr_options,
+                                    const DesignBitstreamCommands& design_cmds,
+                                    const std::string& bitstream_fname,
+                                    const bool& verbose) {
+  /* Reload the implementation results of the design */
+  std::string vpr_cmd = std::string("vpr ") + vpr_options;
+  if (CMD_EXEC_SUCCESS !=
+      shell->execute_command(vpr_cmd.c_str(), openfpga_ctx)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  int status = relink_arch_template(openfpga_ctx, verbose);
+
+  std::vector<std::string> cmd_lines = design_cmds.build_commands;
+  cmd_lines.push_back(std::string("write_fabric_bitstream --file ") +
+                      bitstream_fname + design_cmds.write_options);
+  for (const std::string& cmd_line : cmd_lines) {
+    /* Abort as soon as a fatal error happens */
+    if (CMD_EXEC_FATAL_ERROR == status) {
+      break;
+    }
+    status = shell->execute_command(cmd_line.c_str(), openfpga_ctx);
+  }
+
+  return status;
+}
+
+/********************************************************************
+ * Build the bitstreams of a list of designs on the same FPGA fabric.
+ * The fabric, i.e., the module graph, the routing graph annotation and the
+ * multiplexer library, is built once and kept for all the designs.
+ * The fabric bitstream of each design is written to the output directory
+ *******************************************************************/
+template <class T>
+int build_bitstreams_batch_template(openfpga::Shell<T>* shell, T& openfpga_ctx,
+                                    const Command& cmd,
+                                    const CommandContext& cmd_context) {
+  vtr::ScopedStartFinishTimer timer("Build bitstreams for a batch of designs");
+
+  CommandOptionId opt_designs = cmd.option("designs");
+  CommandOptionId opt_output_dir = cmd.option("output_dir");
+  CommandOptionId opt_verbose = cmd.option("verbose");
+
+  std::vector<BitstreamBatchDesign> designs;
+  if (CMD_EXEC_SUCCESS !=
+      read_bitstream_batch_designs(cmd_context.option_value(cmd, opt_designs),
+                                   designs)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  DesignBitstreamCommands design_cmds;
+  if (CMD_EXEC_SUCCESS !=
+      find_design_bitstream_commands(cmd, cmd_context, design_cmds)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  std::string output_dir("./");
+  if (true == cmd_context.option_enable(cmd, opt_output_dir)) {
+    output_dir = format_dir_path(cmd_context.option_value(cmd, opt_output_dir));
+  }
+  create_directory(output_dir);
+
+  size_t num_failed_designs = 0;
+  for (const BitstreamBatchDesign& design : designs) {
+    vtr::ScopedStartFinishTimer design_timer("Build bitstream for design '" +
+                                             design.name + "'");
+
+    std::string bitstream_fname = output_dir + design.name +
+                                  "_fabric_bitstream" + design_cmds.file_suffix;
+    if (CMD_EXEC_FATAL_ERROR ==
+        build_design_bitstream_template(
+          shell, openfpga_ctx, design.vpr_options, design_cmds,
+          bitstream_fname, cmd_context.option_enable(cmd, opt_verbose))) {
+      VTR_LOG_ERROR("Failed to build bitstream for design '%s'!\n",
+                    design.name.c_str());
+      num_failed_designs++;
+    }
+  }
+
+  VTR_LOG("Built bitstreams for %lu out of %lu designs\n",
+          designs.size() - num_failed_designs, designs.size());
+
+  if (0 < num_failed_designs) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+  return CMD_EXEC_SUCCESS;
+}
+
+/********************************************************************
+ * Run a bitstream server, which keeps the FPGA fabric that has been built
+ * and builds the bitstreams of the designs requested by local clients.
+ * A dedicated thread accepts clients and fills a bounded job queue,
+ * while the jobs are processed one by one in the order of arrival.
+ * The server returns when a client requests to shut it down and all the
+ * queued jobs are done.
+ *******************************************************************/
+template <class T>
+int start_bitstream_server_template(openfpga::Shell<T>* shell, T& openfpga_ctx,
+                                    const Command& cmd,
+                                    const CommandContext& cmd_context) {
+  CommandOptionId opt_socket = cmd.option("socket");
+  CommandOptionId opt_queue_size = cmd.option("queue_size");
+  CommandOptionId opt_verbose = cmd.option("verbose");
+
+  DesignBitstreamCommands design_cmds;
+  if (CMD_EXEC_SUCCESS !=
+      find_design_bitstream_commands(cmd, cmd_context, design_cmds)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  size_t queue_size = 16;
+  if (true == cmd_context.option_enable(cmd, opt_queue_size)) {
+    int num_queued_jobs =
+      std::atoi(cmd_context.option_value(cmd, opt_queue_size).c_str());
+    if (0 >= num_queued_jobs) {
+      VTR_LOG_ERROR("Invalid queue size '%d'! Expect a positive integer\n",
+                    num_queued_jobs);
+      return CMD_EXEC_FATAL_ERROR;
+    }
+    queue_size = num_queued_jobs;
+  }
+
+  std::string socket_path = cmd_context.option_value(cmd, opt_socket);
+  int server_socket = open_bitstream_server_socket(socket_path);
+  if (server_socket < 0) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+  VTR_LOG("Bitstream server is listening at '%s' with a queue of %lu jobs\n",
+          socket_path.c_str(), queue_size);
+
+  BitstreamServerJobQueue job_queue(queue_size);
+  std::thread client_thread(accept_bitstream_server_jobs, server_socket,
+                            std::ref(job_queue),
+                            cmd_context.option_enable(cmd, opt_verbose));
+
+  size_t num_jobs = 0;
+  size_t num_failed_jobs = 0;
+  BitstreamServerJob job;
+  while (job_queue.pop(job)) {
+    vtr::ScopedStartFinishTimer job_timer("Build bitstream '" +
+                                          job.bitstream_file + "'");
+    int status = build_design_bitstream_template(
+      shell, openfpga_ctx, job.vpr_options, design_cmds, job.bitstream_file,
+      cmd_context.option_enable(cmd, opt_verbose));
+    if (CMD_EXEC_FATAL_ERROR == status) {
+      VTR_LOG_ERROR("Failed to build bitstream '%s'!\n",
+                    job.bitstream_file.c_str());
+      num_failed_jobs++;
+    }
+    reply_bitstream_server_job(job, status);
+    num_jobs++;
+  }
+
+  client_thread.join();
+  close_bitstream_server_socket(server_socket, socket_path);
+
+  VTR_LOG("Bitstream server built %lu out of %lu bitstreams\n",
+          num_jobs - num_failed_jobs, num_jobs);
+
+  if (0 < num_failed_jobs) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+  return CMD_EXEC_SUCCESS;
+}
+
 } /* end namespace openfpga */
 
 #endif
@@ -3,6 +3,7 @@
 /********************************************************************
  * This file includes functions to compress the hierachy of routing architecture
  *******************************************************************/
+#include "build_device_bitstream.h"
 #include "build_device_module.h"
 #include "build_fabric_global_port_info.h"
 #include "build_fabric_io_location_map.h"
@@ -13,7 +14,10 @@
 #include "device_rr_gsb_utils.h"
 #include "fabric_hierarchy_writer.h"
 #include "fabric_key_writer.h"
+#include "fabric_snapshot.h"
 #include "globals.h"
+#include "module_manager_utils.h"
+#include "openfpga_parallel.h"
 #include "read_xml_fabric_key.h"
 #include "vtr_log.h"
 #include "vtr_time.h"
@@ -27,13 +31,14 @@ namespace openfpga {
  *******************************************************************/
 template <class T>
 void compress_routing_hierarchy_template(T& openfpga_ctx,
+                                         const size_t& num_threads,
                                          const bool& verbose_output) {
   vtr::ScopedStartFinishTimer timer(
     "Identify unique General Switch Blocks (GSBs)");
 
   /* Build unique module lists */
   openfpga_ctx.mutable_device_rr_gsb().build_unique_module(
-    g_vpr_ctx.device().rr_graph);
+    g_vpr_ctx.device().rr_graph, num_threads);
 
   /* Report the stats */
   VTR_LOGV(
@@ -95,16 +100,56 @@ int build_fabric_template(T& openfpga_ctx, const Command& cmd,
     cmd.option("generate_random_fabric_key");
   CommandOptionId opt_write_fabric_key = cmd.option("write_fabric_key");
   CommandOptionId opt_load_fabric_key = cmd.option("load_fabric_key");
+  CommandOptionId opt_cache_dir = cmd.option("cache_dir");
+  CommandOptionId opt_lite = cmd.option("lite");
+  CommandOptionId opt_jobs = cmd.option("jobs");
   CommandOptionId opt_verbose = cmd.option("verbose");
 
-  if (true == cmd_context.option_enable(cmd, opt_compress_routing)) {
-    compress_routing_hierarchy_template<T>(
-      openfpga_ctx, cmd_context.option_enable(cmd, opt_verbose));
-    /* Update flow manager to enable compress routing */
-    openfpga_ctx.mutable_flow_manager().set_compress_routing(true);
+  /* Number of threads, where 0 means all the hardware threads */
+  size_t num_threads = 1;
+  if (false == parse_num_threads(cmd_context.option_value(cmd, opt_jobs),
+                                 num_threads)) {
+    return CMD_EXEC_FATAL_ERROR;
   }
 
-  VTR_LOG("\n");
+  /* A lite fabric contains no net at all, which implies the frame view */
+  bool lite = cmd_context.option_enable(cmd, opt_lite);
+  bool frame_view = lite || cmd_context.option_enable(cmd, opt_frame_view);
+  if (true == lite) {
+    /* Lite mode decides the net storage, which must be set on an empty graph
+     */
+    if (0 != openfpga_ctx.module_graph().num_modules()) {
+      VTR_LOG_ERROR(
+        "Lite mode requires an empty fabric while the fabric has been built "
+        "already!\n");
+      return CMD_EXEC_FATAL_ERROR;
+    }
+    openfpga_ctx.mutable_module_graph().set_lite(true);
+  }
+
+  /* Find the snapshot of the fabric in cache directory, if specified.
+   * A random fabric key changes the fabric at each run, so the snapshot is
+   * not applicable
+   */
+  std::string snapshot_key;
+  std::string snapshot_fname;
+  if (true == cmd_context.option_enable(cmd, opt_cache_dir)) {
+    if (true == cmd_context.option_enable(cmd, opt_gen_random_fabric_key)) {
+      VTR_LOG_WARN(
+        "Fabric snapshot is disabled when generating a random fabric key\n");
+    } else {
+      std::string fkey_fname;
+      if (true == cmd_context.option_enable(cmd, opt_load_fabric_key)) {
+        fkey_fname = cmd_context.option_value(cmd, opt_load_fabric_key);
+      }
+      snapshot_key = find_fabric_snapshot_key(
+        openfpga_ctx.flow_manager(), g_vpr_ctx.device(), fkey_fname,
+        frame_view, lite, cmd_context.option_enable(cmd, opt_compress_routing),
+        cmd_context.option_enable(cmd, opt_duplicate_grid_pin));
+      snapshot_fname = find_fabric_snapshot_file_name(
+        cmd_context.option_value(cmd, opt_cache_dir), snapshot_key);
+    }
+  }
 
   /* Record the execution status in curr_status for each command
    * and summarize them in the final status
@@ -112,33 +157,104 @@ int build_fabric_template(T& openfpga_ctx, const Command& cmd,
   int curr_status = CMD_EXEC_SUCCESS;
   int final_status = CMD_EXEC_SUCCESS;
 
-  /* Load fabric key from file */
-  FabricKey predefined_fabric_key;
-  if (true == cmd_context.option_enable(cmd, opt_load_fabric_key)) {
-    std::string fkey_fname = cmd_context.option_value(cmd, opt_load_fabric_key);
-    VTR_ASSERT(false == fkey_fname.empty());
-    predefined_fabric_key = read_xml_fabric_key(fkey_fname.c_str());
+  bool snapshot_loaded = false;
+  if (false == snapshot_fname.empty()) {
+    snapshot_loaded =
+      (CMD_EXEC_SUCCESS ==
+       read_fabric_snapshot_from_binary_file(
+         snapshot_fname, snapshot_key, openfpga_ctx.mutable_module_graph(),
+         openfpga_ctx.mutable_decoder_lib(),
+         openfpga_ctx.mutable_blwl_shift_register_banks(),
+         openfpga_ctx.mutable_device_rr_gsb(),
+         cmd_context.option_enable(cmd, opt_verbose)));
+  }
+
+  if (true == cmd_context.option_enable(cmd, opt_compress_routing)) {
+    /* Unique modules have been restored from the snapshot */
+    if (false == snapshot_loaded) {
+      compress_routing_hierarchy_template<T>(
+        openfpga_ctx, num_threads, cmd_context.option_enable(cmd, opt_verbose));
+    }
+    /* Update flow manager to enable compress routing */
+    openfpga_ctx.mutable_flow_manager().set_compress_routing(true);
   }
 
   VTR_LOG("\n");
 
-  curr_status = build_device_module_graph(
-    openfpga_ctx.mutable_module_graph(), openfpga_ctx.mutable_decoder_lib(),
-    openfpga_ctx.mutable_blwl_shift_register_banks(),
-    const_cast<const T&>(openfpga_ctx), g_vpr_ctx.device(),
-    cmd_context.option_enable(cmd, opt_frame_view),
-    cmd_context.option_enable(cmd, opt_compress_routing),
-    cmd_context.option_enable(cmd, opt_duplicate_grid_pin),
-    predefined_fabric_key,
-    cmd_context.option_enable(cmd, opt_gen_random_fabric_key),
-    cmd_context.option_enable(cmd, opt_verbose));
+  if (false == snapshot_loaded) {
+    /* Load fabric key from file */
+    FabricKey predefined_fabric_key;
+    if (true == cmd_context.option_enable(cmd, opt_load_fabric_key)) {
+      std::string fkey_fname =
+        cmd_context.option_value(cmd, opt_load_fabric_key);
+      VTR_ASSERT(false == fkey_fname.empty());
+      predefined_fabric_key = read_xml_fabric_key(fkey_fname.c_str());
+    }
 
-  /* If there is any error, final status cannot be overwritten by a success flag
-   */
-  if (CMD_EXEC_SUCCESS != curr_status) {
-    final_status = curr_status;
+    VTR_LOG("\n");
+
+    curr_status = build_device_module_graph(
+      openfpga_ctx.mutable_module_graph(), openfpga_ctx.mutable_decoder_lib(),
+      openfpga_ctx.mutable_blwl_shift_register_banks(),
+      const_cast<const T&>(openfpga_ctx), g_vpr_ctx.device(), frame_view,
+      cmd_context.option_enable(cmd, opt_compress_routing),
+      cmd_context.option_enable(cmd, opt_duplicate_grid_pin),
+      predefined_fabric_key,
+      cmd_context.option_enable(cmd, opt_gen_random_fabric_key), num_threads,
+      cmd_context.option_enable(cmd, opt_verbose));
+
+    /* If there is any error, final status cannot be overwritten by a success
+     * flag */
+    if (CMD_EXEC_SUCCESS != curr_status) {
+      final_status = curr_status;
+    }
+
+    /* Report the nets which are skipped by the lite fabric. The memory is
+     * estimated by the minimum storage of each net and net terminal, while
+     * the runtime is sampled on a scratch module graph */
+    if (true == lite) {
+      size_t num_skipped_nets =
+        openfpga_ctx.module_graph().num_lite_skipped_nets();
+      size_t num_skipped_terminals =
+        openfpga_ctx.module_graph().num_lite_skipped_net_terminals();
+      VTR_LOG(
+        "Lite fabric skipped %lu nets and %lu net terminals, saving at least "
+        "%.2f MB of memory and about %.2f seconds of build time\n",
+        num_skipped_nets, num_skipped_terminals,
+        (float)(num_skipped_nets * (sizeof(std::string) + sizeof(size_t)) +
+                num_skipped_terminals * 3 * sizeof(size_t)) /
+          (1024. * 1024.),
+        estimate_module_net_build_runtime(num_skipped_nets,
+                                          num_skipped_terminals));
+    }
+
+    /* Save a snapshot for the next run. Failures here are not critical since
+     * the fabric has been built already */
+    if ((CMD_EXEC_SUCCESS == curr_status) &&
+        (false == snapshot_fname.empty())) {
+      write_fabric_snapshot_to_binary_file(
+        snapshot_fname, snapshot_key, openfpga_ctx.module_graph(),
+        openfpga_ctx.decoder_lib(), openfpga_ctx.blwl_shift_register_banks(),
+        openfpga_ctx.device_rr_gsb(),
+        cmd_context.option_enable(cmd, opt_verbose));
+    }
   }
 
+  /* The module graph is complete. Freeze the nets to save memory for the
+   * downstream writers */
+  openfpga_ctx.mutable_module_graph().compact();
+
+  /* Count the configurable blocks and bits of each module, which are only
+   * read by the bitstream generators */
+  build_module_config_stats(openfpga_ctx.mutable_module_graph(),
+                            openfpga_ctx.arch().config_protocol);
+  /* Store the size of configuration ports of each module, which is read
+   * by the bitstream generators and the testbench writers */
+  build_module_config_port_stats(
+    openfpga_ctx.mutable_module_graph(), openfpga_ctx.arch().circuit_lib,
+    openfpga_ctx.arch().config_protocol.memory_model(),
+    openfpga_ctx.arch().config_protocol.type());
+
   /* Build I/O location map */
   openfpga_ctx.mutable_io_location_map() = build_fabric_io_location_map(
     openfpga_ctx.module_graph(), g_vpr_ctx.device().grid);
@@ -9,6 +9,7 @@
 #include "decoder_library.h"
 #include "device_rr_gsb.h"
 #include "fabric_bitstream.h"
+#include "fabric_bitstream_protocol_view.h"
 #include "fabric_global_port_info.h"
 #include "io_location_map.h"
 #include "memory_bank_shift_register_banks.h"
@@ -86,6 +87,9 @@ class OpenfpgaContext : public Context {
     return vpr_bitstream_annotation_;
   }
   const openfpga::DeviceRRGSB& device_rr_gsb() const { return device_rr_gsb_; }
+  size_t linked_chan_width() const { return linked_chan_width_; }
+  size_t linked_num_rr_nodes() const { return linked_num_rr_nodes_; }
+  size_t linked_num_rr_edges() const { return linked_num_rr_edges_; }
   const openfpga::MuxLibrary& mux_lib() const { return mux_lib_; }
   const openfpga::DecoderLibrary& decoder_lib() const { return decoder_lib_; }
   const openfpga::MemoryBankShiftRegisterBanks& blwl_shift_register_banks()
@@ -101,6 +105,9 @@ class OpenfpgaContext : public Context {
   const openfpga::FabricBitstream& fabric_bitstream() const {
     return fabric_bitstream_;
   }
+  const openfpga::FabricBitstreamProtocolView& fabric_bitstream_view() const {
+    return fabric_bitstream_view_;
+  }
   const openfpga::IoLocationMap& io_location_map() const {
     return io_location_map_;
   }
@@ -145,9 +152,13 @@ class OpenfpgaContext : public Context {
     return vpr_bitstream_annotation_;
   }
   openfpga::DeviceRRGSB& mutable_device_rr_gsb() { return device_rr_gsb_; }
+  size_t& mutable_linked_chan_width() { return linked_chan_width_; }
+  size_t& mutable_linked_num_rr_nodes() { return linked_num_rr_nodes_; }
+  size_t& mutable_linked_num_rr_edges() { return linked_num_rr_edges_; }
   openfpga::MuxLibrary& mutable_mux_lib() { return mux_lib_; }
   openfpga::DecoderLibrary& mutable_decoder_lib() { return decoder_lib_; }
   openfpga::MemoryBankShiftRegisterBanks& mutable_blwl_shift_register_banks() {
+    fabric_bitstream_view_.clear();
     return blwl_sr_banks_;
   }
   openfpga::TileDirect& mutable_tile_direct() { return tile_direct_; }
@@ -157,6 +168,8 @@ class OpenfpgaContext : public Context {
     return bitstream_manager_;
   }
   openfpga::FabricBitstream& mutable_fabric_bitstream() {
+    /* The reorganized bitstreams are outdated once the bitstream changes */
+    fabric_bitstream_view_.clear();
     return fabric_bitstream_;
   }
   openfpga::IoLocationMap& mutable_io_location_map() {
@@ -199,6 +212,13 @@ class OpenfpgaContext : public Context {
   /* Device-level annotation */
   openfpga::DeviceRRGSB device_rr_gsb_{vpr_device_annotation_};
 
+  /* Channel width and size of the routing resource graph which the device
+   * annotation is built on. Used to check that a device to be re-linked is
+   * the same */
+  size_t linked_chan_width_ = 0;
+  size_t linked_num_rr_nodes_ = 0;
+  size_t linked_num_rr_edges_ = 0;
+
   /* Library of physical implmentation of routing multiplexers */
   openfpga::MuxLibrary mux_lib_;
 
@@ -221,6 +241,10 @@ class OpenfpgaContext : public Context {
   /* Bitstream database */
   openfpga::BitstreamManager bitstream_manager_;
   openfpga::FabricBitstream fabric_bitstream_;
+  /* Fabric bitstream reorganized for configuration protocols, which is built
+   * on demand */
+  openfpga::FabricBitstreamProtocolView fabric_bitstream_view_{
+    fabric_bitstream_, blwl_sr_banks_};
 
   /* Netlist database
    * TODO: Each format should have an independent entry
@@ -14,6 +14,7 @@ namespace openfpga {
 FlowManager::FlowManager() {
   /* Turn off compress_routing as default */
   compress_routing_ = false;
+  sort_gsb_in_edges_ = false;
 }
 
 /**************************************************
@@ -21,6 +22,14 @@ FlowManager::FlowManager() {
  *************************************************/
 bool FlowManager::compress_routing() const { return compress_routing_; }
 
+bool FlowManager::sort_gsb_in_edges() const { return sort_gsb_in_edges_; }
+
+std::string FlowManager::arch_digest() const { return arch_digest_; }
+
+std::string FlowManager::clock_arch_digest() const {
+  return clock_arch_digest_;
+}
+
 /******************************************************************************
  * Private Mutators
  ******************************************************************************/
@@ -28,4 +37,16 @@ void FlowManager::set_compress_routing(const bool& enabled) {
   compress_routing_ = enabled;
 }
 
+void FlowManager::set_sort_gsb_in_edges(const bool& enabled) {
+  sort_gsb_in_edges_ = enabled;
+}
+
+void FlowManager::set_arch_digest(const std::string& digest) {
+  arch_digest_ = digest;
+}
+
+void FlowManager::set_clock_arch_digest(const std::string& digest) {
+  clock_arch_digest_ = digest;
+}
+
 } /* end namespace openfpga */
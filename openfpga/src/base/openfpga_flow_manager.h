@@ -4,6 +4,8 @@
 /********************************************************************
  * Include header files required by the data structure definition
  *******************************************************************/
+#include <string>
+
 /* Begin namespace openfpga */
 namespace openfpga {
 
@@ -20,12 +22,25 @@ class FlowManager {
 
  public: /* Public accessors */
   bool compress_routing() const;
+  /* If the incoming edges of GSB nodes have been sorted when linking the
+   * architecture, which changes the order of multiplexer inputs */
+  bool sort_gsb_in_edges() const;
+  /* Digests of the architecture files which have been loaded,
+   * used to identify if the fabric can be reused from a previous run */
+  std::string arch_digest() const;
+  std::string clock_arch_digest() const;
 
  public: /* Public mutators */
   void set_compress_routing(const bool& enabled);
+  void set_sort_gsb_in_edges(const bool& enabled);
+  void set_arch_digest(const std::string& digest);
+  void set_clock_arch_digest(const std::string& digest);
 
  private: /* Internal Data */
   bool compress_routing_;
+  bool sort_gsb_in_edges_;
+  std::string arch_digest_;
+  std::string clock_arch_digest_;
 };
 
 } /* End namespace openfpga*/
@@ -20,12 +20,16 @@
 #include "globals.h"
 #include "mux_library_builder.h"
 #include "openfpga_annotate_routing.h"
+#include "openfpga_parallel.h"
 #include "openfpga_rr_graph_support.h"
 #include "pb_type_utils.h"
 #include "read_activity.h"
 #include "read_xml_pin_constraints.h"
 #include "route_clock_rr_graph.h"
+#include "vpr_bitstream_annotation.h"
+#include "vpr_clustering_annotation.h"
 #include "vpr_device_annotation.h"
+#include "vpr_netlist_annotation.h"
 #include "vtr_assert.h"
 #include "vtr_log.h"
 #include "vtr_time.h"
@@ -34,7 +38,7 @@
 namespace openfpga {
 
 /********************************************************************
- * Top-level function to link openfpga architecture to VPR, including:
+ * Link the openfpga architecture to the VPR device context, including:
  * - physical pb_type
  * - mode selection bits for pb_type and pb interconnect
  * - circuit models for pb_type and pb interconnect
@@ -42,15 +46,7 @@ namespace openfpga {
  * - circuit models for global routing architecture
  *******************************************************************/
 template <class T>
-int link_arch_template(T& openfpga_ctx, const Command& cmd,
-                       const CommandContext& cmd_context) {
-  vtr::ScopedStartFinishTimer timer(
-    "Link OpenFPGA architecture to VPR architecture");
-
-  CommandOptionId opt_activity_file = cmd.option("activity_file");
-  CommandOptionId opt_sort_edge = cmd.option("sort_gsb_chan_node_in_edges");
-  CommandOptionId opt_verbose = cmd.option("verbose");
-
+void link_vpr_device_annotation_template(T& openfpga_ctx, const bool& verbose) {
   /* Build fast look-up between physical tile pin index and port information */
   build_physical_tile_pin2port_info(
     g_vpr_ctx.device(), openfpga_ctx.mutable_vpr_device_annotation());
@@ -61,8 +57,7 @@ int link_arch_template(T& openfpga_ctx, const Command& cmd,
    * - circuit models for pb_type and pb interconnect
    */
   annotate_pb_types(g_vpr_ctx.device(), openfpga_ctx.arch(),
-                    openfpga_ctx.mutable_vpr_device_annotation(),
-                    cmd_context.option_enable(cmd, opt_verbose));
+                    openfpga_ctx.mutable_vpr_device_annotation(), verbose);
 
   /* Annotate pb_graph_nodes
    * - Give unique index to each node in the same type
@@ -71,67 +66,43 @@ int link_arch_template(T& openfpga_ctx, const Command& cmd,
    * pins
    */
   annotate_pb_graph(g_vpr_ctx.device(),
-                    openfpga_ctx.mutable_vpr_device_annotation(),
-                    cmd_context.option_enable(cmd, opt_verbose));
+                    openfpga_ctx.mutable_vpr_device_annotation(), verbose);
 
   /* Annotate routing architecture to circuit library */
   annotate_rr_graph_circuit_models(g_vpr_ctx.device(), openfpga_ctx.arch(),
                                    openfpga_ctx.mutable_vpr_device_annotation(),
-                                   cmd_context.option_enable(cmd, opt_verbose));
+                                   verbose);
+}
 
-  /* Annotate routing results:
-   * - net mapping to each rr_node
-   * - previous nodes driving each rr_node
-   */
+/********************************************************************
+ * Annotate routing results:
+ * - net mapping to each rr_node
+ * - previous nodes driving each rr_node
+ *******************************************************************/
+template <class T>
+void link_vpr_routing_results_template(T& openfpga_ctx, const bool& verbose) {
   openfpga_ctx.mutable_vpr_routing_annotation().init(
     g_vpr_ctx.device().rr_graph);
 
   annotate_vpr_rr_node_nets(g_vpr_ctx.device(), g_vpr_ctx.clustering(),
                             g_vpr_ctx.routing(),
                             openfpga_ctx.mutable_vpr_routing_annotation(),
-                            cmd_context.option_enable(cmd, opt_verbose));
+                            verbose);
 
   annotate_rr_node_previous_nodes(g_vpr_ctx.device(), g_vpr_ctx.clustering(),
                                   g_vpr_ctx.routing(),
                                   openfpga_ctx.mutable_vpr_routing_annotation(),
-                                  cmd_context.option_enable(cmd, opt_verbose));
-
-  /* Build the routing graph annotation
-   * - RRGSB
-   * - DeviceRRGSB
-   */
-  if (false == is_vpr_rr_graph_supported(g_vpr_ctx.device().rr_graph)) {
-    return CMD_EXEC_FATAL_ERROR;
-  }
-
-  /* Build incoming edges as VPR only builds fan-out edges for each node */
-  g_vpr_ctx.mutable_device().rr_graph_builder.build_in_edges();
-  VTR_LOG("Built %ld incoming edges for routing resource graph\n",
-          g_vpr_ctx.device().rr_graph.in_edges_count());
-  VTR_ASSERT(g_vpr_ctx.device().rr_graph.validate_in_edges());
-  annotate_device_rr_gsb(
-    g_vpr_ctx.device(), openfpga_ctx.mutable_device_rr_gsb(),
-    !openfpga_ctx.clock_arch().empty(), /* FIXME: consider to be more robust! */
-    cmd_context.option_enable(cmd, opt_verbose));
-
-  if (true == cmd_context.option_enable(cmd, opt_sort_edge)) {
-    sort_device_rr_gsb_chan_node_in_edges(
-      g_vpr_ctx.device().rr_graph, openfpga_ctx.mutable_device_rr_gsb(),
-      cmd_context.option_enable(cmd, opt_verbose));
-    sort_device_rr_gsb_ipin_node_in_edges(
-      g_vpr_ctx.device().rr_graph, openfpga_ctx.mutable_device_rr_gsb(),
-      cmd_context.option_enable(cmd, opt_verbose));
-  }
-
-  /* Build multiplexer library */
-  openfpga_ctx.mutable_mux_lib() = build_device_mux_library(
-    g_vpr_ctx.device(), const_cast<const T&>(openfpga_ctx));
-
-  /* Build tile direct annotation */
-  openfpga_ctx.mutable_tile_direct() = build_device_tile_direct(
-    g_vpr_ctx.device(), openfpga_ctx.arch().arch_direct,
-    cmd_context.option_enable(cmd, opt_verbose));
+                                  verbose);
+}
 
+/********************************************************************
+ * Annotate the clustering and placement results of VPR, as well as
+ * the simulation and bitstream settings which depend on the mapped design
+ * An empty activity file name means that no activity file is provided
+ *******************************************************************/
+template <class T>
+int link_vpr_mapping_results_template(T& openfpga_ctx,
+                                      const std::string& activity_file) {
   /* Annotate clustering results */
   if (CMD_EXEC_FATAL_ERROR ==
       annotate_post_routing_cluster_sync_results(
@@ -151,10 +122,8 @@ int link_arch_template(T& openfpga_ctx, const Command& cmd,
    * - When FPGA-SPICE is enabled
    */
   std::unordered_map<AtomNetId, t_net_power> net_activity;
-  if (true == cmd_context.option_enable(cmd, opt_activity_file)) {
-    net_activity =
-      read_activity(g_vpr_ctx.atom().nlist,
-                    cmd_context.option_value(cmd, opt_activity_file).c_str());
+  if (false == activity_file.empty()) {
+    net_activity = read_activity(g_vpr_ctx.atom().nlist, activity_file.c_str());
   }
 
   /* TODO: Annotate the number of clock cycles and clock frequency by following
@@ -182,10 +151,183 @@ int link_arch_template(T& openfpga_ctx, const Command& cmd,
     return CMD_EXEC_FATAL_ERROR;
   }
 
-  /* TODO: should identify the error code from internal function execution */
   return CMD_EXEC_SUCCESS;
 }
 
+/********************************************************************
+ * Top-level function to link openfpga architecture to VPR, including:
+ * - physical pb_type
+ * - mode selection bits for pb_type and pb interconnect
+ * - circuit models for pb_type and pb interconnect
+ * - physical pb_graph nodes and pb_graph pins
+ * - circuit models for global routing architecture
+ *******************************************************************/
+template <class T>
+int link_arch_template(T& openfpga_ctx, const Command& cmd,
+                       const CommandContext& cmd_context) {
+  vtr::ScopedStartFinishTimer timer(
+    "Link OpenFPGA architecture to VPR architecture");
+
+  CommandOptionId opt_activity_file = cmd.option("activity_file");
+  CommandOptionId opt_sort_edge = cmd.option("sort_gsb_chan_node_in_edges");
+  CommandOptionId opt_jobs = cmd.option("jobs");
+  CommandOptionId opt_verbose = cmd.option("verbose");
+
+  /* Number of threads, where 0 means all the hardware threads */
+  size_t num_threads = 1;
+  if (false == parse_num_threads(cmd_context.option_value(cmd, opt_jobs),
+                                 num_threads)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  link_vpr_device_annotation_template(
+    openfpga_ctx, cmd_context.option_enable(cmd, opt_verbose));
+
+  link_vpr_routing_results_template(
+    openfpga_ctx, cmd_context.option_enable(cmd, opt_verbose));
+
+  /* Build the routing graph annotation
+   * - RRGSB
+   * - DeviceRRGSB
+   */
+  if (false == is_vpr_rr_graph_supported(g_vpr_ctx.device().rr_graph)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  /* Build incoming edges as VPR only builds fan-out edges for each node */
+  {
+    vtr::ScopedStartFinishTimer in_edge_timer(
+      "Build incoming edges for routing resource graph");
+    g_vpr_ctx.mutable_device().rr_graph_builder.build_in_edges();
+    VTR_LOG("Built %ld incoming edges for routing resource graph\n",
+            g_vpr_ctx.device().rr_graph.in_edges_count());
+    VTR_ASSERT(g_vpr_ctx.device().rr_graph.validate_in_edges());
+  }
+  /* Record the routing resource graph, so that a re-link can check the device
+   */
+  openfpga_ctx.mutable_linked_chan_width() =
+    size_t(g_vpr_ctx.device().chan_width.max);
+  openfpga_ctx.mutable_linked_num_rr_nodes() =
+    g_vpr_ctx.device().rr_graph.num_nodes();
+  openfpga_ctx.mutable_linked_num_rr_edges() =
+    g_vpr_ctx.device().rr_graph.in_edges_count();
+
+  annotate_device_rr_gsb(
+    g_vpr_ctx.device(), openfpga_ctx.mutable_device_rr_gsb(),
+    !openfpga_ctx.clock_arch().empty(), /* FIXME: consider to be more robust! */
+    num_threads, cmd_context.option_enable(cmd, opt_verbose));
+
+  openfpga_ctx.mutable_flow_manager().set_sort_gsb_in_edges(
+    cmd_context.option_enable(cmd, opt_sort_edge));
+  if (true == cmd_context.option_enable(cmd, opt_sort_edge)) {
+    sort_device_rr_gsb_chan_node_in_edges(
+      g_vpr_ctx.device().rr_graph, openfpga_ctx.mutable_device_rr_gsb(),
+      num_threads, cmd_context.option_enable(cmd, opt_verbose));
+    sort_device_rr_gsb_ipin_node_in_edges(
+      g_vpr_ctx.device().rr_graph, openfpga_ctx.mutable_device_rr_gsb(),
+      num_threads, cmd_context.option_enable(cmd, opt_verbose));
+  }
+
+  /* Build multiplexer library */
+  openfpga_ctx.mutable_mux_lib() = build_device_mux_library(
+    g_vpr_ctx.device(), const_cast<const T&>(openfpga_ctx));
+
+  /* Build tile direct annotation */
+  openfpga_ctx.mutable_tile_direct() = build_device_tile_direct(
+    g_vpr_ctx.device(), openfpga_ctx.arch().arch_direct,
+    cmd_context.option_enable(cmd, opt_verbose));
+
+  std::string activity_file;
+  if (true == cmd_context.option_enable(cmd, opt_activity_file)) {
+    activity_file = cmd_context.option_value(cmd, opt_activity_file);
+  }
+
+  /* TODO: should identify the error code from internal function execution */
+  return link_vpr_mapping_results_template(openfpga_ctx, activity_file);
+}
+
+/********************************************************************
+ * Re-link the openfpga architecture to VPR after VPR has been run again
+ * for another design on the same device. The data structures of the fabric,
+ * i.e., the routing graph annotation (DeviceRRGSB), the multiplexer library
+ * and the module graph, are kept as they are. Only the annotations depending
+ * on the VPR contexts are rebuilt.
+ *******************************************************************/
+template <class T>
+int relink_arch_template(T& openfpga_ctx, const bool& verbose) {
+  vtr::ScopedStartFinishTimer timer(
+    "Re-link OpenFPGA architecture to VPR results");
+
+  /* The clock network is appended to the routing resource graph, which is
+   * rebuilt by VPR. It cannot be reused across designs */
+  if (!openfpga_ctx.clock_arch().empty()) {
+    VTR_LOG_ERROR(
+      "Unable to re-link a device with a programmable clock network!\n");
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  /* The fabric is reused, so VPR must have run on the same device */
+  vtr::Point<size_t> gsb_range(g_vpr_ctx.device().grid.width() - 1,
+                               g_vpr_ctx.device().grid.height() - 1);
+  if (gsb_range != openfpga_ctx.device_rr_gsb().get_gsb_range()) {
+    VTR_LOG_ERROR(
+      "Device grid size (%lu x %lu) mismatches the one (%lu x %lu) used to "
+      "build the fabric!\n",
+      g_vpr_ctx.device().grid.width(), g_vpr_ctx.device().grid.height(),
+      openfpga_ctx.device_rr_gsb().get_gsb_range().x() + 1,
+      openfpga_ctx.device_rr_gsb().get_gsb_range().y() + 1);
+    return CMD_EXEC_FATAL_ERROR;
+  }
+  if (false == is_vpr_rr_graph_supported(g_vpr_ctx.device().rr_graph)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  /* Build incoming edges as VPR only builds fan-out edges for each node */
+  g_vpr_ctx.mutable_device().rr_graph_builder.build_in_edges();
+  VTR_ASSERT(g_vpr_ctx.device().rr_graph.validate_in_edges());
+
+  /* The routing graph annotation and the fabric depend on the routing
+   * resource graph, which must be the same as the one used to build them.
+   * This requires VPR to route with a fixed channel width */
+  if (size_t(g_vpr_ctx.device().chan_width.max) !=
+      openfpga_ctx.linked_chan_width()) {
+    VTR_LOG_ERROR(
+      "Channel width %d mismatches the one (%lu) used to build the fabric! "
+      "Please use a fixed '--route_chan_width' for VPR\n",
+      g_vpr_ctx.device().chan_width.max, openfpga_ctx.linked_chan_width());
+    return CMD_EXEC_FATAL_ERROR;
+  }
+  if ((g_vpr_ctx.device().rr_graph.num_nodes() !=
+       openfpga_ctx.linked_num_rr_nodes()) ||
+      (g_vpr_ctx.device().rr_graph.in_edges_count() !=
+       openfpga_ctx.linked_num_rr_edges())) {
+    VTR_LOG_ERROR(
+      "Routing resource graph (%lu nodes, %lu edges) mismatches the one (%lu "
+      "nodes, %lu edges) used to build the fabric!\n",
+      g_vpr_ctx.device().rr_graph.num_nodes(),
+      g_vpr_ctx.device().rr_graph.in_edges_count(),
+      openfpga_ctx.linked_num_rr_nodes(), openfpga_ctx.linked_num_rr_edges());
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  /* The VPR data structures have been reallocated. Drop all the annotations
+   * which point to the previous ones */
+  openfpga_ctx.mutable_vpr_device_annotation() = VprDeviceAnnotation();
+  openfpga_ctx.mutable_vpr_netlist_annotation() = VprNetlistAnnotation();
+  openfpga_ctx.mutable_vpr_clustering_annotation() = VprClusteringAnnotation();
+  openfpga_ctx.mutable_vpr_bitstream_annotation() = VprBitstreamAnnotation();
+
+  link_vpr_device_annotation_template(openfpga_ctx, verbose);
+
+  link_vpr_routing_results_template(openfpga_ctx, verbose);
+
+  /* Build tile direct annotation */
+  openfpga_ctx.mutable_tile_direct() = build_device_tile_direct(
+    g_vpr_ctx.device(), openfpga_ctx.arch().arch_direct, verbose);
+
+  return link_vpr_mapping_results_template(openfpga_ctx, std::string());
+}
+
 /********************************************************************
  * Top-level function to append a clock network to VPR's routing resource graph,
  *including:
@@ -199,11 +341,20 @@ int append_clock_rr_graph_template(T& openfpga_ctx, const Command& cmd,
   vtr::ScopedStartFinishTimer timer(
     "Append clock network to routing resource graph");
 
+  CommandOptionId opt_jobs = cmd.option("jobs");
   CommandOptionId opt_verbose = cmd.option("verbose");
 
+  /* Number of threads, where 0 means all the hardware threads */
+  size_t num_threads = 1;
+  if (false == parse_num_threads(cmd_context.option_value(cmd, opt_jobs),
+                                 num_threads)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
   return append_clock_rr_graph(
     g_vpr_ctx.mutable_device(), openfpga_ctx.mutable_clock_rr_lookup(),
-    openfpga_ctx.clock_arch(), cmd_context.option_enable(cmd, opt_verbose));
+    openfpga_ctx.clock_arch(), num_threads,
+    cmd_context.option_enable(cmd, opt_verbose));
 }
 
 /********************************************************************
@@ -217,6 +368,8 @@ int route_clock_rr_graph_template(T& openfpga_ctx, const Command& cmd,
 
   /* add an option '--pin_constraints_file in short '-pcf' */
   CommandOptionId opt_pcf = cmd.option("pin_constraints_file");
+  CommandOptionId opt_disable_unused_spines =
+    cmd.option("disable_unused_spines");
   CommandOptionId opt_verbose = cmd.option("verbose");
 
   /* If pin constraints are enabled by command options, read the file */
@@ -229,8 +382,9 @@ int route_clock_rr_graph_template(T& openfpga_ctx, const Command& cmd,
   return route_clock_rr_graph(
     openfpga_ctx.mutable_vpr_routing_annotation(), g_vpr_ctx.device(),
     g_vpr_ctx.atom(), g_vpr_ctx.clustering().clb_nlist,
-    openfpga_ctx.vpr_netlist_annotation(), openfpga_ctx.clock_rr_lookup(),
-    openfpga_ctx.clock_arch(), pin_constraints,
+    openfpga_ctx.vpr_netlist_annotation(), g_vpr_ctx.placement(),
+    openfpga_ctx.clock_rr_lookup(), openfpga_ctx.clock_arch(), pin_constraints,
+    cmd_context.option_enable(cmd, opt_disable_unused_spines),
     cmd_context.option_enable(cmd, opt_verbose));
 }
 
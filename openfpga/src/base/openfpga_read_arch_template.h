@@ -15,6 +15,7 @@
 #include "globals.h"
 #include "read_xml_clock_network.h"
 #include "read_xml_openfpga_arch.h"
+#include "vtr_digest.h"
 #include "vtr_log.h"
 #include "write_xml_clock_network.h"
 #include "write_xml_openfpga_arch.h"
@@ -45,6 +46,9 @@ int read_openfpga_arch_template(T& openfpga_context, const Command& cmd,
   VTR_LOG("Reading XML architecture '%s'...\n", arch_file_name.c_str());
   openfpga_context.mutable_arch() =
     read_xml_openfpga_arch(arch_file_name.c_str());
+  /* Record the digest of the file so that fabric snapshots can be identified */
+  openfpga_context.mutable_flow_manager().set_arch_digest(
+    vtr::secure_digest_file(arch_file_name));
 
   /* Check the architecture:
    * 1. Circuit library
@@ -235,6 +239,8 @@ int read_openfpga_clock_arch_template(T& openfpga_context, const Command& cmd,
   VTR_LOG("Reading XML clock architecture '%s'...\n", arch_file_name.c_str());
   openfpga_context.mutable_clock_arch() =
     read_xml_clock_network(arch_file_name.c_str());
+  openfpga_context.mutable_flow_manager().set_clock_arch_digest(
+    vtr::secure_digest_file(arch_file_name));
   /* Build internal links */
   openfpga_context.mutable_clock_arch().link();
   link_clock_network_rr_graph(openfpga_context.mutable_clock_arch(),
@@ -94,6 +94,14 @@ ShellCommandId add_write_pnr_sdc_command_template(
   shell_cmd.add_option("no_time_stamp", false,
                        "Do not print time stamp in output files");
 
+  /* Add an option '--jobs' */
+  CommandOptionId jobs_opt = shell_cmd.add_option(
+    "jobs", false,
+    "number of threads used to write the SDC files of routing blocks; 0 uses "
+    "all the hardware threads. The outputs are the same regardless of the "
+    "number of threads. Default is 1");
+  shell_cmd.set_option_require_value(jobs_opt, openfpga::OPT_INT);
+
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Enable verbose output");
 
@@ -242,6 +250,19 @@ ShellCommandId add_write_analysis_sdc_command_template(
   shell_cmd.add_option("no_time_stamp", false,
                        "Do not print time stamp in output files");
 
+  /* Add an option '--compress_disable_timing' */
+  shell_cmd.add_option("compress_disable_timing", false,
+                       "Merge the constraints to disable timing into ranged "
+                       "ports and collections");
+
+  /* Add an option '--jobs' */
+  CommandOptionId jobs_opt = shell_cmd.add_option(
+    "jobs", false,
+    "number of threads used to write the constraints of routing blocks and "
+    "grids; 0 uses all the hardware threads. The outputs are the same "
+    "regardless of the number of threads. Default is 1");
+  shell_cmd.set_option_require_value(jobs_opt, openfpga::OPT_INT);
+
   /* Add command 'write_fabric_verilog' to the Shell */
   ShellCommandId shell_cmd_id =
     shell.add_command(shell_cmd,
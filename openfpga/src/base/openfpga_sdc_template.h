@@ -12,6 +12,7 @@
 #include "configure_port_sdc_writer.h"
 #include "globals.h"
 #include "openfpga_digest.h"
+#include "openfpga_parallel.h"
 #include "openfpga_scale.h"
 #include "pnr_sdc_writer.h"
 #include "vtr_log.h"
@@ -47,6 +48,14 @@ int write_pnr_sdc_template(const T& openfpga_ctx, const Command& cmd,
   CommandOptionId opt_constrain_zero_delay_paths =
     cmd.option("constrain_zero_delay_paths");
   CommandOptionId opt_no_time_stamp = cmd.option("no_time_stamp");
+  CommandOptionId opt_jobs = cmd.option("jobs");
+
+  /* Number of threads, where 0 means all the hardware threads */
+  size_t num_threads = 1;
+  if (false == parse_num_threads(cmd_context.option_value(cmd, opt_jobs),
+                                 num_threads)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
 
   /* This is an intermediate data structure which is designed to modularize the
    * FPGA-SDC Keep it independent from any other outside data structures
@@ -87,6 +96,7 @@ int write_pnr_sdc_template(const T& openfpga_ctx, const Command& cmd,
   options.set_constrain_zero_delay_paths(
     cmd_context.option_enable(cmd, opt_constrain_zero_delay_paths));
   options.set_time_stamp(!cmd_context.option_enable(cmd, opt_no_time_stamp));
+  options.set_num_jobs(num_threads);
 
   /* We first turn on default sdc option and then disable part of them by
    * following users' options */
@@ -193,6 +203,25 @@ int write_analysis_sdc_template(const T& openfpga_ctx, const Command& cmd,
   CommandOptionId opt_flatten_names = cmd.option("flatten_names");
   CommandOptionId opt_time_unit = cmd.option("time_unit");
   CommandOptionId opt_no_time_stamp = cmd.option("no_time_stamp");
+  CommandOptionId opt_compress_disable_timing =
+    cmd.option("compress_disable_timing");
+  CommandOptionId opt_jobs = cmd.option("jobs");
+
+  /* Number of threads, where 0 means all the hardware threads */
+  size_t num_threads = 1;
+  if (false == parse_num_threads(cmd_context.option_value(cmd, opt_jobs),
+                                 num_threads)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  /* A lite module graph does not contain any net to output */
+  if (true == openfpga_ctx.module_graph().is_lite()) {
+    VTR_LOG_ERROR(
+      "Fabric is built in lite mode without nets, which can not be used to "
+      "output %s! Please run build_fabric without the option '--lite'\n",
+      "analysis SDC");
+    return CMD_EXEC_FATAL_ERROR;
+  }
 
   /* This is an intermediate data structure which is designed to modularize the
    * FPGA-SDC Keep it independent from any other outside data structures
@@ -207,6 +236,9 @@ int write_analysis_sdc_template(const T& openfpga_ctx, const Command& cmd,
   options.set_generate_sdc_analysis(true);
   options.set_flatten_names(cmd_context.option_enable(cmd, opt_flatten_names));
   options.set_time_stamp(!cmd_context.option_enable(cmd, opt_no_time_stamp));
+  options.set_compress_disable_timing(
+    cmd_context.option_enable(cmd, opt_compress_disable_timing));
+  options.set_num_jobs(num_threads);
 
   if (true == cmd_context.option_enable(cmd, opt_time_unit)) {
     options.set_time_unit(
@@ -207,6 +207,14 @@ ShellCommandId add_link_arch_command_template(
                        "Sort all the incoming edges for each routing track "
                        "output node in General Switch Blocks (GSBs)");
 
+  /* Add an option '--jobs' */
+  CommandOptionId opt_jobs = shell_cmd.add_option(
+    "jobs", false,
+    "number of threads used to build and sort the General Switch Blocks "
+    "(GSBs); 0 uses all the hardware threads. The GSBs are the same "
+    "regardless of the number of threads. Default is 1");
+  shell_cmd.set_option_require_value(opt_jobs, openfpga::OPT_INT);
+
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Show verbose outputs");
 
@@ -386,6 +394,12 @@ ShellCommandId add_build_fabric_command_template(
     "frame_view", false,
     "Build only frame view of the fabric (nets are skipped)");
 
+  /* Add an option '--lite' */
+  shell_cmd.add_option("lite", false,
+                       "Build a lite fabric which only contains the data "
+                       "required by bitstream generation (all the nets are "
+                       "skipped). Netlists can not be outputted");
+
   /* Add an option '--compress_routing' */
   shell_cmd.add_option("compress_routing", false,
                        "Compress the number of unique routing modules by "
@@ -410,6 +424,22 @@ ShellCommandId add_build_fabric_command_template(
                        "Create a random fabric key which will shuffle the "
                        "memory address for encryption purpose");
 
+  /* Add an option '--cache_dir' */
+  CommandOptionId opt_cache_dir = shell_cmd.add_option(
+    "cache_dir", false,
+    "reuse the fabric from a snapshot in the given directory if the "
+    "architecture and options are unchanged; otherwise build the fabric and "
+    "save a snapshot there");
+  shell_cmd.set_option_require_value(opt_cache_dir, openfpga::OPT_STRING);
+
+  /* Add an option '--jobs' */
+  CommandOptionId opt_jobs = shell_cmd.add_option(
+    "jobs", false,
+    "number of threads used to identify unique routing blocks and to build "
+    "routing modules; 0 uses all the hardware threads. The fabric is the same "
+    "regardless of the number of threads. Default is 1");
+  shell_cmd.set_option_require_value(opt_jobs, openfpga::OPT_INT);
+
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Show verbose outputs");
 
@@ -639,6 +669,14 @@ ShellCommandId add_append_clock_rr_graph_command_template(
   const std::vector<ShellCommandId>& dependent_cmds, const bool& hidden) {
   Command shell_cmd("append_clock_rr_graph");
 
+  /* Add an option '--jobs' */
+  CommandOptionId opt_jobs = shell_cmd.add_option(
+    "jobs", false,
+    "number of threads used to find the edges between clock nodes; 0 uses all "
+    "the hardware threads. The routing resource graph is the same regardless "
+    "of the number of threads. Default is 1");
+  shell_cmd.set_option_require_value(opt_jobs, openfpga::OPT_INT);
+
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Show verbose outputs");
 
@@ -674,6 +712,12 @@ ShellCommandId add_route_clock_rr_graph_command_template(
   shell_cmd.set_option_short_name(opt_file, "pcf");
   shell_cmd.set_option_require_value(opt_file, openfpga::OPT_STRING);
 
+  /* Add an option '--disable_unused_spines' */
+  shell_cmd.add_option("disable_unused_spines", false,
+                       "Only route the spines which reach the clock pins used "
+                       "by the placed design. Unused spines are left "
+                       "unconfigured");
+
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Show verbose outputs");
 
@@ -5,6 +5,7 @@
 #include "command_parser.h"
 #include "openfpga_bitstream_command.h"
 #include "openfpga_context.h"
+#include "openfpga_parallel.h"
 #include "openfpga_sdc_command.h"
 #include "openfpga_setup_command.h"
 #include "openfpga_spice_command.h"
@@ -75,6 +76,24 @@ int OpenfpgaShell::start(int argc, char** argv) {
                          "Launch OpenFPGA in batch  mode when running scripts");
   start_cmd.set_option_short_name(opt_batch_exec, "batch");
 
+  /* '--parallel_const_commands': execute consecutive commands which do not
+   * modify the OpenFPGA context concurrently, e.g., writing netlists and
+   * bitstreams. Only valid for script mode
+   */
+  openfpga::CommandOptionId opt_parallel_const_cmds = start_cmd.add_option(
+    "parallel_const_commands", false,
+    "Execute consecutive read-only commands concurrently when running scripts");
+
+  /* '--parallel_const_command_jobs': bound the number of threads used by
+   * '--parallel_const_commands'. By default, all the hardware threads
+   */
+  openfpga::CommandOptionId opt_parallel_const_cmd_jobs = start_cmd.add_option(
+    "parallel_const_command_jobs", false,
+    "Specify the maximum number of read-only commands executed concurrently. "
+    "Use 0 for all the hardware threads");
+  start_cmd.set_option_require_value(opt_parallel_const_cmd_jobs,
+                                     openfpga::OPT_INT);
+
   /* '--version', -v': print version information */
   openfpga::CommandOptionId opt_version =
     start_cmd.add_option("version", false, "Show OpenFPGA version");
@@ -111,6 +130,16 @@ int OpenfpgaShell::start(int argc, char** argv) {
     }
 
     if (true == start_cmd_context.option_enable(start_cmd, opt_script_mode)) {
+      size_t num_parallel_const_cmd_threads = 0;
+      if (false == openfpga::parse_num_threads(
+                     start_cmd_context.option_value(
+                       start_cmd, opt_parallel_const_cmd_jobs),
+                     num_parallel_const_cmd_threads)) {
+        return 1;
+      }
+      shell_.set_parallel_const_commands(
+        start_cmd_context.option_enable(start_cmd, opt_parallel_const_cmds),
+        num_parallel_const_cmd_threads);
       shell_.run_script_mode(
         start_cmd_context.option_value(start_cmd, opt_script_mode).c_str(),
         openfpga_ctx_,
@@ -51,6 +51,14 @@ ShellCommandId add_write_fabric_spice_command_template(
   shell_cmd.add_option("explicit_port_mapping", false,
                        "Use explicit port mapping in Verilog netlists");
 
+  /* Add an option '--jobs' */
+  CommandOptionId jobs_opt = shell_cmd.add_option(
+    "jobs", false,
+    "number of threads used to write the netlists of routing blocks and "
+    "grids; 0 uses all the hardware threads. The outputs are the same "
+    "regardless of the number of threads. Default is 1");
+  shell_cmd.set_option_require_value(jobs_opt, openfpga::OPT_INT);
+
   /* Add an option '--verbose' */
   shell_cmd.add_option("verbose", false, "Enable verbose output");
 
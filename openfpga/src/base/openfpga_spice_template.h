@@ -5,6 +5,7 @@
 #include "command_context.h"
 #include "command_exit_codes.h"
 #include "globals.h"
+#include "openfpga_parallel.h"
 #include "spice_api.h"
 #include "vtr_log.h"
 #include "vtr_time.h"
@@ -22,6 +23,23 @@ int write_fabric_spice_template(T& openfpga_ctx, const Command& cmd,
   CommandOptionId opt_explicit_port_mapping =
     cmd.option("explicit_port_mapping");
   CommandOptionId opt_verbose = cmd.option("verbose");
+  CommandOptionId opt_jobs = cmd.option("jobs");
+
+  /* A lite module graph does not contain any net to output */
+  if (true == openfpga_ctx.module_graph().is_lite()) {
+    VTR_LOG_ERROR(
+      "Fabric is built in lite mode without nets, which can not be used to "
+      "output %s! Please run build_fabric without the option '--lite'\n",
+      "fabric netlists");
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
+  /* Number of threads, where 0 means all the hardware threads */
+  size_t num_threads = 1;
+  if (false == parse_num_threads(cmd_context.option_value(cmd, opt_jobs),
+                                 num_threads)) {
+    return CMD_EXEC_FATAL_ERROR;
+  }
 
   /* This is an intermediate data structure which is designed to modularize the
    * FPGA-SPICE Keep it independent from any other outside data structures
@@ -32,6 +50,7 @@ int write_fabric_spice_template(T& openfpga_ctx, const Command& cmd,
     cmd_context.option_enable(cmd, opt_explicit_port_mapping));
   options.set_verbose_output(cmd_context.option_enable(cmd, opt_verbose));
   options.set_compress_routing(openfpga_ctx.flow_manager().compress_routing());
+  options.set_num_jobs(num_threads);
 
   int status = CMD_EXEC_SUCCESS;
   status = fpga_fabric_spice(
@@ -35,6 +35,15 @@ int write_fabric_verilog_template(T& openfpga_ctx, const Command& cmd,
   CommandOptionId opt_use_relative_path = cmd.option("use_relative_path");
   CommandOptionId opt_verbose = cmd.option("verbose");
 
+  /* A lite module graph does not contain any net to output */
+  if (true == openfpga_ctx.module_graph().is_lite()) {
+    VTR_LOG_ERROR(
+      "Fabric is built in lite mode without nets, which can not be used to "
+      "output %s! Please run build_fabric without the option '--lite'\n",
+      "fabric netlists");
+    return CMD_EXEC_FATAL_ERROR;
+  }
+
   /* This is an intermediate data structure which is designed to modularize the
    * FPGA-Verilog Keep it independent from any other outside data structures
    */
@@ -56,6 +65,10 @@ int write_fabric_verilog_template(T& openfpga_ctx, const Command& cmd,
   options.set_verbose_output(cmd_context.option_enable(cmd, opt_verbose));
   options.set_compress_routing(openfpga_ctx.flow_manager().compress_routing());
 
+  /* The writer adds modules for the submodules (e.g., the ReRAM-based
+   * multiplexers), which restores the nets to the expandable storage */
+  bool compact_module_graph = openfpga_ctx.module_graph().is_compact();
+
   fpga_fabric_verilog(openfpga_ctx.mutable_module_graph(),
                       openfpga_ctx.mutable_verilog_netlists(),
                       openfpga_ctx.blwl_shift_register_banks(),
@@ -64,6 +77,11 @@ int write_fabric_verilog_template(T& openfpga_ctx, const Command& cmd,
                       openfpga_ctx.vpr_device_annotation(),
                       openfpga_ctx.device_rr_gsb(), options);
 
+  /* Freeze the nets again for the downstream writers */
+  if (true == compact_module_graph) {
+    openfpga_ctx.mutable_module_graph().compact();
+  }
+
   /* TODO: should identify the error code from internal function execution */
   return CMD_EXEC_SUCCESS;
 }
@@ -131,8 +149,8 @@ int write_full_testbench_template(const T& openfpga_ctx, const Command& cmd,
 
   return fpga_verilog_full_testbench(
     openfpga_ctx.module_graph(), openfpga_ctx.bitstream_manager(),
-    openfpga_ctx.fabric_bitstream(), openfpga_ctx.blwl_shift_register_banks(),
-    g_vpr_ctx.atom(), g_vpr_ctx.placement(), pin_constraints, bus_group,
+    openfpga_ctx.fabric_bitstream_view(), g_vpr_ctx.atom(),
+    g_vpr_ctx.placement(), pin_constraints, bus_group,
     cmd_context.option_value(cmd, opt_bitstream),
     openfpga_ctx.io_location_map(), openfpga_ctx.fabric_global_port_info(),
     openfpga_ctx.vpr_netlist_annotation(), openfpga_ctx.arch().circuit_lib,
@@ -20,6 +20,7 @@
 #include "build_top_module.h"
 #include "build_wire_modules.h"
 #include "command_exit_codes.h"
+#include "module_manager_utils.h"
 
 /* begin namespace openfpga */
 namespace openfpga {
@@ -34,7 +35,8 @@ int build_device_module_graph(
   const OpenfpgaContext& openfpga_ctx, const DeviceContext& vpr_device_ctx,
   const bool& frame_view, const bool& compress_routing,
   const bool& duplicate_grid_pin, const FabricKey& fabric_key,
-  const bool& generate_random_fabric_key, const bool& verbose) {
+  const bool& generate_random_fabric_key, const size_t& num_threads,
+  const bool& verbose) {
   vtr::ScopedStartFinishTimer timer("Build fabric module graph");
 
   int status = CMD_EXEC_SUCCESS;
@@ -88,16 +90,24 @@ int build_device_module_graph(
       module_manager, decoder_lib, vpr_device_ctx,
       openfpga_ctx.vpr_device_annotation(), openfpga_ctx.device_rr_gsb(),
       openfpga_ctx.arch().circuit_lib,
-      openfpga_ctx.arch().config_protocol.type(), sram_model, verbose);
+      openfpga_ctx.arch().config_protocol.type(), sram_model, num_threads,
+      verbose);
   } else {
     VTR_ASSERT_SAFE(false == compress_routing);
     build_flatten_routing_modules(
       module_manager, decoder_lib, vpr_device_ctx,
       openfpga_ctx.vpr_device_annotation(), openfpga_ctx.device_rr_gsb(),
       openfpga_ctx.arch().circuit_lib,
-      openfpga_ctx.arch().config_protocol.type(), sram_model, verbose);
+      openfpga_ctx.arch().config_protocol.type(), sram_model, num_threads,
+      verbose);
   }
 
+  /* Store the size of configuration ports of the modules built so far, which
+   * are frequently looked up when building the top-level module */
+  build_module_config_port_stats(module_manager,
+                                 openfpga_ctx.arch().circuit_lib, sram_model,
+                                 openfpga_ctx.arch().config_protocol.type());
+
   /* Build FPGA fabric top-level module */
   status = build_top_module(
     module_manager, decoder_lib, blwl_sr_banks, openfpga_ctx.arch().circuit_lib,
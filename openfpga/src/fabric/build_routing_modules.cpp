@@ -4,7 +4,17 @@
  * Covering:
  * 1. Connection blocks
  * 2. Switch blocks
+ *
+ * Each routing module is built in two steps:
+ * 1. Staging: all the information required by the module, e.g., ports,
+ *    routing multiplexers and their connections, is collected from the
+ *    routing resource graph. This step does not touch the module manager,
+ *    so that the routing modules can be staged on multiple threads.
+ * 2. Commit: the staged module is added to the module manager.
+ *    Modules are committed in a fixed order, so that the module ids,
+ *    names and netlists are the same regardless of the number of threads.
  *******************************************************************/
+#include <algorithm>
 #include <vector>
 
 /* Headers from vtrutil library */
@@ -19,6 +29,7 @@
 #include "build_routing_modules.h"
 #include "module_manager_utils.h"
 #include "openfpga_naming.h"
+#include "openfpga_parallel.h"
 #include "openfpga_reserved_words.h"
 #include "openfpga_rr_graph_utils.h"
 #include "openfpga_side_manager.h"
@@ -27,6 +38,64 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
+/* Number of routing modules to be staged before committing them to the
+ * module manager. This limits the memory footprint of the staged modules */
+constexpr size_t ROUTING_MODULE_STAGING_BATCH_SIZE = 256;
+
+/*********************************************************************
+ * An interconnection inside a routing module, which is either
+ * - a short wire from an input pin to an output pin of the routing module
+ * - a routing multiplexer (and its memory) whose inputs are wired to the
+ *   input pins and output is wired to an output pin of the routing module
+ ********************************************************************/
+struct RoutingIntercStaging {
+  bool is_mux;
+  std::vector<ModulePinInfo> input_pins;
+  ModulePinInfo output_pin;
+  /* Only applicable to routing multiplexers */
+  CircuitModelId mux_model;
+  std::string mux_module_name;
+  std::string mux_instance_name;
+  std::string mem_module_name;
+  std::string mem_instance_name;
+};
+
+/*********************************************************************
+ * All the information required to add a routing module to the module manager
+ * Ports are added in the sequence of the list, so that the port ids in the
+ * module manager are the indices of the list
+ ********************************************************************/
+struct RoutingModuleStaging {
+  std::string module_name;
+  ModuleManager::e_module_usage_type usage;
+  std::vector<BasicPort> ports;
+  std::vector<ModuleManager::e_module_port_type> port_types;
+  /* Create a net for each pin of the port right after adding the port */
+  std::vector<bool> port_source_nets;
+  /* Short wires between the ports, whose nets are created after all the ports
+   * are added: [(source pin, sink pin)] */
+  std::vector<std::pair<ModulePinInfo, ModulePinInfo>> port_short_wires;
+  std::vector<RoutingIntercStaging> intercs;
+  /* Add the source of input nets to multiplexers if not yet in the list */
+  bool check_mux_input_net_source;
+};
+
+/*********************************************************************
+ * Add a port to a staged routing module as well as a scratch module manager
+ * which mirrors the ports of the staged module. The scratch module manager
+ * allows the port look-up functions to be reused during staging.
+ ********************************************************************/
+static ModulePortId add_routing_module_staging_port(
+  RoutingModuleStaging& staging, ModuleManager& scratch_module_manager,
+  const ModuleId& scratch_module, const BasicPort& port,
+  const ModuleManager::e_module_port_type& port_type,
+  const bool& source_nets) {
+  staging.ports.push_back(port);
+  staging.port_types.push_back(port_type);
+  staging.port_source_nets.push_back(source_nets);
+  return scratch_module_manager.add_port(scratch_module, port, port_type);
+}
+
 /*********************************************************************
  * Generate a short interconneciton in switch box
  * There are two cases should be noticed.
@@ -36,15 +105,17 @@ namespace openfpga {
  * 2. The actual fan-in of cur_rr_node is 0. In this case,
  *    The cur_rr_node need to connected to the drive_rr_node
  ********************************************************************/
-static void build_switch_block_module_short_interc(
-  ModuleManager& module_manager, const ModuleId& sb_module,
+static RoutingIntercStaging stage_switch_block_module_short_interc(
+  const ModuleManager& scratch_module_manager, const ModuleId& sb_module,
   const VprDeviceAnnotation& device_annotation, const DeviceGrid& grids,
   const RRGraphView& rr_graph, const RRGSB& rr_gsb, const e_side& chan_side,
-  const RRNodeId& cur_rr_node, const RRNodeId& drive_rr_node,
-  const std::map<ModulePinInfo, ModuleNetId>& input_port_to_module_nets) {
+  const RRNodeId& cur_rr_node, const RRNodeId& drive_rr_node) {
+  RoutingIntercStaging interc;
+  interc.is_mux = false;
+
   /* Find the name of output port */
-  ModulePinInfo output_port_info = find_switch_block_module_chan_port(
-    module_manager, sb_module, rr_graph, rr_gsb, chan_side, cur_rr_node,
+  interc.output_pin = find_switch_block_module_chan_port(
+    scratch_module_manager, sb_module, rr_graph, rr_gsb, chan_side, cur_rr_node,
     OUT_PORT);
   enum e_side input_pin_side = chan_side;
   int index = -1;
@@ -78,177 +149,84 @@ static void build_switch_block_module_short_interc(
       exit(1);
   }
   /* Find the name of input port */
-  ModulePinInfo input_port_info = find_switch_block_module_input_port(
-    module_manager, sb_module, grids, device_annotation, rr_graph, rr_gsb,
-    input_pin_side, drive_rr_node);
-
-  /* The input port and output port must match in size */
-  BasicPort input_port =
-    module_manager.module_port(sb_module, input_port_info.first);
-  BasicPort output_port =
-    module_manager.module_port(sb_module, output_port_info.first);
-
-  /* Create a module net for this short-wire connection */
-  ModuleNetId net = input_port_to_module_nets.at(input_port_info);
-  /* Skip Configuring the net source, it is done before */
-  /* Configure the net sink */
-  module_manager.add_module_net_sink(sb_module, net, sb_module, 0,
-                                     output_port_info.first,
-                                     output_port_info.second);
+  interc.input_pins.push_back(find_switch_block_module_input_port(
+    scratch_module_manager, sb_module, grids, device_annotation, rr_graph,
+    rr_gsb, input_pin_side, drive_rr_node));
+
+  return interc;
 }
 
 /*********************************************************************
- * Build a instance of a routing multiplexer as well as
+ * Stage a instance of a routing multiplexer as well as
  * associated memory modules for a connection inside a switch block
  ********************************************************************/
-static void build_switch_block_mux_module(
-  ModuleManager& module_manager, const ModuleId& sb_module,
+static RoutingIntercStaging stage_switch_block_mux_module(
+  const ModuleManager& scratch_module_manager, const ModuleId& sb_module,
   const VprDeviceAnnotation& device_annotation, const DeviceGrid& grids,
   const RRGraphView& rr_graph, const RRGSB& rr_gsb,
   const CircuitLibrary& circuit_lib, const e_side& chan_side,
   const size_t& chan_node_id, const RRNodeId& cur_rr_node,
-  const std::vector<RRNodeId>& driver_rr_nodes, const RRSwitchId& switch_index,
-  const std::map<ModulePinInfo, ModuleNetId>& input_port_to_module_nets) {
+  const std::vector<RRNodeId>& driver_rr_nodes,
+  const RRSwitchId& switch_index) {
   /* Check current rr_node is CHANX or CHANY*/
   VTR_ASSERT((CHANX == rr_graph.node_type(cur_rr_node)) ||
              (CHANY == rr_graph.node_type(cur_rr_node)));
 
+  RoutingIntercStaging interc;
+  interc.is_mux = true;
+
   /* Get the circuit model id of the routing multiplexer */
-  CircuitModelId mux_model =
-    device_annotation.rr_switch_circuit_model(switch_index);
+  interc.mux_model = device_annotation.rr_switch_circuit_model(switch_index);
 
   /* Find the input size of the implementation of a routing multiplexer */
   size_t datapath_mux_size = driver_rr_nodes.size();
 
-  /* Find the module name of the multiplexer and try to find it in the module
-   * manager */
-  std::string mux_module_name = generate_mux_subckt_name(
-    circuit_lib, mux_model, datapath_mux_size, std::string(""));
-  ModuleId mux_module = module_manager.find_module(mux_module_name);
-  VTR_ASSERT(true == module_manager.valid_module_id(mux_module));
-
-  /* Get the MUX instance id from the module manager */
-  size_t mux_instance_id = module_manager.num_instance(sb_module, mux_module);
-  /* Instanciate the MUX Module */
-  module_manager.add_child_module(sb_module, mux_module);
+  /* Find the module name of the multiplexer */
+  interc.mux_module_name = generate_mux_subckt_name(
+    circuit_lib, interc.mux_model, datapath_mux_size, std::string(""));
 
   /* Give an instance name: this name should be consistent with the block name
    * given in SDC manager, If you want to bind the SDC generation to modules
    */
-  std::string mux_instance_name = generate_sb_memory_instance_name(
+  interc.mux_instance_name = generate_sb_memory_instance_name(
     SWITCH_BLOCK_MUX_INSTANCE_PREFIX, chan_side, chan_node_id, std::string(""));
-  module_manager.set_child_instance_name(sb_module, mux_module, mux_instance_id,
-                                         mux_instance_name);
 
   /* Generate input ports that are wired to the input bus of the routing
    * multiplexer */
-  std::vector<ModulePinInfo> sb_input_port_ids =
-    find_switch_block_module_input_ports(module_manager, sb_module, grids,
-                                         device_annotation, rr_graph, rr_gsb,
-                                         driver_rr_nodes);
-
-  /* Link input bus port to Switch Block inputs */
-  std::vector<CircuitPortId> mux_model_input_ports =
-    circuit_lib.model_ports_by_type(mux_model, CIRCUIT_MODEL_PORT_INPUT, true);
-  VTR_ASSERT(1 == mux_model_input_ports.size());
-  /* Find the module port id of the input port */
-  ModulePortId mux_input_port_id = module_manager.find_module_port(
-    mux_module, circuit_lib.port_prefix(mux_model_input_ports[0]));
-  VTR_ASSERT(
-    true == module_manager.valid_module_port_id(mux_module, mux_input_port_id));
-  BasicPort mux_input_port =
-    module_manager.module_port(mux_module, mux_input_port_id);
-
-  /* Check port size should match */
-  VTR_ASSERT(mux_input_port.get_width() == sb_input_port_ids.size());
-  for (size_t pin_id = 0; pin_id < sb_input_port_ids.size(); ++pin_id) {
-    /* Use the exising net */
-    ModuleNetId net = input_port_to_module_nets.at(sb_input_port_ids[pin_id]);
-    /* Configure the net source only if it is not yet in the source list */
-    if (false ==
-        module_manager.net_source_exist(sb_module, net, sb_module, 0,
-                                        sb_input_port_ids[pin_id].first,
-                                        sb_input_port_ids[pin_id].second)) {
-      module_manager.add_module_net_source(sb_module, net, sb_module, 0,
-                                           sb_input_port_ids[pin_id].first,
-                                           sb_input_port_ids[pin_id].second);
-    }
-    /* Configure the net sink */
-    module_manager.add_module_net_sink(sb_module, net, mux_module,
-                                       mux_instance_id, mux_input_port_id,
-                                       mux_input_port.pins()[pin_id]);
-  }
+  interc.input_pins = find_switch_block_module_input_ports(
+    scratch_module_manager, sb_module, grids, device_annotation, rr_graph,
+    rr_gsb, driver_rr_nodes);
 
   /* Link output port to Switch Block outputs */
-  std::vector<CircuitPortId> mux_model_output_ports =
-    circuit_lib.model_ports_by_type(mux_model, CIRCUIT_MODEL_PORT_OUTPUT, true);
-  VTR_ASSERT(1 == mux_model_output_ports.size());
-  /* Use the port name convention in the circuit library */
-  ModulePortId mux_output_port_id = module_manager.find_module_port(
-    mux_module, circuit_lib.port_prefix(mux_model_output_ports[0]));
-  VTR_ASSERT(true == module_manager.valid_module_port_id(mux_module,
-                                                         mux_output_port_id));
-  BasicPort mux_output_port =
-    module_manager.module_port(mux_module, mux_output_port_id);
-  ModulePinInfo sb_output_port_id = find_switch_block_module_chan_port(
-    module_manager, sb_module, rr_graph, rr_gsb, chan_side, cur_rr_node,
+  interc.output_pin = find_switch_block_module_chan_port(
+    scratch_module_manager, sb_module, rr_graph, rr_gsb, chan_side, cur_rr_node,
     OUT_PORT);
-  BasicPort sb_output_port =
-    module_manager.module_port(sb_module, sb_output_port_id.first);
 
-  /* Check port size should match */
-  VTR_ASSERT(1 == mux_output_port.get_width());
-  for (size_t pin_id = 0; pin_id < mux_output_port.pins().size(); ++pin_id) {
-    /* Configuring the net source */
-    ModuleNetId net = create_module_source_pin_net(
-      module_manager, sb_module, mux_module, mux_instance_id,
-      mux_output_port_id, mux_output_port.pins()[pin_id]);
-    /* Configure the net sink */
-    module_manager.add_module_net_sink(sb_module, net, sb_module, 0,
-                                       sb_output_port_id.first,
-                                       sb_output_port_id.second);
-  }
-
-  /* Instanciate memory modules */
-  /* Find the name and module id of the memory module */
-  std::string mem_module_name =
-    generate_mux_subckt_name(circuit_lib, mux_model, datapath_mux_size,
+  /* Find the name of the memory module */
+  interc.mem_module_name =
+    generate_mux_subckt_name(circuit_lib, interc.mux_model, datapath_mux_size,
                              std::string(MEMORY_MODULE_POSTFIX));
-  ModuleId mem_module = module_manager.find_module(mem_module_name);
-  VTR_ASSERT(true == module_manager.valid_module_id(mem_module));
-
-  size_t mem_instance_id = module_manager.num_instance(sb_module, mem_module);
-  module_manager.add_child_module(sb_module, mem_module);
   /* Give an instance name: this name should be consistent with the block name
    * given in bitstream manager, If you want to bind the bitstream generation to
    * modules
    */
-  std::string mem_instance_name = generate_sb_memory_instance_name(
+  interc.mem_instance_name = generate_sb_memory_instance_name(
     SWITCH_BLOCK_MEM_INSTANCE_PREFIX, chan_side, chan_node_id, std::string(""));
-  module_manager.set_child_instance_name(sb_module, mem_module, mem_instance_id,
-                                         mem_instance_name);
 
-  /* Add nets to connect regular and mode-select SRAM ports to the SRAM port of
-   * memory module */
-  add_module_nets_between_logic_and_memory_sram_bus(
-    module_manager, sb_module, mux_module, mux_instance_id, mem_module,
-    mem_instance_id, circuit_lib, mux_model);
-  /* Update memory and instance list */
-  module_manager.add_configurable_child(sb_module, mem_module, mem_instance_id);
+  return interc;
 }
 
 /*********************************************************************
- * Generate child modules for a interconnection inside switch block
+ * Stage child modules for a interconnection inside switch block
  * The interconnection could be either a wire or a routing multiplexer,
  * which depends on the fan-in of the rr_nodes in the switch block
  ********************************************************************/
-static void build_switch_block_interc_modules(
-  ModuleManager& module_manager, const ModuleId& sb_module,
-  const VprDeviceAnnotation& device_annotation, const DeviceGrid& grids,
-  const RRGraphView& rr_graph, const RRGSB& rr_gsb,
+static void stage_switch_block_interc_modules(
+  RoutingModuleStaging& staging, const ModuleManager& scratch_module_manager,
+  const ModuleId& sb_module, const VprDeviceAnnotation& device_annotation,
+  const DeviceGrid& grids, const RRGraphView& rr_graph, const RRGSB& rr_gsb,
   const CircuitLibrary& circuit_lib, const e_side& chan_side,
-  const size_t& chan_node_id,
-  const std::map<ModulePinInfo, ModuleNetId>& input_port_to_module_nets) {
+  const size_t& chan_node_id) {
   std::vector<RRNodeId> driver_rr_nodes;
 
   /* Get the node */
@@ -268,23 +246,23 @@ static void build_switch_block_interc_modules(
 
   if (0 == driver_rr_nodes.size()) {
     /* Print a special direct connection*/
-    build_switch_block_module_short_interc(
-      module_manager, sb_module, device_annotation, grids, rr_graph, rr_gsb,
-      chan_side, cur_rr_node, cur_rr_node, input_port_to_module_nets);
+    staging.intercs.push_back(stage_switch_block_module_short_interc(
+      scratch_module_manager, sb_module, device_annotation, grids, rr_graph,
+      rr_gsb, chan_side, cur_rr_node, cur_rr_node));
   } else if (1 == driver_rr_nodes.size()) {
     /* Print a direct connection*/
-    build_switch_block_module_short_interc(
-      module_manager, sb_module, device_annotation, grids, rr_graph, rr_gsb,
-      chan_side, cur_rr_node, driver_rr_nodes[0], input_port_to_module_nets);
+    staging.intercs.push_back(stage_switch_block_module_short_interc(
+      scratch_module_manager, sb_module, device_annotation, grids, rr_graph,
+      rr_gsb, chan_side, cur_rr_node, driver_rr_nodes[0]));
   } else if (1 < driver_rr_nodes.size()) {
     /* Print the multiplexer, fan_in >= 2 */
     std::vector<RRSwitchId> driver_switches =
       get_rr_graph_driver_switches(rr_graph, cur_rr_node);
     VTR_ASSERT(1 == driver_switches.size());
-    build_switch_block_mux_module(
-      module_manager, sb_module, device_annotation, grids, rr_graph, rr_gsb,
-      circuit_lib, chan_side, chan_node_id, cur_rr_node, driver_rr_nodes,
-      driver_switches[0], input_port_to_module_nets);
+    staging.intercs.push_back(stage_switch_block_mux_module(
+      scratch_module_manager, sb_module, device_annotation, grids, rr_graph,
+      rr_gsb, circuit_lib, chan_side, chan_node_id, cur_rr_node,
+      driver_rr_nodes, driver_switches[0]));
   } /*Nothing should be done else*/
 }
 
@@ -349,26 +327,22 @@ static void build_switch_block_interc_modules(
  *
  *
  ********************************************************************/
-static void build_switch_block_module(
-  ModuleManager& module_manager, DecoderLibrary& decoder_lib,
+static RoutingModuleStaging stage_switch_block_module(
   const VprDeviceAnnotation& device_annotation, const DeviceGrid& grids,
   const RRGraphView& rr_graph, const CircuitLibrary& circuit_lib,
-  const e_config_protocol_type& sram_orgz_type,
-  const CircuitModelId& sram_model, const RRGSB& rr_gsb, const bool& verbose) {
-  /* Create a Module of Switch Block and add to module manager */
-  vtr::Point<size_t> gsb_coordinate(rr_gsb.get_sb_x(), rr_gsb.get_sb_y());
-  ModuleId sb_module = module_manager.add_module(
-    generate_switch_block_module_name(gsb_coordinate));
+  const RRGSB& rr_gsb) {
+  RoutingModuleStaging staging;
 
+  vtr::Point<size_t> gsb_coordinate(rr_gsb.get_sb_x(), rr_gsb.get_sb_y());
+  staging.module_name = generate_switch_block_module_name(gsb_coordinate);
   /* Label module usage */
-  module_manager.set_module_usage(sb_module, ModuleManager::MODULE_SB);
+  staging.usage = ModuleManager::MODULE_SB;
+  staging.check_mux_input_net_source = true;
 
-  VTR_LOGV(verbose, "Building module '%s'...",
-           generate_switch_block_module_name(gsb_coordinate).c_str());
-
-  /* Create a cache (fast look up) for module nets whose source are input ports
-   */
-  std::map<ModulePinInfo, ModuleNetId> input_port_to_module_nets;
+  /* The scratch module manager contains only the ports of this module */
+  ModuleManager scratch_module_manager;
+  scratch_module_manager.set_lite(true);
+  ModuleId sb_module = scratch_module_manager.add_module(staging.module_name);
 
   /* Add routing channel ports at each side of the GSB */
   for (size_t side = 0; side < rr_gsb.get_num_sides(); ++side) {
@@ -399,33 +373,25 @@ static void build_switch_block_module(
     if (0 < rr_gsb.get_chan_width(side_manager.get_side())) {
       t_rr_type chan_type = rr_gsb.get_chan_type(side_manager.get_side());
 
+      /* Nets of input ports are cached when adding the module */
       std::string chan_input_port_name = generate_sb_module_track_port_name(
         chan_type, side_manager.get_side(), IN_PORT);
       BasicPort chan_input_port(chan_input_port_name, chan_input_port_size);
-      ModulePortId chan_input_port_id = module_manager.add_port(
-        sb_module, chan_input_port, ModuleManager::MODULE_INPUT_PORT);
-
-      /* Cache the input net */
-      for (const size_t& pin : chan_input_port.pins()) {
-        ModuleNetId net = create_module_source_pin_net(
-          module_manager, sb_module, sb_module, 0, chan_input_port_id, pin);
-        input_port_to_module_nets[ModulePinInfo(chan_input_port_id, pin)] = net;
-      }
+      add_routing_module_staging_port(
+        staging, scratch_module_manager, sb_module, chan_input_port,
+        ModuleManager::MODULE_INPUT_PORT, true);
 
       std::string chan_output_port_name = generate_sb_module_track_port_name(
         chan_type, side_manager.get_side(), OUT_PORT);
       BasicPort chan_output_port(chan_output_port_name, chan_output_port_size);
-      module_manager.add_port(sb_module, chan_output_port,
-                              ModuleManager::MODULE_OUTPUT_PORT);
+      add_routing_module_staging_port(
+        staging, scratch_module_manager, sb_module, chan_output_port,
+        ModuleManager::MODULE_OUTPUT_PORT, false);
     }
 
     /* Dump OPINs of adjacent CLBs */
     for (size_t inode = 0;
          inode < rr_gsb.get_num_opin_nodes(side_manager.get_side()); ++inode) {
-      vtr::Point<size_t> port_coord(rr_graph.node_xlow(rr_gsb.get_opin_node(
-                                      side_manager.get_side(), inode)),
-                                    rr_graph.node_ylow(rr_gsb.get_opin_node(
-                                      side_manager.get_side(), inode)));
       std::string port_name = generate_sb_module_grid_port_name(
         side_manager.get_side(),
         get_rr_graph_single_node_side(
@@ -435,13 +401,9 @@ static void build_switch_block_module(
       BasicPort module_port(port_name,
                             1); /* Every grid output has a port size of 1 */
       /* Grid outputs are inputs of switch blocks */
-      ModulePortId input_port_id = module_manager.add_port(
-        sb_module, module_port, ModuleManager::MODULE_INPUT_PORT);
-
-      /* Cache the input net */
-      ModuleNetId net = create_module_source_pin_net(
-        module_manager, sb_module, sb_module, 0, input_port_id, 0);
-      input_port_to_module_nets[ModulePinInfo(input_port_id, 0)] = net;
+      add_routing_module_staging_port(staging, scratch_module_manager,
+                                      sb_module, module_port,
+                                      ModuleManager::MODULE_INPUT_PORT, true);
     }
   }
 
@@ -453,70 +415,25 @@ static void build_switch_block_module(
       /* We care OUTPUT tracks at this time only */
       if (OUT_PORT ==
           rr_gsb.get_chan_node_direction(side_manager.get_side(), itrack)) {
-        build_switch_block_interc_modules(
-          module_manager, sb_module, device_annotation, grids, rr_graph, rr_gsb,
-          circuit_lib, side_manager.get_side(), itrack,
-          input_port_to_module_nets);
+        stage_switch_block_interc_modules(
+          staging, scratch_module_manager, sb_module, device_annotation, grids,
+          rr_graph, rr_gsb, circuit_lib, side_manager.get_side(), itrack);
       }
     }
   }
 
-  /* Add global ports to the pb_module:
-   * This is a much easier job after adding sub modules (instances),
-   * we just need to find all the global ports from the child modules and build
-   * a list of it
-   */
-  add_module_global_ports_from_child_modules(module_manager, sb_module);
-
-  /* Count shared SRAM ports from the sub-modules under this Verilog module
-   * This is a much easier job after adding sub modules (instances),
-   * we just need to find all the I/O ports from the child modules and build a
-   * list of it
-   */
-  size_t module_num_shared_config_bits =
-    find_module_num_shared_config_bits_from_child_modules(module_manager,
-                                                          sb_module);
-  if (0 < module_num_shared_config_bits) {
-    add_reserved_sram_ports_to_module_manager(module_manager, sb_module,
-                                              module_num_shared_config_bits);
-  }
-
-  /* Count SRAM ports from the sub-modules under this Verilog module
-   * This is a much easier job after adding sub modules (instances),
-   * we just need to find all the I/O ports from the child modules and build a
-   * list of it
-   */
-  size_t module_num_config_bits =
-    find_module_num_config_bits_from_child_modules(
-      module_manager, sb_module, circuit_lib, sram_model, sram_orgz_type);
-  if (0 < module_num_config_bits) {
-    add_pb_sram_ports_to_module_manager(module_manager, sb_module, circuit_lib,
-                                        sram_model, sram_orgz_type,
-                                        module_num_config_bits);
-  }
-
-  /* Add all the nets to connect configuration ports from memory module to
-   * primitive modules This is a one-shot addition that covers all the memory
-   * modules in this primitive module!
-   */
-  if (0 < module_manager.configurable_children(sb_module).size()) {
-    add_pb_module_nets_memory_config_bus(
-      module_manager, decoder_lib, sb_module, sram_orgz_type,
-      circuit_lib.design_tech_type(sram_model));
-  }
-
-  VTR_LOGV(verbose, "Done\n");
+  return staging;
 }
 
 /*********************************************************************
- * Print a short interconneciton in connection
+ * Stage a short interconneciton in connection block
  ********************************************************************/
-static void build_connection_block_module_short_interc(
-  ModuleManager& module_manager, const ModuleId& cb_module,
-  const VprDeviceAnnotation& device_annotation, const DeviceGrid& grids,
-  const RRGraphView& rr_graph, const RRGSB& rr_gsb, const t_rr_type& cb_type,
-  const e_side& cb_ipin_side, const size_t& ipin_index,
-  const std::map<ModulePinInfo, ModuleNetId>& input_port_to_module_nets) {
+static void stage_connection_block_module_short_interc(
+  RoutingModuleStaging& staging, const ModuleManager& scratch_module_manager,
+  const ModuleId& cb_module, const VprDeviceAnnotation& device_annotation,
+  const DeviceGrid& grids, const RRGraphView& rr_graph, const RRGSB& rr_gsb,
+  const t_rr_type& cb_type, const e_side& cb_ipin_side,
+  const size_t& ipin_index) {
   /* Ensure we have only one 1 driver node */
   const RRNodeId& src_rr_node = rr_gsb.get_ipin_node(cb_ipin_side, ipin_index);
   std::vector<RREdgeId> driver_rr_edges =
@@ -553,40 +470,36 @@ static void build_connection_block_module_short_interc(
   VTR_ASSERT((CHANX == rr_graph.node_type(driver_rr_node)) ||
              (CHANY == rr_graph.node_type(driver_rr_node)));
 
+  RoutingIntercStaging interc;
+  interc.is_mux = false;
+
   /* Create port description for the routing track middle output */
-  ModulePinInfo input_port_info = find_connection_block_module_chan_port(
-    module_manager, cb_module, rr_graph, rr_gsb, cb_type, driver_rr_node);
+  interc.input_pins.push_back(find_connection_block_module_chan_port(
+    scratch_module_manager, cb_module, rr_graph, rr_gsb, cb_type,
+    driver_rr_node));
 
   /* Create port description for input pin of a CLB */
   ModulePortId ipin_port_id = find_connection_block_module_ipin_port(
-    module_manager, cb_module, grids, device_annotation, rr_graph, rr_gsb,
-    src_rr_node);
-
-  /* The input port and output port must match in size */
-  BasicPort input_port =
-    module_manager.module_port(cb_module, input_port_info.first);
-  BasicPort ipin_port = module_manager.module_port(cb_module, ipin_port_id);
+    scratch_module_manager, cb_module, grids, device_annotation, rr_graph,
+    rr_gsb, src_rr_node);
+  BasicPort ipin_port =
+    scratch_module_manager.module_port(cb_module, ipin_port_id);
   VTR_ASSERT(1 == ipin_port.get_width());
+  interc.output_pin = ModulePinInfo(ipin_port_id, ipin_port.pins()[0]);
 
-  /* Create a module net for this short-wire connection */
-  ModuleNetId net = input_port_to_module_nets.at(input_port_info);
-  /* Skip Configuring the net source, it is done before */
-  /* Configure the net sink */
-  module_manager.add_module_net_sink(cb_module, net, cb_module, 0, ipin_port_id,
-                                     ipin_port.pins()[0]);
+  staging.intercs.push_back(interc);
 }
 
 /*********************************************************************
- * Build a instance of a routing multiplexer as well as
+ * Stage a instance of a routing multiplexer as well as
  * associated memory modules for a connection inside a connection block
  ********************************************************************/
-static void build_connection_block_mux_module(
-  ModuleManager& module_manager, const ModuleId& cb_module,
-  const VprDeviceAnnotation& device_annotation, const DeviceGrid& grids,
-  const RRGraphView& rr_graph, const RRGSB& rr_gsb, const t_rr_type& cb_type,
-  const CircuitLibrary& circuit_lib, const e_side& cb_ipin_side,
-  const size_t& ipin_index,
-  const std::map<ModulePinInfo, ModuleNetId>& input_port_to_module_nets) {
+static void stage_connection_block_mux_module(
+  RoutingModuleStaging& staging, const ModuleManager& scratch_module_manager,
+  const ModuleId& cb_module, const VprDeviceAnnotation& device_annotation,
+  const DeviceGrid& grids, const RRGraphView& rr_graph, const RRGSB& rr_gsb,
+  const t_rr_type& cb_type, const CircuitLibrary& circuit_lib,
+  const e_side& cb_ipin_side, const size_t& ipin_index) {
   const RRNodeId& cur_rr_node = rr_gsb.get_ipin_node(cb_ipin_side, ipin_index);
   /* Check current rr_node is an input pin of a CLB */
   VTR_ASSERT(IPIN == rr_graph.node_type(cur_rr_node));
@@ -603,125 +516,59 @@ static void build_connection_block_mux_module(
     get_rr_graph_driver_switches(rr_graph, cur_rr_node);
   VTR_ASSERT(1 == driver_switches.size());
 
+  RoutingIntercStaging interc;
+  interc.is_mux = true;
+
   /* Get the circuit model id of the routing multiplexer */
-  CircuitModelId mux_model =
+  interc.mux_model =
     device_annotation.rr_switch_circuit_model(driver_switches[0]);
 
   /* Find the input size of the implementation of a routing multiplexer */
   size_t datapath_mux_size = driver_rr_nodes.size();
 
-  /* Find the module name of the multiplexer and try to find it in the module
-   * manager */
-  std::string mux_module_name = generate_mux_subckt_name(
-    circuit_lib, mux_model, datapath_mux_size, std::string(""));
-  ModuleId mux_module = module_manager.find_module(mux_module_name);
-  VTR_ASSERT(true == module_manager.valid_module_id(mux_module));
-
-  /* Get the MUX instance id from the module manager */
-  size_t mux_instance_id = module_manager.num_instance(cb_module, mux_module);
-  module_manager.add_child_module(cb_module, mux_module);
+  /* Find the module name of the multiplexer */
+  interc.mux_module_name = generate_mux_subckt_name(
+    circuit_lib, interc.mux_model, datapath_mux_size, std::string(""));
 
   /* Give an instance name: this name should be consistent with the block name
    * given in SDC manager, If you want to bind the SDC generation to modules
    */
-  std::string mux_instance_name = generate_cb_mux_instance_name(
+  interc.mux_instance_name = generate_cb_mux_instance_name(
     CONNECTION_BLOCK_MUX_INSTANCE_PREFIX,
-    get_rr_graph_single_node_side(
-      rr_graph, rr_gsb.get_ipin_node(cb_ipin_side, ipin_index)),
-    ipin_index, std::string(""));
-  module_manager.set_child_instance_name(cb_module, mux_module, mux_instance_id,
-                                         mux_instance_name);
+    get_rr_graph_single_node_side(rr_graph, cur_rr_node), ipin_index,
+    std::string(""));
 
-  /* TODO: Generate input ports that are wired to the input bus of the routing
+  /* Generate input ports that are wired to the input bus of the routing
    * multiplexer */
-  std::vector<ModulePinInfo> cb_input_port_ids =
-    find_connection_block_module_input_ports(
-      module_manager, cb_module, rr_graph, rr_gsb, cb_type, driver_rr_nodes);
-
-  /* Link input bus port to Switch Block inputs */
-  std::vector<CircuitPortId> mux_model_input_ports =
-    circuit_lib.model_ports_by_type(mux_model, CIRCUIT_MODEL_PORT_INPUT, true);
-  VTR_ASSERT(1 == mux_model_input_ports.size());
-  /* Find the module port id of the input port */
-  ModulePortId mux_input_port_id = module_manager.find_module_port(
-    mux_module, circuit_lib.port_prefix(mux_model_input_ports[0]));
-  VTR_ASSERT(
-    true == module_manager.valid_module_port_id(mux_module, mux_input_port_id));
-  BasicPort mux_input_port =
-    module_manager.module_port(mux_module, mux_input_port_id);
-
-  /* Check port size should match */
-  VTR_ASSERT(mux_input_port.get_width() == cb_input_port_ids.size());
-  for (size_t pin_id = 0; pin_id < cb_input_port_ids.size(); ++pin_id) {
-    /* Use the exising net */
-    ModuleNetId net = input_port_to_module_nets.at(cb_input_port_ids[pin_id]);
-    /* No need to configure the net source since it is already done before */
-    /* Configure the net sink */
-    module_manager.add_module_net_sink(cb_module, net, mux_module,
-                                       mux_instance_id, mux_input_port_id,
-                                       mux_input_port.pins()[pin_id]);
-  }
+  interc.input_pins = find_connection_block_module_input_ports(
+    scratch_module_manager, cb_module, rr_graph, rr_gsb, cb_type,
+    driver_rr_nodes);
 
-  /* Link output port to Switch Block outputs */
-  std::vector<CircuitPortId> mux_model_output_ports =
-    circuit_lib.model_ports_by_type(mux_model, CIRCUIT_MODEL_PORT_OUTPUT, true);
-  VTR_ASSERT(1 == mux_model_output_ports.size());
-  /* Use the port name convention in the circuit library */
-  ModulePortId mux_output_port_id = module_manager.find_module_port(
-    mux_module, circuit_lib.port_prefix(mux_model_output_ports[0]));
-  VTR_ASSERT(true == module_manager.valid_module_port_id(mux_module,
-                                                         mux_output_port_id));
-  BasicPort mux_output_port =
-    module_manager.module_port(mux_module, mux_output_port_id);
+  /* Link output port to Connection Block outputs */
   ModulePortId cb_output_port_id = find_connection_block_module_ipin_port(
-    module_manager, cb_module, grids, device_annotation, rr_graph, rr_gsb,
-    cur_rr_node);
+    scratch_module_manager, cb_module, grids, device_annotation, rr_graph,
+    rr_gsb, cur_rr_node);
   BasicPort cb_output_port =
-    module_manager.module_port(cb_module, cb_output_port_id);
-
-  /* Check port size should match */
-  VTR_ASSERT(cb_output_port.get_width() == mux_output_port.get_width());
-  for (size_t pin_id = 0; pin_id < mux_output_port.pins().size(); ++pin_id) {
-    /* Configuring the net source */
-    ModuleNetId net = create_module_source_pin_net(
-      module_manager, cb_module, mux_module, mux_instance_id,
-      mux_output_port_id, mux_output_port.pins()[pin_id]);
-    /* Configure the net sink */
-    module_manager.add_module_net_sink(cb_module, net, cb_module, 0,
-                                       cb_output_port_id,
-                                       cb_output_port.pins()[pin_id]);
-  }
-
-  /* Instanciate memory modules */
-  /* Find the name and module id of the memory module */
-  std::string mem_module_name =
-    generate_mux_subckt_name(circuit_lib, mux_model, datapath_mux_size,
+    scratch_module_manager.module_port(cb_module, cb_output_port_id);
+  /* Routing multiplexers have only 1 output */
+  VTR_ASSERT(1 == cb_output_port.get_width());
+  interc.output_pin =
+    ModulePinInfo(cb_output_port_id, cb_output_port.pins()[0]);
+
+  /* Find the name of the memory module */
+  interc.mem_module_name =
+    generate_mux_subckt_name(circuit_lib, interc.mux_model, datapath_mux_size,
                              std::string(MEMORY_MODULE_POSTFIX));
-  ModuleId mem_module = module_manager.find_module(mem_module_name);
-  VTR_ASSERT(true == module_manager.valid_module_id(mem_module));
-
-  size_t mem_instance_id = module_manager.num_instance(cb_module, mem_module);
-  module_manager.add_child_module(cb_module, mem_module);
-
   /* Give an instance name: this name should be consistent with the block name
    * given in bitstream manager, If you want to bind the bitstream generation to
    * modules
    */
-  std::string mem_instance_name = generate_cb_memory_instance_name(
+  interc.mem_instance_name = generate_cb_memory_instance_name(
     CONNECTION_BLOCK_MEM_INSTANCE_PREFIX,
-    get_rr_graph_single_node_side(
-      rr_graph, rr_gsb.get_ipin_node(cb_ipin_side, ipin_index)),
-    ipin_index, std::string(""));
-  module_manager.set_child_instance_name(cb_module, mem_module, mem_instance_id,
-                                         mem_instance_name);
+    get_rr_graph_single_node_side(rr_graph, cur_rr_node), ipin_index,
+    std::string(""));
 
-  /* Add nets to connect regular and mode-select SRAM ports to the SRAM port of
-   * memory module */
-  add_module_nets_between_logic_and_memory_sram_bus(
-    module_manager, cb_module, mux_module, mux_instance_id, mem_module,
-    mem_instance_id, circuit_lib, mux_model);
-  /* Update memory and instance list */
-  module_manager.add_configurable_child(cb_module, mem_module, mem_instance_id);
+  staging.intercs.push_back(interc);
 }
 
 /********************************************************************
@@ -731,13 +578,12 @@ static void build_connection_block_mux_module(
  * For a IPIN node that is driven by more than two fan-ins,
  * a routing multiplexer will be instanciated
  ********************************************************************/
-static void build_connection_block_interc_modules(
-  ModuleManager& module_manager, const ModuleId& cb_module,
-  const VprDeviceAnnotation& device_annotation, const DeviceGrid& grids,
-  const RRGraphView& rr_graph, const RRGSB& rr_gsb, const t_rr_type& cb_type,
-  const CircuitLibrary& circuit_lib, const e_side& cb_ipin_side,
-  const size_t& ipin_index,
-  const std::map<ModulePinInfo, ModuleNetId>& input_port_to_module_nets) {
+static void stage_connection_block_interc_modules(
+  RoutingModuleStaging& staging, const ModuleManager& scratch_module_manager,
+  const ModuleId& cb_module, const VprDeviceAnnotation& device_annotation,
+  const DeviceGrid& grids, const RRGraphView& rr_graph, const RRGSB& rr_gsb,
+  const t_rr_type& cb_type, const CircuitLibrary& circuit_lib,
+  const e_side& cb_ipin_side, const size_t& ipin_index) {
   std::vector<RREdgeId> driver_rr_edges =
     rr_gsb.get_ipin_node_in_edges(rr_graph, cb_ipin_side, ipin_index);
 
@@ -745,16 +591,15 @@ static void build_connection_block_interc_modules(
     return; /* This port has no driver, skip it */
   } else if (1 == driver_rr_edges.size()) {
     /* Print a direct connection */
-    build_connection_block_module_short_interc(
-      module_manager, cb_module, device_annotation, grids, rr_graph, rr_gsb,
-      cb_type, cb_ipin_side, ipin_index, input_port_to_module_nets);
+    stage_connection_block_module_short_interc(
+      staging, scratch_module_manager, cb_module, device_annotation, grids,
+      rr_graph, rr_gsb, cb_type, cb_ipin_side, ipin_index);
 
   } else if (1 < driver_rr_edges.size()) {
     /* Print the multiplexer, fan_in >= 2 */
-    build_connection_block_mux_module(
-      module_manager, cb_module, device_annotation, grids, rr_graph, rr_gsb,
-      cb_type, circuit_lib, cb_ipin_side, ipin_index,
-      input_port_to_module_nets);
+    stage_connection_block_mux_module(
+      staging, scratch_module_manager, cb_module, device_annotation, grids,
+      rr_graph, rr_gsb, cb_type, circuit_lib, cb_ipin_side, ipin_index);
   } /*Nothing should be done else*/
 }
 
@@ -813,28 +658,24 @@ static void build_connection_block_interc_modules(
  *  W: routing channel width
  *
  ********************************************************************/
-static void build_connection_block_module(
-  ModuleManager& module_manager, DecoderLibrary& decoder_lib,
+static RoutingModuleStaging stage_connection_block_module(
   const VprDeviceAnnotation& device_annotation, const DeviceGrid& grids,
   const RRGraphView& rr_graph, const CircuitLibrary& circuit_lib,
-  const e_config_protocol_type& sram_orgz_type,
-  const CircuitModelId& sram_model, const RRGSB& rr_gsb,
-  const t_rr_type& cb_type, const bool& verbose) {
-  /* Create the netlist */
+  const RRGSB& rr_gsb, const t_rr_type& cb_type) {
+  RoutingModuleStaging staging;
+
   vtr::Point<size_t> gsb_coordinate(rr_gsb.get_cb_x(cb_type),
                                     rr_gsb.get_cb_y(cb_type));
-
-  /* Create a Verilog Module based on the circuit model, and add to module
-   * manager */
-  ModuleId cb_module = module_manager.add_module(
-    generate_connection_block_module_name(cb_type, gsb_coordinate));
-
+  staging.module_name =
+    generate_connection_block_module_name(cb_type, gsb_coordinate);
   /* Label module usage */
-  module_manager.set_module_usage(cb_module, ModuleManager::MODULE_CB);
+  staging.usage = ModuleManager::MODULE_CB;
+  staging.check_mux_input_net_source = false;
 
-  VTR_LOGV(
-    verbose, "Building module '%s'...",
-    generate_connection_block_module_name(cb_type, gsb_coordinate).c_str());
+  /* The scratch module manager contains only the ports of this module */
+  ModuleManager scratch_module_manager;
+  scratch_module_manager.set_lite(true);
+  ModuleId cb_module = scratch_module_manager.add_module(staging.module_name);
 
   /* Add the input and output ports of routing tracks in the channel
    * Routing tracks pass through the connection blocks
@@ -846,32 +687,36 @@ static void build_connection_block_module(
     generate_cb_module_track_port_name(cb_type, IN_PORT, true);
   BasicPort chan_upper_input_port(chan_upper_input_port_name,
                                   rr_gsb.get_cb_chan_width(cb_type) / 2);
-  ModulePortId chan_upper_input_port_id = module_manager.add_port(
-    cb_module, chan_upper_input_port, ModuleManager::MODULE_INPUT_PORT);
+  ModulePortId chan_upper_input_port_id = add_routing_module_staging_port(
+    staging, scratch_module_manager, cb_module, chan_upper_input_port,
+    ModuleManager::MODULE_INPUT_PORT, false);
 
   /* Lower input port: W/2 == 1 tracks */
   std::string chan_lower_input_port_name =
     generate_cb_module_track_port_name(cb_type, IN_PORT, false);
   BasicPort chan_lower_input_port(chan_lower_input_port_name,
                                   rr_gsb.get_cb_chan_width(cb_type) / 2);
-  ModulePortId chan_lower_input_port_id = module_manager.add_port(
-    cb_module, chan_lower_input_port, ModuleManager::MODULE_INPUT_PORT);
+  ModulePortId chan_lower_input_port_id = add_routing_module_staging_port(
+    staging, scratch_module_manager, cb_module, chan_lower_input_port,
+    ModuleManager::MODULE_INPUT_PORT, false);
 
   /* Upper output port: W/2 == 0 tracks */
   std::string chan_upper_output_port_name =
     generate_cb_module_track_port_name(cb_type, OUT_PORT, true);
   BasicPort chan_upper_output_port(chan_upper_output_port_name,
                                    rr_gsb.get_cb_chan_width(cb_type) / 2);
-  ModulePortId chan_upper_output_port_id = module_manager.add_port(
-    cb_module, chan_upper_output_port, ModuleManager::MODULE_OUTPUT_PORT);
+  ModulePortId chan_upper_output_port_id = add_routing_module_staging_port(
+    staging, scratch_module_manager, cb_module, chan_upper_output_port,
+    ModuleManager::MODULE_OUTPUT_PORT, false);
 
   /* Lower output port: W/2 == 1 tracks */
   std::string chan_lower_output_port_name =
     generate_cb_module_track_port_name(cb_type, OUT_PORT, false);
   BasicPort chan_lower_output_port(chan_lower_output_port_name,
                                    rr_gsb.get_cb_chan_width(cb_type) / 2);
-  ModulePortId chan_lower_output_port_id = module_manager.add_port(
-    cb_module, chan_lower_output_port, ModuleManager::MODULE_OUTPUT_PORT);
+  ModulePortId chan_lower_output_port_id = add_routing_module_staging_port(
+    staging, scratch_module_manager, cb_module, chan_lower_output_port,
+    ModuleManager::MODULE_OUTPUT_PORT, false);
 
   /* Add the input pins of grids, which are output ports of the connection block
    */
@@ -881,22 +726,17 @@ static void build_connection_block_module(
     for (size_t inode = 0; inode < rr_gsb.get_num_ipin_nodes(cb_ipin_side);
          ++inode) {
       const RRNodeId& ipin_node = rr_gsb.get_ipin_node(cb_ipin_side, inode);
-      vtr::Point<size_t> port_coord(rr_graph.node_xlow(ipin_node),
-                                    rr_graph.node_ylow(ipin_node));
       std::string port_name = generate_cb_module_grid_port_name(
         cb_ipin_side, grids, device_annotation, rr_graph, ipin_node);
       BasicPort module_port(port_name,
                             1); /* Every grid output has a port size of 1 */
       /* Grid outputs are inputs of switch blocks */
-      module_manager.add_port(cb_module, module_port,
-                              ModuleManager::MODULE_OUTPUT_PORT);
+      add_routing_module_staging_port(staging, scratch_module_manager,
+                                      cb_module, module_port,
+                                      ModuleManager::MODULE_OUTPUT_PORT, false);
     }
   }
 
-  /* Create a cache (fast look up) for module nets whose source are input ports
-   */
-  std::map<ModulePinInfo, ModuleNetId> input_port_to_module_nets;
-
   /* Generate short-wire connection for each routing track :
    * Each input port is short-wired to its output port
    *
@@ -908,30 +748,22 @@ static void build_connection_block_module(
              chan_lower_output_port.get_width());
   for (size_t pin_id = 0; pin_id < chan_upper_input_port.pins().size();
        ++pin_id) {
-    ModuleNetId net = create_module_source_pin_net(
-      module_manager, cb_module, cb_module, 0, chan_upper_input_port_id,
-      chan_upper_input_port.pins()[pin_id]);
-    module_manager.add_module_net_sink(cb_module, net, cb_module, 0,
-                                       chan_lower_output_port_id,
-                                       chan_lower_output_port.pins()[pin_id]);
-    /* Cache the module net */
-    input_port_to_module_nets[ModulePinInfo(
-      chan_upper_input_port_id, chan_upper_input_port.pins()[pin_id])] = net;
+    staging.port_short_wires.push_back(std::make_pair(
+      ModulePinInfo(chan_upper_input_port_id,
+                    chan_upper_input_port.pins()[pin_id]),
+      ModulePinInfo(chan_lower_output_port_id,
+                    chan_lower_output_port.pins()[pin_id])));
   }
 
   VTR_ASSERT(chan_lower_input_port.get_width() ==
              chan_upper_output_port.get_width());
   for (size_t pin_id = 0; pin_id < chan_lower_input_port.pins().size();
        ++pin_id) {
-    ModuleNetId net = create_module_source_pin_net(
-      module_manager, cb_module, cb_module, 0, chan_lower_input_port_id,
-      chan_lower_input_port.pins()[pin_id]);
-    module_manager.add_module_net_sink(cb_module, net, cb_module, 0,
-                                       chan_upper_output_port_id,
-                                       chan_upper_output_port.pins()[pin_id]);
-    /* Cache the module net */
-    input_port_to_module_nets[ModulePinInfo(
-      chan_lower_input_port_id, chan_lower_input_port.pins()[pin_id])] = net;
+    staging.port_short_wires.push_back(std::make_pair(
+      ModulePinInfo(chan_lower_input_port_id,
+                    chan_lower_input_port.pins()[pin_id]),
+      ModulePinInfo(chan_upper_output_port_id,
+                    chan_upper_output_port.pins()[pin_id])));
   }
 
   /* Add sub modules of routing multiplexers or direct interconnect*/
@@ -939,10 +771,180 @@ static void build_connection_block_module(
     enum e_side cb_ipin_side = cb_ipin_sides[iside];
     for (size_t inode = 0; inode < rr_gsb.get_num_ipin_nodes(cb_ipin_side);
          ++inode) {
-      build_connection_block_interc_modules(
-        module_manager, cb_module, device_annotation, grids, rr_graph, rr_gsb,
-        cb_type, circuit_lib, cb_ipin_side, inode, input_port_to_module_nets);
+      stage_connection_block_interc_modules(
+        staging, scratch_module_manager, cb_module, device_annotation, grids,
+        rr_graph, rr_gsb, cb_type, circuit_lib, cb_ipin_side, inode);
+    }
+  }
+
+  return staging;
+}
+
+/*********************************************************************
+ * Add a routing multiplexer as well as associated memory modules to a routing
+ * module, as staged
+ ********************************************************************/
+static void add_routing_module_mux_interc(
+  ModuleManager& module_manager, const ModuleId& parent_module,
+  const CircuitLibrary& circuit_lib, const RoutingIntercStaging& interc,
+  const bool& check_input_net_source,
+  const std::map<ModulePinInfo, ModuleNetId>& input_port_to_module_nets) {
+  /* Try to find the multiplexer in the module manager */
+  ModuleId mux_module = module_manager.find_module(interc.mux_module_name);
+  VTR_ASSERT(true == module_manager.valid_module_id(mux_module));
+
+  /* Get the MUX instance id from the module manager */
+  size_t mux_instance_id =
+    module_manager.num_instance(parent_module, mux_module);
+  /* Instanciate the MUX Module */
+  module_manager.add_child_module(parent_module, mux_module);
+  module_manager.set_child_instance_name(parent_module, mux_module,
+                                         mux_instance_id,
+                                         interc.mux_instance_name);
+
+  /* Link input bus port to routing module inputs */
+  std::vector<CircuitPortId> mux_model_input_ports =
+    circuit_lib.model_ports_by_type(interc.mux_model, CIRCUIT_MODEL_PORT_INPUT,
+                                    true);
+  VTR_ASSERT(1 == mux_model_input_ports.size());
+  /* Find the module port id of the input port */
+  ModulePortId mux_input_port_id = module_manager.find_module_port(
+    mux_module, circuit_lib.port_prefix(mux_model_input_ports[0]));
+  VTR_ASSERT(
+    true == module_manager.valid_module_port_id(mux_module, mux_input_port_id));
+  BasicPort mux_input_port =
+    module_manager.module_port(mux_module, mux_input_port_id);
+
+  /* Check port size should match */
+  VTR_ASSERT(mux_input_port.get_width() == interc.input_pins.size());
+  for (size_t pin_id = 0; pin_id < interc.input_pins.size(); ++pin_id) {
+    /* Use the exising net */
+    ModuleNetId net = input_port_to_module_nets.at(interc.input_pins[pin_id]);
+    /* Configure the net source only if it is not yet in the source list */
+    if ((true == check_input_net_source) &&
+        (false == module_manager.net_source_exist(
+                    parent_module, net, parent_module, 0,
+                    interc.input_pins[pin_id].first,
+                    interc.input_pins[pin_id].second))) {
+      module_manager.add_module_net_source(
+        parent_module, net, parent_module, 0, interc.input_pins[pin_id].first,
+        interc.input_pins[pin_id].second);
+    }
+    /* Configure the net sink */
+    module_manager.add_module_net_sink(parent_module, net, mux_module,
+                                       mux_instance_id, mux_input_port_id,
+                                       mux_input_port.pins()[pin_id]);
+  }
+
+  /* Link output port to routing module outputs */
+  std::vector<CircuitPortId> mux_model_output_ports =
+    circuit_lib.model_ports_by_type(interc.mux_model,
+                                    CIRCUIT_MODEL_PORT_OUTPUT, true);
+  VTR_ASSERT(1 == mux_model_output_ports.size());
+  /* Use the port name convention in the circuit library */
+  ModulePortId mux_output_port_id = module_manager.find_module_port(
+    mux_module, circuit_lib.port_prefix(mux_model_output_ports[0]));
+  VTR_ASSERT(true == module_manager.valid_module_port_id(mux_module,
+                                                         mux_output_port_id));
+  BasicPort mux_output_port =
+    module_manager.module_port(mux_module, mux_output_port_id);
+
+  /* Check port size should match */
+  VTR_ASSERT(1 == mux_output_port.get_width());
+  /* Configuring the net source */
+  ModuleNetId net = create_module_source_pin_net(
+    module_manager, parent_module, mux_module, mux_instance_id,
+    mux_output_port_id, mux_output_port.pins()[0]);
+  /* Configure the net sink */
+  module_manager.add_module_net_sink(parent_module, net, parent_module, 0,
+                                     interc.output_pin.first,
+                                     interc.output_pin.second);
+
+  /* Instanciate memory modules */
+  ModuleId mem_module = module_manager.find_module(interc.mem_module_name);
+  VTR_ASSERT(true == module_manager.valid_module_id(mem_module));
+
+  size_t mem_instance_id =
+    module_manager.num_instance(parent_module, mem_module);
+  module_manager.add_child_module(parent_module, mem_module);
+  module_manager.set_child_instance_name(parent_module, mem_module,
+                                         mem_instance_id,
+                                         interc.mem_instance_name);
+
+  /* Add nets to connect regular and mode-select SRAM ports to the SRAM port of
+   * memory module */
+  add_module_nets_between_logic_and_memory_sram_bus(
+    module_manager, parent_module, mux_module, mux_instance_id, mem_module,
+    mem_instance_id, circuit_lib, interc.mux_model);
+  /* Update memory and instance list */
+  module_manager.add_configurable_child(parent_module, mem_module,
+                                        mem_instance_id);
+}
+
+/*********************************************************************
+ * Add a staged routing module to the module manager, including
+ * ports, interconnections, global ports and configuration ports
+ ********************************************************************/
+static void add_routing_module_from_staging(
+  ModuleManager& module_manager, DecoderLibrary& decoder_lib,
+  const CircuitLibrary& circuit_lib,
+  const e_config_protocol_type& sram_orgz_type,
+  const CircuitModelId& sram_model, const RoutingModuleStaging& staging,
+  const bool& verbose) {
+  /* Create a Module and add to module manager */
+  ModuleId routing_module = module_manager.add_module(staging.module_name);
+
+  /* Label module usage */
+  module_manager.set_module_usage(routing_module, staging.usage);
+
+  VTR_LOGV(verbose, "Building module '%s'...", staging.module_name.c_str());
+
+  /* Create a cache (fast look up) for module nets whose source are input ports
+   */
+  std::map<ModulePinInfo, ModuleNetId> input_port_to_module_nets;
+
+  for (size_t iport = 0; iport < staging.ports.size(); ++iport) {
+    ModulePortId port_id = module_manager.add_port(
+      routing_module, staging.ports[iport], staging.port_types[iport]);
+    /* Port ids must be the same as those used in staging */
+    VTR_ASSERT(size_t(port_id) == iport);
+    if (false == staging.port_source_nets[iport]) {
+      continue;
+    }
+    /* Cache the input net */
+    for (const size_t& pin : staging.ports[iport].pins()) {
+      ModuleNetId net = create_module_source_pin_net(
+        module_manager, routing_module, routing_module, 0, port_id, pin);
+      input_port_to_module_nets[ModulePinInfo(port_id, pin)] = net;
+    }
+  }
+
+  for (const auto& short_wire : staging.port_short_wires) {
+    ModuleNetId net = create_module_source_pin_net(
+      module_manager, routing_module, routing_module, 0, short_wire.first.first,
+      short_wire.first.second);
+    module_manager.add_module_net_sink(routing_module, net, routing_module, 0,
+                                       short_wire.second.first,
+                                       short_wire.second.second);
+    /* Cache the module net */
+    input_port_to_module_nets[short_wire.first] = net;
+  }
+
+  /* Add routing multiplexers as child modules, or short wires */
+  for (const RoutingIntercStaging& interc : staging.intercs) {
+    if (true == interc.is_mux) {
+      add_routing_module_mux_interc(module_manager, routing_module, circuit_lib,
+                                    interc, staging.check_mux_input_net_source,
+                                    input_port_to_module_nets);
+      continue;
     }
+    VTR_ASSERT(1 == interc.input_pins.size());
+    /* Skip Configuring the net source, it is done before */
+    ModuleNetId net = input_port_to_module_nets.at(interc.input_pins[0]);
+    /* Configure the net sink */
+    module_manager.add_module_net_sink(routing_module, net, routing_module, 0,
+                                       interc.output_pin.first,
+                                       interc.output_pin.second);
   }
 
   /* Add global ports to the pb_module:
@@ -950,7 +952,7 @@ static void build_connection_block_module(
    * we just need to find all the global ports from the child modules and build
    * a list of it
    */
-  add_module_global_ports_from_child_modules(module_manager, cb_module);
+  add_module_global_ports_from_child_modules(module_manager, routing_module);
 
   /* Count shared SRAM ports from the sub-modules under this Verilog module
    * This is a much easier job after adding sub modules (instances),
@@ -959,9 +961,9 @@ static void build_connection_block_module(
    */
   size_t module_num_shared_config_bits =
     find_module_num_shared_config_bits_from_child_modules(module_manager,
-                                                          cb_module);
+                                                          routing_module);
   if (0 < module_num_shared_config_bits) {
-    add_reserved_sram_ports_to_module_manager(module_manager, cb_module,
+    add_reserved_sram_ports_to_module_manager(module_manager, routing_module,
                                               module_num_shared_config_bits);
   }
 
@@ -972,10 +974,10 @@ static void build_connection_block_module(
    */
   size_t module_num_config_bits =
     find_module_num_config_bits_from_child_modules(
-      module_manager, cb_module, circuit_lib, sram_model, sram_orgz_type);
+      module_manager, routing_module, circuit_lib, sram_model, sram_orgz_type);
   if (0 < module_num_config_bits) {
-    add_pb_sram_ports_to_module_manager(module_manager, cb_module, circuit_lib,
-                                        sram_model, sram_orgz_type,
+    add_pb_sram_ports_to_module_manager(module_manager, routing_module,
+                                        circuit_lib, sram_model, sram_orgz_type,
                                         module_num_config_bits);
   }
 
@@ -983,9 +985,9 @@ static void build_connection_block_module(
    * primitive modules This is a one-shot addition that covers all the memory
    * modules in this primitive module!
    */
-  if (0 < module_manager.configurable_children(cb_module).size()) {
+  if (0 < module_manager.configurable_children(routing_module).size()) {
     add_pb_module_nets_memory_config_bus(
-      module_manager, decoder_lib, cb_module, sram_orgz_type,
+      module_manager, decoder_lib, routing_module, sram_orgz_type,
       circuit_lib.design_tech_type(sram_model));
   }
 
@@ -993,33 +995,47 @@ static void build_connection_block_module(
 }
 
 /********************************************************************
- * Iterate over all the connection blocks in a device
- * and build a module for each of them
+ * Build a list of routing modules, each of which is either a switch block
+ * (CHANX and CHANY are not applicable) or a connection block of a GSB.
+ * Routing modules are staged on multiple threads in batches, and then added
+ * to the module manager in the order of the list.
  *******************************************************************/
-static void build_flatten_connection_block_modules(
+static void build_routing_modules(
   ModuleManager& module_manager, DecoderLibrary& decoder_lib,
   const DeviceContext& device_ctx, const VprDeviceAnnotation& device_annotation,
-  const DeviceRRGSB& device_rr_gsb, const CircuitLibrary& circuit_lib,
+  const CircuitLibrary& circuit_lib,
   const e_config_protocol_type& sram_orgz_type,
-  const CircuitModelId& sram_model, const t_rr_type& cb_type,
-  const bool& verbose) {
-  /* Build unique X-direction connection block modules */
-  vtr::Point<size_t> cb_range = device_rr_gsb.get_gsb_range();
-
-  for (size_t ix = 0; ix < cb_range.x(); ++ix) {
-    for (size_t iy = 0; iy < cb_range.y(); ++iy) {
-      /* Check if the connection block exists in the device!
-       * Some of them do NOT exist due to heterogeneous blocks (height > 1)
-       * We will skip those modules
-       */
-      const RRGSB& rr_gsb = device_rr_gsb.get_gsb(ix, iy);
-      if (false == rr_gsb.is_cb_exist(cb_type)) {
-        continue;
+  const CircuitModelId& sram_model,
+  const std::vector<std::pair<const RRGSB*, t_rr_type>>& routing_modules,
+  const size_t& num_threads, const bool& verbose) {
+  std::vector<RoutingModuleStaging> stagings;
+
+  for (size_t batch_begin = 0; batch_begin < routing_modules.size();
+       batch_begin += ROUTING_MODULE_STAGING_BATCH_SIZE) {
+    size_t batch_end =
+      std::min(batch_begin + ROUTING_MODULE_STAGING_BATCH_SIZE,
+               routing_modules.size());
+    stagings.clear();
+    stagings.resize(batch_end - batch_begin);
+
+    parallel_for(stagings.size(), num_threads, [&](const size_t& ijob) {
+      const RRGSB& rr_gsb = *(routing_modules[batch_begin + ijob].first);
+      const t_rr_type& cb_type = routing_modules[batch_begin + ijob].second;
+      if ((CHANX == cb_type) || (CHANY == cb_type)) {
+        stagings[ijob] = stage_connection_block_module(
+          device_annotation, device_ctx.grid, device_ctx.rr_graph, circuit_lib,
+          rr_gsb, cb_type);
+      } else {
+        stagings[ijob] =
+          stage_switch_block_module(device_annotation, device_ctx.grid,
+                                    device_ctx.rr_graph, circuit_lib, rr_gsb);
       }
-      build_connection_block_module(
-        module_manager, decoder_lib, device_annotation, device_ctx.grid,
-        device_ctx.rr_graph, circuit_lib, sram_orgz_type, sram_model, rr_gsb,
-        cb_type, verbose);
+    });
+
+    for (const RoutingModuleStaging& staging : stagings) {
+      add_routing_module_from_staging(module_manager, decoder_lib, circuit_lib,
+                                      sram_orgz_type, sram_model, staging,
+                                      verbose);
     }
   }
 }
@@ -1038,32 +1054,46 @@ void build_flatten_routing_modules(
   const DeviceContext& device_ctx, const VprDeviceAnnotation& device_annotation,
   const DeviceRRGSB& device_rr_gsb, const CircuitLibrary& circuit_lib,
   const e_config_protocol_type& sram_orgz_type,
-  const CircuitModelId& sram_model, const bool& verbose) {
+  const CircuitModelId& sram_model, const size_t& num_threads,
+  const bool& verbose) {
   vtr::ScopedStartFinishTimer timer("Build routing modules...");
 
-  vtr::Point<size_t> sb_range = device_rr_gsb.get_gsb_range();
+  vtr::Point<size_t> gsb_range = device_rr_gsb.get_gsb_range();
 
-  /* Build unique switch block modules */
-  for (size_t ix = 0; ix < sb_range.x(); ++ix) {
-    for (size_t iy = 0; iy < sb_range.y(); ++iy) {
+  /* Switch blocks are labeled by an invalid type of connection block */
+  std::vector<std::pair<const RRGSB*, t_rr_type>> routing_modules;
+
+  /* Build switch block modules */
+  for (size_t ix = 0; ix < gsb_range.x(); ++ix) {
+    for (size_t iy = 0; iy < gsb_range.y(); ++iy) {
       const RRGSB& rr_gsb = device_rr_gsb.get_gsb(ix, iy);
       if (false == rr_gsb.is_sb_exist()) {
         continue;
       }
-      build_switch_block_module(module_manager, decoder_lib, device_annotation,
-                                device_ctx.grid, device_ctx.rr_graph,
-                                circuit_lib, sram_orgz_type, sram_model, rr_gsb,
-                                verbose);
+      routing_modules.push_back(std::make_pair(&rr_gsb, NUM_RR_TYPES));
     }
   }
 
-  build_flatten_connection_block_modules(
-    module_manager, decoder_lib, device_ctx, device_annotation, device_rr_gsb,
-    circuit_lib, sram_orgz_type, sram_model, CHANX, verbose);
+  /* Build X-direction and Y-direction connection block modules */
+  for (const t_rr_type& cb_type : {CHANX, CHANY}) {
+    for (size_t ix = 0; ix < gsb_range.x(); ++ix) {
+      for (size_t iy = 0; iy < gsb_range.y(); ++iy) {
+        /* Check if the connection block exists in the device!
+         * Some of them do NOT exist due to heterogeneous blocks (height > 1)
+         * We will skip those modules
+         */
+        const RRGSB& rr_gsb = device_rr_gsb.get_gsb(ix, iy);
+        if (false == rr_gsb.is_cb_exist(cb_type)) {
+          continue;
+        }
+        routing_modules.push_back(std::make_pair(&rr_gsb, cb_type));
+      }
+    }
+  }
 
-  build_flatten_connection_block_modules(
-    module_manager, decoder_lib, device_ctx, device_annotation, device_rr_gsb,
-    circuit_lib, sram_orgz_type, sram_model, CHANY, verbose);
+  build_routing_modules(module_manager, decoder_lib, device_ctx,
+                        device_annotation, circuit_lib, sram_orgz_type,
+                        sram_model, routing_modules, num_threads, verbose);
 }
 
 /********************************************************************
@@ -1082,39 +1112,31 @@ void build_unique_routing_modules(
   const DeviceContext& device_ctx, const VprDeviceAnnotation& device_annotation,
   const DeviceRRGSB& device_rr_gsb, const CircuitLibrary& circuit_lib,
   const e_config_protocol_type& sram_orgz_type,
-  const CircuitModelId& sram_model, const bool& verbose) {
+  const CircuitModelId& sram_model, const size_t& num_threads,
+  const bool& verbose) {
   vtr::ScopedStartFinishTimer timer("Build unique routing modules...");
 
+  /* Switch blocks are labeled by an invalid type of connection block */
+  std::vector<std::pair<const RRGSB*, t_rr_type>> routing_modules;
+
   /* Build unique switch block modules */
   for (size_t isb = 0; isb < device_rr_gsb.get_num_sb_unique_module(); ++isb) {
-    const RRGSB& unique_mirror = device_rr_gsb.get_sb_unique_module(isb);
-    build_switch_block_module(module_manager, decoder_lib, device_annotation,
-                              device_ctx.grid, device_ctx.rr_graph, circuit_lib,
-                              sram_orgz_type, sram_model, unique_mirror,
-                              verbose);
+    routing_modules.push_back(
+      std::make_pair(&device_rr_gsb.get_sb_unique_module(isb), NUM_RR_TYPES));
   }
 
-  /* Build unique X-direction connection block modules */
-  for (size_t icb = 0; icb < device_rr_gsb.get_num_cb_unique_module(CHANX);
-       ++icb) {
-    const RRGSB& unique_mirror = device_rr_gsb.get_cb_unique_module(CHANX, icb);
-
-    build_connection_block_module(
-      module_manager, decoder_lib, device_annotation, device_ctx.grid,
-      device_ctx.rr_graph, circuit_lib, sram_orgz_type, sram_model,
-      unique_mirror, CHANX, verbose);
+  /* Build unique X-direction and Y-direction connection block modules */
+  for (const t_rr_type& cb_type : {CHANX, CHANY}) {
+    for (size_t icb = 0; icb < device_rr_gsb.get_num_cb_unique_module(cb_type);
+         ++icb) {
+      routing_modules.push_back(std::make_pair(
+        &device_rr_gsb.get_cb_unique_module(cb_type, icb), cb_type));
+    }
   }
 
-  /* Build unique X-direction connection block modules */
-  for (size_t icb = 0; icb < device_rr_gsb.get_num_cb_unique_module(CHANY);
-       ++icb) {
-    const RRGSB& unique_mirror = device_rr_gsb.get_cb_unique_module(CHANY, icb);
-
-    build_connection_block_module(
-      module_manager, decoder_lib, device_annotation, device_ctx.grid,
-      device_ctx.rr_graph, circuit_lib, sram_orgz_type, sram_model,
-      unique_mirror, CHANY, verbose);
-  }
+  build_routing_modules(module_manager, decoder_lib, device_ctx,
+                        device_annotation, circuit_lib, sram_orgz_type,
+                        sram_model, routing_modules, num_threads, verbose);
 }
 
 } /* end namespace openfpga */
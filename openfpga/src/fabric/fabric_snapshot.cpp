@@ -0,0 +1,976 @@
+/********************************************************************
+ * This file includes functions to save and restore a snapshot of the
+ * fabric module graph in a binary file, so that build_fabric can be
+ * skipped when the architecture and the options are not changed.
+ *
+ * A snapshot includes:
+ * - the module graph (modules, ports, children, configurable regions and nets)
+ * - the library of decoders
+ * - the shift register banks for BL/WL protocols
+ * - the unique module lists of the device GSBs
+ *
+ * All the data are restored through the public APIs of each data structure,
+ * so that the internal fast look-ups are rebuilt consistently.
+ *******************************************************************/
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <sstream>
+
+/* Headers from vtrutil library */
+#include "vtr_assert.h"
+#include "vtr_digest.h"
+#include "vtr_log.h"
+#include "vtr_time.h"
+
+/* Headers from openfpgautil library */
+#include "command_exit_codes.h"
+#include "fabric_snapshot.h"
+#include "openfpga_digest.h"
+#include "openfpga_version.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/* Signature and format version at the head of each snapshot file.
+ * Increase the version whenever the layout of the file is changed */
+constexpr const char* FABRIC_SNAPSHOT_SIGNATURE = "OPENFPGA_FABRIC_SNAPSHOT";
+constexpr size_t FABRIC_SNAPSHOT_FORMAT_VERSION = 2;
+
+/********************************************************************
+ * Basic writers/readers of the binary file
+ * All the integers are stored in 64 bits to be independent from platforms
+ *******************************************************************/
+static void write_snapshot_size(std::fstream& fp, const size_t& value) {
+  uint64_t data = value;
+  fp.write(reinterpret_cast<const char*>(&data), sizeof(data));
+}
+
+static void write_snapshot_string(std::fstream& fp, const std::string& str) {
+  write_snapshot_size(fp, str.size());
+  fp.write(str.data(), str.size());
+}
+
+static void write_snapshot_port(std::fstream& fp, const BasicPort& port) {
+  write_snapshot_string(fp, port.get_name());
+  write_snapshot_size(fp, port.get_lsb());
+  write_snapshot_size(fp, port.get_msb());
+  write_snapshot_size(fp, port.get_origin_port_width());
+}
+
+static void write_snapshot_coordinate(std::fstream& fp,
+                                      const vtr::Point<int>& coord) {
+  write_snapshot_size(fp, size_t(coord.x()));
+  write_snapshot_size(fp, size_t(coord.y()));
+}
+
+static size_t read_snapshot_size(std::fstream& fp) {
+  uint64_t data = 0;
+  fp.read(reinterpret_cast<char*>(&data), sizeof(data));
+  return size_t(data);
+}
+
+/********************************************************************
+ * Identify if a count read from the file is valid, i.e., the items of
+ * the given minimum size in bytes do not exceed the remaining file.
+ * This rejects corrupted counts before any allocation. Small counts
+ * are not checked, which avoids seeking the file for each of them
+ *******************************************************************/
+static bool valid_snapshot_count(std::fstream& fp, const size_t& count,
+                                 const size_t& item_size) {
+  constexpr size_t NUM_UNCHECKED_BYTES = 4096;
+  if (count <= NUM_UNCHECKED_BYTES / item_size) {
+    return true;
+  }
+  std::streampos curr_pos = fp.tellg();
+  fp.seekg(0, std::ios::end);
+  std::streampos end_pos = fp.tellg();
+  fp.seekg(curr_pos);
+  if (!fp.good() || (end_pos < curr_pos)) {
+    return false;
+  }
+  if (count > size_t(end_pos - curr_pos) / item_size) {
+    fp.setstate(std::ios::failbit);
+    return false;
+  }
+  return true;
+}
+
+static std::string read_snapshot_string(std::fstream& fp) {
+  size_t str_size = read_snapshot_size(fp);
+  if (!fp.good() || !valid_snapshot_count(fp, str_size, sizeof(char))) {
+    return std::string();
+  }
+  std::string str(str_size, '\0');
+  fp.read(&str[0], str_size);
+  return str;
+}
+
+static BasicPort read_snapshot_port(std::fstream& fp) {
+  /* Restore the exact LSB/MSB, even for invalid ports */
+  BasicPort port;
+  port.set_name(read_snapshot_string(fp));
+  port.set_lsb(read_snapshot_size(fp));
+  port.set_msb(read_snapshot_size(fp));
+  port.set_origin_port_width(read_snapshot_size(fp));
+  return port;
+}
+
+static vtr::Point<int> read_snapshot_coordinate(std::fstream& fp) {
+  int x = int(read_snapshot_size(fp));
+  int y = int(read_snapshot_size(fp));
+  return vtr::Point<int>(x, y);
+}
+
+/********************************************************************
+ * Create a key which identifies all the inputs of build_fabric
+ * Any change on the architectures, the routing resource graph or the
+ * options will lead to a different key
+ *******************************************************************/
+std::string find_fabric_snapshot_key(const FlowManager& flow_manager,
+                                     const DeviceContext& vpr_device_ctx,
+                                     const std::string& fabric_key_fname,
+                                     const bool& frame_view, const bool& lite,
+                                     const bool& compress_routing,
+                                     const bool& duplicate_grid_pin) {
+  std::stringstream key_stream;
+
+  key_stream << "version=" << VERSION << "\n";
+  key_stream << "openfpga_arch=" << flow_manager.arch_digest() << "\n";
+  key_stream << "clock_arch=" << flow_manager.clock_arch_digest() << "\n";
+  key_stream << "sort_gsb_in_edges=" << flow_manager.sort_gsb_in_edges()
+             << "\n";
+  if (nullptr != vpr_device_ctx.arch->architecture_id) {
+    key_stream << "vpr_arch=" << vpr_device_ctx.arch->architecture_id << "\n";
+  }
+  if (!vpr_device_ctx.read_rr_graph_filename.empty()) {
+    key_stream << "rr_graph="
+               << vtr::secure_digest_file(vpr_device_ctx.read_rr_graph_filename)
+               << "\n";
+  }
+  key_stream << "grid=" << vpr_device_ctx.grid.width() << "x"
+             << vpr_device_ctx.grid.height() << "\n";
+  key_stream << "chan_width=" << vpr_device_ctx.chan_width.max << "\n";
+  key_stream << "rr_nodes=" << vpr_device_ctx.rr_graph.num_nodes() << "\n";
+  /* Graphs built in process have no file to digest, so count the edges
+   * which are changed by most of the routing options */
+  if (vpr_device_ctx.read_rr_graph_filename.empty()) {
+    size_t num_rr_edges = 0;
+    for (const RRNodeId& node : vpr_device_ctx.rr_graph.nodes()) {
+      num_rr_edges += vpr_device_ctx.rr_graph.num_edges(node);
+    }
+    key_stream << "rr_edges=" << num_rr_edges << "\n";
+  }
+  if (!fabric_key_fname.empty()) {
+    key_stream << "fabric_key=" << vtr::secure_digest_file(fabric_key_fname)
+               << "\n";
+  }
+  key_stream << "frame_view=" << frame_view << "\n";
+  key_stream << "lite=" << lite << "\n";
+  key_stream << "compress_routing=" << compress_routing << "\n";
+  key_stream << "duplicate_grid_pin=" << duplicate_grid_pin << "\n";
+
+  return vtr::secure_digest_stream(key_stream);
+}
+
+/********************************************************************
+ * Find the name of the snapshot file under a cache directory
+ * Snapshots of different keys can co-exist in the same directory
+ *******************************************************************/
+std::string find_fabric_snapshot_file_name(const std::string& cache_dir,
+                                           const std::string& snapshot_key) {
+  /* Keep only the hexadecimal part of digest, e.g., SHA256:<hex> */
+  std::string key_hex;
+  size_t found = snapshot_key.rfind(':');
+  for (size_t ichar = (found == std::string::npos) ? 0 : found + 1;
+       ichar < snapshot_key.size(); ++ichar) {
+    if (std::isalnum(snapshot_key[ichar])) {
+      key_hex.push_back(snapshot_key[ichar]);
+    }
+  }
+  return format_dir_path(cache_dir) + std::string("fabric_snapshot_") +
+         key_hex + std::string(".bin");
+}
+
+/********************************************************************
+ * Write the module graph
+ * Modules and ports are written first, so that children and nets can
+ * refer to any module when restoring
+ *******************************************************************/
+static void write_module_graph_to_snapshot(
+  std::fstream& fp, const ModuleManager& module_manager) {
+  write_snapshot_size(fp, module_manager.is_lite());
+  write_snapshot_size(fp, module_manager.num_modules());
+  for (const ModuleId& module : module_manager.modules()) {
+    write_snapshot_string(fp, module_manager.module_name(module));
+    write_snapshot_size(fp, size_t(module_manager.module_usage(module)));
+    write_snapshot_size(fp, module_manager.module_ports(module).size());
+    for (const ModulePortId& port : module_manager.module_ports(module)) {
+      write_snapshot_port(fp, module_manager.module_port(module, port));
+      write_snapshot_size(fp, size_t(module_manager.port_type(module, port)));
+      write_snapshot_size(fp, module_manager.port_is_wire(module, port));
+      write_snapshot_size(fp, module_manager.port_is_mappable_io(module, port));
+      write_snapshot_size(fp, module_manager.port_is_register(module, port));
+      write_snapshot_string(fp, module_manager.port_preproc_flag(module, port));
+    }
+  }
+
+  for (const ModuleId& module : module_manager.modules()) {
+    /* Child modules and instance names */
+    std::vector<ModuleId> children = module_manager.child_modules(module);
+    write_snapshot_size(fp, children.size());
+    for (const ModuleId& child : children) {
+      write_snapshot_size(fp, size_t(child));
+      write_snapshot_size(fp, module_manager.num_instance(module, child));
+      for (const size_t& inst :
+           module_manager.child_module_instances(module, child)) {
+        write_snapshot_string(fp,
+                              module_manager.instance_name(module, child, inst));
+      }
+    }
+
+    /* Configurable children */
+    std::vector<ModuleId> config_children =
+      module_manager.configurable_children(module);
+    std::vector<size_t> config_child_insts =
+      module_manager.configurable_child_instances(module);
+    std::vector<vtr::Point<int>> config_child_coords =
+      module_manager.configurable_child_coordinates(module);
+    write_snapshot_size(fp, config_children.size());
+    std::map<std::pair<ModuleId, size_t>, size_t> config_child_ids;
+    for (size_t ichild = 0; ichild < config_children.size(); ++ichild) {
+      write_snapshot_size(fp, size_t(config_children[ichild]));
+      write_snapshot_size(fp, config_child_insts[ichild]);
+      write_snapshot_coordinate(fp, config_child_coords[ichild]);
+      config_child_ids[std::make_pair(config_children[ichild],
+                                      config_child_insts[ichild])] = ichild;
+    }
+
+    /* Configurable regions, where children are referred by their index in the
+     * configurable children list */
+    write_snapshot_size(fp, module_manager.regions(module).size());
+    for (const ConfigRegionId& region : module_manager.regions(module)) {
+      std::vector<ModuleId> region_children =
+        module_manager.region_configurable_children(module, region);
+      std::vector<size_t> region_child_insts =
+        module_manager.region_configurable_child_instances(module, region);
+      write_snapshot_size(fp, region_children.size());
+      for (size_t ichild = 0; ichild < region_children.size(); ++ichild) {
+        write_snapshot_size(
+          fp, config_child_ids.at(std::make_pair(region_children[ichild],
+                                                 region_child_insts[ichild])));
+      }
+    }
+
+    /* I/O children */
+    std::vector<ModuleId> io_children = module_manager.io_children(module);
+    std::vector<size_t> io_child_insts =
+      module_manager.io_child_instances(module);
+    std::vector<vtr::Point<int>> io_child_coords =
+      module_manager.io_child_coordinates(module);
+    write_snapshot_size(fp, io_children.size());
+    for (size_t ichild = 0; ichild < io_children.size(); ++ichild) {
+      write_snapshot_size(fp, size_t(io_children[ichild]));
+      write_snapshot_size(fp, io_child_insts[ichild]);
+      write_snapshot_coordinate(fp, io_child_coords[ichild]);
+    }
+  }
+
+  /* Nets */
+  for (const ModuleId& module : module_manager.modules()) {
+    write_snapshot_size(fp, module_manager.num_nets(module));
+    for (size_t inet = 0; inet < module_manager.num_nets(module); ++inet) {
+      ModuleNetId net = ModuleNetId(inet);
+      write_snapshot_string(fp, module_manager.net_name(module, net));
+
+      auto src_modules = module_manager.net_source_modules(module, net);
+      auto src_insts = module_manager.net_source_instances(module, net);
+      auto src_ports = module_manager.net_source_ports(module, net);
+      auto src_pins = module_manager.net_source_pins(module, net);
+      write_snapshot_size(fp, src_modules.size());
+      for (const ModuleNetSrcId& src :
+           module_manager.module_net_sources(module, net)) {
+        write_snapshot_size(fp, size_t(src_modules[src]));
+        write_snapshot_size(fp, src_insts[src]);
+        write_snapshot_size(fp, size_t(src_ports[src]));
+        write_snapshot_size(fp, src_pins[src]);
+      }
+
+      auto sink_modules = module_manager.net_sink_modules(module, net);
+      auto sink_insts = module_manager.net_sink_instances(module, net);
+      auto sink_ports = module_manager.net_sink_ports(module, net);
+      auto sink_pins = module_manager.net_sink_pins(module, net);
+      write_snapshot_size(fp, sink_modules.size());
+      for (const ModuleNetSinkId& sink :
+           module_manager.module_net_sinks(module, net)) {
+        write_snapshot_size(fp, size_t(sink_modules[sink]));
+        write_snapshot_size(fp, sink_insts[sink]);
+        write_snapshot_size(fp, size_t(sink_ports[sink]));
+        write_snapshot_size(fp, sink_pins[sink]);
+      }
+    }
+  }
+}
+
+/********************************************************************
+ * Identify if a net terminal read from the file refers to a valid pin
+ * of the parent module itself or of one of its child instances
+ *******************************************************************/
+static bool valid_snapshot_net_terminal(const ModuleManager& module_manager,
+                                        const ModuleId& parent_module,
+                                        const ModuleId& child_module,
+                                        const size_t& child_instance,
+                                        const ModulePortId& child_port,
+                                        const size_t& child_pin) {
+  if (!module_manager.valid_module_port_id(child_module, child_port)) {
+    return false;
+  }
+  if ((child_module != parent_module) &&
+      !module_manager.valid_module_instance_id(parent_module, child_module,
+                                               child_instance)) {
+    return false;
+  }
+  return child_pin <
+         module_manager.module_port(child_module, child_port).get_width();
+}
+
+/********************************************************************
+ * Restore the module graph written by write_module_graph_to_snapshot()
+ * Return false if the file is truncated
+ *******************************************************************/
+static bool read_module_graph_from_snapshot(std::fstream& fp,
+                                            ModuleManager& module_manager) {
+  /* Lite mode must be set before adding any module */
+  module_manager.set_lite(read_snapshot_size(fp));
+  size_t num_modules = read_snapshot_size(fp);
+  for (size_t imodule = 0; imodule < num_modules && fp.good(); ++imodule) {
+    ModuleId module = module_manager.add_module(read_snapshot_string(fp));
+    if (!module_manager.valid_module_id(module) ||
+        size_t(module) != imodule) {
+      return false;
+    }
+    size_t usage = read_snapshot_size(fp);
+    if (usage >= ModuleManager::NUM_MODULE_USAGE_TYPES) {
+      return false;
+    }
+    module_manager.set_module_usage(
+      module, ModuleManager::e_module_usage_type(usage));
+    size_t num_ports = read_snapshot_size(fp);
+    for (size_t iport = 0; iport < num_ports && fp.good(); ++iport) {
+      BasicPort port_info = read_snapshot_port(fp);
+      size_t port_type = read_snapshot_size(fp);
+      if (port_type >= ModuleManager::NUM_MODULE_PORT_TYPES) {
+        return false;
+      }
+      ModulePortId port = module_manager.add_port(
+        module, port_info, ModuleManager::e_module_port_type(port_type));
+      /* Wire and register flags are set by name in module manager */
+      bool is_wire = read_snapshot_size(fp);
+      if (is_wire) {
+        module_manager.set_port_is_wire(module, port_info.get_name(), true);
+      }
+      module_manager.set_port_is_mappable_io(module, port,
+                                             read_snapshot_size(fp));
+      bool is_register = read_snapshot_size(fp);
+      if (is_register) {
+        module_manager.set_port_is_register(module, port_info.get_name(),
+                                            true);
+      }
+      module_manager.set_port_preproc_flag(module, port,
+                                           read_snapshot_string(fp));
+    }
+  }
+  if (!fp.good()) {
+    return false;
+  }
+
+  for (const ModuleId& module : module_manager.modules()) {
+    size_t num_children = read_snapshot_size(fp);
+    for (size_t ichild = 0; ichild < num_children && fp.good(); ++ichild) {
+      ModuleId child = ModuleId(read_snapshot_size(fp));
+      if (!module_manager.valid_module_id(child)) {
+        return false;
+      }
+      size_t num_insts = read_snapshot_size(fp);
+      for (size_t inst = 0; inst < num_insts && fp.good(); ++inst) {
+        /* I/O children are restored later in their own sequence */
+        module_manager.add_child_module(module, child, false);
+        module_manager.set_child_instance_name(module, child, inst,
+                                               read_snapshot_string(fp));
+      }
+    }
+
+    size_t num_config_children = read_snapshot_size(fp);
+    if (!valid_snapshot_count(fp, num_config_children,
+                              4 * sizeof(uint64_t))) {
+      return false;
+    }
+    module_manager.reserve_configurable_child(module, num_config_children);
+    for (size_t ichild = 0; ichild < num_config_children && fp.good();
+         ++ichild) {
+      ModuleId child = ModuleId(read_snapshot_size(fp));
+      size_t inst = read_snapshot_size(fp);
+      vtr::Point<int> coord = read_snapshot_coordinate(fp);
+      if (!module_manager.valid_module_instance_id(module, child, inst)) {
+        return false;
+      }
+      module_manager.add_configurable_child(module, child, inst, coord);
+    }
+
+    std::vector<ModuleId> config_children =
+      module_manager.configurable_children(module);
+    std::vector<size_t> config_child_insts =
+      module_manager.configurable_child_instances(module);
+    size_t num_regions = read_snapshot_size(fp);
+    for (size_t iregion = 0; iregion < num_regions && fp.good(); ++iregion) {
+      ConfigRegionId region = module_manager.add_config_region(module);
+      size_t num_region_children = read_snapshot_size(fp);
+      for (size_t ichild = 0; ichild < num_region_children && fp.good();
+           ++ichild) {
+        size_t config_child_id = read_snapshot_size(fp);
+        if (config_child_id >= config_children.size()) {
+          return false;
+        }
+        module_manager.add_configurable_child_to_region(
+          module, region, config_children[config_child_id],
+          config_child_insts[config_child_id], config_child_id);
+      }
+    }
+
+    size_t num_io_children = read_snapshot_size(fp);
+    if (!valid_snapshot_count(fp, num_io_children, 4 * sizeof(uint64_t))) {
+      return false;
+    }
+    module_manager.reserve_io_child(module, num_io_children);
+    for (size_t ichild = 0; ichild < num_io_children && fp.good(); ++ichild) {
+      ModuleId child = ModuleId(read_snapshot_size(fp));
+      size_t inst = read_snapshot_size(fp);
+      vtr::Point<int> coord = read_snapshot_coordinate(fp);
+      if (!module_manager.valid_module_instance_id(module, child, inst)) {
+        return false;
+      }
+      module_manager.add_io_child(module, child, inst, coord);
+    }
+
+    if (!fp.good()) {
+      return false;
+    }
+  }
+
+  for (const ModuleId& module : module_manager.modules()) {
+    size_t num_nets = read_snapshot_size(fp);
+    if (!valid_snapshot_count(fp, num_nets, 3 * sizeof(uint64_t))) {
+      return false;
+    }
+    module_manager.reserve_module_nets(module, num_nets);
+    for (size_t inet = 0; inet < num_nets && fp.good(); ++inet) {
+      ModuleNetId net = module_manager.create_module_net(module);
+      module_manager.set_net_name(module, net, read_snapshot_string(fp));
+
+      size_t num_srcs = read_snapshot_size(fp);
+      if (!valid_snapshot_count(fp, num_srcs, 4 * sizeof(uint64_t))) {
+        return false;
+      }
+      module_manager.reserve_module_net_sources(module, net, num_srcs);
+      for (size_t isrc = 0; isrc < num_srcs && fp.good(); ++isrc) {
+        ModuleId src_module = ModuleId(read_snapshot_size(fp));
+        size_t src_inst = read_snapshot_size(fp);
+        ModulePortId src_port = ModulePortId(read_snapshot_size(fp));
+        size_t src_pin = read_snapshot_size(fp);
+        if (!valid_snapshot_net_terminal(module_manager, module, src_module,
+                                         src_inst, src_port, src_pin)) {
+          return false;
+        }
+        module_manager.add_module_net_source(module, net, src_module, src_inst,
+                                             src_port, src_pin);
+      }
+
+      size_t num_sinks = read_snapshot_size(fp);
+      if (!valid_snapshot_count(fp, num_sinks, 4 * sizeof(uint64_t))) {
+        return false;
+      }
+      module_manager.reserve_module_net_sinks(module, net, num_sinks);
+      for (size_t isink = 0; isink < num_sinks && fp.good(); ++isink) {
+        ModuleId sink_module = ModuleId(read_snapshot_size(fp));
+        size_t sink_inst = read_snapshot_size(fp);
+        ModulePortId sink_port = ModulePortId(read_snapshot_size(fp));
+        size_t sink_pin = read_snapshot_size(fp);
+        if (!valid_snapshot_net_terminal(module_manager, module, sink_module,
+                                         sink_inst, sink_port, sink_pin)) {
+          return false;
+        }
+        module_manager.add_module_net_sink(module, net, sink_module, sink_inst,
+                                           sink_port, sink_pin);
+      }
+    }
+  }
+
+  return fp.good();
+}
+
+/********************************************************************
+ * Write/restore the decoder library
+ *******************************************************************/
+static void write_decoder_library_to_snapshot(
+  std::fstream& fp, const DecoderLibrary& decoder_lib) {
+  write_snapshot_size(fp, decoder_lib.decoders().size());
+  for (const DecoderId& decoder : decoder_lib.decoders()) {
+    write_snapshot_size(fp, decoder_lib.addr_size(decoder));
+    write_snapshot_size(fp, decoder_lib.data_size(decoder));
+    write_snapshot_size(fp, decoder_lib.use_enable(decoder));
+    write_snapshot_size(fp, decoder_lib.use_data_in(decoder));
+    write_snapshot_size(fp, decoder_lib.use_data_inv_port(decoder));
+    write_snapshot_size(fp, decoder_lib.use_readback(decoder));
+  }
+}
+
+static bool read_decoder_library_from_snapshot(std::fstream& fp,
+                                               DecoderLibrary& decoder_lib) {
+  size_t num_decoders = read_snapshot_size(fp);
+  for (size_t idec = 0; idec < num_decoders && fp.good(); ++idec) {
+    size_t addr_size = read_snapshot_size(fp);
+    size_t data_size = read_snapshot_size(fp);
+    bool use_enable = read_snapshot_size(fp);
+    bool use_data_in = read_snapshot_size(fp);
+    bool use_data_inv_port = read_snapshot_size(fp);
+    bool use_readback = read_snapshot_size(fp);
+    decoder_lib.add_decoder(addr_size, data_size, use_enable, use_data_in,
+                            use_data_inv_port, use_readback);
+  }
+  return fp.good();
+}
+
+/********************************************************************
+ * Write/restore the shift register banks
+ *******************************************************************/
+static void write_blwl_shift_register_banks_to_snapshot(
+  std::fstream& fp, const MemoryBankShiftRegisterBanks& blwl_sr_banks) {
+  write_snapshot_size(fp, blwl_sr_banks.regions().size());
+  for (const ConfigRegionId& region : blwl_sr_banks.regions()) {
+    write_snapshot_size(fp, blwl_sr_banks.bl_banks(region).size());
+    for (const FabricBitLineBankId& bank : blwl_sr_banks.bl_banks(region)) {
+      std::vector<BasicPort> data_ports =
+        blwl_sr_banks.bl_bank_data_ports(region, bank);
+      write_snapshot_size(fp, data_ports.size());
+      for (const BasicPort& data_port : data_ports) {
+        write_snapshot_port(fp, data_port);
+      }
+      write_snapshot_size(
+        fp, size_t(blwl_sr_banks.bl_shift_register_bank_module(region, bank)));
+      write_snapshot_size(
+        fp, blwl_sr_banks.bl_shift_register_bank_instance(region, bank));
+      /* Sink nodes are indexed by the source ports */
+      for (const BasicPort& src_port :
+           blwl_sr_banks.bl_shift_register_bank_source_ports(region, bank)) {
+        std::vector<size_t> sink_child_ids =
+          blwl_sr_banks.bl_shift_register_bank_sink_child_ids(region, bank,
+                                                              src_port);
+        std::vector<size_t> sink_child_pin_ids =
+          blwl_sr_banks.bl_shift_register_bank_sink_child_pin_ids(region, bank,
+                                                                  src_port);
+        VTR_ASSERT(sink_child_ids.size() == sink_child_pin_ids.size());
+        write_snapshot_size(fp, sink_child_ids.size());
+        for (size_t isink = 0; isink < sink_child_ids.size(); ++isink) {
+          write_snapshot_size(fp, sink_child_ids[isink]);
+          write_snapshot_size(fp, sink_child_pin_ids[isink]);
+        }
+      }
+    }
+
+    write_snapshot_size(fp, blwl_sr_banks.wl_banks(region).size());
+    for (const FabricWordLineBankId& bank : blwl_sr_banks.wl_banks(region)) {
+      std::vector<BasicPort> data_ports =
+        blwl_sr_banks.wl_bank_data_ports(region, bank);
+      write_snapshot_size(fp, data_ports.size());
+      for (const BasicPort& data_port : data_ports) {
+        write_snapshot_port(fp, data_port);
+      }
+      write_snapshot_size(
+        fp, size_t(blwl_sr_banks.wl_shift_register_bank_module(region, bank)));
+      write_snapshot_size(
+        fp, blwl_sr_banks.wl_shift_register_bank_instance(region, bank));
+      for (const BasicPort& src_port :
+           blwl_sr_banks.wl_shift_register_bank_source_ports(region, bank)) {
+        std::vector<size_t> sink_child_ids =
+          blwl_sr_banks.wl_shift_register_bank_sink_child_ids(region, bank,
+                                                              src_port);
+        std::vector<size_t> sink_child_pin_ids =
+          blwl_sr_banks.wl_shift_register_bank_sink_child_pin_ids(region, bank,
+                                                                  src_port);
+        VTR_ASSERT(sink_child_ids.size() == sink_child_pin_ids.size());
+        write_snapshot_size(fp, sink_child_ids.size());
+        for (size_t isink = 0; isink < sink_child_ids.size(); ++isink) {
+          write_snapshot_size(fp, sink_child_ids[isink]);
+          write_snapshot_size(fp, sink_child_pin_ids[isink]);
+        }
+      }
+    }
+  }
+}
+
+static bool read_blwl_shift_register_banks_from_snapshot(
+  std::fstream& fp, const ModuleManager& module_manager,
+  MemoryBankShiftRegisterBanks& blwl_sr_banks) {
+  size_t num_regions = read_snapshot_size(fp);
+  if (!fp.good() ||
+      !valid_snapshot_count(fp, num_regions, 2 * sizeof(uint64_t))) {
+    return false;
+  }
+  /* Nothing to restore, keep the banks empty */
+  if (0 == num_regions) {
+    return true;
+  }
+  blwl_sr_banks.resize_regions(num_regions);
+  for (const ConfigRegionId& region : blwl_sr_banks.regions()) {
+    size_t num_bl_banks = read_snapshot_size(fp);
+    if (!valid_snapshot_count(fp, num_bl_banks, 3 * sizeof(uint64_t))) {
+      return false;
+    }
+    blwl_sr_banks.reserve_bl_shift_register_banks(region, num_bl_banks);
+    for (size_t ibank = 0; ibank < num_bl_banks && fp.good(); ++ibank) {
+      FabricBitLineBankId bank =
+        blwl_sr_banks.create_bl_shift_register_bank(region);
+      size_t num_data_ports = read_snapshot_size(fp);
+      for (size_t iport = 0; iport < num_data_ports && fp.good(); ++iport) {
+        blwl_sr_banks.add_data_port_to_bl_shift_register_bank(
+          region, bank, read_snapshot_port(fp));
+      }
+      ModuleId bank_module = ModuleId(read_snapshot_size(fp));
+      if (!module_manager.valid_module_id(bank_module)) {
+        return false;
+      }
+      blwl_sr_banks.link_bl_shift_register_bank_to_module(region, bank,
+                                                          bank_module);
+      blwl_sr_banks.link_bl_shift_register_bank_to_instance(
+        region, bank, read_snapshot_size(fp));
+      for (const BasicPort& src_port :
+           blwl_sr_banks.bl_shift_register_bank_source_ports(region, bank)) {
+        size_t num_sinks = read_snapshot_size(fp);
+        for (size_t isink = 0; isink < num_sinks && fp.good(); ++isink) {
+          size_t sink_child_id = read_snapshot_size(fp);
+          size_t sink_child_pin_id = read_snapshot_size(fp);
+          blwl_sr_banks.add_bl_shift_register_bank_sink_node(
+            region, bank, src_port, sink_child_id, sink_child_pin_id);
+        }
+      }
+    }
+
+    size_t num_wl_banks = read_snapshot_size(fp);
+    if (!valid_snapshot_count(fp, num_wl_banks, 3 * sizeof(uint64_t))) {
+      return false;
+    }
+    blwl_sr_banks.reserve_wl_shift_register_banks(region, num_wl_banks);
+    for (size_t ibank = 0; ibank < num_wl_banks && fp.good(); ++ibank) {
+      FabricWordLineBankId bank =
+        blwl_sr_banks.create_wl_shift_register_bank(region);
+      size_t num_data_ports = read_snapshot_size(fp);
+      for (size_t iport = 0; iport < num_data_ports && fp.good(); ++iport) {
+        blwl_sr_banks.add_data_port_to_wl_shift_register_bank(
+          region, bank, read_snapshot_port(fp));
+      }
+      ModuleId bank_module = ModuleId(read_snapshot_size(fp));
+      if (!module_manager.valid_module_id(bank_module)) {
+        return false;
+      }
+      blwl_sr_banks.link_wl_shift_register_bank_to_module(region, bank,
+                                                          bank_module);
+      blwl_sr_banks.link_wl_shift_register_bank_to_instance(
+        region, bank, read_snapshot_size(fp));
+      for (const BasicPort& src_port :
+           blwl_sr_banks.wl_shift_register_bank_source_ports(region, bank)) {
+        size_t num_sinks = read_snapshot_size(fp);
+        for (size_t isink = 0; isink < num_sinks && fp.good(); ++isink) {
+          size_t sink_child_id = read_snapshot_size(fp);
+          size_t sink_child_pin_id = read_snapshot_size(fp);
+          blwl_sr_banks.add_wl_shift_register_bank_sink_node(
+            region, bank, src_port, sink_child_id, sink_child_pin_id);
+        }
+      }
+    }
+
+    if (!fp.good()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/********************************************************************
+ * Write/restore the unique module lists of GSBs
+ * The GSB array itself is built by link_openfpga_arch and is not stored
+ *******************************************************************/
+static void write_unique_module_list_to_snapshot(
+  std::fstream& fp, const std::vector<vtr::Point<size_t>>& unique_coords,
+  const std::vector<std::vector<size_t>>& unique_ids) {
+  write_snapshot_size(fp, unique_coords.size());
+  for (const vtr::Point<size_t>& coord : unique_coords) {
+    write_snapshot_size(fp, coord.x());
+    write_snapshot_size(fp, coord.y());
+  }
+  for (const std::vector<size_t>& unique_id_column : unique_ids) {
+    for (const size_t& unique_id : unique_id_column) {
+      write_snapshot_size(fp, unique_id);
+    }
+  }
+}
+
+static void write_device_rr_gsb_to_snapshot(std::fstream& fp,
+                                            const DeviceRRGSB& device_rr_gsb) {
+  /* Unique modules are only available when routing hierarchy is compressed */
+  bool has_unique_module = (0 != device_rr_gsb.get_num_gsb_unique_module());
+  write_snapshot_size(fp, has_unique_module);
+  if (!has_unique_module) {
+    return;
+  }
+
+  vtr::Point<size_t> gsb_range = device_rr_gsb.get_gsb_range();
+  write_snapshot_size(fp, gsb_range.x());
+  write_snapshot_size(fp, gsb_range.y());
+
+  /* Gather the id matrix in the sequence of GSB array */
+  std::vector<std::vector<size_t>> gsb_ids(
+    gsb_range.x(), std::vector<size_t>(gsb_range.y(), 0));
+  std::vector<std::vector<size_t>> sb_ids = gsb_ids;
+  std::vector<std::vector<size_t>> cbx_ids = gsb_ids;
+  std::vector<std::vector<size_t>> cby_ids = gsb_ids;
+  for (size_t ix = 0; ix < gsb_range.x(); ++ix) {
+    for (size_t iy = 0; iy < gsb_range.y(); ++iy) {
+      vtr::Point<size_t> coord(ix, iy);
+      gsb_ids[ix][iy] = device_rr_gsb.get_gsb_unique_module_index(coord);
+      sb_ids[ix][iy] = device_rr_gsb.get_sb_unique_module_index(coord);
+      cbx_ids[ix][iy] = device_rr_gsb.get_cb_unique_module_index(CHANX, coord);
+      cby_ids[ix][iy] = device_rr_gsb.get_cb_unique_module_index(CHANY, coord);
+    }
+  }
+
+  std::vector<vtr::Point<size_t>> unique_coords;
+  for (size_t id = 0; id < device_rr_gsb.get_num_gsb_unique_module(); ++id) {
+    unique_coords.push_back(device_rr_gsb.get_gsb_unique_module_coordinate(id));
+  }
+  write_unique_module_list_to_snapshot(fp, unique_coords, gsb_ids);
+
+  unique_coords.clear();
+  for (size_t id = 0; id < device_rr_gsb.get_num_sb_unique_module(); ++id) {
+    unique_coords.push_back(device_rr_gsb.get_sb_unique_module_coordinate(id));
+  }
+  write_unique_module_list_to_snapshot(fp, unique_coords, sb_ids);
+
+  unique_coords.clear();
+  for (size_t id = 0; id < device_rr_gsb.get_num_cb_unique_module(CHANX);
+       ++id) {
+    unique_coords.push_back(
+      device_rr_gsb.get_cb_unique_module_coordinate(CHANX, id));
+  }
+  write_unique_module_list_to_snapshot(fp, unique_coords, cbx_ids);
+
+  unique_coords.clear();
+  for (size_t id = 0; id < device_rr_gsb.get_num_cb_unique_module(CHANY);
+       ++id) {
+    unique_coords.push_back(
+      device_rr_gsb.get_cb_unique_module_coordinate(CHANY, id));
+  }
+  write_unique_module_list_to_snapshot(fp, unique_coords, cby_ids);
+}
+
+static bool read_unique_module_list_from_snapshot(
+  std::fstream& fp, const vtr::Point<size_t>& gsb_range,
+  std::vector<vtr::Point<size_t>>& unique_coords,
+  std::vector<std::vector<size_t>>& unique_ids) {
+  size_t num_unique_modules = read_snapshot_size(fp);
+  for (size_t id = 0; id < num_unique_modules && fp.good(); ++id) {
+    size_t x = read_snapshot_size(fp);
+    size_t y = read_snapshot_size(fp);
+    if ((x >= gsb_range.x()) || (y >= gsb_range.y())) {
+      return false;
+    }
+    unique_coords.push_back(vtr::Point<size_t>(x, y));
+  }
+  unique_ids.resize(gsb_range.x(), std::vector<size_t>(gsb_range.y(), 0));
+  for (size_t ix = 0; ix < gsb_range.x(); ++ix) {
+    for (size_t iy = 0; iy < gsb_range.y(); ++iy) {
+      unique_ids[ix][iy] = read_snapshot_size(fp);
+      if (unique_ids[ix][iy] >= unique_coords.size()) {
+        return false;
+      }
+    }
+  }
+  return fp.good();
+}
+
+static bool read_device_rr_gsb_from_snapshot(std::fstream& fp,
+                                             DeviceRRGSB& device_rr_gsb) {
+  bool has_unique_module = read_snapshot_size(fp);
+  if (!fp.good()) {
+    return false;
+  }
+  if (!has_unique_module) {
+    return true;
+  }
+
+  vtr::Point<size_t> gsb_range;
+  gsb_range.set_x(read_snapshot_size(fp));
+  gsb_range.set_y(read_snapshot_size(fp));
+  /* The GSB array must be the same as when the snapshot was created */
+  if (!fp.good() || !(gsb_range == device_rr_gsb.get_gsb_range())) {
+    return false;
+  }
+
+  std::vector<vtr::Point<size_t>> gsb_unique_coords;
+  std::vector<std::vector<size_t>> gsb_ids;
+  std::vector<vtr::Point<size_t>> sb_unique_coords;
+  std::vector<std::vector<size_t>> sb_ids;
+  std::vector<vtr::Point<size_t>> cbx_unique_coords;
+  std::vector<std::vector<size_t>> cbx_ids;
+  std::vector<vtr::Point<size_t>> cby_unique_coords;
+  std::vector<std::vector<size_t>> cby_ids;
+  if (!read_unique_module_list_from_snapshot(fp, gsb_range, gsb_unique_coords,
+                                             gsb_ids) ||
+      !read_unique_module_list_from_snapshot(fp, gsb_range, sb_unique_coords,
+                                             sb_ids) ||
+      !read_unique_module_list_from_snapshot(fp, gsb_range, cbx_unique_coords,
+                                             cbx_ids) ||
+      !read_unique_module_list_from_snapshot(fp, gsb_range, cby_unique_coords,
+                                             cby_ids)) {
+    return false;
+  }
+
+  device_rr_gsb.preload_gsb_unique_module(gsb_unique_coords, gsb_ids);
+  device_rr_gsb.preload_sb_unique_module(sb_unique_coords, sb_ids);
+  device_rr_gsb.preload_cb_unique_module(CHANX, cbx_unique_coords, cbx_ids);
+  device_rr_gsb.preload_cb_unique_module(CHANY, cby_unique_coords, cby_ids);
+
+  return true;
+}
+
+/********************************************************************
+ * Write a snapshot of the fabric to a binary file
+ * The file is written to a temporary file first and then renamed,
+ * so that other runs sharing the same cache will never see a partial file
+ *
+ * Return 0 if successful
+ * Return 2 if fail when creating files
+ *******************************************************************/
+int write_fabric_snapshot_to_binary_file(
+  const std::string& fname, const std::string& snapshot_key,
+  const ModuleManager& module_manager, const DecoderLibrary& decoder_lib,
+  const MemoryBankShiftRegisterBanks& blwl_sr_banks,
+  const DeviceRRGSB& device_rr_gsb, const bool& verbose) {
+  std::string timer_message =
+    std::string("Write fabric snapshot to binary file '") + fname +
+    std::string("'");
+
+  std::string dir_path = format_dir_path(find_path_dir_name(fname));
+
+  /* Create directories */
+  create_directory(dir_path);
+
+  /* Start time count */
+  vtr::ScopedStartFinishTimer timer(timer_message);
+
+  std::string tmp_fname = fname + std::string(".tmp");
+  std::fstream fp;
+  fp.open(tmp_fname, std::fstream::out | std::fstream::trunc |
+                       std::fstream::binary);
+  if (false == valid_file_stream(fp)) {
+    VTR_LOG_WARN("Unable to create fabric snapshot file '%s'!\n",
+                 tmp_fname.c_str());
+    return CMD_EXEC_MINOR_ERROR;
+  }
+
+  write_snapshot_string(fp, std::string(FABRIC_SNAPSHOT_SIGNATURE));
+  write_snapshot_size(fp, FABRIC_SNAPSHOT_FORMAT_VERSION);
+  write_snapshot_string(fp, snapshot_key);
+
+  write_module_graph_to_snapshot(fp, module_manager);
+  write_decoder_library_to_snapshot(fp, decoder_lib);
+  write_blwl_shift_register_banks_to_snapshot(fp, blwl_sr_banks);
+  write_device_rr_gsb_to_snapshot(fp, device_rr_gsb);
+
+  bool write_ok = fp.good();
+  fp.close();
+
+  if (!write_ok || (0 != std::rename(tmp_fname.c_str(), fname.c_str()))) {
+    VTR_LOG_WARN("Failed to write fabric snapshot file '%s'!\n",
+                 fname.c_str());
+    std::remove(tmp_fname.c_str());
+    return CMD_EXEC_MINOR_ERROR;
+  }
+
+  VTR_LOGV(verbose, "Saved fabric snapshot of %lu modules\n",
+           module_manager.num_modules());
+
+  return CMD_EXEC_SUCCESS;
+}
+
+/********************************************************************
+ * Restore the fabric from a snapshot in a binary file
+ * The data is restored in local copies and committed only when the whole
+ * file is valid, so that a failed load does not leave partial data.
+ *
+ * Return 0 if the snapshot is restored
+ * Return 2 if the snapshot does not exist or cannot be used, in which
+ *   case the fabric should be built as usual
+ *******************************************************************/
+int read_fabric_snapshot_from_binary_file(
+  const std::string& fname, const std::string& snapshot_key,
+  ModuleManager& module_manager, DecoderLibrary& decoder_lib,
+  MemoryBankShiftRegisterBanks& blwl_sr_banks, DeviceRRGSB& device_rr_gsb,
+  const bool& verbose) {
+  std::fstream fp;
+  fp.open(fname, std::fstream::in | std::fstream::binary);
+  if (false == valid_file_stream(fp)) {
+    VTR_LOG("No fabric snapshot found at '%s'\n", fname.c_str());
+    return CMD_EXEC_MINOR_ERROR;
+  }
+
+  /* A snapshot can only be restored on an empty fabric */
+  if ((0 != module_manager.num_modules()) ||
+      (0 != decoder_lib.decoders().size()) || (!blwl_sr_banks.empty())) {
+    VTR_LOG_WARN(
+      "Fabric has been built already. Skip loading snapshot '%s'\n",
+      fname.c_str());
+    return CMD_EXEC_MINOR_ERROR;
+  }
+
+  /* Check signature, format version and key before loading anything */
+  std::string signature = read_snapshot_string(fp);
+  size_t format_version = read_snapshot_size(fp);
+  std::string file_key = read_snapshot_string(fp);
+  if ((signature != std::string(FABRIC_SNAPSHOT_SIGNATURE)) ||
+      (format_version != FABRIC_SNAPSHOT_FORMAT_VERSION) ||
+      (file_key != snapshot_key)) {
+    VTR_LOG_WARN("Fabric snapshot '%s' is outdated and will be ignored\n",
+                 fname.c_str());
+    return CMD_EXEC_MINOR_ERROR;
+  }
+
+  vtr::ScopedStartFinishTimer timer(
+    std::string("Read fabric snapshot from binary file '") + fname +
+    std::string("'"));
+
+  ModuleManager snapshot_module_manager;
+  DecoderLibrary snapshot_decoder_lib;
+  MemoryBankShiftRegisterBanks snapshot_blwl_sr_banks;
+  if (!read_module_graph_from_snapshot(fp, snapshot_module_manager) ||
+      !read_decoder_library_from_snapshot(fp, snapshot_decoder_lib) ||
+      !read_blwl_shift_register_banks_from_snapshot(
+        fp, snapshot_module_manager, snapshot_blwl_sr_banks) ||
+      !read_device_rr_gsb_from_snapshot(fp, device_rr_gsb)) {
+    VTR_LOG_WARN("Fabric snapshot '%s' is corrupted and will be ignored\n",
+                 fname.c_str());
+    return CMD_EXEC_MINOR_ERROR;
+  }
+
+  module_manager = std::move(snapshot_module_manager);
+  decoder_lib = std::move(snapshot_decoder_lib);
+  blwl_sr_banks = std::move(snapshot_blwl_sr_banks);
+
+  VTR_LOGV(verbose, "Restored fabric snapshot of %lu modules\n",
+           module_manager.num_modules());
+
+  return CMD_EXEC_SUCCESS;
+}
+
+} /* end namespace openfpga */
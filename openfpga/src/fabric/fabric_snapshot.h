@@ -0,0 +1,47 @@
+#ifndef FABRIC_SNAPSHOT_H
+#define FABRIC_SNAPSHOT_H
+
+/********************************************************************
+ * Include header files that are required by function declaration
+ *******************************************************************/
+#include <string>
+
+#include "decoder_library.h"
+#include "device_rr_gsb.h"
+#include "memory_bank_shift_register_banks.h"
+#include "module_manager.h"
+#include "openfpga_flow_manager.h"
+#include "vpr_context.h"
+
+/********************************************************************
+ * Function declaration
+ *******************************************************************/
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+std::string find_fabric_snapshot_key(const FlowManager& flow_manager,
+                                     const DeviceContext& vpr_device_ctx,
+                                     const std::string& fabric_key_fname,
+                                     const bool& frame_view, const bool& lite,
+                                     const bool& compress_routing,
+                                     const bool& duplicate_grid_pin);
+
+std::string find_fabric_snapshot_file_name(const std::string& cache_dir,
+                                           const std::string& snapshot_key);
+
+int write_fabric_snapshot_to_binary_file(
+  const std::string& fname, const std::string& snapshot_key,
+  const ModuleManager& module_manager, const DecoderLibrary& decoder_lib,
+  const MemoryBankShiftRegisterBanks& blwl_sr_banks,
+  const DeviceRRGSB& device_rr_gsb, const bool& verbose);
+
+int read_fabric_snapshot_from_binary_file(
+  const std::string& fname, const std::string& snapshot_key,
+  ModuleManager& module_manager, DecoderLibrary& decoder_lib,
+  MemoryBankShiftRegisterBanks& blwl_sr_banks, DeviceRRGSB& device_rr_gsb,
+  const bool& verbose);
+
+} /* end namespace openfpga */
+
+#endif
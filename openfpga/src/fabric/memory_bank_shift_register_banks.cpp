@@ -123,30 +123,44 @@ std::vector<BasicPort> MemoryBankShiftRegisterBanks::wl_bank_data_ports(
 FabricBitLineBankId
 MemoryBankShiftRegisterBanks::find_bl_shift_register_bank_id(
   const ConfigRegionId& region, const BasicPort& bl_port) const {
-  if (is_bl_bank_dirty_) {
-    build_bl_port_fast_lookup();
-  }
-
-  VTR_ASSERT(valid_region_id(region));
-  const auto& result = bl_ports_to_sr_bank_ids_[region].find(bl_port);
-  if (result == bl_ports_to_sr_bank_ids_[region].end()) {
+  const std::vector<FabricBitLineBankId>& bank_ids =
+    bl_shift_register_bank_ids(region);
+  if ((std::string(MEMORY_BL_PORT_NAME) != bl_port.get_name()) ||
+      (1 != bl_port.get_width()) || (bl_port.get_lsb() >= bank_ids.size())) {
     return FabricBitLineBankId::INVALID();
   }
-  return result->second;
+  return bank_ids[bl_port.get_lsb()];
 }
 
 BasicPort MemoryBankShiftRegisterBanks::find_bl_shift_register_bank_data_port(
   const ConfigRegionId& region, const BasicPort& bl_port) const {
+  if (!find_bl_shift_register_bank_id(region, bl_port)) {
+    return BasicPort();
+  }
+  size_t sr_pin = bl_index_to_sr_bank_pins_[region][bl_port.get_lsb()];
+  return BasicPort(std::string(MEMORY_BL_PORT_NAME), sr_pin, sr_pin);
+}
+
+const std::vector<FabricBitLineBankId>&
+MemoryBankShiftRegisterBanks::bl_shift_register_bank_ids(
+  const ConfigRegionId& region) const {
   if (is_bl_bank_dirty_) {
     build_bl_port_fast_lookup();
   }
 
   VTR_ASSERT(valid_region_id(region));
-  const auto& result = bl_ports_to_sr_bank_ports_[region].find(bl_port);
-  if (result == bl_ports_to_sr_bank_ports_[region].end()) {
-    return BasicPort();
+  return bl_index_to_sr_bank_ids_[region];
+}
+
+const std::vector<size_t>&
+MemoryBankShiftRegisterBanks::bl_shift_register_bank_pins(
+  const ConfigRegionId& region) const {
+  if (is_bl_bank_dirty_) {
+    build_bl_port_fast_lookup();
   }
-  return result->second;
+
+  VTR_ASSERT(valid_region_id(region));
+  return bl_index_to_sr_bank_pins_[region];
 }
 
 std::vector<size_t>
@@ -206,30 +220,44 @@ size_t MemoryBankShiftRegisterBanks::bl_shift_register_bank_instance(
 FabricWordLineBankId
 MemoryBankShiftRegisterBanks::find_wl_shift_register_bank_id(
   const ConfigRegionId& region, const BasicPort& wl_port) const {
-  if (is_wl_bank_dirty_) {
-    build_wl_port_fast_lookup();
-  }
-
-  VTR_ASSERT(valid_region_id(region));
-  const auto& result = wl_ports_to_sr_bank_ids_[region].find(wl_port);
-  if (result == wl_ports_to_sr_bank_ids_[region].end()) {
+  const std::vector<FabricWordLineBankId>& bank_ids =
+    wl_shift_register_bank_ids(region);
+  if ((std::string(MEMORY_WL_PORT_NAME) != wl_port.get_name()) ||
+      (1 != wl_port.get_width()) || (wl_port.get_lsb() >= bank_ids.size())) {
     return FabricWordLineBankId::INVALID();
   }
-  return result->second;
+  return bank_ids[wl_port.get_lsb()];
 }
 
 BasicPort MemoryBankShiftRegisterBanks::find_wl_shift_register_bank_data_port(
   const ConfigRegionId& region, const BasicPort& wl_port) const {
+  if (!find_wl_shift_register_bank_id(region, wl_port)) {
+    return BasicPort();
+  }
+  size_t sr_pin = wl_index_to_sr_bank_pins_[region][wl_port.get_lsb()];
+  return BasicPort(std::string(MEMORY_WL_PORT_NAME), sr_pin, sr_pin);
+}
+
+const std::vector<FabricWordLineBankId>&
+MemoryBankShiftRegisterBanks::wl_shift_register_bank_ids(
+  const ConfigRegionId& region) const {
   if (is_wl_bank_dirty_) {
     build_wl_port_fast_lookup();
   }
 
   VTR_ASSERT(valid_region_id(region));
-  const auto& result = wl_ports_to_sr_bank_ports_[region].find(wl_port);
-  if (result == wl_ports_to_sr_bank_ports_[region].end()) {
-    return BasicPort();
+  return wl_index_to_sr_bank_ids_[region];
+}
+
+const std::vector<size_t>&
+MemoryBankShiftRegisterBanks::wl_shift_register_bank_pins(
+  const ConfigRegionId& region) const {
+  if (is_wl_bank_dirty_) {
+    build_wl_port_fast_lookup();
   }
-  return result->second;
+
+  VTR_ASSERT(valid_region_id(region));
+  return wl_index_to_sr_bank_pins_[region];
 }
 
 void MemoryBankShiftRegisterBanks::resize_regions(const size_t& num_regions) {
@@ -250,6 +278,10 @@ void MemoryBankShiftRegisterBanks::resize_regions(const size_t& num_regions) {
   wl_bank_instances_.resize(num_regions);
   wl_bank_sink_child_ids_.resize(num_regions);
   wl_bank_sink_child_pin_ids_.resize(num_regions);
+
+  /* Fast look-up has to be resized as well */
+  is_bl_bank_dirty_ = true;
+  is_wl_bank_dirty_ = true;
 }
 
 void MemoryBankShiftRegisterBanks::link_bl_shift_register_bank_to_module(
@@ -494,23 +526,28 @@ bool MemoryBankShiftRegisterBanks::empty() const {
 }
 
 void MemoryBankShiftRegisterBanks::build_bl_port_fast_lookup() const {
-  bl_ports_to_sr_bank_ids_.resize(bl_bank_data_ports_.size());
-  bl_ports_to_sr_bank_ports_.resize(bl_bank_data_ports_.size());
+  bl_index_to_sr_bank_ids_.clear();
+  bl_index_to_sr_bank_pins_.clear();
+  bl_index_to_sr_bank_ids_.resize(bl_bank_data_ports_.size());
+  bl_index_to_sr_bank_pins_.resize(bl_bank_data_ports_.size());
   for (const auto& region : bl_bank_data_ports_) {
+    ConfigRegionId region_id =
+      ConfigRegionId(&region - &bl_bank_data_ports_[ConfigRegionId(0)]);
+    std::vector<FabricBitLineBankId>& bank_ids =
+      bl_index_to_sr_bank_ids_[region_id];
+    std::vector<size_t>& bank_pins = bl_index_to_sr_bank_pins_[region_id];
     for (const auto& bank : region) {
+      FabricBitLineBankId bank_id =
+        FabricBitLineBankId(&bank - &region[FabricBitLineBankId(0)]);
       size_t cur_pin = 0;
       for (const auto& port : bank) {
         for (const size_t& bl_index : port.pins()) {
-          BasicPort bl_port(std::string(MEMORY_BL_PORT_NAME), bl_index,
-                            bl_index);
-          BasicPort sr_bl_port(std::string(MEMORY_BL_PORT_NAME), cur_pin,
-                               cur_pin);
-          ConfigRegionId region_id =
-            ConfigRegionId(&region - &bl_bank_data_ports_[ConfigRegionId(0)]);
-          FabricBitLineBankId bank_id =
-            FabricBitLineBankId(&bank - &region[FabricBitLineBankId(0)]);
-          bl_ports_to_sr_bank_ids_[region_id][bl_port] = bank_id;
-          bl_ports_to_sr_bank_ports_[region_id][bl_port] = sr_bl_port;
+          if (bl_index >= bank_ids.size()) {
+            bank_ids.resize(bl_index + 1, FabricBitLineBankId::INVALID());
+            bank_pins.resize(bl_index + 1, size_t(-1));
+          }
+          bank_ids[bl_index] = bank_id;
+          bank_pins[bl_index] = cur_pin;
           cur_pin++;
         }
       }
@@ -521,23 +558,28 @@ void MemoryBankShiftRegisterBanks::build_bl_port_fast_lookup() const {
 }
 
 void MemoryBankShiftRegisterBanks::build_wl_port_fast_lookup() const {
-  wl_ports_to_sr_bank_ids_.resize(wl_bank_data_ports_.size());
-  wl_ports_to_sr_bank_ports_.resize(wl_bank_data_ports_.size());
+  wl_index_to_sr_bank_ids_.clear();
+  wl_index_to_sr_bank_pins_.clear();
+  wl_index_to_sr_bank_ids_.resize(wl_bank_data_ports_.size());
+  wl_index_to_sr_bank_pins_.resize(wl_bank_data_ports_.size());
   for (const auto& region : wl_bank_data_ports_) {
+    ConfigRegionId region_id =
+      ConfigRegionId(&region - &wl_bank_data_ports_[ConfigRegionId(0)]);
+    std::vector<FabricWordLineBankId>& bank_ids =
+      wl_index_to_sr_bank_ids_[region_id];
+    std::vector<size_t>& bank_pins = wl_index_to_sr_bank_pins_[region_id];
     for (const auto& bank : region) {
+      FabricWordLineBankId bank_id =
+        FabricWordLineBankId(&bank - &region[FabricWordLineBankId(0)]);
       size_t cur_pin = 0;
       for (const auto& port : bank) {
         for (const size_t& wl_index : port.pins()) {
-          BasicPort wl_port(std::string(MEMORY_WL_PORT_NAME), wl_index,
-                            wl_index);
-          BasicPort sr_wl_port(std::string(MEMORY_WL_PORT_NAME), cur_pin,
-                               cur_pin);
-          ConfigRegionId region_id =
-            ConfigRegionId(&region - &wl_bank_data_ports_[ConfigRegionId(0)]);
-          FabricWordLineBankId bank_id =
-            FabricWordLineBankId(&bank - &region[FabricWordLineBankId(0)]);
-          wl_ports_to_sr_bank_ids_[region_id][wl_port] = bank_id;
-          wl_ports_to_sr_bank_ports_[region_id][wl_port] = sr_wl_port;
+          if (wl_index >= bank_ids.size()) {
+            bank_ids.resize(wl_index + 1, FabricWordLineBankId::INVALID());
+            bank_pins.resize(wl_index + 1, size_t(-1));
+          }
+          bank_ids[wl_index] = bank_id;
+          bank_pins[wl_index] = cur_pin;
           cur_pin++;
         }
       }
@@ -62,6 +62,17 @@ class MemoryBankShiftRegisterBanks {
   BasicPort find_bl_shift_register_bank_data_port(
     const ConfigRegionId& region, const BasicPort& bl_port) const;
 
+  /** @brief Return the BL shift register bank id to which each BL of a
+   * configuration region is connected to, indexed by the BL index, e.g., bl[i].
+   * A BL which is not driven by any bank has an invalid id */
+  const std::vector<FabricBitLineBankId>& bl_shift_register_bank_ids(
+    const ConfigRegionId& region) const;
+
+  /** @brief Return the data pin of the BL shift register bank to which each BL
+   * of a configuration region is connected to, indexed by the BL index */
+  const std::vector<size_t>& bl_shift_register_bank_pins(
+    const ConfigRegionId& region) const;
+
   /** @brief Return the module id of a BL shift register bank */
   ModuleId bl_shift_register_bank_module(
     const ConfigRegionId& region_id, const FabricBitLineBankId& bank_id) const;
@@ -120,6 +131,17 @@ class MemoryBankShiftRegisterBanks {
   BasicPort find_wl_shift_register_bank_data_port(
     const ConfigRegionId& region, const BasicPort& wl_port) const;
 
+  /** @brief Return the WL shift register bank id to which each WL of a
+   * configuration region is connected to, indexed by the WL index, e.g., wl[i].
+   * A WL which is not driven by any bank has an invalid id */
+  const std::vector<FabricWordLineBankId>& wl_shift_register_bank_ids(
+    const ConfigRegionId& region) const;
+
+  /** @brief Return the data pin of the WL shift register bank to which each WL
+   * of a configuration region is connected to, indexed by the WL index */
+  const std::vector<size_t>& wl_shift_register_bank_pins(
+    const ConfigRegionId& region) const;
+
   /** @brief Return the module id of a WL shift register bank */
   ModuleId wl_shift_register_bank_module(
     const ConfigRegionId& region_id, const FabricWordLineBankId& bank_id) const;
@@ -291,18 +313,18 @@ class MemoryBankShiftRegisterBanks {
     vtr::vector<FabricWordLineBankId, std::map<BasicPort, std::vector<size_t>>>>
     wl_bank_sink_child_pin_ids_;
 
-  /* Fast look-up: given a BL/Wl port, e.g., bl[i], find out
+  /* Fast look-up: given the index of a BL/Wl port, e.g., i of bl[i], find out
    * - the shift register bank id
    * - the output pin id of the shift register bank
    */
-  mutable vtr::vector<ConfigRegionId, std::map<BasicPort, FabricBitLineBankId>>
-    bl_ports_to_sr_bank_ids_;
-  mutable vtr::vector<ConfigRegionId, std::map<BasicPort, BasicPort>>
-    bl_ports_to_sr_bank_ports_;
-  mutable vtr::vector<ConfigRegionId, std::map<BasicPort, FabricWordLineBankId>>
-    wl_ports_to_sr_bank_ids_;
-  mutable vtr::vector<ConfigRegionId, std::map<BasicPort, BasicPort>>
-    wl_ports_to_sr_bank_ports_;
+  mutable vtr::vector<ConfigRegionId, std::vector<FabricBitLineBankId>>
+    bl_index_to_sr_bank_ids_;
+  mutable vtr::vector<ConfigRegionId, std::vector<size_t>>
+    bl_index_to_sr_bank_pins_;
+  mutable vtr::vector<ConfigRegionId, std::vector<FabricWordLineBankId>>
+    wl_index_to_sr_bank_ids_;
+  mutable vtr::vector<ConfigRegionId, std::vector<size_t>>
+    wl_index_to_sr_bank_pins_;
 
   /* A flag to indicate that the general information of the shift register banks
    * have been modified, fast look-up has to be updated */
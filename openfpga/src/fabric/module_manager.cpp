@@ -14,9 +14,83 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
+/******************************************************************************
+ * Internal helpers for the compact storage of nets
+ ******************************************************************************/
+/* Find the terminal data of a net, either from the expandable storage or the
+ * compact storage */
+template <class ID>
+static vtr::vector<ID, size_t> find_compact_net_terminals(
+  const vtr::vector<ModuleId, vtr::vector<ModuleNetId, vtr::vector<ID, size_t>>>&
+    expandable_storage,
+  const vtr::vector<ModuleId, std::vector<size_t>>& compact_storage,
+  const vtr::vector<ModuleId, std::vector<size_t>>& compact_offsets,
+  const bool& is_compact, const ModuleId& module, const ModuleNetId& net) {
+  if (!is_compact) {
+    return expandable_storage[module][net];
+  }
+  return vtr::vector<ID, size_t>(
+    compact_storage[module].begin() + compact_offsets[module][size_t(net)],
+    compact_storage[module].begin() + compact_offsets[module][size_t(net) + 1]);
+}
+
+/* Find the offsets of the terminals of each net in a flat list, where the
+ * last one is the total number of terminals */
+template <class ID>
+static std::vector<size_t> find_net_terminal_offsets(
+  const vtr::vector<ModuleNetId, vtr::vector<ID, size_t>>& expandable_storage) {
+  std::vector<size_t> compact_offsets;
+  compact_offsets.reserve(expandable_storage.size() + 1);
+  compact_offsets.push_back(0);
+  for (const auto& net_terminals : expandable_storage) {
+    compact_offsets.push_back(compact_offsets.back() + net_terminals.size());
+  }
+  return compact_offsets;
+}
+
+/* Move the terminal data of all the nets in a module to a flat list, whose
+ * offsets have been found by find_net_terminal_offsets() */
+template <class ID>
+static void compact_net_terminals(
+  vtr::vector<ModuleNetId, vtr::vector<ID, size_t>>& expandable_storage,
+  std::vector<size_t>& compact_storage,
+  const std::vector<size_t>& compact_offsets) {
+  VTR_ASSERT(compact_offsets.size() == expandable_storage.size() + 1);
+  compact_storage.reserve(compact_offsets.back());
+  for (const auto& net_terminals : expandable_storage) {
+    compact_storage.insert(compact_storage.end(), net_terminals.begin(),
+                           net_terminals.end());
+  }
+  VTR_ASSERT(compact_storage.size() == compact_offsets.back());
+  /* Release the memory */
+  expandable_storage = vtr::vector<ModuleNetId, vtr::vector<ID, size_t>>();
+}
+
+/* Move the terminal data of all the nets in a module back to per-net lists */
+template <class ID>
+static void expand_net_terminals(
+  vtr::vector<ModuleNetId, vtr::vector<ID, size_t>>& expandable_storage,
+  std::vector<size_t>& compact_storage,
+  const std::vector<size_t>& compact_offsets) {
+  VTR_ASSERT(!compact_offsets.empty());
+  expandable_storage.resize(compact_offsets.size() - 1);
+  for (size_t inet = 0; inet < expandable_storage.size(); ++inet) {
+    expandable_storage[ModuleNetId(inet)].assign(
+      compact_storage.begin() + compact_offsets[inet],
+      compact_storage.begin() + compact_offsets[inet + 1]);
+  }
+  compact_storage = std::vector<size_t>();
+}
+
 /******************************************************************************
  * Public Constructors
  ******************************************************************************/
+ModuleManager::ModuleManager() {
+  is_compact_ = false;
+  is_lite_ = false;
+  num_lite_skipped_nets_ = 0;
+  num_lite_skipped_net_terminals_ = 0;
+}
 
 /**************************************************
  * Public Accessors : Aggregates
@@ -133,8 +207,10 @@ ModuleManager::module_net_src_range ModuleManager::module_net_sources(
   const ModuleId& module, const ModuleNetId& net) const {
   /* Validate the module_id */
   VTR_ASSERT(valid_module_net_id(module, net));
-  return vtr::make_range(net_src_ids_[module][net].begin(),
-                         net_src_ids_[module][net].end());
+  return vtr::make_range(
+    module_net_src_iterator(ModuleNetSrcId(0), invalid_net_src_ids_),
+    module_net_src_iterator(ModuleNetSrcId(num_net_sources(module, net)),
+                            invalid_net_src_ids_));
 }
 
 /* Find the sink ids of modules */
@@ -142,8 +218,10 @@ ModuleManager::module_net_sink_range ModuleManager::module_net_sinks(
   const ModuleId& module, const ModuleNetId& net) const {
   /* Validate the module_id */
   VTR_ASSERT(valid_module_net_id(module, net));
-  return vtr::make_range(net_sink_ids_[module][net].begin(),
-                         net_sink_ids_[module][net].end());
+  return vtr::make_range(
+    module_net_sink_iterator(ModuleNetSinkId(0), invalid_net_sink_ids_),
+    module_net_sink_iterator(ModuleNetSinkId(num_net_sinks(module, net)),
+                             invalid_net_sink_ids_));
 }
 
 ModuleManager::region_range ModuleManager::regions(
@@ -224,6 +302,32 @@ size_t ModuleManager::num_nets(const ModuleId& module) const {
   return num_nets_[module];
 }
 
+bool ModuleManager::is_compact() const { return is_compact_; }
+
+bool ModuleManager::is_lite() const { return is_lite_; }
+
+size_t ModuleManager::num_lite_skipped_nets() const {
+  return num_lite_skipped_nets_;
+}
+
+size_t ModuleManager::num_lite_skipped_net_terminals() const {
+  return num_lite_skipped_net_terminals_;
+}
+
+size_t ModuleManager::config_stat(const ModuleId& module,
+                                  const e_config_stat_type& stat_type,
+                                  const size_t& key) const {
+  VTR_ASSERT(valid_module_id(module));
+  VTR_ASSERT(stat_type < NUM_CONFIG_STAT_TYPES);
+
+  auto result = config_stats_[stat_type].find(key);
+  if ((result == config_stats_[stat_type].end()) ||
+      (size_t(module) >= result->second.size())) {
+    return size_t(-1);
+  }
+  return result->second[module];
+}
+
 /* Find the name of a module */
 std::string ModuleManager::module_name(const ModuleId& module_id) const {
   /* Validate the module_id */
@@ -440,8 +544,37 @@ ModuleNetId ModuleManager::module_instance_port_net(
   /* Validate child_pin */
   VTR_ASSERT(child_pin < module_port(child_module, child_port).get_width());
 
-  return net_lookup_[parent_module][child_module][child_instance][child_port]
-                    [child_pin];
+  /* No net is stored in lite mode, all the connected pins share the
+   * placeholder net */
+  if (is_lite_) {
+    if (size_t(parent_module) >= lite_connected_pins_.size()) {
+      return ModuleNetId::INVALID();
+    }
+    auto result = lite_connected_pins_[parent_module].find(
+      std::make_tuple(child_module, child_instance, child_port));
+    if ((result == lite_connected_pins_[parent_module].end()) ||
+        (false == result->second[child_pin])) {
+      return ModuleNetId::INVALID();
+    }
+    return ModuleNetId(0);
+  }
+
+  if (is_compact_) {
+    auto result = net_lookup_child_offsets_[parent_module].find(child_module);
+    VTR_ASSERT(result != net_lookup_child_offsets_[parent_module].end());
+    return net_lookup_nets_[parent_module]
+                           [result->second +
+                            child_instance *
+                              port_pin_offsets_[child_module].back() +
+                            port_pin_offsets_[child_module][size_t(child_port)] +
+                            child_pin];
+  }
+
+  /* Use at() rather than operator[] on the maps, which never inserts and
+   * keeps the lookup safe when called from multiple threads */
+  return net_lookup_[parent_module]
+    .at(child_module)[child_instance]
+    .at(child_port)[child_pin];
 }
 
 /* Find the name of net */
@@ -460,8 +593,9 @@ vtr::vector<ModuleNetSrcId, ModuleId> ModuleManager::net_source_modules(
   VTR_ASSERT(valid_module_net_id(module, net));
 
   vtr::vector<ModuleNetSrcId, ModuleId> src_modules;
-  src_modules.reserve(net_src_terminal_ids_[module][net].size());
-  for (const size_t& id : net_src_terminal_ids_[module][net]) {
+  for (const size_t& id : find_compact_net_terminals<ModuleNetSrcId>(
+         net_src_terminal_ids_, net_src_terminal_list_,
+         net_src_offsets_, is_compact_, module, net)) {
     src_modules.push_back(net_terminal_storage_[id].first);
   }
 
@@ -474,7 +608,9 @@ vtr::vector<ModuleNetSrcId, size_t> ModuleManager::net_source_instances(
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
 
-  return net_src_instance_ids_[module][net];
+  return find_compact_net_terminals<ModuleNetSrcId>(
+    net_src_instance_ids_, net_src_instance_list_, net_src_offsets_,
+    is_compact_, module, net);
 }
 
 /* Find the source ports of a net */
@@ -484,8 +620,9 @@ vtr::vector<ModuleNetSrcId, ModulePortId> ModuleManager::net_source_ports(
   VTR_ASSERT(valid_module_net_id(module, net));
 
   vtr::vector<ModuleNetSrcId, ModulePortId> src_ports;
-  src_ports.reserve(net_src_terminal_ids_[module][net].size());
-  for (const size_t& id : net_src_terminal_ids_[module][net]) {
+  for (const size_t& id : find_compact_net_terminals<ModuleNetSrcId>(
+         net_src_terminal_ids_, net_src_terminal_list_,
+         net_src_offsets_, is_compact_, module, net)) {
     src_ports.push_back(net_terminal_storage_[id].second);
   }
 
@@ -498,7 +635,10 @@ vtr::vector<ModuleNetSrcId, size_t> ModuleManager::net_source_pins(
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
 
-  return net_src_pin_ids_[module][net];
+  return find_compact_net_terminals<ModuleNetSrcId>(net_src_pin_ids_,
+                                          net_src_pin_list_,
+                                          net_src_offsets_, is_compact_,
+                                          module, net);
 }
 
 /* Identify if a pin of a port in a module already exists in the net source
@@ -516,15 +656,17 @@ bool ModuleManager::net_source_exist(const ModuleId& module,
    * If a net source has the same src_module, instance_id, src_port and src_pin,
    * we can say that the source has already been added to this net!
    */
+  vtr::vector<ModuleNetSrcId, ModuleId> src_modules =
+    net_source_modules(module, net);
+  vtr::vector<ModuleNetSrcId, size_t> src_instances =
+    net_source_instances(module, net);
+  vtr::vector<ModuleNetSrcId, ModulePortId> src_ports =
+    net_source_ports(module, net);
+  vtr::vector<ModuleNetSrcId, size_t> src_pins = net_source_pins(module, net);
   for (const ModuleNetSrcId& net_src : module_net_sources(module, net)) {
-    if ((src_module ==
-         net_terminal_storage_[net_src_terminal_ids_[module][net][net_src]]
-           .first) &&
-        (instance_id == net_source_instances(module, net)[net_src]) &&
-        (src_port ==
-         net_terminal_storage_[net_src_terminal_ids_[module][net][net_src]]
-           .second) &&
-        (src_pin == net_source_pins(module, net)[net_src])) {
+    if ((src_module == src_modules[net_src]) &&
+        (instance_id == src_instances[net_src]) &&
+        (src_port == src_ports[net_src]) && (src_pin == src_pins[net_src])) {
       return true;
     }
   }
@@ -540,8 +682,9 @@ vtr::vector<ModuleNetSinkId, ModuleId> ModuleManager::net_sink_modules(
   VTR_ASSERT(valid_module_net_id(module, net));
 
   vtr::vector<ModuleNetSinkId, ModuleId> sink_modules;
-  sink_modules.reserve(net_sink_terminal_ids_[module][net].size());
-  for (const size_t& id : net_sink_terminal_ids_[module][net]) {
+  for (const size_t& id : find_compact_net_terminals<ModuleNetSinkId>(
+         net_sink_terminal_ids_, net_sink_terminal_list_,
+         net_sink_offsets_, is_compact_, module, net)) {
     sink_modules.push_back(net_terminal_storage_[id].first);
   }
 
@@ -554,7 +697,9 @@ vtr::vector<ModuleNetSinkId, size_t> ModuleManager::net_sink_instances(
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
 
-  return net_sink_instance_ids_[module][net];
+  return find_compact_net_terminals<ModuleNetSinkId>(
+    net_sink_instance_ids_, net_sink_instance_list_, net_sink_offsets_,
+    is_compact_, module, net);
 }
 
 /* Find the sink ports of a net */
@@ -564,8 +709,9 @@ vtr::vector<ModuleNetSinkId, ModulePortId> ModuleManager::net_sink_ports(
   VTR_ASSERT(valid_module_net_id(module, net));
 
   vtr::vector<ModuleNetSinkId, ModulePortId> sink_ports;
-  sink_ports.reserve(net_sink_terminal_ids_[module][net].size());
-  for (const size_t& id : net_sink_terminal_ids_[module][net]) {
+  for (const size_t& id : find_compact_net_terminals<ModuleNetSinkId>(
+         net_sink_terminal_ids_, net_sink_terminal_list_,
+         net_sink_offsets_, is_compact_, module, net)) {
     sink_ports.push_back(net_terminal_storage_[id].second);
   }
 
@@ -578,7 +724,10 @@ vtr::vector<ModuleNetSinkId, size_t> ModuleManager::net_sink_pins(
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
 
-  return net_sink_pin_ids_[module][net];
+  return find_compact_net_terminals<ModuleNetSinkId>(net_sink_pin_ids_,
+                                          net_sink_pin_list_,
+                                          net_sink_offsets_, is_compact_,
+                                          module, net);
 }
 
 /* Identify if a pin of a port in a module already exists in the net sink list*/
@@ -595,15 +744,18 @@ bool ModuleManager::net_sink_exist(const ModuleId& module,
    * If a net sink has the same sink_module, instance_id, sink_port and
    * sink_pin, we can say that the sink has already been added to this net!
    */
+  vtr::vector<ModuleNetSinkId, ModuleId> sink_modules =
+    net_sink_modules(module, net);
+  vtr::vector<ModuleNetSinkId, size_t> sink_instances =
+    net_sink_instances(module, net);
+  vtr::vector<ModuleNetSinkId, ModulePortId> sink_ports =
+    net_sink_ports(module, net);
+  vtr::vector<ModuleNetSinkId, size_t> sink_pins = net_sink_pins(module, net);
   for (const ModuleNetSinkId& net_sink : module_net_sinks(module, net)) {
-    if ((sink_module ==
-         net_terminal_storage_[net_sink_terminal_ids_[module][net][net_sink]]
-           .first) &&
-        (instance_id == net_sink_instances(module, net)[net_sink]) &&
-        (sink_port ==
-         net_terminal_storage_[net_sink_terminal_ids_[module][net][net_sink]]
-           .second) &&
-        (sink_pin == net_sink_pins(module, net)[net_sink])) {
+    if ((sink_module == sink_modules[net_sink]) &&
+        (instance_id == sink_instances[net_sink]) &&
+        (sink_port == sink_ports[net_sink]) &&
+        (sink_pin == sink_pins[net_sink])) {
       return true;
     }
   }
@@ -615,6 +767,24 @@ bool ModuleManager::net_sink_exist(const ModuleId& module,
 /******************************************************************************
  * Private Accessors
  ******************************************************************************/
+size_t ModuleManager::num_net_sources(const ModuleId& module,
+                                      const ModuleNetId& net) const {
+  if (is_compact_) {
+    return net_src_offsets_[module][size_t(net) + 1] -
+           net_src_offsets_[module][size_t(net)];
+  }
+  return net_src_terminal_ids_[module][net].size();
+}
+
+size_t ModuleManager::num_net_sinks(const ModuleId& module,
+                                    const ModuleNetId& net) const {
+  if (is_compact_) {
+    return net_sink_offsets_[module][size_t(net) + 1] -
+           net_sink_offsets_[module][size_t(net)];
+  }
+  return net_sink_terminal_ids_[module][net].size();
+}
+
 size_t ModuleManager::find_child_module_index_in_parent_module(
   const ModuleId& parent_module, const ModuleId& child_module) const {
   /* validate both module ids */
@@ -643,6 +813,9 @@ ModuleId ModuleManager::add_module(const std::string& name) {
     return ModuleId::INVALID();
   }
 
+  /* Restore the expandable storage before adding any module */
+  expand();
+
   /* Create an new id */
   ModuleId module = ModuleId(ids_.size());
   ids_.push_back(module);
@@ -677,12 +850,10 @@ ModuleId ModuleManager::add_module(const std::string& name) {
   num_nets_.emplace_back(0);
   invalid_net_ids_.emplace_back();
   net_names_.emplace_back();
-  net_src_ids_.emplace_back();
   net_src_terminal_ids_.emplace_back();
   net_src_instance_ids_.emplace_back();
   net_src_pin_ids_.emplace_back();
 
-  net_sink_ids_.emplace_back();
   net_sink_terminal_ids_.emplace_back();
   net_sink_instance_ids_.emplace_back();
   net_sink_pin_ids_.emplace_back();
@@ -697,12 +868,29 @@ ModuleId ModuleManager::add_module(const std::string& name) {
   /* Build fast look-up for nets */
   net_lookup_.emplace_back();
   /* Reserve the instance 0 for the module */
-  net_lookup_[module][module].emplace_back();
+  if (!is_lite_) {
+    net_lookup_[module][module].emplace_back();
+  }
 
   /* Return the new id */
   return module;
 }
 
+void ModuleManager::set_config_stat(const ModuleId& module,
+                                    const e_config_stat_type& stat_type,
+                                    const size_t& key, const size_t& value) {
+  VTR_ASSERT(valid_module_id(module));
+  VTR_ASSERT(stat_type < NUM_CONFIG_STAT_TYPES);
+
+  vtr::vector<ModuleId, size_t>& stats = config_stats_[stat_type][key];
+  /* Allocate the statistics for all the modules at once, to avoid frequent
+   * resizing */
+  if (stats.size() < ids_.size()) {
+    stats.resize(ids_.size(), size_t(-1));
+  }
+  stats[module] = value;
+}
+
 /* Add a port to a module */
 ModulePortId ModuleManager::add_port(const ModuleId& module,
                                      const BasicPort& port_info,
@@ -710,6 +898,12 @@ ModulePortId ModuleManager::add_port(const ModuleId& module,
   /* Validate the id of module */
   VTR_ASSERT(valid_module_id(module));
 
+  /* Pin offsets of the compact net look-up will change */
+  expand();
+
+  /* The width of configuration ports may change */
+  invalidate_config_port_stats(module);
+
   /* Add port and fill port attributes */
   ModulePortId port = ModulePortId(port_ids_[module].size());
   port_ids_[module].push_back(port);
@@ -725,9 +919,11 @@ ModulePortId ModuleManager::add_port(const ModuleId& module,
   port_lookup_[module][port_type].push_back(port);
 
   /* Update fast look-up for nets */
-  VTR_ASSERT_SAFE(1 == net_lookup_[module][module].size());
-  net_lookup_[module][module][0][port].resize(port_info.get_width(),
-                                              ModuleNetId::INVALID());
+  if (!is_lite_) {
+    VTR_ASSERT_SAFE(1 == net_lookup_[module][module].size());
+    net_lookup_[module][module][0][port].resize(port_info.get_width(),
+                                                ModuleNetId::INVALID());
+  }
 
   return port;
 }
@@ -740,6 +936,9 @@ void ModuleManager::set_module_port_name(const ModuleId& module,
   VTR_ASSERT(valid_module_port_id(module, module_port));
 
   ports_[module][module_port].set_name(port_name);
+
+  /* Configuration ports are found by names */
+  invalidate_config_port_stats(module);
 }
 
 /* Set a name for a module */
@@ -805,6 +1004,9 @@ void ModuleManager::add_child_module(const ModuleId& parent_module,
   VTR_ASSERT(valid_module_id(parent_module));
   VTR_ASSERT(valid_module_id(child_module));
 
+  /* Restore the expandable net look-up to add the new instance */
+  expand();
+
   /* Try to find if the parent module is already in the list */
   std::vector<ModuleId>::iterator parent_it =
     std::find(parents_[child_module].begin(), parents_[child_module].end(),
@@ -844,6 +1046,9 @@ void ModuleManager::add_child_module(const ModuleId& parent_module,
   }
 
   /* Update fast look-up for nets */
+  if (is_lite_) {
+    return;
+  }
   size_t instance_id = net_lookup_[parent_module][child_module].size();
   net_lookup_[parent_module][child_module].emplace_back();
   /* Find the ports for the child module and update the fast look-up */
@@ -893,6 +1098,8 @@ void ModuleManager::add_configurable_child(const ModuleId& parent_module,
   configurable_child_regions_[parent_module].push_back(
     ConfigRegionId::INVALID());
   configurable_child_coordinates_[parent_module].push_back(coord);
+
+  invalidate_config_stats();
 }
 
 void ModuleManager::reserve_configurable_child(const ModuleId& parent_module,
@@ -1000,13 +1207,18 @@ void ModuleManager::reserve_module_nets(const ModuleId& module,
   /* Validate the module id */
   VTR_ASSERT(valid_module_id(module));
 
+  /* Only a placeholder net is created in lite mode */
+  if (is_lite_) {
+    return;
+  }
+
+  expand();
+
   net_names_[module].reserve(num_nets);
-  net_src_ids_[module].reserve(num_nets);
   net_src_terminal_ids_[module].reserve(num_nets);
   net_src_instance_ids_[module].reserve(num_nets);
   net_src_pin_ids_[module].reserve(num_nets);
 
-  net_sink_ids_[module].reserve(num_nets);
   net_sink_terminal_ids_[module].reserve(num_nets);
   net_sink_instance_ids_[module].reserve(num_nets);
   net_sink_pin_ids_[module].reserve(num_nets);
@@ -1017,13 +1229,22 @@ ModuleNetId ModuleManager::create_module_net(const ModuleId& module) {
   /* Validate the module id */
   VTR_ASSERT(valid_module_id(module));
 
+  /* In lite mode, all the nets of a module share a placeholder net */
+  if (is_lite_) {
+    num_lite_skipped_nets_++;
+    if (0 < num_nets_[module]) {
+      return ModuleNetId(0);
+    }
+  }
+
+  expand();
+
   /* Create an new id */
   ModuleNetId net = ModuleNetId(num_nets_[module]);
   num_nets_[module]++;
 
   /* Allocate net-related data structures */
   net_names_[module].emplace_back();
-  net_src_ids_[module].emplace_back();
   net_src_terminal_ids_[module].emplace_back();
   net_src_instance_ids_[module].emplace_back();
   net_src_pin_ids_[module].emplace_back();
@@ -1031,7 +1252,6 @@ ModuleNetId ModuleManager::create_module_net(const ModuleId& module) {
   /* Reserve a source */
   reserve_module_net_sources(module, net, 1);
 
-  net_sink_ids_[module].emplace_back();
   net_sink_terminal_ids_[module].emplace_back();
   net_sink_instance_ids_[module].emplace_back();
   net_sink_pin_ids_[module].emplace_back();
@@ -1048,6 +1268,11 @@ void ModuleManager::set_net_name(const ModuleId& module, const ModuleNetId& net,
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
 
+  /* Keep the placeholder net anonymous in lite mode */
+  if (is_lite_) {
+    return;
+  }
+
   net_names_[module][net] = name;
 }
 
@@ -1057,7 +1282,12 @@ void ModuleManager::reserve_module_net_sources(const ModuleId& module,
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
 
-  net_src_ids_[module][net].reserve(num_sources);
+  if (is_lite_) {
+    return;
+  }
+
+  expand();
+
   net_src_terminal_ids_[module][net].reserve(num_sources);
   net_src_instance_ids_[module][net].reserve(num_sources);
   net_src_pin_ids_[module][net].reserve(num_sources);
@@ -1071,9 +1301,18 @@ ModuleNetSrcId ModuleManager::add_module_net_source(
   /* Validate the module and net id */
   VTR_ASSERT(valid_module_net_id(module, net));
 
+  /* Drop the terminal in lite mode */
+  if (is_lite_) {
+    num_lite_skipped_net_terminals_++;
+    set_lite_connected_pin(module, src_module, instance_id, src_port, src_pin);
+    return ModuleNetSrcId::INVALID();
+  }
+
+  expand();
+
   /* Create a new id for src node */
-  ModuleNetSrcId net_src = ModuleNetSrcId(net_src_ids_[module][net].size());
-  net_src_ids_[module][net].push_back(net_src);
+  ModuleNetSrcId net_src =
+    ModuleNetSrcId(net_src_terminal_ids_[module][net].size());
 
   /* Validate the source module */
   VTR_ASSERT(valid_module_id(src_module));
@@ -1124,7 +1363,12 @@ void ModuleManager::reserve_module_net_sinks(const ModuleId& module,
   /* Validate module net */
   VTR_ASSERT(valid_module_net_id(module, net));
 
-  net_sink_ids_[module][net].reserve(num_sinks);
+  if (is_lite_) {
+    return;
+  }
+
+  expand();
+
   net_sink_terminal_ids_[module][net].reserve(num_sinks);
   net_sink_instance_ids_[module][net].reserve(num_sinks);
   net_sink_pin_ids_[module][net].reserve(num_sinks);
@@ -1138,9 +1382,19 @@ ModuleNetSinkId ModuleManager::add_module_net_sink(
   /* Validate the module and net id */
   VTR_ASSERT(valid_module_net_id(module, net));
 
+  /* Drop the terminal in lite mode */
+  if (is_lite_) {
+    num_lite_skipped_net_terminals_++;
+    set_lite_connected_pin(module, sink_module, instance_id, sink_port,
+                           sink_pin);
+    return ModuleNetSinkId::INVALID();
+  }
+
+  expand();
+
   /* Create a new id for sink node */
-  ModuleNetSinkId net_sink = ModuleNetSinkId(net_sink_ids_[module][net].size());
-  net_sink_ids_[module][net].push_back(net_sink);
+  ModuleNetSinkId net_sink =
+    ModuleNetSinkId(net_sink_terminal_ids_[module][net].size());
 
   /* Validate the source module */
   VTR_ASSERT(valid_module_id(sink_module));
@@ -1185,6 +1439,106 @@ ModuleNetSinkId ModuleManager::add_module_net_sink(
   return net_sink;
 }
 
+/******************************************************************************
+ * Public storage management
+ ******************************************************************************/
+void ModuleManager::compact() {
+  if (is_compact_) {
+    return;
+  }
+
+  /* Pin offsets of each port, which are used to index the compact net look-up
+   */
+  port_pin_offsets_.resize(ids_.size());
+  for (const ModuleId& module : ids_) {
+    port_pin_offsets_[module].clear();
+    port_pin_offsets_[module].reserve(ports_[module].size() + 1);
+    port_pin_offsets_[module].push_back(0);
+    for (const BasicPort& port : ports_[module]) {
+      port_pin_offsets_[module].push_back(port_pin_offsets_[module].back() +
+                                          port.get_width());
+    }
+  }
+
+  /* Flatten the terminals of nets */
+  net_src_offsets_.resize(ids_.size());
+  net_src_terminal_list_.resize(ids_.size());
+  net_src_instance_list_.resize(ids_.size());
+  net_src_pin_list_.resize(ids_.size());
+  net_sink_offsets_.resize(ids_.size());
+  net_sink_terminal_list_.resize(ids_.size());
+  net_sink_instance_list_.resize(ids_.size());
+  net_sink_pin_list_.resize(ids_.size());
+  for (const ModuleId& module : ids_) {
+    /* The terminal, instance and pin lists of a net have the same size, so
+     * they share the offsets */
+    net_src_offsets_[module] =
+      find_net_terminal_offsets(net_src_terminal_ids_[module]);
+    net_sink_offsets_[module] =
+      find_net_terminal_offsets(net_sink_terminal_ids_[module]);
+    compact_net_terminals(net_src_terminal_ids_[module],
+                          net_src_terminal_list_[module],
+                          net_src_offsets_[module]);
+    compact_net_terminals(net_src_instance_ids_[module],
+                          net_src_instance_list_[module],
+                          net_src_offsets_[module]);
+    compact_net_terminals(net_src_pin_ids_[module], net_src_pin_list_[module],
+                          net_src_offsets_[module]);
+    compact_net_terminals(net_sink_terminal_ids_[module],
+                          net_sink_terminal_list_[module],
+                          net_sink_offsets_[module]);
+    compact_net_terminals(net_sink_instance_ids_[module],
+                          net_sink_instance_list_[module],
+                          net_sink_offsets_[module]);
+    compact_net_terminals(net_sink_pin_ids_[module],
+                          net_sink_pin_list_[module],
+                          net_sink_offsets_[module]);
+  }
+
+  /* Flatten the fast look-up for nets */
+  net_lookup_child_offsets_.resize(ids_.size());
+  net_lookup_nets_.resize(ids_.size());
+  for (const ModuleId& parent : ids_) {
+    size_t num_pins = 0;
+    for (const auto& child_lookup : net_lookup_[parent]) {
+      net_lookup_child_offsets_[parent][child_lookup.first] = num_pins;
+      num_pins += child_lookup.second.size() *
+                  port_pin_offsets_[child_lookup.first].back();
+    }
+    net_lookup_nets_[parent].assign(num_pins, ModuleNetId::INVALID());
+    for (const auto& child_lookup : net_lookup_[parent]) {
+      const ModuleId& child = child_lookup.first;
+      size_t child_offset = net_lookup_child_offsets_[parent][child];
+      for (size_t inst = 0; inst < child_lookup.second.size(); ++inst) {
+        for (const auto& port_lookup : child_lookup.second[inst]) {
+          std::copy(
+            port_lookup.second.begin(), port_lookup.second.end(),
+            net_lookup_nets_[parent].begin() + child_offset +
+              inst * port_pin_offsets_[child].back() +
+              port_pin_offsets_[child][size_t(port_lookup.first)]);
+        }
+      }
+    }
+  }
+  net_lookup_ = NetLookup();
+
+  /* Release the memory of the expandable storage */
+  net_src_terminal_ids_ = decltype(net_src_terminal_ids_)();
+  net_src_instance_ids_ = decltype(net_src_instance_ids_)();
+  net_src_pin_ids_ = decltype(net_src_pin_ids_)();
+  net_sink_terminal_ids_ = decltype(net_sink_terminal_ids_)();
+  net_sink_instance_ids_ = decltype(net_sink_instance_ids_)();
+  net_sink_pin_ids_ = decltype(net_sink_pin_ids_)();
+
+  is_compact_ = true;
+}
+
+void ModuleManager::set_lite(const bool& lite) {
+  /* The storage of nets can not be changed once modules are added */
+  VTR_ASSERT(0 == num_modules());
+  is_lite_ = lite;
+}
+
 /******************************************************************************
  * Public Deconstructor
  ******************************************************************************/
@@ -1195,6 +1549,8 @@ void ModuleManager::clear_configurable_children(const ModuleId& parent_module) {
   configurable_child_instances_[parent_module].clear();
   configurable_child_regions_[parent_module].clear();
   configurable_child_coordinates_[parent_module].clear();
+
+  invalidate_config_stats();
 }
 
 void ModuleManager::clear_config_region(const ModuleId& parent_module) {
@@ -1261,4 +1617,111 @@ void ModuleManager::invalidate_port_lookup() { port_lookup_.clear(); }
 
 void ModuleManager::invalidate_net_lookup() { net_lookup_.clear(); }
 
+void ModuleManager::invalidate_config_stats() {
+  config_stats_[CONFIG_STAT_NUM_BLOCKS].clear();
+  config_stats_[CONFIG_STAT_NUM_BITS].clear();
+}
+
+void ModuleManager::invalidate_config_port_stats(const ModuleId& module) {
+  for (const e_config_stat_type& stat_type :
+       {CONFIG_STAT_CONFIG_PORT_WIDTH, CONFIG_STAT_NUM_BLS,
+        CONFIG_STAT_NUM_WLS}) {
+    for (auto& stats : config_stats_[stat_type]) {
+      if (size_t(module) < stats.second.size()) {
+        stats.second[module] = size_t(-1);
+      }
+    }
+  }
+}
+
+/******************************************************************************
+ * Private mutators
+ ******************************************************************************/
+void ModuleManager::expand() {
+  if (!is_compact_) {
+    return;
+  }
+
+  /* Restore the terminals of nets */
+  net_src_terminal_ids_.resize(ids_.size());
+  net_src_instance_ids_.resize(ids_.size());
+  net_src_pin_ids_.resize(ids_.size());
+  net_sink_terminal_ids_.resize(ids_.size());
+  net_sink_instance_ids_.resize(ids_.size());
+  net_sink_pin_ids_.resize(ids_.size());
+  for (const ModuleId& module : ids_) {
+    expand_net_terminals(net_src_terminal_ids_[module],
+                         net_src_terminal_list_[module],
+                         net_src_offsets_[module]);
+    expand_net_terminals(net_src_instance_ids_[module],
+                         net_src_instance_list_[module],
+                         net_src_offsets_[module]);
+    expand_net_terminals(net_src_pin_ids_[module], net_src_pin_list_[module],
+                         net_src_offsets_[module]);
+    expand_net_terminals(net_sink_terminal_ids_[module],
+                         net_sink_terminal_list_[module],
+                         net_sink_offsets_[module]);
+    expand_net_terminals(net_sink_instance_ids_[module],
+                         net_sink_instance_list_[module],
+                         net_sink_offsets_[module]);
+    expand_net_terminals(net_sink_pin_ids_[module], net_sink_pin_list_[module],
+                         net_sink_offsets_[module]);
+  }
+
+  /* Restore the fast look-up for nets */
+  net_lookup_.resize(ids_.size());
+  for (const ModuleId& parent : ids_) {
+    for (const auto& child_offset : net_lookup_child_offsets_[parent]) {
+      const ModuleId& child = child_offset.first;
+      size_t num_insts = (child == parent) ? 1 : num_instance(parent, child);
+      net_lookup_[parent][child].resize(num_insts);
+      for (size_t inst = 0; inst < num_insts; ++inst) {
+        for (const ModulePortId& port : port_ids_[child]) {
+          auto pin_begin = net_lookup_nets_[parent].begin() +
+                           child_offset.second +
+                           inst * port_pin_offsets_[child].back() +
+                           port_pin_offsets_[child][size_t(port)];
+          net_lookup_[parent][child][inst][port].assign(
+            pin_begin, pin_begin + ports_[child][port].get_width());
+        }
+      }
+    }
+  }
+
+  /* Release the compact storage */
+  net_src_offsets_.clear();
+  net_src_terminal_list_.clear();
+  net_src_instance_list_.clear();
+  net_src_pin_list_.clear();
+  net_sink_offsets_.clear();
+  net_sink_terminal_list_.clear();
+  net_sink_instance_list_.clear();
+  net_sink_pin_list_.clear();
+  net_lookup_child_offsets_.clear();
+  net_lookup_nets_.clear();
+  port_pin_offsets_.clear();
+
+  is_compact_ = false;
+}
+
+void ModuleManager::set_lite_connected_pin(const ModuleId& parent_module,
+                                           const ModuleId& child_module,
+                                           const size_t& child_instance,
+                                           const ModulePortId& child_port,
+                                           const size_t& child_pin) {
+  VTR_ASSERT(valid_module_port_id(child_module, child_port));
+  if (size_t(parent_module) >= lite_connected_pins_.size()) {
+    lite_connected_pins_.resize(ids_.size());
+  }
+  /* The instance id of the parent module itself is always zero */
+  size_t instance_id = (child_module == parent_module) ? 0 : child_instance;
+  std::vector<bool>& connected_pins = lite_connected_pins_[parent_module]
+    [std::make_tuple(child_module, instance_id, child_port)];
+  if (connected_pins.empty()) {
+    connected_pins.resize(ports_[child_module][child_port].get_width(), false);
+  }
+  VTR_ASSERT(child_pin < connected_pins.size());
+  connected_pins[child_pin] = true;
+}
+
 } /* end namespace openfpga */
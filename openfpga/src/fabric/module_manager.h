@@ -1,6 +1,7 @@
 #ifndef MODULE_MANAGER_H
 #define MODULE_MANAGER_H
 
+#include <array>
 #include <map>
 #include <string>
 #include <tuple>
@@ -68,7 +69,28 @@ class ModuleManager {
     NUM_MODULE_USAGE_TYPES
   };
 
+  /* Types of the configuration statistics which are stored for each module
+   * - CONFIG_STAT_NUM_BLOCKS/BITS: the number of configurable blocks and
+   *   configuration bits under the module, which depend on the configurable
+   *   children of the module and all its descendants
+   * - CONFIG_STAT_CONFIG_PORT_WIDTH: the width of the configuration ports of
+   *   the module
+   * - CONFIG_STAT_NUM_BLS/WLS: the width of the BL/WL ports of the module
+   *   under the QuickLogic memory bank protocol
+   * The last three only depend on the ports of the module
+   */
+  enum e_config_stat_type {
+    CONFIG_STAT_NUM_BLOCKS,
+    CONFIG_STAT_NUM_BITS,
+    CONFIG_STAT_CONFIG_PORT_WIDTH,
+    CONFIG_STAT_NUM_BLS,
+    CONFIG_STAT_NUM_WLS,
+    NUM_CONFIG_STAT_TYPES
+  };
+
  public: /* Public Constructors */
+  ModuleManager();
+
  public: /* Type implementations */
   /*
    * This class (forward delcared above) is a template used to represent a
@@ -139,10 +161,8 @@ class ModuleManager {
   typedef vtr::vector<ModulePortId, ModulePortId>::const_iterator
     module_port_iterator;
   typedef lazy_id_iterator<ModuleNetId> module_net_iterator;
-  typedef vtr::vector<ModuleNetSrcId, ModuleNetSrcId>::const_iterator
-    module_net_src_iterator;
-  typedef vtr::vector<ModuleNetSinkId, ModuleNetSinkId>::const_iterator
-    module_net_sink_iterator;
+  typedef lazy_id_iterator<ModuleNetSrcId> module_net_src_iterator;
+  typedef lazy_id_iterator<ModuleNetSinkId> module_net_sink_iterator;
   typedef vtr::vector<ConfigRegionId, ConfigRegionId>::const_iterator
     region_iterator;
 
@@ -211,6 +231,20 @@ class ModuleManager {
  public: /* Public accessors */
   size_t num_modules() const;
   size_t num_nets(const ModuleId& module) const;
+  /* Identify if the net storage has been compacted by compact() */
+  bool is_compact() const;
+  /* Find the configuration statistics of a module under a given key, which
+   * have been set by set_config_stat(). The key is defined by the caller,
+   * e.g., to distinguish configuration protocols. Return size_t(-1) if the
+   * statistics are not available */
+  size_t config_stat(const ModuleId& module,
+                     const e_config_stat_type& stat_type,
+                     const size_t& key) const;
+  /* Identify if the module graph is a lite one, where nets are not stored */
+  bool is_lite() const;
+  /* Statistics on the nets and net terminals which are skipped in lite mode */
+  size_t num_lite_skipped_nets() const;
+  size_t num_lite_skipped_net_terminals() const;
   std::string module_name(const ModuleId& module_id) const;
   e_module_usage_type module_usage(const ModuleId& module_id) const;
   std::string module_port_type_str(
@@ -298,10 +332,20 @@ class ModuleManager {
  private: /* Private accessors */
   size_t find_child_module_index_in_parent_module(
     const ModuleId& parent_module, const ModuleId& child_module) const;
+  /* Find the number of sources/sinks of a net, regardless of the storage */
+  size_t num_net_sources(const ModuleId& module, const ModuleNetId& net) const;
+  size_t num_net_sinks(const ModuleId& module, const ModuleNetId& net) const;
 
  public: /* Public mutators */
   /* Add a module */
   ModuleId add_module(const std::string& name);
+  /* Set the configuration statistics of a module under a given key.
+   * The block and bit counts of all the modules are dropped when the
+   * configurable children of any module are changed, while the port widths
+   * of a module are dropped when its ports are changed */
+  void set_config_stat(const ModuleId& module,
+                       const e_config_stat_type& stat_type, const size_t& key,
+                       const size_t& value);
   /* Add a port to a module */
   ModulePortId add_port(const ModuleId& module, const BasicPort& port_info,
                         const enum e_module_port_type& port_type);
@@ -423,6 +467,33 @@ class ModuleManager {
                                       const ModulePortId& sink_port,
                                       const size_t& sink_pin);
 
+ public: /* Public storage management */
+  /* Freeze the nets of all the modules into compact arrays, where the
+   * terminals of all the nets in a module are stored in a flat list indexed by
+   * offsets. This saves a large amount of memory and heap allocations for
+   * large fabrics. It should be called once the module graph is built.
+   * All the accessors work in the same way after compaction.
+   * Any mutator on ports, children or nets will restore the storage
+   * to the expandable form automatically, which is slow.
+   * So do NOT modify the module graph after compaction unless necessary.
+   * A caller which modifies a compact module graph should call compact()
+   * again afterwards, as is_compact() will be false then.
+   */
+  void compact();
+
+  /* Enable/disable the lite mode, which must be set before adding any module.
+   * In lite mode, the module graph keeps only the modules, ports, children,
+   * configurable children and regions which are required by bitstream
+   * generation. Nets are not stored:
+   *   - create_module_net() returns a placeholder net without any terminal
+   *   - module_instance_port_net() returns the placeholder net for the pins
+   *     which have been connected, and an invalid net otherwise
+   *   - any source/sink added to a net is dropped, only the pin is marked
+   *     as connected
+   * The lite module graph can NOT be used to output netlists
+   */
+  void set_lite(const bool& lite);
+
  public: /* Public deconstructors */
   /* This is a strong function which will remove all the configurable children
    * under a given parent module
@@ -461,6 +532,19 @@ class ModuleManager {
   void invalidate_name2id_map();
   void invalidate_port_lookup();
   void invalidate_net_lookup();
+  void invalidate_config_stats();
+  void invalidate_config_port_stats(const ModuleId& module);
+
+ private: /* Private mutators */
+  /* Restore the compacted nets to the expandable storage. Called by mutators
+   */
+  void expand();
+  /* Mark a pin as connected to the placeholder net in lite mode */
+  void set_lite_connected_pin(const ModuleId& parent_module,
+                              const ModuleId& child_module,
+                              const size_t& child_instance,
+                              const ModulePortId& child_port,
+                              const size_t& child_pin);
 
  private: /* Internal data */
   /* Module-level data */
@@ -551,10 +635,6 @@ class ModuleManager {
   vtr::vector<ModuleId, vtr::vector<ModuleNetId, std::string>>
     net_names_; /* Name of net */
 
-  vtr::vector<
-    ModuleId,
-    vtr::vector<ModuleNetId, vtr::vector<ModuleNetSrcId, ModuleNetSrcId>>>
-    net_src_ids_; /* Unique id of the source that drive the net */
   vtr::vector<ModuleId,
               vtr::vector<ModuleNetId, vtr::vector<ModuleNetSrcId, size_t>>>
     net_src_terminal_ids_; /* Pin ids that drive the net */
@@ -565,10 +645,6 @@ class ModuleManager {
               vtr::vector<ModuleNetId, vtr::vector<ModuleNetSrcId, size_t>>>
     net_src_pin_ids_; /* Pin ids that drive the net */
 
-  vtr::vector<
-    ModuleId,
-    vtr::vector<ModuleNetId, vtr::vector<ModuleNetSinkId, ModuleNetSinkId>>>
-    net_sink_ids_; /* Unique ids of the sink that the net drives */
   vtr::vector<ModuleId,
               vtr::vector<ModuleNetId, vtr::vector<ModuleNetSinkId, size_t>>>
     net_sink_terminal_ids_; /* Pin ids that the net drives */
@@ -579,6 +655,35 @@ class ModuleManager {
               vtr::vector<ModuleNetId, vtr::vector<ModuleNetSinkId, size_t>>>
     net_sink_pin_ids_; /* Pin ids that drive the net */
 
+  /* Compact storage of nets, which is used after compact() is called.
+   * The expandable storage above is released after compaction, and vice versa.
+   * The terminals of a net are stored in the flat lists of the module, in the
+   * range of [offsets[net], offsets[net + 1])
+   */
+  bool is_compact_;
+  vtr::vector<ModuleId, std::vector<size_t>> net_src_offsets_;
+  vtr::vector<ModuleId, std::vector<size_t>> net_src_terminal_list_;
+  vtr::vector<ModuleId, std::vector<size_t>> net_src_instance_list_;
+  vtr::vector<ModuleId, std::vector<size_t>> net_src_pin_list_;
+  vtr::vector<ModuleId, std::vector<size_t>> net_sink_offsets_;
+  vtr::vector<ModuleId, std::vector<size_t>> net_sink_terminal_list_;
+  vtr::vector<ModuleId, std::vector<size_t>> net_sink_instance_list_;
+  vtr::vector<ModuleId, std::vector<size_t>> net_sink_pin_list_;
+  /* Source/sink ids are contiguous and never invalidated. Empty sets are
+   * required by the lazy iterators */
+  std::unordered_set<ModuleNetSrcId> invalid_net_src_ids_;
+  std::unordered_set<ModuleNetSinkId> invalid_net_sink_ids_;
+
+  /* Lite mode where no net is stored, and the statistics of skipped nets */
+  bool is_lite_;
+  size_t num_lite_skipped_nets_;
+  size_t num_lite_skipped_net_terminals_;
+  /* Pins which are connected in lite mode, one bit per pin:
+   * [module_ids][(child_module, instance_id, port_id)][pin_ids] */
+  vtr::vector<ModuleId, std::map<std::tuple<ModuleId, size_t, ModulePortId>,
+                                 std::vector<bool>>>
+    lite_connected_pins_;
+
   /* fast look-up for module */
   std::map<std::string, ModuleId> name_id_map_;
   /* fast look-up for ports */
@@ -595,10 +700,26 @@ class ModuleManager {
   mutable NetLookup
     net_lookup_; /* [module_ids][module_ids][instance_ids][port_ids][pin_ids] */
 
+  /* Compact fast look-up for nets, which is used after compact() is called.
+   * The nets of all the pins of a parent module and its child instances are
+   * stored in a flat list. The net of a pin can be found at
+   * [child_offset + instance_id * num_pins(child) + port_pin_offset + pin_id]
+   */
+  vtr::vector<ModuleId, std::map<ModuleId, size_t>> net_lookup_child_offsets_;
+  vtr::vector<ModuleId, std::vector<ModuleNetId>> net_lookup_nets_;
+  vtr::vector<ModuleId, std::vector<size_t>>
+    port_pin_offsets_; /* [module_ids][port_ids], the last one is the number of
+                          pins of the module */
+
   /* Store pairs of a module and a port, which are frequently used in net
    * terminals (either source or sink)
    */
   std::vector<std::pair<ModuleId, ModulePortId>> net_terminal_storage_;
+
+  /* Configuration statistics: [stat_types][keys][module_ids] */
+  std::array<std::map<size_t, vtr::vector<ModuleId, size_t>>,
+             NUM_CONFIG_STAT_TYPES>
+    config_stats_;
 };
 
 } /* end namespace openfpga */
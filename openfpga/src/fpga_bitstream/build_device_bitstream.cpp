@@ -26,6 +26,9 @@ namespace openfpga {
  * This function will recursively walk through the module graph
  * from the specified top module and count the number of configurable children
  * which are the blocks that will be added to the bitstream manager
+ * The number of blocks of each module is looked up from the module manager
+ * if available, i.e., built by build_module_config_stats(), so that a module
+ * used by many instances is visited only once
  *******************************************************************/
 static size_t rec_estimate_device_bitstream_num_blocks(
   const ModuleManager& module_manager, const ModuleId& top_module) {
@@ -39,6 +42,12 @@ static size_t rec_estimate_device_bitstream_num_blocks(
     return 0;
   }
 
+  size_t stat_num_blocks = module_manager.config_stat(
+    top_module, ModuleManager::CONFIG_STAT_NUM_BLOCKS, 0);
+  if (size_t(-1) != stat_num_blocks) {
+    return stat_num_blocks;
+  }
+
   size_t num_configurable_children =
     module_manager.configurable_children(top_module).size();
   for (size_t ichild = 0; ichild < num_configurable_children; ++ichild) {
@@ -59,6 +68,10 @@ static size_t rec_estimate_device_bitstream_num_blocks(
  *bitstream This function will recursively walk through the module graph from
  *the specified top module and count the number of leaf configurable children
  * which are the bits that will be added to the bitstream manager
+ * The number of bits of each module other than the top module is looked up
+ * from the module manager if available, i.e., built by
+ * build_module_config_stats(), so that a module used by many instances is
+ * visited only once
  *******************************************************************/
 static size_t rec_estimate_device_bitstream_num_bits(
   const ModuleManager& module_manager, const ModuleId& top_module,
@@ -104,6 +117,13 @@ static size_t rec_estimate_device_bitstream_num_bits(
   } else {
     VTR_ASSERT_SAFE(parent_module != top_module);
 
+    size_t stat_num_bits = module_manager.config_stat(
+      parent_module, ModuleManager::CONFIG_STAT_NUM_BITS,
+      size_t(config_protocol.type()));
+    if (size_t(-1) != stat_num_bits) {
+      return stat_num_bits;
+    }
+
     size_t num_configurable_children =
       module_manager.configurable_children(parent_module).size();
 
@@ -126,6 +146,80 @@ static size_t rec_estimate_device_bitstream_num_bits(
   return num_bits;
 }
 
+/********************************************************************
+ * Count the configurable blocks and configuration bits under a module, in the
+ * same way as the estimators above do for the modules other than the top
+ * module. Children are counted before their parents, so that each module is
+ * visited only once
+ *******************************************************************/
+static void rec_build_module_config_stats(
+  const ModuleManager& module_manager, const ModuleId& parent_module,
+  const ConfigProtocol& config_protocol,
+  vtr::vector<ModuleId, size_t>& num_blocks,
+  vtr::vector<ModuleId, size_t>& num_bits) {
+  if (size_t(-1) != num_blocks[parent_module]) {
+    return;
+  }
+
+  const std::vector<ModuleId>& config_children =
+    module_manager.configurable_children(parent_module);
+  /* Configurable memory elements are not blocks but bits */
+  if (config_children.empty()) {
+    num_blocks[parent_module] = 0;
+    num_bits[parent_module] = 1;
+    return;
+  }
+
+  size_t curr_num_blocks = 1;
+  for (const ModuleId& child_module : config_children) {
+    rec_build_module_config_stats(module_manager, child_module,
+                                  config_protocol, num_blocks, num_bits);
+    curr_num_blocks += num_blocks[child_module];
+  }
+
+  /* Frame-based configuration protocol will have 1 decoder
+   * if there are more than 1 configurable children
+   */
+  size_t num_configurable_children = config_children.size();
+  if ((CONFIG_MEM_FRAME_BASED == config_protocol.type()) &&
+      (2 <= num_configurable_children)) {
+    num_configurable_children--;
+  }
+  size_t curr_num_bits = 0;
+  for (size_t ichild = 0; ichild < num_configurable_children; ++ichild) {
+    curr_num_bits += num_bits[config_children[ichild]];
+  }
+
+  num_blocks[parent_module] = curr_num_blocks;
+  num_bits[parent_module] = curr_num_bits;
+}
+
+/********************************************************************
+ * Build the number of configurable blocks and configuration bits of each
+ * module, which are used to estimate the size of device bitstreams.
+ * This should be called once the module graph is complete, so that the
+ * estimators only read the module manager
+ *******************************************************************/
+void build_module_config_stats(ModuleManager& module_manager,
+                               const ConfigProtocol& config_protocol) {
+  vtr::vector<ModuleId, size_t> num_blocks(module_manager.num_modules(),
+                                           size_t(-1));
+  vtr::vector<ModuleId, size_t> num_bits(module_manager.num_modules(),
+                                         size_t(-1));
+  for (const ModuleId& module : module_manager.modules()) {
+    rec_build_module_config_stats(module_manager, module, config_protocol,
+                                  num_blocks, num_bits);
+  }
+
+  for (const ModuleId& module : module_manager.modules()) {
+    module_manager.set_config_stat(
+      module, ModuleManager::CONFIG_STAT_NUM_BLOCKS, 0, num_blocks[module]);
+    module_manager.set_config_stat(module, ModuleManager::CONFIG_STAT_NUM_BITS,
+                                   size_t(config_protocol.type()),
+                                   num_bits[module]);
+  }
+}
+
 /********************************************************************
  * A top-level function to build a bistream from the FPGA device
  * 1. It will organize the bitstream w.r.t. the hierarchy of module graphs
@@ -16,6 +16,9 @@
 /* begin namespace openfpga */
 namespace openfpga {
 
+void build_module_config_stats(ModuleManager& module_manager,
+                               const ConfigProtocol& config_protocol);
+
 BitstreamManager build_device_bitstream(const VprContext& vpr_ctx,
                                         const OpenfpgaContext& openfpga_ctx,
                                         const bool& verbose);
@@ -117,6 +117,33 @@ std::vector<char> FabricBitstream::bit_wl_address(
   return addr_bits;
 }
 
+void FabricBitstream::append_bit_address(const FabricBitId& bit_id,
+                                         std::string& addr_str) const {
+  /* Ensure a valid id */
+  VTR_ASSERT(true == valid_bit_id(bit_id));
+  VTR_ASSERT(true == use_address_);
+
+  append_address_bits(bit_address_1bits_[bit_id], bit_address_xbits_[bit_id],
+                      address_length_, addr_str);
+}
+
+void FabricBitstream::append_bit_bl_address(const FabricBitId& bit_id,
+                                            std::string& addr_str) const {
+  append_bit_address(bit_id, addr_str);
+}
+
+void FabricBitstream::append_bit_wl_address(const FabricBitId& bit_id,
+                                            std::string& addr_str) const {
+  /* Ensure a valid id */
+  VTR_ASSERT(true == valid_bit_id(bit_id));
+  VTR_ASSERT(true == use_address_);
+  VTR_ASSERT(true == use_wl_address_);
+
+  append_address_bits(bit_wl_address_1bits_[bit_id],
+                      bit_wl_address_xbits_[bit_id], wl_address_length_,
+                      addr_str);
+}
+
 char FabricBitstream::bit_din(const FabricBitId& bit_id) const {
   /* Ensure a valid id */
   VTR_ASSERT(true == valid_bit_id(bit_id));
@@ -355,4 +382,24 @@ std::vector<char> FabricBitstream::decode_address_bits(
   return ret_vec;
 }
 
+/* Decode the address bits in the same way as decode_address_bits(), but
+ * write the characters to the end of a string directly */
+void FabricBitstream::append_address_bits(const std::vector<uint64_t>& bits1,
+                                          const std::vector<uint64_t>& bitsx,
+                                          const size_t& addr_len,
+                                          std::string& addr_str) const {
+  for (size_t curr_idx = 0; curr_idx < bits1.size(); curr_idx++) {
+    size_t curr_addr_len = std::min(size_t(64), addr_len - curr_idx * 64);
+    for (size_t ibit = 0; ibit < curr_addr_len; ++ibit) {
+      if (1 == ((bitsx[curr_idx] >> ibit) & 1)) {
+        addr_str += 'x';
+      } else if (1 == ((bits1[curr_idx] >> ibit) & 1)) {
+        addr_str += '1';
+      } else {
+        addr_str += '0';
+      }
+    }
+  }
+}
+
 } /* end namespace openfpga */
@@ -30,6 +30,7 @@
 #ifndef FABRIC_BITSTREAM_H
 #define FABRIC_BITSTREAM_H
 
+#include <string>
 #include <unordered_map>
 #include <unordered_set>
 #include <vector>
@@ -137,6 +138,15 @@ class FabricBitstream {
   std::vector<char> bit_bl_address(const FabricBitId& bit_id) const;
   std::vector<char> bit_wl_address(const FabricBitId& bit_id) const;
 
+  /* Append the address of bitstream to a string, which avoids creating a
+   * vector for each bit when writing large bitstreams */
+  void append_bit_address(const FabricBitId& bit_id,
+                          std::string& addr_str) const;
+  void append_bit_bl_address(const FabricBitId& bit_id,
+                             std::string& addr_str) const;
+  void append_bit_wl_address(const FabricBitId& bit_id,
+                             std::string& addr_str) const;
+
   /* Find the data-in of bitstream */
   char bit_din(const FabricBitId& bit_id) const;
 
@@ -208,6 +218,10 @@ class FabricBitstream {
   uint64_t encode_address_xbits(const std::vector<char>& address) const;
   std::vector<char> decode_address_bits(const size_t& bit1, const size_t& bitx,
                                         const size_t& addr_len) const;
+  void append_address_bits(const std::vector<uint64_t>& bits1,
+                           const std::vector<uint64_t>& bitsx,
+                           const size_t& addr_len,
+                           std::string& addr_str) const;
 
  private: /* Internal data */
   /* Unique id of a region in the Bitstream */
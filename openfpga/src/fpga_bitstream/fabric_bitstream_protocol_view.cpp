@@ -0,0 +1,130 @@
+/******************************************************************************
+ * Member functions for data structure FabricBitstreamProtocolView
+ ******************************************************************************/
+#include "fabric_bitstream_protocol_view.h"
+
+#include "vtr_assert.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/**************************************************
+ * Public Constructors
+ *************************************************/
+FabricBitstreamProtocolView::FabricBitstreamProtocolView(
+  const FabricBitstream& fabric_bitstream,
+  const MemoryBankShiftRegisterBanks& blwl_sr_banks)
+  : fabric_bitstream_(fabric_bitstream), blwl_sr_banks_(blwl_sr_banks) {
+  clear();
+}
+
+/**************************************************
+ * Public Accessors
+ *************************************************/
+const FabricBitstream& FabricBitstreamProtocolView::fabric_bitstream() const {
+  return fabric_bitstream_;
+}
+
+const MemoryBankShiftRegisterBanks& FabricBitstreamProtocolView::blwl_sr_banks()
+  const {
+  return blwl_sr_banks_;
+}
+
+const FrameFabricBitstream& FabricBitstreamProtocolView::frame_based_bitstream()
+  const {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  if (false == frame_based_bitstream_built_) {
+    frame_based_bitstream_ =
+      build_frame_based_fabric_bitstream_by_address(fabric_bitstream_);
+    frame_based_bitstream_built_ = true;
+  }
+  return frame_based_bitstream_;
+}
+
+size_t FabricBitstreamProtocolView::frame_based_fast_configuration_size(
+  const bool& bit_value_to_skip) const {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  auto result = frame_based_fast_configuration_sizes_.find(bit_value_to_skip);
+  if (result != frame_based_fast_configuration_sizes_.end()) {
+    return result->second;
+  }
+  size_t num_bits = find_frame_based_fast_configuration_fabric_bitstream_size(
+    frame_based_bitstream(), bit_value_to_skip);
+  frame_based_fast_configuration_sizes_[bit_value_to_skip] = num_bits;
+  return num_bits;
+}
+
+const MemoryBankFabricBitstream&
+FabricBitstreamProtocolView::memory_bank_bitstream() const {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  if (false == memory_bank_bitstream_built_) {
+    memory_bank_bitstream_ =
+      build_memory_bank_fabric_bitstream_by_address(fabric_bitstream_);
+    memory_bank_bitstream_built_ = true;
+  }
+  return memory_bank_bitstream_;
+}
+
+size_t FabricBitstreamProtocolView::memory_bank_fast_configuration_size(
+  const bool& bit_value_to_skip) const {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  auto result = memory_bank_fast_configuration_sizes_.find(bit_value_to_skip);
+  if (result != memory_bank_fast_configuration_sizes_.end()) {
+    return result->second;
+  }
+  size_t num_bits = find_memory_bank_fast_configuration_fabric_bitstream_size(
+    memory_bank_bitstream(), bit_value_to_skip);
+  memory_bank_fast_configuration_sizes_[bit_value_to_skip] = num_bits;
+  return num_bits;
+}
+
+const MemoryBankFlattenFabricBitstream&
+FabricBitstreamProtocolView::memory_bank_flatten_bitstream(
+  const bool& bit_value_to_skip, const char& dont_care_bit) const {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  ViewOptions options(bit_value_to_skip, dont_care_bit);
+  auto result = memory_bank_flatten_bitstreams_.find(options);
+  if (result != memory_bank_flatten_bitstreams_.end()) {
+    return result->second;
+  }
+  return memory_bank_flatten_bitstreams_
+    .emplace(options, build_memory_bank_flatten_fabric_bitstream(
+                        fabric_bitstream_, bit_value_to_skip, dont_care_bit))
+    .first->second;
+}
+
+const MemoryBankShiftRegisterFabricBitstream&
+FabricBitstreamProtocolView::memory_bank_shift_register_bitstream(
+  const bool& bit_value_to_skip, const char& dont_care_bit) const {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  ViewOptions options(bit_value_to_skip, dont_care_bit);
+  auto result = memory_bank_shift_register_bitstreams_.find(options);
+  if (result != memory_bank_shift_register_bitstreams_.end()) {
+    return result->second;
+  }
+  return memory_bank_shift_register_bitstreams_
+    .emplace(options, build_memory_bank_shift_register_fabric_bitstream(
+                        memory_bank_flatten_bitstream(bit_value_to_skip,
+                                                      dont_care_bit),
+                        blwl_sr_banks_, dont_care_bit))
+    .first->second;
+}
+
+/******************************************************************************
+ * Public Mutators
+ ******************************************************************************/
+void FabricBitstreamProtocolView::clear() {
+  std::lock_guard<std::recursive_mutex> lock(mutex_);
+  frame_based_bitstream_built_ = false;
+  frame_based_bitstream_.clear();
+  frame_based_fast_configuration_sizes_.clear();
+
+  memory_bank_bitstream_built_ = false;
+  memory_bank_bitstream_.clear();
+  memory_bank_fast_configuration_sizes_.clear();
+
+  memory_bank_flatten_bitstreams_.clear();
+  memory_bank_shift_register_bitstreams_.clear();
+}
+
+} /* end namespace openfpga */
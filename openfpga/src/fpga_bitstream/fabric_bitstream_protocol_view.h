@@ -0,0 +1,100 @@
+#ifndef FABRIC_BITSTREAM_PROTOCOL_VIEW_H
+#define FABRIC_BITSTREAM_PROTOCOL_VIEW_H
+
+/********************************************************************
+ * Include header files required by the data structure definition
+ *******************************************************************/
+#include <map>
+#include <mutex>
+#include <utility>
+
+#include "fabric_bitstream.h"
+#include "fabric_bitstream_utils.h"
+#include "memory_bank_flatten_fabric_bitstream.h"
+#include "memory_bank_shift_register_banks.h"
+#include "memory_bank_shift_register_fabric_bitstream.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/********************************************************************
+ * The fabric bitstream reorganized for a configuration protocol, e.g.,
+ * the bits of memory banks grouped by addresses.
+ *
+ * The reorganized bitstreams are expensive to build on large fabrics,
+ * while the same ones are required by several writers, e.g., bitstream
+ * files and testbenches. Each of them is built on the first request and
+ * then kept until clear() is called, which must be done whenever the
+ * fabric bitstream or the shift register banks change.
+ *
+ * Note that the reorganized bitstreams are built by const accessors,
+ * which are guarded by a lock, so that commands writing bitstreams can
+ * run concurrently.
+ *******************************************************************/
+class FabricBitstreamProtocolView {
+ public: /* Public constructors */
+  FabricBitstreamProtocolView(
+    const FabricBitstream& fabric_bitstream,
+    const MemoryBankShiftRegisterBanks& blwl_sr_banks);
+
+ public: /* Public accessors */
+  const FabricBitstream& fabric_bitstream() const;
+  const MemoryBankShiftRegisterBanks& blwl_sr_banks() const;
+
+  /* Frame-based protocol: bits grouped by address */
+  const FrameFabricBitstream& frame_based_bitstream() const;
+  /* Number of addresses to be programmed with fast configuration */
+  size_t frame_based_fast_configuration_size(
+    const bool& bit_value_to_skip) const;
+
+  /* Memory bank with BL/WL decoders: bits grouped by BL/WL addresses */
+  const MemoryBankFabricBitstream& memory_bank_bitstream() const;
+  /* Number of addresses to be programmed with fast configuration */
+  size_t memory_bank_fast_configuration_size(
+    const bool& bit_value_to_skip) const;
+
+  /* Memory bank with flatten BL/WLs: BLs merged under the same WLs.
+   * Every WL address is kept, so the bitstream is the same with or
+   * without fast configuration */
+  const MemoryBankFlattenFabricBitstream& memory_bank_flatten_bitstream(
+    const bool& bit_value_to_skip, const char& dont_care_bit = 'x') const;
+
+  /* Memory bank with BL/WL shift registers: flatten BL/WLs reshaped
+   * for the shift register banks */
+  const MemoryBankShiftRegisterFabricBitstream&
+  memory_bank_shift_register_bitstream(const bool& bit_value_to_skip,
+                                       const char& dont_care_bit = 'x') const;
+
+ public: /* Public mutators */
+  /* Drop all the reorganized bitstreams */
+  void clear();
+
+ private: /* Internal data */
+  const FabricBitstream& fabric_bitstream_;
+  const MemoryBankShiftRegisterBanks& blwl_sr_banks_;
+
+  /* Options to build a reorganized bitstream:
+   * (bit_value_to_skip, dont_care_bit) */
+  typedef std::pair<bool, char> ViewOptions;
+
+  /* Memoized reorganized bitstreams */
+  mutable bool frame_based_bitstream_built_;
+  mutable FrameFabricBitstream frame_based_bitstream_;
+  mutable std::map<bool, size_t> frame_based_fast_configuration_sizes_;
+
+  mutable bool memory_bank_bitstream_built_;
+  mutable MemoryBankFabricBitstream memory_bank_bitstream_;
+  mutable std::map<bool, size_t> memory_bank_fast_configuration_sizes_;
+
+  mutable std::map<ViewOptions, MemoryBankFlattenFabricBitstream>
+    memory_bank_flatten_bitstreams_;
+  mutable std::map<ViewOptions, MemoryBankShiftRegisterFabricBitstream>
+    memory_bank_shift_register_bitstreams_;
+
+  /* Recursive, as some reorganized bitstreams are built from others */
+  mutable std::recursive_mutex mutex_;
+};
+
+} /* end namespace openfpga */
+
+#endif
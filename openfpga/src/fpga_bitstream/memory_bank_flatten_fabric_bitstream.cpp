@@ -1,10 +1,12 @@
 #include "memory_bank_flatten_fabric_bitstream.h"
 
+#include "vtr_assert.h"
+
 /* begin namespace openfpga */
 namespace openfpga {
 
 size_t MemoryBankFlattenFabricBitstream::size() const {
-  return bitstream_.size();
+  return wl_vectors_.size();
 }
 
 size_t MemoryBankFlattenFabricBitstream::bl_vector_size() const {
@@ -12,7 +14,7 @@ size_t MemoryBankFlattenFabricBitstream::bl_vector_size() const {
    * just get it from the 1st element to save runtime
    */
   size_t bl_vec_size = 0;
-  for (const auto& bl_vec : bitstream_.begin()->second) {
+  for (const auto& bl_vec : bl_vectors_.front()) {
     bl_vec_size += bl_vec.size();
   }
   return bl_vec_size;
@@ -23,31 +25,34 @@ size_t MemoryBankFlattenFabricBitstream::wl_vector_size() const {
    * just get it from the 1st element to save runtime
    */
   size_t wl_vec_size = 0;
-  for (const auto& wl_vec : bitstream_.begin()->first) {
+  for (const auto& wl_vec : wl_vectors_.front()) {
     wl_vec_size += wl_vec.size();
   }
   return wl_vec_size;
 }
 
-std::vector<std::string> MemoryBankFlattenFabricBitstream::bl_vector(
-  const std::vector<std::string>& wl_vec) const {
-  return bitstream_.at(wl_vec);
+const std::vector<TernaryBitVector>&
+MemoryBankFlattenFabricBitstream::bl_vector(const size_t& word) const {
+  VTR_ASSERT(word < bl_vectors_.size());
+  return bl_vectors_[word];
 }
 
-std::vector<std::vector<std::string>>
-MemoryBankFlattenFabricBitstream::wl_vectors() const {
-  std::vector<std::vector<std::string>> wl_vecs;
-  for (const auto& pair : bitstream_) {
-    wl_vecs.push_back(pair.first);
-  }
-  return wl_vecs;
+const std::vector<TernaryBitVector>&
+MemoryBankFlattenFabricBitstream::wl_vector(const size_t& word) const {
+  VTR_ASSERT(word < wl_vectors_.size());
+  return wl_vectors_[word];
+}
+
+void MemoryBankFlattenFabricBitstream::reserve(const size_t& num_words) {
+  bl_vectors_.reserve(num_words);
+  wl_vectors_.reserve(num_words);
 }
 
 void MemoryBankFlattenFabricBitstream::add_blwl_vectors(
-  const std::vector<std::string>& bl_vec,
-  const std::vector<std::string>& wl_vec) {
-  /* TODO: Add sanity check. Give a warning if the wl vector is already there */
-  bitstream_[wl_vec] = bl_vec;
+  const std::vector<TernaryBitVector>& bl_vec,
+  const std::vector<TernaryBitVector>& wl_vec) {
+  bl_vectors_.push_back(bl_vec);
+  wl_vectors_.push_back(wl_vec);
 }
 
 } /* end namespace openfpga */
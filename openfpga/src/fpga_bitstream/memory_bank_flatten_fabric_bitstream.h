@@ -1,10 +1,10 @@
 #ifndef MEMORY_BANK_FLATTEN_FABRIC_BITSTREAM_H
 #define MEMORY_BANK_FLATTEN_FABRIC_BITSTREAM_H
 
-#include <map>
 #include <string>
 #include <vector>
 
+#include "openfpga_ternary_bit_vector.h"
 #include "vtr_vector.h"
 
 /* begin namespace openfpga */
@@ -28,25 +28,29 @@ class MemoryBankFlattenFabricBitstream {
   /* @brief Return the WL address size */
   size_t wl_vector_size() const;
 
-  /* @brief Return the BL vectors with a given WL key */
-  std::vector<std::string> bl_vector(
-    const std::vector<std::string>& wl_vec) const;
+  /* @brief Return the BL vectors of a word in the downloaded sequence */
+  const std::vector<TernaryBitVector>& bl_vector(const size_t& word) const;
 
-  /* @brief Return all the WL vectors in a downloaded sequence */
-  std::vector<std::vector<std::string>> wl_vectors() const;
+  /* @brief Return the WL vectors of a word in the downloaded sequence */
+  const std::vector<TernaryBitVector>& wl_vector(const size_t& word) const;
 
  public: /* Mutators */
-  /* @brief add a pair of BL/WL vectors to the bitstream database */
-  void add_blwl_vectors(const std::vector<std::string>& bl_vec,
-                        const std::vector<std::string>& wl_vec);
+  /* @brief Reserve a number of words to be memory efficient */
+  void reserve(const size_t& num_words);
+
+  /* @brief add a pair of BL/WL vectors to the bitstream database, as the last
+   * word in the downloaded sequence */
+  void add_blwl_vectors(const std::vector<TernaryBitVector>& bl_vec,
+                        const std::vector<TernaryBitVector>& wl_vec);
 
  public:  /* Validators */
  private: /* Internal data */
-  /* [(wl_bank0, wl_bank1, ...)] = [(bl_bank0, bl_bank1, ...)]
-   * Must use (WL, BL) as pairs in the map!!!
-   * This is because BL data may not be unique while WL must be unique
+  /* [(bl_bank0, bl_bank1, ...)] and [(wl_bank0, wl_bank1, ...)] of each word
+   * in the downloaded sequence. Note that BL data may not be unique while WL
+   * must be unique
    */
-  std::map<std::vector<std::string>, std::vector<std::string>> bitstream_;
+  std::vector<std::vector<TernaryBitVector>> bl_vectors_;
+  std::vector<std::vector<TernaryBitVector>> wl_vectors_;
 };
 
 } /* end namespace openfpga */
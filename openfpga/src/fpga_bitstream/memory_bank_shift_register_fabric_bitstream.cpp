@@ -43,13 +43,15 @@ size_t MemoryBankShiftRegisterFabricBitstream::wl_width() const {
   return bitstream_word_wls_[bitstream_word_ids_.back()].back().size();
 }
 
-std::vector<std::string> MemoryBankShiftRegisterFabricBitstream::bl_vectors(
+const std::vector<TernaryBitVector>&
+MemoryBankShiftRegisterFabricBitstream::bl_vectors(
   const MemoryBankShiftRegisterFabricBitstreamWordId& word_id) const {
   VTR_ASSERT(valid_word_id(word_id));
   return bitstream_word_bls_[word_id];
 }
 
-std::vector<std::string> MemoryBankShiftRegisterFabricBitstream::wl_vectors(
+const std::vector<TernaryBitVector>&
+MemoryBankShiftRegisterFabricBitstream::wl_vectors(
   const MemoryBankShiftRegisterFabricBitstreamWordId& word_id) const {
   VTR_ASSERT(valid_word_id(word_id));
   return bitstream_word_wls_[word_id];
@@ -72,14 +74,14 @@ MemoryBankShiftRegisterFabricBitstream::create_word() {
 
 void MemoryBankShiftRegisterFabricBitstream::add_bl_vectors(
   const MemoryBankShiftRegisterFabricBitstreamWordId& word_id,
-  const std::string& bl_vec) {
+  const TernaryBitVector& bl_vec) {
   VTR_ASSERT(valid_word_id(word_id));
   return bitstream_word_bls_[word_id].push_back(bl_vec);
 }
 
 void MemoryBankShiftRegisterFabricBitstream::add_wl_vectors(
   const MemoryBankShiftRegisterFabricBitstreamWordId& word_id,
-  const std::string& wl_vec) {
+  const TernaryBitVector& wl_vec) {
   VTR_ASSERT(valid_word_id(word_id));
   return bitstream_word_wls_[word_id].push_back(wl_vec);
 }
@@ -6,6 +6,7 @@
 #include <vector>
 
 #include "memory_bank_shift_register_fabric_bitstream_fwd.h"
+#include "openfpga_ternary_bit_vector.h"
 #include "vtr_vector.h"
 
 /* begin namespace openfpga */
@@ -50,11 +51,11 @@ class MemoryBankShiftRegisterFabricBitstream {
   size_t wl_width() const;
 
   /* @brief Return the BL vectors with a given word id*/
-  std::vector<std::string> bl_vectors(
+  const std::vector<TernaryBitVector>& bl_vectors(
     const MemoryBankShiftRegisterFabricBitstreamWordId& word_id) const;
 
   /* @brief Return the WL vectors in a given word id */
-  std::vector<std::string> wl_vectors(
+  const std::vector<TernaryBitVector>& wl_vectors(
     const MemoryBankShiftRegisterFabricBitstreamWordId& word_id) const;
 
  public: /* Mutators */
@@ -64,12 +65,12 @@ class MemoryBankShiftRegisterFabricBitstream {
   /* @brief Add BLs to a given word */
   void add_bl_vectors(
     const MemoryBankShiftRegisterFabricBitstreamWordId& word_id,
-    const std::string& bl_vec);
+    const TernaryBitVector& bl_vec);
 
   /* @brief Add WLs to a given word */
   void add_wl_vectors(
     const MemoryBankShiftRegisterFabricBitstreamWordId& word_id,
-    const std::string& wl_vec);
+    const TernaryBitVector& wl_vec);
 
  public: /* Validators */
   bool valid_word_id(
@@ -104,10 +105,10 @@ class MemoryBankShiftRegisterFabricBitstream {
               MemoryBankShiftRegisterFabricBitstreamWordId>
     bitstream_word_ids_;
   vtr::vector<MemoryBankShiftRegisterFabricBitstreamWordId,
-              std::vector<std::string>>
+              std::vector<TernaryBitVector>>
     bitstream_word_bls_;
   vtr::vector<MemoryBankShiftRegisterFabricBitstreamWordId,
-              std::vector<std::string>>
+              std::vector<TernaryBitVector>>
     bitstream_word_wls_;
 };
 
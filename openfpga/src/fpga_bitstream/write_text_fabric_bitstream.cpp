@@ -2,8 +2,6 @@
  * This file includes functions that output a fabric-dependent
  * bitstream database to files in plain text
  *******************************************************************/
-#include <chrono>
-#include <ctime>
 #include <fstream>
 
 /* Headers from vtrutil library */
@@ -34,11 +32,9 @@ static void write_fabric_bitstream_text_file_head(
   fp << "// Fabric bitstream" << std::endl;
 
   if (include_time_stamp) {
-    auto end = std::chrono::system_clock::now();
-    std::time_t end_time = std::chrono::system_clock::to_time_t(end);
     /* Note that version is also a type of time stamp */
     fp << "// Version: " << openfpga::VERSION << std::endl;
-    fp << "// Date: " << std::ctime(&end_time);
+    fp << "// Date: " << get_current_time_stamp();
   }
 }
 
@@ -131,11 +127,12 @@ static int write_config_chain_fabric_bitstream_to_text_file(
  *******************************************************************/
 static int write_memory_bank_fabric_bitstream_to_text_file(
   std::fstream& fp, const bool& fast_configuration,
-  const bool& bit_value_to_skip, const FabricBitstream& fabric_bitstream) {
+  const bool& bit_value_to_skip,
+  const FabricBitstreamProtocolView& fabric_bitstream_view) {
   int status = 0;
 
-  MemoryBankFabricBitstream fabric_bits_by_addr =
-    build_memory_bank_fabric_bitstream_by_address(fabric_bitstream);
+  const MemoryBankFabricBitstream& fabric_bits_by_addr =
+    fabric_bitstream_view.memory_bank_bitstream();
 
   /* The address sizes and data input sizes are the same across any element,
    * just get it from the 1st element to save runtime
@@ -149,8 +146,8 @@ static int write_memory_bank_fabric_bitstream_to_text_file(
   if (true == fast_configuration) {
     num_bits_to_skip =
       fabric_bits_by_addr.size() -
-      find_memory_bank_fast_configuration_fabric_bitstream_size(
-        fabric_bitstream, bit_value_to_skip);
+      fabric_bitstream_view.memory_bank_fast_configuration_size(
+        bit_value_to_skip);
     VTR_ASSERT(num_bits_to_skip < fabric_bits_by_addr.size());
     VTR_LOG(
       "Fast configuration will skip %g% (%lu/%lu) of configuration "
@@ -204,8 +201,8 @@ static int write_memory_bank_fabric_bitstream_to_text_file(
  *  - 1 if critical errors occured
  *******************************************************************/
 static int write_memory_bank_flatten_fabric_bitstream_to_text_file(
-  std::fstream& fp, const bool& fast_configuration,
-  const bool& bit_value_to_skip, const FabricBitstream& fabric_bitstream,
+  std::fstream& fp, const bool& bit_value_to_skip,
+  const FabricBitstreamProtocolView& fabric_bitstream_view,
   const bool& keep_dont_care_bits) {
   int status = 0;
 
@@ -213,9 +210,9 @@ static int write_memory_bank_flatten_fabric_bitstream_to_text_file(
   if (keep_dont_care_bits) {
     dont_care_bit = DONT_CARE_CHAR;
   }
-  MemoryBankFlattenFabricBitstream fabric_bits =
-    build_memory_bank_flatten_fabric_bitstream(
-      fabric_bitstream, fast_configuration, bit_value_to_skip, dont_care_bit);
+  const MemoryBankFlattenFabricBitstream& fabric_bits =
+    fabric_bitstream_view.memory_bank_flatten_bitstream(bit_value_to_skip,
+                                                        dont_care_bit);
 
   /* The address sizes and data input sizes are the same across any element,
    * just get it from the 1st element to save runtime
@@ -230,14 +227,14 @@ static int write_memory_bank_flatten_fabric_bitstream_to_text_file(
   fp << "<wl_address " << wl_addr_size << " bits>";
   fp << std::endl;
 
-  for (const auto& wl_vec : fabric_bits.wl_vectors()) {
+  for (size_t iword = 0; iword < fabric_bits.size(); ++iword) {
     /* Write BL address code */
-    for (const auto& bl_unit : fabric_bits.bl_vector(wl_vec)) {
-      fp << bl_unit;
+    for (const auto& bl_unit : fabric_bits.bl_vector(iword)) {
+      fp << bl_unit.to_string();
     }
     /* Write WL address code */
-    for (const auto& wl_unit : wl_vec) {
-      fp << wl_unit;
+    for (const auto& wl_unit : fabric_bits.wl_vector(iword)) {
+      fp << wl_unit.to_string();
     }
     fp << std::endl;
   }
@@ -254,9 +251,8 @@ static int write_memory_bank_flatten_fabric_bitstream_to_text_file(
  *  - 1 if critical errors occured
  *******************************************************************/
 static int write_memory_bank_shift_register_fabric_bitstream_to_text_file(
-  std::fstream& fp, const bool& fast_configuration,
-  const bool& bit_value_to_skip, const FabricBitstream& fabric_bitstream,
-  const MemoryBankShiftRegisterBanks& blwl_sr_banks,
+  std::fstream& fp, const bool& bit_value_to_skip,
+  const FabricBitstreamProtocolView& fabric_bitstream_view,
   const bool& keep_dont_care_bits) {
   int status = 0;
 
@@ -264,10 +260,9 @@ static int write_memory_bank_shift_register_fabric_bitstream_to_text_file(
   if (keep_dont_care_bits) {
     dont_care_bit = DONT_CARE_CHAR;
   }
-  MemoryBankShiftRegisterFabricBitstream fabric_bits =
-    build_memory_bank_shift_register_fabric_bitstream(
-      fabric_bitstream, blwl_sr_banks, fast_configuration, bit_value_to_skip,
-      dont_care_bit);
+  const MemoryBankShiftRegisterFabricBitstream& fabric_bits =
+    fabric_bitstream_view.memory_bank_shift_register_bitstream(
+      bit_value_to_skip, dont_care_bit);
 
   /* Output information about how to intepret the bitstream */
   fp << "// Bitstream word count: " << fabric_bits.num_words() << std::endl;
@@ -288,14 +283,14 @@ static int write_memory_bank_shift_register_fabric_bitstream_to_text_file(
     /* Write BL address code */
     fp << "// BL part " << std::endl;
     for (const auto& bl_vec : fabric_bits.bl_vectors(word)) {
-      fp << bl_vec;
+      fp << bl_vec.to_string();
       fp << std::endl;
     }
 
     /* Write WL address code */
     fp << "// WL part " << std::endl;
     for (const auto& wl_vec : fabric_bits.wl_vectors(word)) {
-      fp << wl_vec;
+      fp << wl_vec.to_string();
       fp << std::endl;
     }
 
@@ -315,11 +310,12 @@ static int write_memory_bank_shift_register_fabric_bitstream_to_text_file(
  *******************************************************************/
 static int write_frame_based_fabric_bitstream_to_text_file(
   std::fstream& fp, const bool& fast_configuration,
-  const bool& bit_value_to_skip, const FabricBitstream& fabric_bitstream) {
+  const bool& bit_value_to_skip,
+  const FabricBitstreamProtocolView& fabric_bitstream_view) {
   int status = 0;
 
-  FrameFabricBitstream fabric_bits_by_addr =
-    build_frame_based_fabric_bitstream_by_address(fabric_bitstream);
+  const FrameFabricBitstream& fabric_bits_by_addr =
+    fabric_bitstream_view.frame_based_bitstream();
 
   /* The address sizes and data input sizes are the same across any element,
    * just get it from the 1st element to save runtime
@@ -332,8 +328,8 @@ static int write_frame_based_fabric_bitstream_to_text_file(
   if (true == fast_configuration) {
     num_bits_to_skip =
       fabric_bits_by_addr.size() -
-      find_frame_based_fast_configuration_fabric_bitstream_size(
-        fabric_bitstream, bit_value_to_skip);
+      fabric_bitstream_view.frame_based_fast_configuration_size(
+        bit_value_to_skip);
     VTR_ASSERT(num_bits_to_skip < fabric_bits_by_addr.size());
     VTR_LOG(
       "Fast configuration will skip %g% (%lu/%lu) of configuration "
@@ -388,12 +384,14 @@ static int write_frame_based_fabric_bitstream_to_text_file(
  *******************************************************************/
 int write_fabric_bitstream_to_text_file(
   const BitstreamManager& bitstream_manager,
-  const FabricBitstream& fabric_bitstream,
-  const MemoryBankShiftRegisterBanks& blwl_sr_banks,
+  const FabricBitstreamProtocolView& fabric_bitstream_view,
   const ConfigProtocol& config_protocol,
   const FabricGlobalPortInfo& global_ports, const std::string& fname,
   const bool& fast_configuration, const bool& keep_dont_care_bits,
   const bool& include_time_stamp, const bool& verbose) {
+  const FabricBitstream& fabric_bitstream =
+    fabric_bitstream_view.fabric_bitstream();
+
   /* Ensure that we have a valid file name */
   if (true == fname.empty()) {
     VTR_LOG_ERROR(
@@ -453,18 +451,16 @@ int write_fabric_bitstream_to_text_file(
        */
       if (BLWL_PROTOCOL_DECODER == config_protocol.bl_protocol_type()) {
         status = write_memory_bank_fabric_bitstream_to_text_file(
-          fp, apply_fast_configuration, bit_value_to_skip, fabric_bitstream);
+          fp, apply_fast_configuration, bit_value_to_skip,
+          fabric_bitstream_view);
       } else if (BLWL_PROTOCOL_FLATTEN == config_protocol.bl_protocol_type()) {
         status = write_memory_bank_flatten_fabric_bitstream_to_text_file(
-          fp, apply_fast_configuration, bit_value_to_skip, fabric_bitstream,
-          keep_dont_care_bits);
+          fp, bit_value_to_skip, fabric_bitstream_view, keep_dont_care_bits);
       } else {
         VTR_ASSERT(BLWL_PROTOCOL_SHIFT_REGISTER ==
                    config_protocol.bl_protocol_type());
         status = write_memory_bank_shift_register_fabric_bitstream_to_text_file(
-          fp, apply_fast_configuration, bit_value_to_skip,
-
-          fabric_bitstream, blwl_sr_banks, keep_dont_care_bits);
+          fp, bit_value_to_skip, fabric_bitstream_view, keep_dont_care_bits);
       }
       break;
     }
@@ -474,7 +470,8 @@ int write_fabric_bitstream_to_text_file(
       break;
     case CONFIG_MEM_FRAME_BASED:
       status = write_frame_based_fabric_bitstream_to_text_file(
-        fp, apply_fast_configuration, bit_value_to_skip, fabric_bitstream);
+        fp, apply_fast_configuration, bit_value_to_skip,
+        fabric_bitstream_view);
       break;
     default:
       VTR_LOGF_ERROR(__FILE__, __LINE__,
@@ -9,9 +9,8 @@
 
 #include "bitstream_manager.h"
 #include "config_protocol.h"
-#include "fabric_bitstream.h"
+#include "fabric_bitstream_protocol_view.h"
 #include "fabric_global_port_info.h"
-#include "memory_bank_shift_register_banks.h"
 
 /********************************************************************
  * Function declaration
@@ -22,8 +21,7 @@ namespace openfpga {
 
 int write_fabric_bitstream_to_text_file(
   const BitstreamManager& bitstream_manager,
-  const FabricBitstream& fabric_bitstream,
-  const MemoryBankShiftRegisterBanks& blwl_sr_banks,
+  const FabricBitstreamProtocolView& fabric_bitstream_view,
   const ConfigProtocol& config_protocol,
   const FabricGlobalPortInfo& global_ports, const std::string& fname,
   const bool& fast_configuration, const bool& keep_dont_care_bits,
@@ -2,8 +2,6 @@
  * This file includes functions that output a fabric-dependent
  * bitstream database to files in XML format
  *******************************************************************/
-#include <chrono>
-#include <ctime>
 #include <fstream>
 
 /* Headers from vtrutil library */
@@ -35,16 +33,63 @@ static void write_fabric_bitstream_xml_file_head(
   fp << "\t- Author: Xifan TANG" << std::endl;
   fp << "\t- Organization: University of Utah" << std::endl;
 
-  auto end = std::chrono::system_clock::now();
-  std::time_t end_time = std::chrono::system_clock::to_time_t(end);
   if (include_time_stamp) {
-    fp << "\t- Date: " << std::ctime(&end_time);
+    fp << "\t- Date: " << get_current_time_stamp();
   }
 
   fp << "-->" << std::endl;
   fp << std::endl;
 }
 
+/* Flush the output buffer to the file once it grows beyond this size */
+constexpr size_t XML_FABRIC_BITSTREAM_BUFFER_SIZE = 1 << 20;
+
+/********************************************************************
+ * A buffered sink for the XML writer, which also caches the hierarchical
+ * path of the latest parent block.
+ * Configuration bits under the same parent block are consecutive in
+ * most fabric bitstreams, so that the block hierarchy is only walked when
+ * the parent block changes.
+ *******************************************************************/
+struct XmlFabricBitstreamWriter {
+  std::string buffer;
+  ConfigBlockId cached_block;
+  std::string cached_block_path;
+};
+
+/********************************************************************
+ * Dump the content of the output buffer to the file stream
+ *******************************************************************/
+static void flush_xml_fabric_bitstream_buffer(
+  std::fstream& fp, XmlFabricBitstreamWriter& writer) {
+  fp.write(writer.buffer.data(), writer.buffer.size());
+  writer.buffer.clear();
+}
+
+/********************************************************************
+ * Find the hierarchical path of a block, i.e., <top>.<child>.<leaf>.
+ * The result is cached until a different block is requested
+ *******************************************************************/
+static const std::string& find_xml_fabric_bitstream_block_path(
+  const BitstreamManager& bitstream_manager, const ConfigBlockId& config_block,
+  XmlFabricBitstreamWriter& writer) {
+  if (config_block == writer.cached_block) {
+    return writer.cached_block_path;
+  }
+
+  std::vector<ConfigBlockId> block_hierarchy =
+    find_bitstream_manager_block_hierarchy(bitstream_manager, config_block);
+  writer.cached_block_path.clear();
+  for (const ConfigBlockId& temp_block : block_hierarchy) {
+    writer.cached_block_path += bitstream_manager.block_name(temp_block);
+    writer.cached_block_path += '.';
+  }
+  writer.cached_block_path += generate_configurable_memory_data_out_name();
+  writer.cached_block = config_block;
+
+  return writer.cached_block_path;
+}
+
 /********************************************************************
  * Write a configuration bit into a plain text file
  * General format
@@ -69,38 +114,31 @@ static void write_fabric_bitstream_xml_file_head(
  *  - 1 if critical errors occured
  *******************************************************************/
 static int write_fabric_config_bit_to_xml_file(
-  std::fstream& fp, const BitstreamManager& bitstream_manager,
+  std::fstream& fp, XmlFabricBitstreamWriter& writer,
+  const BitstreamManager& bitstream_manager,
   const FabricBitstream& fabric_bitstream, const FabricBitId& fabric_bit,
   const e_config_protocol_type& config_type, const int& xml_hierarchy_depth) {
-  if (false == valid_file_stream(fp)) {
-    return 1;
-  }
+  std::string& buffer = writer.buffer;
 
-  write_tab_to_file(fp, xml_hierarchy_depth);
-  fp << "<bit id=\"" << size_t(fabric_bit) << "\"";
-  fp << " value=\"";
-  fp << bitstream_manager.bit_value(fabric_bitstream.config_bit(fabric_bit));
-  fp << "\"";
+  const ConfigBitId& config_bit = fabric_bitstream.config_bit(fabric_bit);
+
+  buffer.append(xml_hierarchy_depth, '\t');
+  buffer += "<bit id=\"";
+  buffer += std::to_string(size_t(fabric_bit));
+  buffer += "\" value=\"";
+  buffer += bitstream_manager.bit_value(config_bit) ? '1' : '0';
+  buffer += '"';
 
   /* Output hierarchy of this parent*/
-  const ConfigBitId& config_bit = fabric_bitstream.config_bit(fabric_bit);
   const ConfigBlockId& config_block =
     bitstream_manager.bit_parent_block(config_bit);
-  std::vector<ConfigBlockId> block_hierarchy =
-    find_bitstream_manager_block_hierarchy(bitstream_manager, config_block);
-  std::string hie_path;
-  for (const ConfigBlockId& temp_block : block_hierarchy) {
-    hie_path += bitstream_manager.block_name(temp_block);
-    hie_path += std::string(".");
-  }
-  hie_path += generate_configurable_memory_data_out_name();
-  hie_path += std::string("[");
-  hie_path +=
-    std::to_string(find_bitstream_manager_config_bit_index_in_parent_block(
-      bitstream_manager, config_bit));
-  hie_path += std::string("]");
-
-  fp << " path=\"" << hie_path << "\">\n";
+  buffer += " path=\"";
+  buffer += find_xml_fabric_bitstream_block_path(bitstream_manager,
+                                                 config_block, writer);
+  buffer += '[';
+  buffer +=
+    std::to_string(bitstream_manager.bit_index_in_parent_block(config_bit));
+  buffer += "]\">\n";
 
   switch (config_type) {
     case CONFIG_MEM_STANDALONE:
@@ -109,28 +147,22 @@ static int write_fabric_config_bit_to_xml_file(
     case CONFIG_MEM_QL_MEMORY_BANK:
     case CONFIG_MEM_MEMORY_BANK: {
       /* Bit line address */
-      write_tab_to_file(fp, xml_hierarchy_depth + 1);
-      fp << "<bl address=\"";
-      for (const char& addr_bit : fabric_bitstream.bit_bl_address(fabric_bit)) {
-        fp << addr_bit;
-      }
-      fp << "\"/>\n";
-
-      write_tab_to_file(fp, xml_hierarchy_depth + 1);
-      fp << "<wl address=\"";
-      for (const char& addr_bit : fabric_bitstream.bit_wl_address(fabric_bit)) {
-        fp << addr_bit;
-      }
-      fp << "\"/>\n";
+      buffer.append(xml_hierarchy_depth + 1, '\t');
+      buffer += "<bl address=\"";
+      fabric_bitstream.append_bit_bl_address(fabric_bit, buffer);
+      buffer += "\"/>\n";
+
+      buffer.append(xml_hierarchy_depth + 1, '\t');
+      buffer += "<wl address=\"";
+      fabric_bitstream.append_bit_wl_address(fabric_bit, buffer);
+      buffer += "\"/>\n";
       break;
     }
     case CONFIG_MEM_FRAME_BASED: {
-      write_tab_to_file(fp, xml_hierarchy_depth + 1);
-      fp << "<frame address=\"";
-      for (const char& addr_bit : fabric_bitstream.bit_address(fabric_bit)) {
-        fp << addr_bit;
-      }
-      fp << "\"/>\n";
+      buffer.append(xml_hierarchy_depth + 1, '\t');
+      buffer += "<frame address=\"";
+      fabric_bitstream.append_bit_address(fabric_bit, buffer);
+      buffer += "\"/>\n";
       break;
     }
     default:
@@ -139,8 +171,15 @@ static int write_fabric_config_bit_to_xml_file(
       return 1;
   }
 
-  write_tab_to_file(fp, xml_hierarchy_depth);
-  fp << "</bit>\n";
+  buffer.append(xml_hierarchy_depth, '\t');
+  buffer += "</bit>\n";
+
+  if (XML_FABRIC_BITSTREAM_BUFFER_SIZE <= buffer.size()) {
+    flush_xml_fabric_bitstream_buffer(fp, writer);
+    if (false == valid_file_stream(fp)) {
+      return 1;
+    }
+  }
 
   return 0;
 }
@@ -153,7 +192,8 @@ static int write_fabric_config_bit_to_xml_file(
  *  - 1 if critical errors occured
  *******************************************************************/
 static int write_fabric_regional_config_bit_to_xml_file(
-  std::fstream& fp, const BitstreamManager& bitstream_manager,
+  std::fstream& fp, XmlFabricBitstreamWriter& writer,
+  const BitstreamManager& bitstream_manager,
   const FabricBitstream& fabric_bitstream,
   const FabricBitRegionId& fabric_region,
   const e_config_protocol_type& config_type, const int& xml_hierarchy_depth) {
@@ -163,25 +203,23 @@ static int write_fabric_regional_config_bit_to_xml_file(
 
   int status = 0;
 
-  write_tab_to_file(fp, xml_hierarchy_depth);
-  fp << "<region ";
-  fp << "id=\"";
-  fp << size_t(fabric_region);
-  fp << "\"";
-  fp << ">\n";
+  writer.buffer.append(xml_hierarchy_depth, '\t');
+  writer.buffer += "<region id=\"";
+  writer.buffer += std::to_string(size_t(fabric_region));
+  writer.buffer += "\">\n";
 
   for (const FabricBitId& fabric_bit :
        fabric_bitstream.region_bits(fabric_region)) {
     status = write_fabric_config_bit_to_xml_file(
-      fp, bitstream_manager, fabric_bitstream, fabric_bit, config_type,
+      fp, writer, bitstream_manager, fabric_bitstream, fabric_bit, config_type,
       xml_hierarchy_depth + 1);
     if (1 == status) {
       return status;
     }
   }
 
-  write_tab_to_file(fp, xml_hierarchy_depth);
-  fp << "</region>\n";
+  writer.buffer.append(xml_hierarchy_depth, '\t');
+  writer.buffer += "</region>\n";
 
   return status;
 }
@@ -228,14 +266,18 @@ int write_fabric_bitstream_to_xml_file(
 
   /* Output fabric bitstream to the file */
   int status = 0;
+  XmlFabricBitstreamWriter writer;
+  writer.buffer.reserve(XML_FABRIC_BITSTREAM_BUFFER_SIZE +
+                        XML_FABRIC_BITSTREAM_BUFFER_SIZE / 4);
   for (const FabricBitRegionId& region : fabric_bitstream.regions()) {
     status = write_fabric_regional_config_bit_to_xml_file(
-      fp, bitstream_manager, fabric_bitstream, region, config_protocol.type(),
-      xml_hierarchy_depth + 1);
+      fp, writer, bitstream_manager, fabric_bitstream, region,
+      config_protocol.type(), xml_hierarchy_depth + 1);
     if (1 == status) {
       break;
     }
   }
+  flush_xml_fabric_bitstream_buffer(fp, writer);
 
   /* Print an end to the file here */
   fp << "</fabric_bitstream>\n";
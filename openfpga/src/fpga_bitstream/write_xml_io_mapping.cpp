@@ -2,8 +2,6 @@
  * This file includes functions that output io mapping information
  * to files in XML format
  *******************************************************************/
-#include <chrono>
-#include <ctime>
 #include <fstream>
 
 /* Headers from vtrutil library */
@@ -34,11 +32,9 @@ static void write_io_mapping_xml_file_head(std::fstream& fp,
   fp << "\t- I/O mapping" << std::endl;
 
   if (include_time_stamp) {
-    auto end = std::chrono::system_clock::now();
-    std::time_t end_time = std::chrono::system_clock::to_time_t(end);
     /* Note that version is also a type of time stamp */
     fp << "\t- Version: " << openfpga::VERSION << std::endl;
-    fp << "\t- Date: " << std::ctime(&end_time);
+    fp << "\t- Date: " << get_current_time_stamp();
   }
 
   fp << "-->" << std::endl;
@@ -0,0 +1,174 @@
+/********************************************************************
+ * Member functions for the writer of set_disable_timing commands
+ * in analysis SDC files
+ *******************************************************************/
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+
+/* Headers from vtrutil library */
+#include "vtr_assert.h"
+
+/* Headers from openfpgautil library */
+#include "analysis_sdc_disable_timing_writer.h"
+#include "openfpga_parallel.h"
+#include "sdc_writer_utils.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/* Number of chunks per thread to be buffered at a time */
+constexpr size_t ANALYSIS_SDC_CHUNK_BATCH_SIZE = 16;
+
+/********************************************************************
+ * Public Constructors
+ ********************************************************************/
+AnalysisSdcDisableTimingWriter::AnalysisSdcDisableTimingWriter(
+  std::ostream& fp, const bool& compress)
+  : fp_(fp), compress_(compress) {}
+
+/********************************************************************
+ * Public accessors
+ ********************************************************************/
+bool AnalysisSdcDisableTimingWriter::compress() const { return compress_; }
+
+std::ostream& AnalysisSdcDisableTimingWriter::stream() {
+  flush();
+  return fp_;
+}
+
+/********************************************************************
+ * Public mutators
+ ********************************************************************/
+void AnalysisSdcDisableTimingWriter::disable_port(const std::string& hierarchy,
+                                                  const BasicPort& port) {
+  if (false == compress_) {
+    print_constraint(hierarchy + generate_sdc_port(port));
+    return;
+  }
+
+  auto result = pending_pins_[hierarchy].emplace(port.get_name(),
+                                                 std::set<size_t>());
+  if (true == result.second) {
+    if (1 == pending_pins_[hierarchy].size()) {
+      pending_hierarchies_.push_back(hierarchy);
+    }
+    pending_ports_[hierarchy].push_back(port.get_name());
+  }
+  for (const size_t& pin : port.pins()) {
+    result.first->second.insert(pin);
+  }
+}
+
+void AnalysisSdcDisableTimingWriter::disable_all(const std::string& hierarchy) {
+  std::string object = hierarchy + std::string("*");
+  if (false == compress_) {
+    print_constraint(object);
+    return;
+  }
+
+  flush();
+  /* Wildcards are only deduplicated under the current hierarchy */
+  if ((true == wildcard_hierarchy_.empty()) ||
+      (0 != hierarchy.compare(0, wildcard_hierarchy_.size(),
+                              wildcard_hierarchy_))) {
+    wildcard_hierarchy_ = hierarchy;
+    written_wildcards_.clear();
+  }
+  /* The same hierarchy may be reached through different wildcards */
+  if (true == written_wildcards_.insert(object).second) {
+    print_constraint(object);
+  }
+}
+
+/********************************************************************
+ * Output the pending constraints: the pins of each port are merged
+ * into ranges, and all the ports of an instance are grouped into
+ * a single command
+ *******************************************************************/
+void AnalysisSdcDisableTimingWriter::flush() {
+  if (true == pending_hierarchies_.empty()) {
+    return;
+  }
+
+  for (const std::string& hierarchy : pending_hierarchies_) {
+    std::vector<std::string> objects;
+    for (const std::string& port_name : pending_ports_.at(hierarchy)) {
+      const std::set<size_t>& pins = pending_pins_.at(hierarchy).at(port_name);
+      VTR_ASSERT(!pins.empty());
+      /* Merge contiguous pins into ranges */
+      auto range_begin = pins.begin();
+      for (auto it = pins.begin(); it != pins.end(); ++it) {
+        auto next = std::next(it);
+        if ((next != pins.end()) && (*next == *it + 1)) {
+          continue;
+        }
+        /* Repeated pins have been merged in the pending set already */
+        objects.push_back(
+          hierarchy +
+          generate_sdc_port(BasicPort(port_name, *range_begin, *it)));
+        range_begin = next;
+      }
+    }
+
+    if (1 == objects.size()) {
+      print_constraint(objects[0]);
+    } else if (1 < objects.size()) {
+      std::string collection;
+      for (const std::string& object : objects) {
+        if (!collection.empty()) {
+          collection += " ";
+        }
+        collection += object;
+      }
+      print_constraint("{" + collection + "}");
+    }
+  }
+
+  pending_hierarchies_.clear();
+  pending_ports_.clear();
+  pending_pins_.clear();
+}
+
+/********************************************************************
+ * Chunks are printed in batches, so that only the outputs of a batch
+ * are buffered at a time
+ *******************************************************************/
+void AnalysisSdcDisableTimingWriter::print_chunks(
+  const size_t& num_chunks, const size_t& num_threads,
+  const std::function<void(AnalysisSdcDisableTimingWriter&, const size_t&)>&
+    print_chunk) {
+  flush();
+
+  size_t batch_size =
+    ANALYSIS_SDC_CHUNK_BATCH_SIZE * find_num_threads(num_threads, num_chunks);
+  std::vector<std::stringstream> buffers;
+  for (size_t batch_begin = 0; batch_begin < num_chunks;
+       batch_begin += batch_size) {
+    size_t batch_end = std::min(batch_begin + batch_size, num_chunks);
+    buffers.clear();
+    buffers.resize(batch_end - batch_begin);
+
+    parallel_for(buffers.size(), num_threads, [&](const size_t& ijob) {
+      AnalysisSdcDisableTimingWriter chunk_writer(buffers[ijob], compress_);
+      print_chunk(chunk_writer, batch_begin + ijob);
+      chunk_writer.flush();
+    });
+
+    for (const std::stringstream& buffer : buffers) {
+      fp_ << buffer.str();
+    }
+  }
+}
+
+/********************************************************************
+ * Internal utility
+ *******************************************************************/
+void AnalysisSdcDisableTimingWriter::print_constraint(
+  const std::string& object) {
+  fp_ << "set_disable_timing ";
+  fp_ << object;
+  fp_ << std::endl;
+}
+
+} /* end namespace openfpga */
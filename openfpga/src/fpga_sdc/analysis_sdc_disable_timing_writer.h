@@ -0,0 +1,81 @@
+#ifndef ANALYSIS_SDC_DISABLE_TIMING_WRITER_H
+#define ANALYSIS_SDC_DISABLE_TIMING_WRITER_H
+
+/********************************************************************
+ * A writer for the set_disable_timing commands of analysis SDC files
+ *
+ * Without compression, each constraint is written to the file stream
+ * as soon as it is requested, which is the legacy output format.
+ *
+ * With compression, constraints are buffered until the stream is
+ * requested for other outputs (e.g., comments) or until flush() is
+ * called. Then
+ * - repeated constraints of the pending hierarchies are dropped
+ * - contiguous pins of a port are merged into a ranged port,
+ *   e.g., chanx_left_in[0:7]
+ * - the ports of the same instance are merged into one collection,
+ *   e.g., set_disable_timing {cbx_1__0_/chanx_left_in[0:7] ...}
+ *******************************************************************/
+#include <functional>
+#include <map>
+#include <ostream>
+#include <set>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "openfpga_port.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+class AnalysisSdcDisableTimingWriter {
+ public: /* Public Constructors */
+  AnalysisSdcDisableTimingWriter(std::ostream& fp, const bool& compress);
+
+ public: /* Public accessors */
+  bool compress() const;
+  /* Write all the pending constraints and return the file stream
+   * so that callers can output comments in the right order */
+  std::ostream& stream();
+
+ public: /* Public mutators */
+  /* Disable the timing of a port under a hierarchy,
+   * the hierarchy should end with a separator, e.g., 'grid_clb_1__1_/' */
+  void disable_port(const std::string& hierarchy, const BasicPort& port);
+  /* Disable the timing of everything under a hierarchy */
+  void disable_all(const std::string& hierarchy);
+  /* Write all the pending constraints */
+  void flush();
+  /* Print independent chunks (e.g., one per tile) on multiple threads.
+   * Each chunk is printed by its own writer into a buffer, and the buffers
+   * are written to the stream in the order of chunks */
+  void print_chunks(
+    const size_t& num_chunks, const size_t& num_threads,
+    const std::function<void(AnalysisSdcDisableTimingWriter&, const size_t&)>&
+      print_chunk);
+
+ private: /* Internal utility */
+  void print_constraint(const std::string& object);
+
+ private: /* Internal data */
+  std::ostream& fp_;
+  bool compress_;
+
+  /* Pending pins per port per hierarchy, in the order of request */
+  std::vector<std::string> pending_hierarchies_;
+  std::map<std::string, std::vector<std::string>> pending_ports_;
+  std::map<std::string, std::map<std::string, std::set<size_t>>>
+    pending_pins_;
+
+  /* Wildcards written under the hierarchy currently covered by
+   * disable_all(), e.g., an unused programmable block. They are dropped
+   * when another hierarchy is reached, so that only the wildcards of one
+   * block are kept at a time */
+  std::string wildcard_hierarchy_;
+  std::unordered_set<std::string> written_wildcards_;
+};
+
+} /* end namespace openfpga */
+
+#endif
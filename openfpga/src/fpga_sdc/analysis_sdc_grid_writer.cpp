@@ -3,12 +3,12 @@
  * to disable unused ports of grids, such as Configurable Logic Block
  * (CLBs), heterogeneous blocks, etc.
  *******************************************************************/
+#include <utility>
+#include <vector>
+
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
 
-/* Headers from openfpgautil library */
-#include "openfpga_digest.h"
-
 /* Headers from vprutil library */
 #include "analysis_sdc_grid_writer.h"
 #include "analysis_sdc_writer_utils.h"
@@ -16,7 +16,6 @@
 #include "openfpga_naming.h"
 #include "openfpga_reserved_words.h"
 #include "pb_type_utils.h"
-#include "sdc_writer_utils.h"
 #include "vpr_utils.h"
 
 /* begin namespace openfpga */
@@ -31,27 +30,23 @@ namespace openfpga {
  * combinatinal path inside an unused grid, when finding critical paths!!!
  *******************************************************************/
 static void rec_print_analysis_sdc_disable_unused_pb_graph_nodes(
-  std::fstream& fp, const VprDeviceAnnotation& device_annotation,
+  AnalysisSdcDisableTimingWriter& sdc_writer,
+  const VprDeviceAnnotation& device_annotation,
   const ModuleManager& module_manager, const ModuleId& parent_module,
   const std::string& hierarchy_name, t_pb_graph_node* physical_pb_graph_node) {
   t_pb_type* physical_pb_type = physical_pb_graph_node->pb_type;
 
-  /* Validate file stream */
-  valid_file_stream(fp);
-
   /* Disable all the ports of current module (parent_module)!
    * Hierarchy name already includes the instance name of parent_module
    */
+  std::ostream& fp = sdc_writer.stream();
   fp << "#######################################" << std::endl;
   fp << "# Disable all the ports for pb_graph_node "
      << physical_pb_graph_node->pb_type->name << "["
      << physical_pb_graph_node->placement_index << "]" << std::endl;
   fp << "#######################################" << std::endl;
 
-  fp << "set_disable_timing ";
-  fp << hierarchy_name;
-  fp << "*";
-  fp << std::endl;
+  sdc_writer.disable_all(hierarchy_name);
 
   /* Return if this is the primitive pb_type */
   if (true == is_primitive_pb_type(physical_pb_type)) {
@@ -71,6 +66,19 @@ static void rec_print_analysis_sdc_disable_unused_pb_graph_nodes(
     ModuleId child_module = module_manager.find_module(child_module_name);
     VTR_ASSERT(true == module_manager.valid_module_id(child_module));
 
+    /* All the instances of a child are unused as well as their parent.
+     * When compression is enabled, cover them with a wildcard
+     * rather than visiting each of them
+     */
+    if (true == sdc_writer.compress()) {
+      rec_print_analysis_sdc_disable_unused_pb_graph_nodes(
+        sdc_writer, device_annotation, module_manager, child_module,
+        hierarchy_name + std::string("*/"),
+        &(physical_pb_graph_node
+            ->child_pb_graph_nodes[physical_mode->index][ichild][0]));
+      continue;
+    }
+
     /* Each child may exist multiple times in the hierarchy*/
     for (int inst = 0; inst < physical_mode->pb_type_children[ichild].num_pb;
          ++inst) {
@@ -85,7 +93,7 @@ static void rec_print_analysis_sdc_disable_unused_pb_graph_nodes(
         hierarchy_name + child_instance_name + std::string("/");
 
       rec_print_analysis_sdc_disable_unused_pb_graph_nodes(
-        fp, device_annotation, module_manager, child_module,
+        sdc_writer, device_annotation, module_manager, child_module,
         updated_hierarchy_name,
         &(physical_pb_graph_node
             ->child_pb_graph_nodes[physical_mode->index][ichild][inst]));
@@ -97,13 +105,10 @@ static void rec_print_analysis_sdc_disable_unused_pb_graph_nodes(
  * Disable an unused pin of a pb_graph_node (parent_module)
  *******************************************************************/
 static void disable_pb_graph_node_unused_pin(
-  std::fstream& fp, const ModuleManager& module_manager,
-  const ModuleId& parent_module, const std::string& hierarchy_name,
-  const t_pb_graph_pin* pb_graph_pin, const PhysicalPb& physical_pb,
-  const PhysicalPbId& pb_id) {
-  /* Validate file stream */
-  valid_file_stream(fp);
-
+  AnalysisSdcDisableTimingWriter& sdc_writer,
+  const ModuleManager& module_manager, const ModuleId& parent_module,
+  const std::string& hierarchy_name, const t_pb_graph_pin* pb_graph_pin,
+  const PhysicalPb& physical_pb, const PhysicalPbId& pb_id) {
   /* Identify if the pb_graph_pin has been used or not
    * TODO: identify if this is a parasitic net
    */
@@ -125,10 +130,7 @@ static void disable_pb_graph_node_unused_pin(
     module_manager.module_port(parent_module, module_port);
   port_to_disable.set_width(pb_graph_pin->pin_number, pb_graph_pin->pin_number);
 
-  fp << "set_disable_timing ";
-  fp << hierarchy_name;
-  fp << generate_sdc_port(port_to_disable);
-  fp << std::endl;
+  sdc_writer.disable_port(hierarchy_name, port_to_disable);
 }
 
 /********************************************************************
@@ -139,12 +141,14 @@ static void disable_pb_graph_node_unused_pin(
  *disable them
  *******************************************************************/
 static void disable_pb_graph_node_unused_pins(
-  std::fstream& fp, const ModuleManager& module_manager,
-  const ModuleId& parent_module, const std::string& hierarchy_name,
-  t_pb_graph_node* physical_pb_graph_node, const PhysicalPb& physical_pb) {
+  AnalysisSdcDisableTimingWriter& sdc_writer,
+  const ModuleManager& module_manager, const ModuleId& parent_module,
+  const std::string& hierarchy_name, t_pb_graph_node* physical_pb_graph_node,
+  const PhysicalPb& physical_pb) {
   const PhysicalPbId& pb_id = physical_pb.find_pb(physical_pb_graph_node);
   VTR_ASSERT(true == physical_pb.valid_pb_id(pb_id));
 
+  std::ostream& fp = sdc_writer.stream();
   fp << "#######################################" << std::endl;
   fp << "# Disable unused pins for pb_graph_node "
      << physical_pb_graph_node->pb_type->name << "["
@@ -157,7 +161,7 @@ static void disable_pb_graph_node_unused_pins(
     for (int ipin = 0; ipin < physical_pb_graph_node->num_input_pins[iport];
          ++ipin) {
       disable_pb_graph_node_unused_pin(
-        fp, module_manager, parent_module, hierarchy_name,
+        sdc_writer, module_manager, parent_module, hierarchy_name,
         &(physical_pb_graph_node->input_pins[iport][ipin]), physical_pb, pb_id);
     }
   }
@@ -168,7 +172,7 @@ static void disable_pb_graph_node_unused_pins(
     for (int ipin = 0; ipin < physical_pb_graph_node->num_output_pins[iport];
          ++ipin) {
       disable_pb_graph_node_unused_pin(
-        fp, module_manager, parent_module, hierarchy_name,
+        sdc_writer, module_manager, parent_module, hierarchy_name,
         &(physical_pb_graph_node->output_pins[iport][ipin]), physical_pb,
         pb_id);
     }
@@ -180,7 +184,7 @@ static void disable_pb_graph_node_unused_pins(
     for (int ipin = 0; ipin < physical_pb_graph_node->num_clock_pins[iport];
          ++ipin) {
       disable_pb_graph_node_unused_pin(
-        fp, module_manager, parent_module, hierarchy_name,
+        sdc_writer, module_manager, parent_module, hierarchy_name,
         &(physical_pb_graph_node->clock_pins[iport][ipin]), physical_pb, pb_id);
     }
   }
@@ -192,10 +196,12 @@ static void disable_pb_graph_node_unused_pins(
  * and store the results in a mux_name-to-net mapping
  *******************************************************************/
 static void disable_pb_graph_node_unused_mux_inputs(
-  std::fstream& fp, const VprDeviceAnnotation& device_annotation,
+  AnalysisSdcDisableTimingWriter& sdc_writer,
+  const VprDeviceAnnotation& device_annotation,
   const ModuleManager& module_manager, const ModuleId& parent_module,
   const std::string& hierarchy_name, t_pb_graph_node* physical_pb_graph_node,
   const PhysicalPb& physical_pb) {
+  std::ostream& fp = sdc_writer.stream();
   fp << "#######################################" << std::endl;
   fp << "# Disable unused mux_inputs for pb_graph_node "
      << physical_pb_graph_node->pb_type->name << "["
@@ -301,8 +307,8 @@ static void disable_pb_graph_node_unused_mux_inputs(
       }
 
       disable_analysis_module_input_pin_net_sinks(
-        fp, module_manager, parent_module, hierarchy_name, module_port, ipin,
-        mapped_net, mux_instance_to_net_map);
+        sdc_writer, module_manager, parent_module, hierarchy_name, module_port,
+        ipin, mapped_net, mux_instance_to_net_map);
     }
   }
 
@@ -335,8 +341,8 @@ static void disable_pb_graph_node_unused_mux_inputs(
       }
 
       disable_analysis_module_input_pin_net_sinks(
-        fp, module_manager, parent_module, hierarchy_name, module_port, ipin,
-        mapped_net, mux_instance_to_net_map);
+        sdc_writer, module_manager, parent_module, hierarchy_name, module_port,
+        ipin, mapped_net, mux_instance_to_net_map);
     }
   }
 
@@ -380,8 +386,9 @@ static void disable_pb_graph_node_unused_mux_inputs(
           }
 
           disable_analysis_module_output_pin_net_sinks(
-            fp, module_manager, parent_module, hierarchy_name, child_module,
-            inst, module_port, ipin, mapped_net, mux_instance_to_net_map);
+            sdc_writer, module_manager, parent_module, hierarchy_name,
+            child_module, inst, module_port, ipin, mapped_net,
+            mux_instance_to_net_map);
         }
       }
     }
@@ -445,7 +452,8 @@ static void disable_pb_graph_node_unused_mux_inputs(
  * combinatinal path inside an unused grid, when finding critical paths!!!
  *******************************************************************/
 static void rec_print_analysis_sdc_disable_pb_graph_node_unused_resources(
-  std::fstream& fp, const VprDeviceAnnotation& device_annotation,
+  AnalysisSdcDisableTimingWriter& sdc_writer,
+  const VprDeviceAnnotation& device_annotation,
   const ModuleManager& module_manager, const ModuleId& parent_module,
   const std::string& hierarchy_name, t_pb_graph_node* physical_pb_graph_node,
   const PhysicalPb& physical_pb) {
@@ -453,7 +461,7 @@ static void rec_print_analysis_sdc_disable_pb_graph_node_unused_resources(
 
   /* Disable unused input ports and output ports of this pb_graph_node
    * (parent_module) */
-  disable_pb_graph_node_unused_pins(fp, module_manager, parent_module,
+  disable_pb_graph_node_unused_pins(sdc_writer, module_manager, parent_module,
                                     hierarchy_name, physical_pb_graph_node,
                                     physical_pb);
 
@@ -467,9 +475,9 @@ static void rec_print_analysis_sdc_disable_pb_graph_node_unused_resources(
   }
 
   /* Disable unused inputs of routing multiplexers of this pb_graph_node */
-  disable_pb_graph_node_unused_mux_inputs(fp, device_annotation, module_manager,
-                                          parent_module, hierarchy_name,
-                                          physical_pb_graph_node, physical_pb);
+  disable_pb_graph_node_unused_mux_inputs(
+    sdc_writer, device_annotation, module_manager, parent_module,
+    hierarchy_name, physical_pb_graph_node, physical_pb);
 
   t_mode* physical_mode = device_annotation.physical_mode(physical_pb_type);
 
@@ -499,7 +507,7 @@ static void rec_print_analysis_sdc_disable_pb_graph_node_unused_resources(
         hierarchy_name + child_instance_name + std::string("/");
 
       rec_print_analysis_sdc_disable_pb_graph_node_unused_resources(
-        fp, device_annotation, module_manager, child_module,
+        sdc_writer, device_annotation, module_manager, child_module,
         updated_hierarchy_name,
         &(physical_pb_graph_node
             ->child_pb_graph_nodes[physical_mode->index][ichild][inst]),
@@ -526,8 +534,8 @@ static void rec_print_analysis_sdc_disable_pb_graph_node_unused_resources(
  * Just walk through each pb_type and disable all the ports using wildcards
  *******************************************************************/
 static void print_analysis_sdc_disable_pb_block_unused_resources(
-  std::fstream& fp, t_physical_tile_type_ptr grid_type,
-  const vtr::Point<size_t>& grid_coordinate,
+  AnalysisSdcDisableTimingWriter& sdc_writer,
+  t_physical_tile_type_ptr grid_type, const vtr::Point<size_t>& grid_coordinate,
   const VprDeviceAnnotation& device_annotation,
   const ModuleManager& module_manager, const std::string& grid_instance_name,
   const size_t& grid_z, const PhysicalPb& physical_pb,
@@ -558,6 +566,7 @@ static void print_analysis_sdc_disable_pb_block_unused_resources(
   VTR_ASSERT(true == module_manager.valid_module_id(pb_module));
 
   /* Print comments */
+  std::ostream& fp = sdc_writer.stream();
   fp << "#######################################" << std::endl;
 
   if (true == unused_block) {
@@ -579,12 +588,12 @@ static void print_analysis_sdc_disable_pb_block_unused_resources(
    * level by level */
   if (true == unused_block) {
     rec_print_analysis_sdc_disable_unused_pb_graph_nodes(
-      fp, device_annotation, module_manager, pb_module, hierarchy_name,
+      sdc_writer, device_annotation, module_manager, pb_module, hierarchy_name,
       pb_graph_head);
   } else {
     VTR_ASSERT_SAFE(false == unused_block);
     rec_print_analysis_sdc_disable_pb_graph_node_unused_resources(
-      fp, device_annotation, module_manager, pb_module, hierarchy_name,
+      sdc_writer, device_annotation, module_manager, pb_module, hierarchy_name,
       pb_graph_head, physical_pb);
   }
 }
@@ -595,14 +604,12 @@ static void print_analysis_sdc_disable_pb_block_unused_resources(
  * Just walk through each pb_type and disable all the ports using wildcards
  *******************************************************************/
 static void print_analysis_sdc_disable_unused_grid(
-  std::fstream& fp, const vtr::Point<size_t>& grid_coordinate,
-  const DeviceGrid& grids, const VprDeviceAnnotation& device_annotation,
+  AnalysisSdcDisableTimingWriter& sdc_writer,
+  const vtr::Point<size_t>& grid_coordinate, const DeviceGrid& grids,
+  const VprDeviceAnnotation& device_annotation,
   const VprClusteringAnnotation& cluster_annotation,
   const VprPlacementAnnotation& place_annotation,
   const ModuleManager& module_manager, const e_side& border_side) {
-  /* Validate file stream */
-  valid_file_stream(fp);
-
   t_physical_tile_type_ptr grid_type =
     grids[grid_coordinate.x()][grid_coordinate.y()].type;
   /* Bypass conditions for grids :
@@ -632,6 +639,7 @@ static void print_analysis_sdc_disable_unused_grid(
   VTR_ASSERT(true == module_manager.valid_module_id(grid_module));
 
   /* Print comments */
+  std::ostream& fp = sdc_writer.stream();
   fp << "#######################################" << std::endl;
   fp << "# Disable Timing for grid[" << grid_coordinate.x() << "]["
      << grid_coordinate.y() << "]" << std::endl;
@@ -647,14 +655,14 @@ static void print_analysis_sdc_disable_unused_grid(
     if (ClusterBlockId::INVALID() != blk_id) {
       const PhysicalPb& physical_pb = cluster_annotation.physical_pb(blk_id);
       print_analysis_sdc_disable_pb_block_unused_resources(
-        fp, grid_type, grid_coordinate, device_annotation, module_manager,
-        grid_instance_name, grid_z, physical_pb, false);
+        sdc_writer, grid_type, grid_coordinate, device_annotation,
+        module_manager, grid_instance_name, grid_z, physical_pb, false);
     } else {
       VTR_ASSERT(ClusterBlockId::INVALID() == blk_id);
       /* For unused grid, disable all the pins in the physical_pb_type */
       print_analysis_sdc_disable_pb_block_unused_resources(
-        fp, grid_type, grid_coordinate, device_annotation, module_manager,
-        grid_instance_name, grid_z, PhysicalPb(), true);
+        sdc_writer, grid_type, grid_coordinate, device_annotation,
+        module_manager, grid_instance_name, grid_z, PhysicalPb(), true);
     }
     grid_z++;
   }
@@ -683,17 +691,19 @@ static void print_analysis_sdc_disable_unused_grid(
  *
  *******************************************************************/
 void print_analysis_sdc_disable_unused_grids(
-  std::fstream& fp, const DeviceGrid& grids,
+  AnalysisSdcDisableTimingWriter& sdc_writer, const DeviceGrid& grids,
   const VprDeviceAnnotation& device_annotation,
   const VprClusteringAnnotation& cluster_annotation,
   const VprPlacementAnnotation& place_annotation,
-  const ModuleManager& module_manager) {
+  const ModuleManager& module_manager, const size_t& num_threads) {
+  /* Collect the grids and the border sides where they locate */
+  std::vector<std::pair<vtr::Point<size_t>, e_side>> grid_coordinates;
+
   /* Process unused core grids */
   for (size_t ix = 1; ix < grids.width() - 1; ++ix) {
     for (size_t iy = 1; iy < grids.height() - 1; ++iy) {
-      print_analysis_sdc_disable_unused_grid(
-        fp, vtr::Point<size_t>(ix, iy), grids, device_annotation,
-        cluster_annotation, place_annotation, module_manager, NUM_SIDES);
+      grid_coordinates.push_back(
+        std::make_pair(vtr::Point<size_t>(ix, iy), NUM_SIDES));
     }
   }
 
@@ -705,11 +715,19 @@ void print_analysis_sdc_disable_unused_grids(
   /* Add instances of I/O grids to top_module */
   for (const e_side& io_side : FPGA_SIDES_CLOCKWISE) {
     for (const vtr::Point<size_t>& io_coordinate : io_coordinates[io_side]) {
-      print_analysis_sdc_disable_unused_grid(
-        fp, io_coordinate, grids, device_annotation, cluster_annotation,
-        place_annotation, module_manager, io_side);
+      grid_coordinates.push_back(std::make_pair(io_coordinate, io_side));
     }
   }
+
+  /* Grids are independent, so they can be printed concurrently */
+  sdc_writer.print_chunks(
+    grid_coordinates.size(), num_threads,
+    [&](AnalysisSdcDisableTimingWriter& chunk_writer, const size_t& igrid) {
+      print_analysis_sdc_disable_unused_grid(
+        chunk_writer, grid_coordinates[igrid].first, grids, device_annotation,
+        cluster_annotation, place_annotation, module_manager,
+        grid_coordinates[igrid].second);
+    });
 }
 
 } /* end namespace openfpga */
@@ -4,9 +4,9 @@
 /********************************************************************
  * Include header files that are required by function declaration
  *******************************************************************/
-#include <fstream>
 #include <vector>
 
+#include "analysis_sdc_disable_timing_writer.h"
 #include "device_grid.h"
 #include "module_manager.h"
 #include "vpr_clustering_annotation.h"
@@ -21,11 +21,11 @@
 namespace openfpga {
 
 void print_analysis_sdc_disable_unused_grids(
-  std::fstream& fp, const DeviceGrid& grids,
+  AnalysisSdcDisableTimingWriter& sdc_writer, const DeviceGrid& grids,
   const VprDeviceAnnotation& device_annotation,
   const VprClusteringAnnotation& cluster_annotation,
   const VprPlacementAnnotation& place_annotation,
-  const ModuleManager& module_manager);
+  const ModuleManager& module_manager, const size_t& num_threads);
 
 } /* end namespace openfpga */
 
@@ -16,6 +16,8 @@ AnalysisSdcOption::AnalysisSdcOption(const std::string& sdc_dir) {
   time_unit_ = 1.;
   time_stamp_ = true;
   generate_sdc_analysis_ = false;
+  compress_disable_timing_ = false;
+  num_jobs_ = 1;
 }
 
 /********************************************************************
@@ -33,6 +35,12 @@ bool AnalysisSdcOption::generate_sdc_analysis() const {
   return generate_sdc_analysis_;
 }
 
+bool AnalysisSdcOption::compress_disable_timing() const {
+  return compress_disable_timing_;
+}
+
+size_t AnalysisSdcOption::num_jobs() const { return num_jobs_; }
+
 /********************************************************************
  * Public mutators
  ********************************************************************/
@@ -57,4 +65,13 @@ void AnalysisSdcOption::set_generate_sdc_analysis(
   generate_sdc_analysis_ = generate_sdc_analysis;
 }
 
+void AnalysisSdcOption::set_compress_disable_timing(
+  const bool& compress_disable_timing) {
+  compress_disable_timing_ = compress_disable_timing;
+}
+
+void AnalysisSdcOption::set_num_jobs(const size_t& num_jobs) {
+  num_jobs_ = num_jobs;
+}
+
 } /* end namespace openfpga */
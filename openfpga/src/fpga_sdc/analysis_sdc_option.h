@@ -6,6 +6,7 @@
  * in purpose of analyzing users' implementations
  ********************************************************************/
 
+#include <cstddef>
 #include <string>
 
 /* begin namespace openfpga */
@@ -21,6 +22,8 @@ class AnalysisSdcOption {
   float time_unit() const;
   bool generate_sdc_analysis() const;
   bool time_stamp() const;
+  bool compress_disable_timing() const;
+  size_t num_jobs() const;
 
  public: /* Public mutators */
   void set_sdc_dir(const std::string& sdc_dir);
@@ -28,6 +31,8 @@ class AnalysisSdcOption {
   void set_time_stamp(const bool& time_stamp);
   void set_time_unit(const float& time_unit);
   void set_generate_sdc_analysis(const bool& generate_sdc_analysis);
+  void set_compress_disable_timing(const bool& compress_disable_timing);
+  void set_num_jobs(const size_t& num_jobs);
 
  private: /* Internal data */
   std::string sdc_dir_;
@@ -35,6 +40,10 @@ class AnalysisSdcOption {
   bool flatten_names_;
   float time_unit_;
   bool time_stamp_;
+  /* Merge the set_disable_timing commands into ranges and collections */
+  bool compress_disable_timing_;
+  /* Number of threads, where 0 means all the hardware threads */
+  size_t num_jobs_;
 };
 
 } /* end namespace openfpga */
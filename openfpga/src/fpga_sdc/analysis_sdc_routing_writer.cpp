@@ -4,6 +4,8 @@
  * using a benchmark
  *******************************************************************/
 #include <map>
+#include <utility>
+#include <vector>
 
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
@@ -12,13 +14,11 @@
 #include "analysis_sdc_routing_writer.h"
 #include "analysis_sdc_writer_utils.h"
 #include "build_routing_module_utils.h"
-#include "openfpga_digest.h"
 #include "openfpga_naming.h"
 #include "openfpga_port.h"
 #include "openfpga_reserved_words.h"
 #include "openfpga_rr_graph_utils.h"
 #include "openfpga_side_manager.h"
-#include "sdc_writer_utils.h"
 
 /* begin namespace openfpga */
 namespace openfpga {
@@ -30,15 +30,12 @@ namespace openfpga {
  *    in a connection block
  *******************************************************************/
 static void print_analysis_sdc_disable_cb_unused_resources(
-  std::fstream& fp, const AtomContext& atom_ctx,
+  AnalysisSdcDisableTimingWriter& sdc_writer, const AtomContext& atom_ctx,
   const ModuleManager& module_manager,
   const VprDeviceAnnotation& device_annotation, const DeviceGrid& grids,
   const RRGraphView& rr_graph, const VprRoutingAnnotation& routing_annotation,
   const DeviceRRGSB& device_rr_gsb, const RRGSB& rr_gsb,
   const t_rr_type& cb_type, const bool& compact_routing_hierarchy) {
-  /* Validate file stream */
-  valid_file_stream(fp);
-
   vtr::Point<size_t> gsb_coordinate(rr_gsb.get_cb_x(cb_type),
                                     rr_gsb.get_cb_y(cb_type));
 
@@ -65,6 +62,7 @@ static void print_analysis_sdc_disable_cb_unused_resources(
   VTR_ASSERT(true == module_manager.valid_module_id(cb_module));
 
   /* Print comments */
+  std::ostream& fp = sdc_writer.stream();
   fp << "##################################################" << std::endl;
   fp << "# Disable timing for Connection block " << cb_module_name << std::endl;
   fp << "##################################################" << std::endl;
@@ -94,10 +92,7 @@ static void print_analysis_sdc_disable_cb_unused_resources(
       module_manager.module_port(cb_module, module_port).get_name(), itrack / 2,
       itrack / 2);
 
-    fp << "set_disable_timing ";
-    fp << cb_instance_name << "/";
-    fp << generate_sdc_port(chan_port);
-    fp << std::endl;
+    sdc_writer.disable_port(cb_instance_name + "/", chan_port);
   }
 
   /* Disable all the output port (routing tracks), which are not used by
@@ -125,10 +120,7 @@ static void print_analysis_sdc_disable_cb_unused_resources(
       module_manager.module_port(cb_module, module_port).get_name(), itrack / 2,
       itrack / 2);
 
-    fp << "set_disable_timing ";
-    fp << cb_instance_name << "/";
-    fp << generate_sdc_port(chan_port);
-    fp << std::endl;
+    sdc_writer.disable_port(cb_instance_name + "/", chan_port);
   }
 
   /* Build a map between mux_instance name and net_num */
@@ -185,11 +177,9 @@ static void print_analysis_sdc_disable_cb_unused_resources(
       VTR_ASSERT(true ==
                  module_manager.valid_module_port_id(cb_module, module_port));
 
-      fp << "set_disable_timing ";
-      fp << cb_instance_name << "/";
-      fp << generate_sdc_port(
+      sdc_writer.disable_port(
+        cb_instance_name + "/",
         module_manager.module_port(cb_module, module_port));
-      fp << std::endl;
     }
   }
 
@@ -229,22 +219,18 @@ static void print_analysis_sdc_disable_cb_unused_resources(
       atom_ctx.lookup.atom_net(routing_annotation.rr_node_net(chan_node));
 
     disable_analysis_module_input_pin_net_sinks(
-      fp, module_manager, cb_module, cb_instance_name, module_port, itrack / 2,
-      mapped_atom_net, mux_instance_to_net_map);
+      sdc_writer, module_manager, cb_module, cb_instance_name, module_port,
+      itrack / 2, mapped_atom_net, mux_instance_to_net_map);
   }
 }
 
 /********************************************************************
  * Iterate over all the connection blocks in a device
- * and disable unused ports for each of them
+ * and collect the existing ones
  *******************************************************************/
-static void print_analysis_sdc_disable_unused_cb_ports(
-  std::fstream& fp, const AtomContext& atom_ctx,
-  const ModuleManager& module_manager,
-  const VprDeviceAnnotation& device_annotation, const DeviceGrid& grids,
-  const RRGraphView& rr_graph, const VprRoutingAnnotation& routing_annotation,
+static void find_analysis_sdc_cbs(
   const DeviceRRGSB& device_rr_gsb, const t_rr_type& cb_type,
-  const bool& compact_routing_hierarchy) {
+  std::vector<std::pair<const RRGSB*, t_rr_type>>& cbs) {
   /* Build unique X-direction connection block modules */
   vtr::Point<size_t> cb_range = device_rr_gsb.get_gsb_range();
 
@@ -259,10 +245,7 @@ static void print_analysis_sdc_disable_unused_cb_ports(
         continue;
       }
 
-      print_analysis_sdc_disable_cb_unused_resources(
-        fp, atom_ctx, module_manager, device_annotation, grids, rr_graph,
-        routing_annotation, device_rr_gsb, rr_gsb, cb_type,
-        compact_routing_hierarchy);
+      cbs.push_back(std::make_pair(&rr_gsb, cb_type));
     }
   }
 }
@@ -270,20 +253,27 @@ static void print_analysis_sdc_disable_unused_cb_ports(
 /********************************************************************
  * Iterate over all the connection blocks in a device
  * and disable unused ports for each of them
+ * Connection blocks are independent, so they can be printed concurrently
  *******************************************************************/
 void print_analysis_sdc_disable_unused_cbs(
-  std::fstream& fp, const AtomContext& atom_ctx,
+  AnalysisSdcDisableTimingWriter& sdc_writer, const AtomContext& atom_ctx,
   const ModuleManager& module_manager,
   const VprDeviceAnnotation& device_annotation, const DeviceGrid& grids,
   const RRGraphView& rr_graph, const VprRoutingAnnotation& routing_annotation,
-  const DeviceRRGSB& device_rr_gsb, const bool& compact_routing_hierarchy) {
-  print_analysis_sdc_disable_unused_cb_ports(
-    fp, atom_ctx, module_manager, device_annotation, grids, rr_graph,
-    routing_annotation, device_rr_gsb, CHANX, compact_routing_hierarchy);
-
-  print_analysis_sdc_disable_unused_cb_ports(
-    fp, atom_ctx, module_manager, device_annotation, grids, rr_graph,
-    routing_annotation, device_rr_gsb, CHANY, compact_routing_hierarchy);
+  const DeviceRRGSB& device_rr_gsb, const bool& compact_routing_hierarchy,
+  const size_t& num_threads) {
+  std::vector<std::pair<const RRGSB*, t_rr_type>> cbs;
+  find_analysis_sdc_cbs(device_rr_gsb, CHANX, cbs);
+  find_analysis_sdc_cbs(device_rr_gsb, CHANY, cbs);
+
+  sdc_writer.print_chunks(
+    cbs.size(), num_threads,
+    [&](AnalysisSdcDisableTimingWriter& chunk_writer, const size_t& icb) {
+      print_analysis_sdc_disable_cb_unused_resources(
+        chunk_writer, atom_ctx, module_manager, device_annotation, grids,
+        rr_graph, routing_annotation, device_rr_gsb, *(cbs[icb].first),
+        cbs[icb].second, compact_routing_hierarchy);
+    });
 }
 
 /********************************************************************
@@ -293,15 +283,12 @@ void print_analysis_sdc_disable_unused_cbs(
  *    in a switch block
  *******************************************************************/
 static void print_analysis_sdc_disable_sb_unused_resources(
-  std::fstream& fp, const AtomContext& atom_ctx,
+  AnalysisSdcDisableTimingWriter& sdc_writer, const AtomContext& atom_ctx,
   const ModuleManager& module_manager,
   const VprDeviceAnnotation& device_annotation, const DeviceGrid& grids,
   const RRGraphView& rr_graph, const VprRoutingAnnotation& routing_annotation,
   const DeviceRRGSB& device_rr_gsb, const RRGSB& rr_gsb,
   const bool& compact_routing_hierarchy) {
-  /* Validate file stream */
-  valid_file_stream(fp);
-
   vtr::Point<size_t> gsb_coordinate(rr_gsb.get_sb_x(), rr_gsb.get_sb_y());
 
   std::string sb_instance_name =
@@ -324,6 +311,7 @@ static void print_analysis_sdc_disable_sb_unused_resources(
   VTR_ASSERT(true == module_manager.valid_module_id(sb_module));
 
   /* Print comments */
+  std::ostream& fp = sdc_writer.stream();
   fp << "##################################################" << std::endl;
   fp << "# Disable timing for Switch block " << sb_module_name << std::endl;
   fp << "##################################################" << std::endl;
@@ -388,10 +376,7 @@ static void print_analysis_sdc_disable_sb_unused_resources(
         module_manager.module_port(sb_module, module_port).get_name(),
         itrack / 2, itrack / 2);
 
-      fp << "set_disable_timing ";
-      fp << sb_instance_name << "/";
-      fp << generate_sdc_port(sb_port);
-      fp << std::endl;
+      sdc_writer.disable_port(sb_instance_name + "/", sb_port);
     }
   }
 
@@ -436,11 +421,9 @@ static void print_analysis_sdc_disable_sb_unused_resources(
         continue;
       }
 
-      fp << "set_disable_timing ";
-      fp << sb_instance_name << "/";
-      fp << generate_sdc_port(
+      sdc_writer.disable_port(
+        sb_instance_name + "/",
         module_manager.module_port(sb_module, module_port));
-      fp << std::endl;
     }
   }
 
@@ -505,7 +488,7 @@ static void print_analysis_sdc_disable_sb_unused_resources(
         atom_ctx.lookup.atom_net(routing_annotation.rr_node_net(opin_node));
 
       disable_analysis_module_input_port_net_sinks(
-        fp, module_manager, sb_module, sb_instance_name, module_port,
+        sdc_writer, module_manager, sb_module, sb_instance_name, module_port,
         mapped_atom_net, mux_instance_to_net_map);
     }
   }
@@ -553,7 +536,7 @@ static void print_analysis_sdc_disable_sb_unused_resources(
         atom_ctx.lookup.atom_net(routing_annotation.rr_node_net(chan_node));
 
       disable_analysis_module_input_pin_net_sinks(
-        fp, module_manager, sb_module, sb_instance_name, module_port,
+        sdc_writer, module_manager, sb_module, sb_instance_name, module_port,
         itrack / 2, mapped_atom_net, mux_instance_to_net_map);
     }
   }
@@ -564,11 +547,14 @@ static void print_analysis_sdc_disable_sb_unused_resources(
  * and disable unused ports for each of them
  *******************************************************************/
 void print_analysis_sdc_disable_unused_sbs(
-  std::fstream& fp, const AtomContext& atom_ctx,
+  AnalysisSdcDisableTimingWriter& sdc_writer, const AtomContext& atom_ctx,
   const ModuleManager& module_manager,
   const VprDeviceAnnotation& device_annotation, const DeviceGrid& grids,
   const RRGraphView& rr_graph, const VprRoutingAnnotation& routing_annotation,
-  const DeviceRRGSB& device_rr_gsb, const bool& compact_routing_hierarchy) {
+  const DeviceRRGSB& device_rr_gsb, const bool& compact_routing_hierarchy,
+  const size_t& num_threads) {
+  std::vector<const RRGSB*> sbs;
+
   /* Build unique X-direction connection block modules */
   vtr::Point<size_t> sb_range = device_rr_gsb.get_gsb_range();
 
@@ -583,11 +569,19 @@ void print_analysis_sdc_disable_unused_sbs(
         continue;
       }
 
-      print_analysis_sdc_disable_sb_unused_resources(
-        fp, atom_ctx, module_manager, device_annotation, grids, rr_graph,
-        routing_annotation, device_rr_gsb, rr_gsb, compact_routing_hierarchy);
+      sbs.push_back(&rr_gsb);
     }
   }
+
+  /* Switch blocks are independent, so they can be printed concurrently */
+  sdc_writer.print_chunks(
+    sbs.size(), num_threads,
+    [&](AnalysisSdcDisableTimingWriter& chunk_writer, const size_t& isb) {
+      print_analysis_sdc_disable_sb_unused_resources(
+        chunk_writer, atom_ctx, module_manager, device_annotation, grids,
+        rr_graph, routing_annotation, device_rr_gsb, *(sbs[isb]),
+        compact_routing_hierarchy);
+    });
 }
 
 } /* end namespace openfpga */
@@ -4,9 +4,9 @@
 /********************************************************************
  * Include header files that are required by function declaration
  *******************************************************************/
-#include <fstream>
 #include <vector>
 
+#include "analysis_sdc_disable_timing_writer.h"
 #include "device_grid.h"
 #include "device_rr_gsb.h"
 #include "module_manager.h"
@@ -21,18 +21,20 @@
 namespace openfpga {
 
 void print_analysis_sdc_disable_unused_cbs(
-  std::fstream& fp, const AtomContext& atom_ctx,
+  AnalysisSdcDisableTimingWriter& sdc_writer, const AtomContext& atom_ctx,
   const ModuleManager& module_manager,
   const VprDeviceAnnotation& device_annotation, const DeviceGrid& grids,
   const RRGraphView& rr_graph, const VprRoutingAnnotation& routing_annotation,
-  const DeviceRRGSB& device_rr_gsb, const bool& compact_routing_hierarchy);
+  const DeviceRRGSB& device_rr_gsb, const bool& compact_routing_hierarchy,
+  const size_t& num_threads);
 
 void print_analysis_sdc_disable_unused_sbs(
-  std::fstream& fp, const AtomContext& atom_ctx,
+  AnalysisSdcDisableTimingWriter& sdc_writer, const AtomContext& atom_ctx,
   const ModuleManager& module_manager,
   const VprDeviceAnnotation& device_annotation, const DeviceGrid& grids,
   const RRGraphView& rr_graph, const VprRoutingAnnotation& routing_annotation,
-  const DeviceRRGSB& device_rr_gsb, const bool& compact_routing_hierarchy);
+  const DeviceRRGSB& device_rr_gsb, const bool& compact_routing_hierarchy,
+  const size_t& num_threads);
 
 } /* end namespace openfpga */
 
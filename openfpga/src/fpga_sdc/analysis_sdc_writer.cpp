@@ -11,6 +11,7 @@
 #include "vtr_time.h"
 
 /* Headers from openfpgautil library */
+#include "analysis_sdc_disable_timing_writer.h"
 #include "analysis_sdc_grid_writer.h"
 #include "analysis_sdc_routing_writer.h"
 #include "analysis_sdc_writer.h"
@@ -280,26 +281,36 @@ void print_analysis_sdc(const AnalysisSdcOption& option,
     fp, option.flatten_names(), openfpga_ctx.module_graph(), top_module,
     format_dir_path(openfpga_ctx.module_graph().module_name(top_module)));
 
+  /* Constraints to disable timing are written through a dedicated writer,
+   * which may merge them when compression is enabled */
+  AnalysisSdcDisableTimingWriter sdc_writer(fp,
+                                            option.compress_disable_timing());
+
   /* Disable timing for unused routing resources in connection blocks */
   print_analysis_sdc_disable_unused_cbs(
-    fp, vpr_ctx.atom(), openfpga_ctx.module_graph(),
+    sdc_writer, vpr_ctx.atom(), openfpga_ctx.module_graph(),
     openfpga_ctx.vpr_device_annotation(), vpr_ctx.device().grid,
     vpr_ctx.device().rr_graph, openfpga_ctx.vpr_routing_annotation(),
-    openfpga_ctx.device_rr_gsb(), compact_routing_hierarchy);
+    openfpga_ctx.device_rr_gsb(), compact_routing_hierarchy,
+    option.num_jobs());
 
   /* Disable timing for unused routing resources in switch blocks */
   print_analysis_sdc_disable_unused_sbs(
-    fp, vpr_ctx.atom(), openfpga_ctx.module_graph(),
+    sdc_writer, vpr_ctx.atom(), openfpga_ctx.module_graph(),
     openfpga_ctx.vpr_device_annotation(), vpr_ctx.device().grid,
     vpr_ctx.device().rr_graph, openfpga_ctx.vpr_routing_annotation(),
-    openfpga_ctx.device_rr_gsb(), compact_routing_hierarchy);
+    openfpga_ctx.device_rr_gsb(), compact_routing_hierarchy,
+    option.num_jobs());
 
   /* Disable timing for unused routing resources in grids (programmable blocks)
    */
   print_analysis_sdc_disable_unused_grids(
-    fp, vpr_ctx.device().grid, openfpga_ctx.vpr_device_annotation(),
+    sdc_writer, vpr_ctx.device().grid, openfpga_ctx.vpr_device_annotation(),
     openfpga_ctx.vpr_clustering_annotation(),
-    openfpga_ctx.vpr_placement_annotation(), openfpga_ctx.module_graph());
+    openfpga_ctx.vpr_placement_annotation(), openfpga_ctx.module_graph(),
+    option.num_jobs());
+
+  sdc_writer.flush();
 
   /* Close file handler */
   fp.close();
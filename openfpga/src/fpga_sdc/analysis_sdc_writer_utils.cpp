@@ -9,8 +9,6 @@
 
 /* Headers from openfpgautil library */
 #include "analysis_sdc_writer_utils.h"
-#include "openfpga_digest.h"
-#include "sdc_writer_utils.h"
 
 /* begin namespace openfpga */
 namespace openfpga {
@@ -48,14 +46,12 @@ bool is_rr_node_to_be_disable_for_analysis(
  *
  *******************************************************************/
 void disable_analysis_module_input_pin_net_sinks(
-  std::fstream& fp, const ModuleManager& module_manager,
-  const ModuleId& parent_module, const std::string& parent_instance_name,
+  AnalysisSdcDisableTimingWriter& sdc_writer,
+  const ModuleManager& module_manager, const ModuleId& parent_module,
+  const std::string& parent_instance_name,
   const ModulePortId& module_input_port, const size_t& module_input_pin,
   const AtomNetId& mapped_net,
   const std::map<std::string, AtomNetId> mux_instance_to_net_map) {
-  /* Validate file stream */
-  valid_file_stream(fp);
-
   /* Find the module net which sources from this port! */
   ModuleNetId module_net = module_manager.module_instance_port_net(
     parent_module, parent_module, 0, module_input_port, module_input_pin);
@@ -110,11 +106,8 @@ void disable_analysis_module_input_pin_net_sinks(
 
     VTR_ASSERT(!sink_instance_name.empty());
     /* Get the input id that is used! Disable the unused inputs! */
-    fp << "set_disable_timing ";
-    fp << parent_instance_name << "/";
-    fp << sink_instance_name << "/";
-    fp << generate_sdc_port(sink_port);
-    fp << std::endl;
+    sdc_writer.disable_port(
+      parent_instance_name + "/" + sink_instance_name + "/", sink_port);
   }
 }
 
@@ -139,18 +132,16 @@ void disable_analysis_module_input_pin_net_sinks(
  *
  *******************************************************************/
 void disable_analysis_module_input_port_net_sinks(
-  std::fstream& fp, const ModuleManager& module_manager,
-  const ModuleId& parent_module, const std::string& parent_instance_name,
+  AnalysisSdcDisableTimingWriter& sdc_writer,
+  const ModuleManager& module_manager, const ModuleId& parent_module,
+  const std::string& parent_instance_name,
   const ModulePortId& module_input_port, const AtomNetId& mapped_net,
   const std::map<std::string, AtomNetId> mux_instance_to_net_map) {
-  /* Validate file stream */
-  valid_file_stream(fp);
-
   /* Find the module net which sources from this port! */
   for (const size_t& pin :
        module_manager.module_port(parent_module, module_input_port).pins()) {
     disable_analysis_module_input_pin_net_sinks(
-      fp, module_manager, parent_module, parent_instance_name,
+      sdc_writer, module_manager, parent_module, parent_instance_name,
       module_input_port, pin, mapped_net, mux_instance_to_net_map);
   }
 }
@@ -182,15 +173,13 @@ void disable_analysis_module_input_port_net_sinks(
  *
  *******************************************************************/
 void disable_analysis_module_output_pin_net_sinks(
-  std::fstream& fp, const ModuleManager& module_manager,
-  const ModuleId& parent_module, const std::string& parent_instance_name,
-  const ModuleId& child_module, const size_t& child_instance,
+  AnalysisSdcDisableTimingWriter& sdc_writer,
+  const ModuleManager& module_manager, const ModuleId& parent_module,
+  const std::string& parent_instance_name, const ModuleId& child_module,
+  const size_t& child_instance,
   const ModulePortId& child_module_port, const size_t& child_module_pin,
   const AtomNetId& mapped_net,
   const std::map<std::string, AtomNetId> mux_instance_to_net_map) {
-  /* Validate file stream */
-  valid_file_stream(fp);
-
   /* Find the module net which sources from this port! */
   ModuleNetId module_net = module_manager.module_instance_port_net(
     parent_module, child_module, child_instance, child_module_port,
@@ -245,11 +234,8 @@ void disable_analysis_module_output_pin_net_sinks(
 
     VTR_ASSERT(!sink_instance_name.empty());
     /* Get the input id that is used! Disable the unused inputs! */
-    fp << "set_disable_timing ";
-    fp << parent_instance_name << "/";
-    fp << sink_instance_name << "/";
-    fp << generate_sdc_port(sink_port);
-    fp << std::endl;
+    sdc_writer.disable_port(
+      parent_instance_name + "/" + sink_instance_name + "/", sink_port);
   }
 }
 
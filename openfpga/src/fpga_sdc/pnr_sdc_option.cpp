@@ -25,6 +25,7 @@ PnrSdcOption::PnrSdcOption(const std::string& sdc_dir) {
   constrain_switch_block_outputs_ = false;
   constrain_zero_delay_paths_ = false;
   time_stamp_ = true;
+  num_jobs_ = 1;
 }
 
 /********************************************************************
@@ -79,6 +80,8 @@ bool PnrSdcOption::constrain_zero_delay_paths() const {
 
 bool PnrSdcOption::time_stamp() const { return time_stamp_; }
 
+size_t PnrSdcOption::num_jobs() const { return num_jobs_; }
+
 /********************************************************************
  * Public mutators
  ********************************************************************/
@@ -156,4 +159,8 @@ void PnrSdcOption::set_constrain_zero_delay_paths(
 
 void PnrSdcOption::set_time_stamp(const bool& enable) { time_stamp_ = enable; }
 
+void PnrSdcOption::set_num_jobs(const size_t& num_jobs) {
+  num_jobs_ = num_jobs;
+}
+
 } /* end namespace openfpga */
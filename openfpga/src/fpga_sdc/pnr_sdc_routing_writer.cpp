@@ -10,6 +10,9 @@
  *******************************************************************/
 #include <ctime>
 #include <fstream>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
@@ -21,6 +24,7 @@
 #include "mux_utils.h"
 #include "openfpga_digest.h"
 #include "openfpga_naming.h"
+#include "openfpga_parallel.h"
 #include "openfpga_port.h"
 #include "openfpga_rr_graph_utils.h"
 #include "openfpga_scale.h"
@@ -205,6 +209,10 @@ void print_pnr_sdc_flatten_routing_constrain_sb_timing(
 
   std::string root_path = module_manager.module_name(top_module);
 
+  /* Collect the SBs and their paths. Each SB has its own SDC file,
+   * so that the files can be written concurrently */
+  std::vector<std::pair<const RRGSB*, std::string>> sbs;
+
   /* Get the range of SB array */
   vtr::Point<size_t> sb_range = device_rr_gsb.get_gsb_range();
   /* Go for each SB */
@@ -224,11 +232,15 @@ void print_pnr_sdc_flatten_routing_constrain_sb_timing(
 
       std::string module_path = format_dir_path(root_path) + sb_instance_name;
 
-      print_pnr_sdc_constrain_sb_timing(options, module_path, module_manager,
-                                        device_annotation, grids, rr_graph,
-                                        rr_gsb);
+      sbs.push_back(std::make_pair(&rr_gsb, module_path));
     }
   }
+
+  parallel_for(sbs.size(), options.num_jobs(), [&](const size_t& isb) {
+    print_pnr_sdc_constrain_sb_timing(options, sbs[isb].second, module_manager,
+                                      device_annotation, grids, rr_graph,
+                                      *(sbs[isb].first));
+  });
 }
 
 /********************************************************************
@@ -246,6 +258,10 @@ void print_pnr_sdc_compact_routing_constrain_sb_timing(
 
   std::string root_path = module_manager.module_name(top_module);
 
+  /* Collect the unique SBs and their paths. Each SB has its own SDC file,
+   * so that the files can be written concurrently */
+  std::vector<std::pair<const RRGSB*, std::string>> sbs;
+
   for (size_t isb = 0; isb < device_rr_gsb.get_num_sb_unique_module(); ++isb) {
     const RRGSB& rr_gsb = device_rr_gsb.get_sb_unique_module(isb);
     if (false == rr_gsb.is_sb_exist()) {
@@ -264,10 +280,14 @@ void print_pnr_sdc_compact_routing_constrain_sb_timing(
 
     std::string module_path = format_dir_path(root_path) + sb_module_name;
 
-    print_pnr_sdc_constrain_sb_timing(options, module_path, module_manager,
-                                      device_annotation, grids, rr_graph,
-                                      rr_gsb);
+    sbs.push_back(std::make_pair(&rr_gsb, module_path));
   }
+
+  parallel_for(sbs.size(), options.num_jobs(), [&](const size_t& isb) {
+    print_pnr_sdc_constrain_sb_timing(options, sbs[isb].second, module_manager,
+                                      device_annotation, grids, rr_graph,
+                                      *(sbs[isb].first));
+  });
 }
 
 /********************************************************************
@@ -486,13 +506,12 @@ static void print_pnr_sdc_constrain_cb_timing(
 
 /********************************************************************
  * Iterate over all the connection blocks in a device
- * and print SDC file for each of them
+ * and collect the ones whose SDC file should be printed
  *******************************************************************/
-static void print_pnr_sdc_flatten_routing_constrain_cb_timing(
-  const PnrSdcOption& options, const ModuleManager& module_manager,
-  const ModuleId& top_module, const VprDeviceAnnotation& device_annotation,
-  const DeviceGrid& grids, const RRGraphView& rr_graph,
-  const DeviceRRGSB& device_rr_gsb, const t_rr_type& cb_type) {
+static void find_pnr_sdc_flatten_routing_cbs(
+  const ModuleManager& module_manager, const ModuleId& top_module,
+  const DeviceRRGSB& device_rr_gsb, const t_rr_type& cb_type,
+  std::vector<std::tuple<const RRGSB*, t_rr_type, std::string>>& cbs) {
   /* Build unique X-direction connection block modules */
   vtr::Point<size_t> cb_range = device_rr_gsb.get_gsb_range();
 
@@ -521,13 +540,28 @@ static void print_pnr_sdc_flatten_routing_constrain_cb_timing(
 
       std::string module_path = format_dir_path(root_path) + cb_instance_name;
 
-      print_pnr_sdc_constrain_cb_timing(options, module_path, module_manager,
-                                        device_annotation, grids, rr_graph,
-                                        rr_gsb, cb_type);
+      cbs.push_back(std::make_tuple(&rr_gsb, cb_type, module_path));
     }
   }
 }
 
+/********************************************************************
+ * Print the SDC files for a list of connection blocks.
+ * Each CB has its own SDC file, so that the files can be written
+ * concurrently
+ *******************************************************************/
+static void print_pnr_sdc_constrain_cbs_timing(
+  const PnrSdcOption& options, const ModuleManager& module_manager,
+  const VprDeviceAnnotation& device_annotation, const DeviceGrid& grids,
+  const RRGraphView& rr_graph,
+  const std::vector<std::tuple<const RRGSB*, t_rr_type, std::string>>& cbs) {
+  parallel_for(cbs.size(), options.num_jobs(), [&](const size_t& icb) {
+    print_pnr_sdc_constrain_cb_timing(
+      options, std::get<2>(cbs[icb]), module_manager, device_annotation, grids,
+      rr_graph, *(std::get<0>(cbs[icb])), std::get<1>(cbs[icb]));
+  });
+}
+
 /********************************************************************
  * Iterate over all the connection blocks in a device
  * and print SDC file for each of them
@@ -541,13 +575,14 @@ void print_pnr_sdc_flatten_routing_constrain_cb_timing(
   vtr::ScopedStartFinishTimer timer(
     "Write SDC for constrain Connection Block timing for P&R flow");
 
-  print_pnr_sdc_flatten_routing_constrain_cb_timing(
-    options, module_manager, top_module, device_annotation, grids, rr_graph,
-    device_rr_gsb, CHANX);
+  std::vector<std::tuple<const RRGSB*, t_rr_type, std::string>> cbs;
+  find_pnr_sdc_flatten_routing_cbs(module_manager, top_module, device_rr_gsb,
+                                   CHANX, cbs);
+  find_pnr_sdc_flatten_routing_cbs(module_manager, top_module, device_rr_gsb,
+                                   CHANY, cbs);
 
-  print_pnr_sdc_flatten_routing_constrain_cb_timing(
-    options, module_manager, top_module, device_annotation, grids, rr_graph,
-    device_rr_gsb, CHANY);
+  print_pnr_sdc_constrain_cbs_timing(options, module_manager, device_annotation,
+                                     grids, rr_graph, cbs);
 }
 
 /********************************************************************
@@ -565,6 +600,8 @@ void print_pnr_sdc_compact_routing_constrain_cb_timing(
 
   std::string root_path = module_manager.module_name(top_module);
 
+  std::vector<std::tuple<const RRGSB*, t_rr_type, std::string>> cbs;
+
   /* Print SDC for unique X-direction connection block modules */
   for (size_t icb = 0; icb < device_rr_gsb.get_num_cb_unique_module(CHANX);
        ++icb) {
@@ -582,9 +619,7 @@ void print_pnr_sdc_compact_routing_constrain_cb_timing(
 
     std::string module_path = format_dir_path(root_path) + cb_module_name;
 
-    print_pnr_sdc_constrain_cb_timing(options, module_path, module_manager,
-                                      device_annotation, grids, rr_graph,
-                                      unique_mirror, CHANX);
+    cbs.push_back(std::make_tuple(&unique_mirror, CHANX, module_path));
   }
 
   /* Print SDC for unique Y-direction connection block modules */
@@ -604,10 +639,11 @@ void print_pnr_sdc_compact_routing_constrain_cb_timing(
 
     std::string module_path = format_dir_path(root_path) + cb_module_name;
 
-    print_pnr_sdc_constrain_cb_timing(options, module_path, module_manager,
-                                      device_annotation, grids, rr_graph,
-                                      unique_mirror, CHANY);
+    cbs.push_back(std::make_tuple(&unique_mirror, CHANY, module_path));
   }
+
+  print_pnr_sdc_constrain_cbs_timing(options, module_manager, device_annotation,
+                                     grids, rr_graph, cbs);
 }
 
 } /* end namespace openfpga */
@@ -1,8 +1,6 @@
 /********************************************************************
  * This file include most utilized functions to be used in SDC writers
  *******************************************************************/
-#include <chrono>
-#include <ctime>
 #include <iomanip>
 #include <map>
 
@@ -33,9 +31,7 @@ void print_sdc_file_header(std::fstream& fp, const std::string& usage,
   fp << "#\tOrganization: University of Utah " << std::endl;
 
   if (include_time_stamp) {
-    auto end = std::chrono::system_clock::now();
-    std::time_t end_time = std::chrono::system_clock::to_time_t(end);
-    fp << "#\tDate: " << std::ctime(&end_time);
+    fp << "#\tDate: " << get_current_time_stamp();
   }
 
   fp << "#############################################" << std::endl;
@@ -4,6 +4,7 @@
 /********************************************************************
  * Include header files required by the data structure definition
  *******************************************************************/
+#include <cstddef>
 #include <string>
 
 /* Begin namespace openfpga */
@@ -22,18 +23,22 @@ class FabricSpiceOption {
   bool explicit_port_mapping() const;
   bool compress_routing() const;
   bool verbose_output() const;
+  size_t num_jobs() const;
 
  public: /* Public mutators */
   void set_output_directory(const std::string& output_dir);
   void set_explicit_port_mapping(const bool& enabled);
   void set_compress_routing(const bool& enabled);
   void set_verbose_output(const bool& enabled);
+  void set_num_jobs(const size_t& num_jobs);
 
  private: /* Internal Data */
   std::string output_directory_;
   bool explicit_port_mapping_;
   bool compress_routing_;
   bool verbose_output_;
+  /* Number of threads, where 0 means all the hardware threads */
+  size_t num_jobs_;
 };
 
 } /* End namespace openfpga*/
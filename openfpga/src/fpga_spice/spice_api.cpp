@@ -89,21 +89,35 @@ int fpga_fabric_spice(const ModuleManager& module_manager,
   }
 
   /* Generate routing blocks */
-  if (true == options.compress_routing()) {
-    print_spice_unique_routing_modules(netlist_manager, module_manager,
-                                       device_rr_gsb, rr_dir_path);
-  } else {
-    VTR_ASSERT(false == options.compress_routing());
-    print_spice_flatten_routing_modules(netlist_manager, module_manager,
-                                        device_rr_gsb, rr_dir_path);
+  {
+    vtr::ScopedStartFinishTimer routing_timer(
+      "Write SPICE netlists for routing blocks");
+    if (true == options.compress_routing()) {
+      print_spice_unique_routing_modules(netlist_manager, module_manager,
+                                         device_rr_gsb, rr_dir_path,
+                                         options.num_jobs());
+    } else {
+      VTR_ASSERT(false == options.compress_routing());
+      print_spice_flatten_routing_modules(netlist_manager, module_manager,
+                                          device_rr_gsb, rr_dir_path,
+                                          options.num_jobs());
+    }
   }
 
   /* Generate grids */
-  print_spice_grids(netlist_manager, module_manager, device_ctx,
-                    device_annotation, lb_dir_path, options.verbose_output());
+  {
+    vtr::ScopedStartFinishTimer grid_timer("Write SPICE netlists for grids");
+    print_spice_grids(netlist_manager, module_manager, device_ctx,
+                      device_annotation, lb_dir_path, options.num_jobs(),
+                      options.verbose_output());
+  }
 
   /* Generate FPGA fabric */
-  print_spice_top_module(netlist_manager, module_manager, src_dir_path);
+  {
+    vtr::ScopedStartFinishTimer top_timer(
+      "Write SPICE netlists for top-level module");
+    print_spice_top_module(netlist_manager, module_manager, src_dir_path);
+  }
 
   /* Generate an netlist including all the fabric-related netlists */
   print_spice_fabric_include_netlist(
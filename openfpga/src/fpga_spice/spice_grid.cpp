@@ -4,6 +4,8 @@
  *******************************************************************/
 /* System header files */
 #include <fstream>
+#include <string>
+#include <utility>
 #include <vector>
 
 /* Headers from vtrutil library */
@@ -16,6 +18,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_parallel.h"
 #include "openfpga_side_manager.h"
 
 /* Headers from vpr library */
@@ -62,26 +65,8 @@ namespace openfpga {
  *
  *******************************************************************/
 static void print_spice_primitive_block(
-  NetlistManager& netlist_manager, const ModuleManager& module_manager,
-  const std::string& subckt_dir, t_pb_graph_node* primitive_pb_graph_node,
-  const bool& verbose) {
-  /* Ensure a valid pb_graph_node */
-  if (nullptr == primitive_pb_graph_node) {
-    VTR_LOGF_ERROR(__FILE__, __LINE__, "Invalid primitive_pb_graph_node!\n");
-    exit(1);
-  }
-
-  /* Give a name to the Verilog netlist */
-  /* Create the file name for Verilog */
-  std::string spice_fname(subckt_dir +
-                          generate_logical_tile_netlist_name(
-                            std::string(), primitive_pb_graph_node,
-                            std::string(SPICE_NETLIST_FILE_POSTFIX)));
-
-  VTR_LOG("Writing SPICE netlist '%s' for primitive pb_type '%s' ...",
-          spice_fname.c_str(), primitive_pb_graph_node->pb_type->name);
-  VTR_LOGV(verbose, "\n");
-
+  const ModuleManager& module_manager, const std::string& spice_fname,
+  t_pb_graph_node* primitive_pb_graph_node) {
   /* Create the file stream */
   std::fstream fp;
   fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
@@ -101,27 +86,57 @@ static void print_spice_primitive_block(
   /* Ensure that the module has been created and thus unique! */
   VTR_ASSERT(true == module_manager.valid_module_id(primitive_module));
 
-  VTR_LOGV(verbose,
-           "Writing SPICE codes of logical tile primitive block '%s'...",
-           module_manager.module_name(primitive_module).c_str());
-
   /* Write the spice module */
   write_spice_subckt_to_file(fp, module_manager, primitive_module);
 
   /* Close file handler */
   fp.close();
+}
+
+/********************************************************************
+ * Print SPICE subckts of a non-primitive node in the pb_graph_node graph,
+ * whose child modules are printed in other netlists
+ *******************************************************************/
+static void print_spice_pb_type_block(const ModuleManager& module_manager,
+                                      const std::string& spice_fname,
+                                      t_pb_graph_node* physical_pb_graph_node) {
+  t_pb_type* physical_pb_type = physical_pb_graph_node->pb_type;
+
+  /* Create the file stream */
+  std::fstream fp;
+  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
+
+  check_file_stream(spice_fname.c_str(), fp);
+
+  print_spice_file_header(fp, std::string("SPICE subckts for pb_type: " +
+                                          std::string(physical_pb_type->name)));
 
-  /* Add fname to the netlist name list */
-  NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
-  VTR_ASSERT(NetlistId::INVALID() != nlist_id);
-  netlist_manager.set_netlist_type(nlist_id,
-                                   NetlistManager::LOGIC_BLOCK_NETLIST);
+  /* Generate the name of the SPICE subckt for this pb_type */
+  std::string pb_module_name =
+    generate_physical_block_module_name(physical_pb_type);
 
-  VTR_LOGV(verbose, "Done\n");
+  /* Register the SPICE subckt in module manager */
+  ModuleId pb_module = module_manager.find_module(pb_module_name);
+  VTR_ASSERT(true == module_manager.valid_module_id(pb_module));
+
+  /* Comment lines */
+  print_spice_comment(
+    fp, std::string("BEGIN Physical programmable logic block SPICE subckt: " +
+                    std::string(physical_pb_type->name)));
+
+  /* Write the spice module */
+  write_spice_subckt_to_file(fp, module_manager, pb_module);
+
+  print_spice_comment(
+    fp, std::string("END Physical programmable logic block SPICE subckt: " +
+                    std::string(physical_pb_type->name)));
+
+  /* Close file handler */
+  fp.close();
 }
 
 /********************************************************************
- * Print SPICE subckts of physical blocks inside a grid (CLB, I/O. etc.)
+ * Find the SPICE subckts of physical blocks inside a grid (CLB, I/O. etc.)
  * This function will traverse the graph of complex logic block
  *(t_pb_graph_node) in a recursive way, using a Depth First Search (DFS)
  *algorithm. As such, primitive physical blocks (LUTs, FFs, etc.), leaf node of
@@ -135,11 +150,14 @@ static void print_spice_primitive_block(
  * Note: DFS is the right way. Do NOT use BFS.
  * DFS can guarantee that all the sub-modules can be registered properly
  * to its parent in module manager
+ *
+ * The nodes are collected here in the DFS order, and then printed by
+ * print_spice_logical_tile_netlist()
  *******************************************************************/
-static void rec_print_spice_logical_tile(
-  NetlistManager& netlist_manager, const ModuleManager& module_manager,
-  const VprDeviceAnnotation& device_annotation, const std::string& subckt_dir,
-  t_pb_graph_node* physical_pb_graph_node, const bool& verbose) {
+static void rec_find_spice_logical_tile_pb_graph_nodes(
+  const VprDeviceAnnotation& device_annotation,
+  t_pb_graph_node* physical_pb_graph_node,
+  std::vector<t_pb_graph_node*>& pb_graph_nodes) {
   /* Check cur_pb_graph_node*/
   if (nullptr == physical_pb_graph_node) {
     VTR_LOGF_ERROR(__FILE__, __LINE__, "Invalid physical_pb_graph_node\n");
@@ -158,78 +176,18 @@ static void rec_print_spice_logical_tile(
   if (false == is_primitive_pb_type(physical_pb_type)) {
     for (int ipb = 0; ipb < physical_mode->num_pb_type_children; ++ipb) {
       /* Go recursive to visit the children */
-      rec_print_spice_logical_tile(
-        netlist_manager, module_manager, device_annotation, subckt_dir,
+      rec_find_spice_logical_tile_pb_graph_nodes(
+        device_annotation,
         &(physical_pb_graph_node
             ->child_pb_graph_nodes[physical_mode->index][ipb][0]),
-        verbose);
+        pb_graph_nodes);
     }
   }
 
-  /* For leaf node, a primitive SPICE subckt will be generated.
-   * Note that the primitive may be mapped to a standard cell, we force to use
-   * explict port mapping. This aims to avoid any port sequence issues!!!
+  /* The node comes after all its children, as the sub-modules should be
+   * printed first. For leaf node, a primitive SPICE subckt will be generated.
    */
-  if (true == is_primitive_pb_type(physical_pb_type)) {
-    print_spice_primitive_block(netlist_manager, module_manager, subckt_dir,
-                                physical_pb_graph_node, verbose);
-    /* Finish for primitive node, return */
-    return;
-  }
-
-  /* Give a name to the Verilog netlist */
-  /* Create the file name for Verilog */
-  std::string spice_fname(subckt_dir +
-                          generate_logical_tile_netlist_name(
-                            std::string(), physical_pb_graph_node,
-                            std::string(SPICE_NETLIST_FILE_POSTFIX)));
-
-  VTR_LOG("Writing SPICE netlist '%s' for pb_type '%s' ...",
-          spice_fname.c_str(), physical_pb_type->name);
-  VTR_LOGV(verbose, "\n");
-
-  /* Create the file stream */
-  std::fstream fp;
-  fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
-
-  check_file_stream(spice_fname.c_str(), fp);
-
-  print_spice_file_header(fp, std::string("SPICE subckts for pb_type: " +
-                                          std::string(physical_pb_type->name)));
-
-  /* Generate the name of the SPICE subckt for this pb_type */
-  std::string pb_module_name =
-    generate_physical_block_module_name(physical_pb_type);
-
-  /* Register the SPICE subckt in module manager */
-  ModuleId pb_module = module_manager.find_module(pb_module_name);
-  VTR_ASSERT(true == module_manager.valid_module_id(pb_module));
-
-  VTR_LOGV(verbose, "Writing SPICE codes of pb_type '%s'...",
-           module_manager.module_name(pb_module).c_str());
-
-  /* Comment lines */
-  print_spice_comment(
-    fp, std::string("BEGIN Physical programmable logic block SPICE subckt: " +
-                    std::string(physical_pb_type->name)));
-
-  /* Write the spice module */
-  write_spice_subckt_to_file(fp, module_manager, pb_module);
-
-  print_spice_comment(
-    fp, std::string("END Physical programmable logic block SPICE subckt: " +
-                    std::string(physical_pb_type->name)));
-
-  /* Close file handler */
-  fp.close();
-
-  /* Add fname to the netlist name list */
-  NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
-  VTR_ASSERT(NetlistId::INVALID() != nlist_id);
-  netlist_manager.set_netlist_type(nlist_id,
-                                   NetlistManager::LOGIC_BLOCK_NETLIST);
-
-  VTR_LOGV(verbose, "Done\n");
+  pb_graph_nodes.push_back(physical_pb_graph_node);
 }
 
 /*****************************************************************************
@@ -239,7 +197,7 @@ static void rec_print_spice_logical_tile(
 static void print_spice_logical_tile_netlist(
   NetlistManager& netlist_manager, const ModuleManager& module_manager,
   const VprDeviceAnnotation& device_annotation, const std::string& subckt_dir,
-  t_pb_graph_node* pb_graph_head, const bool& verbose) {
+  t_pb_graph_node* pb_graph_head, const size_t& num_threads) {
   VTR_LOG("Writing Verilog netlists for logic tile '%s' ...",
           pb_graph_head->pb_type->name);
   VTR_LOG("\n");
@@ -252,9 +210,48 @@ static void print_spice_logical_tile_netlist(
    */
   /* Print SPICE subckts starting from the top-level pb_type/pb_graph_node, and
    * traverse the graph in a recursive way */
-  rec_print_spice_logical_tile(netlist_manager, module_manager,
-                               device_annotation, subckt_dir, pb_graph_head,
-                               verbose);
+  std::vector<t_pb_graph_node*> pb_graph_nodes;
+  rec_find_spice_logical_tile_pb_graph_nodes(device_annotation, pb_graph_head,
+                                             pb_graph_nodes);
+
+  /* Give a name to the SPICE netlist of each pb_type */
+  std::vector<std::string> spice_fnames;
+  for (t_pb_graph_node* pb_graph_node : pb_graph_nodes) {
+    spice_fnames.push_back(subckt_dir +
+                           generate_logical_tile_netlist_name(
+                             std::string(), pb_graph_node,
+                             std::string(SPICE_NETLIST_FILE_POSTFIX)));
+  }
+
+  /* Each netlist is a separated file, which can be written on any thread */
+  parallel_for(pb_graph_nodes.size(), num_threads, [&](const size_t& inode) {
+    if (true == is_primitive_pb_type(pb_graph_nodes[inode]->pb_type)) {
+      print_spice_primitive_block(module_manager, spice_fnames[inode],
+                                  pb_graph_nodes[inode]);
+    } else {
+      print_spice_pb_type_block(module_manager, spice_fnames[inode],
+                                pb_graph_nodes[inode]);
+    }
+  });
+
+  /* Add fnames to the netlist name list in the DFS order */
+  for (size_t inode = 0; inode < pb_graph_nodes.size(); ++inode) {
+    t_pb_type* pb_type = pb_graph_nodes[inode]->pb_type;
+    if (true == is_primitive_pb_type(pb_type)) {
+      VTR_LOG("Writing SPICE netlist '%s' for primitive pb_type '%s' ...",
+              spice_fnames[inode].c_str(), pb_type->name);
+    } else {
+      VTR_LOG("Writing SPICE netlist '%s' for pb_type '%s' ...",
+              spice_fnames[inode].c_str(), pb_type->name);
+    }
+
+    NetlistId nlist_id = netlist_manager.add_netlist(spice_fnames[inode]);
+    VTR_ASSERT(NetlistId::INVALID() != nlist_id);
+    netlist_manager.set_netlist_type(nlist_id,
+                                     NetlistManager::LOGIC_BLOCK_NETLIST);
+
+    VTR_LOG("Done\n");
+  }
 
   VTR_LOG("Done\n");
   VTR_LOG("\n");
@@ -269,33 +266,13 @@ static void print_spice_logical_tile_netlist(
  * the I/O block locates at.
  *****************************************************************************/
 static void print_spice_physical_tile_netlist(
-  NetlistManager& netlist_manager, const ModuleManager& module_manager,
-  const std::string& subckt_dir, t_physical_tile_type_ptr phy_block_type,
-  const e_side& border_side) {
+  const ModuleManager& module_manager, const std::string& spice_fname,
+  t_physical_tile_type_ptr phy_block_type, const e_side& border_side) {
   /* Check code: if this is an IO block, the border side MUST be valid */
   if (true == is_io_type(phy_block_type)) {
     VTR_ASSERT(NUM_SIDES != border_side);
   }
 
-  /* Give a name to the Verilog netlist */
-  /* Create the file name for Verilog */
-  std::string spice_fname(
-    subckt_dir +
-    generate_grid_block_netlist_name(
-      std::string(GRID_MODULE_NAME_PREFIX) + std::string(phy_block_type->name),
-      is_io_type(phy_block_type), border_side,
-      std::string(SPICE_NETLIST_FILE_POSTFIX)));
-
-  /* Echo status */
-  if (true == is_io_type(phy_block_type)) {
-    SideManager side_manager(border_side);
-    VTR_LOG("Writing SPICE Netlist '%s' for physical tile '%s' at %s side ...",
-            spice_fname.c_str(), phy_block_type->name, side_manager.c_str());
-  } else {
-    VTR_LOG("Writing SPICE Netlist '%s' for physical_tile '%s'...",
-            spice_fname.c_str(), phy_block_type->name);
-  }
-
   /* Create the file stream */
   std::fstream fp;
   fp.open(spice_fname, std::fstream::out | std::fstream::trunc);
@@ -327,14 +304,6 @@ static void print_spice_physical_tile_netlist(
 
   /* Close file handler */
   fp.close();
-
-  /* Add fname to the netlist name list */
-  NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
-  VTR_ASSERT(NetlistId::INVALID() != nlist_id);
-  netlist_manager.set_netlist_type(nlist_id,
-                                   NetlistManager::LOGIC_BLOCK_NETLIST);
-
-  VTR_LOG("Done\n");
 }
 
 /*****************************************************************************
@@ -347,7 +316,8 @@ void print_spice_grids(NetlistManager& netlist_manager,
                        const ModuleManager& module_manager,
                        const DeviceContext& device_ctx,
                        const VprDeviceAnnotation& device_annotation,
-                       const std::string& subckt_dir, const bool& verbose) {
+                       const std::string& subckt_dir, const size_t& num_threads,
+                       const bool& verbose) {
   /* Create a vector to contain all the Verilog netlist names that have been
    * generated in this function */
   std::vector<std::string> netlist_names;
@@ -369,7 +339,7 @@ void print_spice_grids(NetlistManager& netlist_manager,
     }
     print_spice_logical_tile_netlist(netlist_manager, module_manager,
                                      device_annotation, subckt_dir,
-                                     logical_tile.pb_graph_head, verbose);
+                                     logical_tile.pb_graph_head, num_threads);
   }
   VTR_LOG("Writing logical tiles...");
   VTR_LOG("Done\n");
@@ -381,6 +351,7 @@ void print_spice_grids(NetlistManager& netlist_manager,
    */
   VTR_LOG("Building physical tiles...");
   VTR_LOGV(verbose, "\n");
+  std::vector<std::pair<t_physical_tile_type_ptr, e_side>> physical_tiles;
   for (const t_physical_tile_type& physical_tile :
        device_ctx.physical_tile_types) {
     /* Bypass empty type or nullptr */
@@ -399,17 +370,53 @@ void print_spice_grids(NetlistManager& netlist_manager,
       std::set<e_side> io_type_sides =
         find_physical_io_tile_located_sides(device_ctx.grid, &physical_tile);
       for (const e_side& io_type_side : io_type_sides) {
-        print_spice_physical_tile_netlist(netlist_manager, module_manager,
-                                          subckt_dir, &physical_tile,
-                                          io_type_side);
+        physical_tiles.push_back(std::make_pair(&physical_tile, io_type_side));
       }
       continue;
     } else {
       /* For CLB and heterogenenous blocks */
-      print_spice_physical_tile_netlist(netlist_manager, module_manager,
-                                        subckt_dir, &physical_tile, NUM_SIDES);
+      physical_tiles.push_back(std::make_pair(&physical_tile, NUM_SIDES));
     }
   }
+
+  /* Give a name to the SPICE netlist of each physical tile */
+  std::vector<std::string> spice_fnames;
+  for (const auto& physical_tile : physical_tiles) {
+    spice_fnames.push_back(
+      subckt_dir + generate_grid_block_netlist_name(
+                     std::string(GRID_MODULE_NAME_PREFIX) +
+                       std::string(physical_tile.first->name),
+                     is_io_type(physical_tile.first), physical_tile.second,
+                     std::string(SPICE_NETLIST_FILE_POSTFIX)));
+  }
+
+  parallel_for(physical_tiles.size(), num_threads, [&](const size_t& itile) {
+    print_spice_physical_tile_netlist(module_manager, spice_fnames[itile],
+                                      physical_tiles[itile].first,
+                                      physical_tiles[itile].second);
+  });
+
+  /* Echo status and add fnames to the netlist name list */
+  for (size_t itile = 0; itile < physical_tiles.size(); ++itile) {
+    t_physical_tile_type_ptr phy_block_type = physical_tiles[itile].first;
+    if (true == is_io_type(phy_block_type)) {
+      SideManager side_manager(physical_tiles[itile].second);
+      VTR_LOG(
+        "Writing SPICE Netlist '%s' for physical tile '%s' at %s side ...",
+        spice_fnames[itile].c_str(), phy_block_type->name,
+        side_manager.c_str());
+    } else {
+      VTR_LOG("Writing SPICE Netlist '%s' for physical_tile '%s'...",
+              spice_fnames[itile].c_str(), phy_block_type->name);
+    }
+
+    NetlistId nlist_id = netlist_manager.add_netlist(spice_fnames[itile]);
+    VTR_ASSERT(NetlistId::INVALID() != nlist_id);
+    netlist_manager.set_netlist_type(nlist_id,
+                                     NetlistManager::LOGIC_BLOCK_NETLIST);
+
+    VTR_LOG("Done\n");
+  }
   VTR_LOG("Building physical tiles...");
   VTR_LOG("Done\n");
   VTR_LOG("\n");
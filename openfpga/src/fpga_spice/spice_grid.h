@@ -22,7 +22,8 @@ void print_spice_grids(NetlistManager& netlist_manager,
                        const ModuleManager& module_manager,
                        const DeviceContext& device_ctx,
                        const VprDeviceAnnotation& device_annotation,
-                       const std::string& subckt_dir, const bool& verbose);
+                       const std::string& subckt_dir, const size_t& num_threads,
+                       const bool& verbose);
 
 } /* end namespace openfpga */
 
@@ -2,6 +2,10 @@
  * This file includes functions that are used for
  * SPICE generation of FPGA routing architecture (global routing)
  *********************************************************************/
+#include <string>
+#include <utility>
+#include <vector>
+
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
 #include "vtr_log.h"
@@ -9,6 +13,7 @@
 
 /* Headers from openfpgautil library */
 #include "openfpga_digest.h"
+#include "openfpga_parallel.h"
 
 /* Include FPGA-Verilog header files*/
 #include "openfpga_naming.h"
@@ -74,11 +79,12 @@ namespace openfpga {
  *
  *  W: routing channel width
  *
+ * Return the name of the netlist, which is NOT registered to the netlist
+ * manager here, so that the netlists can be written in parallel
  ********************************************************************/
-static void print_spice_routing_connection_box_unique_module(
-  NetlistManager& netlist_manager, const ModuleManager& module_manager,
-  const std::string& subckt_dir, const RRGSB& rr_gsb,
-  const t_rr_type& cb_type) {
+static std::string print_spice_routing_connection_box_unique_module(
+  const ModuleManager& module_manager, const std::string& subckt_dir,
+  const RRGSB& rr_gsb, const t_rr_type& cb_type) {
   /* Create the netlist */
   vtr::Point<size_t> gsb_coordinate(rr_gsb.get_cb_x(cb_type),
                                     rr_gsb.get_cb_y(cb_type));
@@ -113,11 +119,7 @@ static void print_spice_routing_connection_box_unique_module(
   /* Close file handler */
   fp.close();
 
-  /* Add fname to the netlist name list */
-  NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
-  VTR_ASSERT(NetlistId::INVALID() != nlist_id);
-  netlist_manager.set_netlist_type(nlist_id,
-                                   NetlistManager::ROUTING_MODULE_NETLIST);
+  return spice_fname;
 }
 
 /*********************************************************************
@@ -178,11 +180,12 @@ static void print_spice_routing_connection_box_unique_module(
  *                       Grid[x][y]     ChanY[x][y]      Grid[x+1][y]
  *                       right_pins    inputs/outputs      left_pins
  *
- *
+ * Return the name of the netlist, which is NOT registered to the netlist
+ * manager here, so that the netlists can be written in parallel
  ********************************************************************/
-static void print_spice_routing_switch_box_unique_module(
-  NetlistManager& netlist_manager, const ModuleManager& module_manager,
-  const std::string& subckt_dir, const RRGSB& rr_gsb) {
+static std::string print_spice_routing_switch_box_unique_module(
+  const ModuleManager& module_manager, const std::string& subckt_dir,
+  const RRGSB& rr_gsb) {
   /* Create the netlist */
   vtr::Point<size_t> gsb_coordinate(rr_gsb.get_sb_x(), rr_gsb.get_sb_y());
   std::string spice_fname(subckt_dir +
@@ -213,21 +216,49 @@ static void print_spice_routing_switch_box_unique_module(
   /* Close file handler */
   fp.close();
 
-  /* Add fname to the netlist name list */
-  NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
-  VTR_ASSERT(NetlistId::INVALID() != nlist_id);
-  netlist_manager.set_netlist_type(nlist_id,
-                                   NetlistManager::ROUTING_MODULE_NETLIST);
+  return spice_fname;
 }
 
 /********************************************************************
- * Iterate over all the connection blocks in a device
- * and build a module for each of them
+ * Write the netlists of switch blocks and connection blocks on multiple
+ * threads. Each netlist is a separated file, and the netlists are
+ * registered to the netlist manager in the given order afterwards,
+ * so that the results do not depend on the number of threads
  *******************************************************************/
-static void print_spice_flatten_connection_block_modules(
+static void print_spice_routing_modules(
   NetlistManager& netlist_manager, const ModuleManager& module_manager,
-  const DeviceRRGSB& device_rr_gsb, const std::string& subckt_dir,
-  const t_rr_type& cb_type) {
+  const std::string& subckt_dir, const std::vector<const RRGSB*>& sbs,
+  const std::vector<std::pair<const RRGSB*, t_rr_type>>& cbs,
+  const size_t& num_threads) {
+  std::vector<std::string> spice_fnames(sbs.size() + cbs.size());
+
+  parallel_for(spice_fnames.size(), num_threads, [&](const size_t& ijob) {
+    if (ijob < sbs.size()) {
+      spice_fnames[ijob] = print_spice_routing_switch_box_unique_module(
+        module_manager, subckt_dir, *(sbs[ijob]));
+      return;
+    }
+    const std::pair<const RRGSB*, t_rr_type>& cb = cbs[ijob - sbs.size()];
+    spice_fnames[ijob] = print_spice_routing_connection_box_unique_module(
+      module_manager, subckt_dir, *(cb.first), cb.second);
+  });
+
+  /* Add fnames to the netlist name list */
+  for (const std::string& spice_fname : spice_fnames) {
+    NetlistId nlist_id = netlist_manager.add_netlist(spice_fname);
+    VTR_ASSERT(NetlistId::INVALID() != nlist_id);
+    netlist_manager.set_netlist_type(nlist_id,
+                                     NetlistManager::ROUTING_MODULE_NETLIST);
+  }
+}
+
+/********************************************************************
+ * Iterate over all the connection blocks in a device
+ * and collect those to build a module for
+ *******************************************************************/
+static void find_spice_flatten_connection_blocks(
+  const DeviceRRGSB& device_rr_gsb, const t_rr_type& cb_type,
+  std::vector<std::pair<const RRGSB*, t_rr_type>>& cbs) {
   /* Build unique X-direction connection block modules */
   vtr::Point<size_t> cb_range = device_rr_gsb.get_gsb_range();
 
@@ -241,8 +272,7 @@ static void print_spice_flatten_connection_block_modules(
       if (true != rr_gsb.is_cb_exist(cb_type)) {
         continue;
       }
-      print_spice_routing_connection_box_unique_module(
-        netlist_manager, module_manager, subckt_dir, rr_gsb, cb_type);
+      cbs.push_back(std::make_pair(&rr_gsb, cb_type));
     }
   }
 }
@@ -259,7 +289,8 @@ static void print_spice_flatten_connection_block_modules(
 void print_spice_flatten_routing_modules(NetlistManager& netlist_manager,
                                          const ModuleManager& module_manager,
                                          const DeviceRRGSB& device_rr_gsb,
-                                         const std::string& subckt_dir) {
+                                         const std::string& subckt_dir,
+                                         const size_t& num_threads) {
   /* Create a vector to contain all the Verilog netlist names that have been
    * generated in this function */
   std::vector<std::string> netlist_names;
@@ -267,22 +298,23 @@ void print_spice_flatten_routing_modules(NetlistManager& netlist_manager,
   vtr::Point<size_t> sb_range = device_rr_gsb.get_gsb_range();
 
   /* Build unique switch block modules */
+  std::vector<const RRGSB*> sbs;
   for (size_t ix = 0; ix < sb_range.x(); ++ix) {
     for (size_t iy = 0; iy < sb_range.y(); ++iy) {
       const RRGSB& rr_gsb = device_rr_gsb.get_gsb(ix, iy);
       if (true != rr_gsb.is_sb_exist()) {
         continue;
       }
-      print_spice_routing_switch_box_unique_module(
-        netlist_manager, module_manager, subckt_dir, rr_gsb);
+      sbs.push_back(&rr_gsb);
     }
   }
 
-  print_spice_flatten_connection_block_modules(
-    netlist_manager, module_manager, device_rr_gsb, subckt_dir, CHANX);
+  std::vector<std::pair<const RRGSB*, t_rr_type>> cbs;
+  find_spice_flatten_connection_blocks(device_rr_gsb, CHANX, cbs);
+  find_spice_flatten_connection_blocks(device_rr_gsb, CHANY, cbs);
 
-  print_spice_flatten_connection_block_modules(
-    netlist_manager, module_manager, device_rr_gsb, subckt_dir, CHANY);
+  print_spice_routing_modules(netlist_manager, module_manager, subckt_dir, sbs,
+                              cbs, num_threads);
 
   /*
   VTR_LOG("Writing header file for routing submodules '%s'...",
@@ -308,35 +340,30 @@ void print_spice_flatten_routing_modules(NetlistManager& netlist_manager,
 void print_spice_unique_routing_modules(NetlistManager& netlist_manager,
                                         const ModuleManager& module_manager,
                                         const DeviceRRGSB& device_rr_gsb,
-                                        const std::string& subckt_dir) {
+                                        const std::string& subckt_dir,
+                                        const size_t& num_threads) {
   /* Create a vector to contain all the Verilog netlist names that have been
    * generated in this function */
   std::vector<std::string> netlist_names;
 
   /* Build unique switch block modules */
+  std::vector<const RRGSB*> sbs;
   for (size_t isb = 0; isb < device_rr_gsb.get_num_sb_unique_module(); ++isb) {
-    const RRGSB& unique_mirror = device_rr_gsb.get_sb_unique_module(isb);
-    print_spice_routing_switch_box_unique_module(
-      netlist_manager, module_manager, subckt_dir, unique_mirror);
+    sbs.push_back(&(device_rr_gsb.get_sb_unique_module(isb)));
   }
 
-  /* Build unique X-direction connection block modules */
-  for (size_t icb = 0; icb < device_rr_gsb.get_num_cb_unique_module(CHANX);
-       ++icb) {
-    const RRGSB& unique_mirror = device_rr_gsb.get_cb_unique_module(CHANX, icb);
-
-    print_spice_routing_connection_box_unique_module(
-      netlist_manager, module_manager, subckt_dir, unique_mirror, CHANX);
+  /* Build unique X- and Y-direction connection block modules */
+  std::vector<std::pair<const RRGSB*, t_rr_type>> cbs;
+  for (const t_rr_type& cb_type : {CHANX, CHANY}) {
+    for (size_t icb = 0; icb < device_rr_gsb.get_num_cb_unique_module(cb_type);
+         ++icb) {
+      cbs.push_back(std::make_pair(
+        &(device_rr_gsb.get_cb_unique_module(cb_type, icb)), cb_type));
+    }
   }
 
-  /* Build unique X-direction connection block modules */
-  for (size_t icb = 0; icb < device_rr_gsb.get_num_cb_unique_module(CHANY);
-       ++icb) {
-    const RRGSB& unique_mirror = device_rr_gsb.get_cb_unique_module(CHANY, icb);
-
-    print_spice_routing_connection_box_unique_module(
-      netlist_manager, module_manager, subckt_dir, unique_mirror, CHANY);
-  }
+  print_spice_routing_modules(netlist_manager, module_manager, subckt_dir, sbs,
+                              cbs, num_threads);
 
   /*
   VTR_LOG("Writing header file for routing submodules '%s'...",
@@ -6,6 +6,7 @@
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
 #include "vtr_log.h"
+#include "vtr_time.h"
 
 /* Headers from openfpgashell library */
 #include "command_exit_codes.h"
@@ -37,8 +38,12 @@ int print_spice_submodule(NetlistManager& netlist_manager,
   int status = CMD_EXEC_SUCCESS;
 
   /* Transistor wrapper */
-  status = print_spice_transistor_wrapper(
-    netlist_manager, openfpga_arch.tech_lib, submodule_dir);
+  {
+    vtr::ScopedStartFinishTimer timer(
+      "Write SPICE netlists for transistor wrappers");
+    status = print_spice_transistor_wrapper(
+      netlist_manager, openfpga_arch.tech_lib, submodule_dir);
+  }
 
   /* Error out if fatal errors have been reported */
   if (CMD_EXEC_SUCCESS != status) {
@@ -46,8 +51,12 @@ int print_spice_submodule(NetlistManager& netlist_manager,
   }
 
   /* Constant modules: VDD and GND */
-  status =
-    print_spice_supply_wrappers(netlist_manager, module_manager, submodule_dir);
+  {
+    vtr::ScopedStartFinishTimer timer(
+      "Write SPICE netlists for supply wrappers");
+    status = print_spice_supply_wrappers(netlist_manager, module_manager,
+                                         submodule_dir);
+  }
 
   /* Error out if fatal errors have been reported */
   if (CMD_EXEC_SUCCESS != status) {
@@ -60,9 +69,14 @@ int print_spice_submodule(NetlistManager& netlist_manager,
    *   - transmission-gate/pass-transistor
    *   - wires
    */
-  status = print_spice_essential_gates(
-    netlist_manager, module_manager, openfpga_arch.circuit_lib,
-    openfpga_arch.tech_lib, openfpga_arch.circuit_tech_binding, submodule_dir);
+  {
+    vtr::ScopedStartFinishTimer timer(
+      "Write SPICE netlists for essential gates");
+    status = print_spice_essential_gates(
+      netlist_manager, module_manager, openfpga_arch.circuit_lib,
+      openfpga_arch.tech_lib, openfpga_arch.circuit_tech_binding,
+      submodule_dir);
+  }
 
   /* Error out if fatal errors have been reported */
   if (CMD_EXEC_SUCCESS != status) {
@@ -72,9 +86,12 @@ int print_spice_submodule(NetlistManager& netlist_manager,
   /* TODO: local decoders for routing multiplexers */
 
   /* Routing multiplexers */
-  status =
-    print_spice_submodule_muxes(netlist_manager, module_manager, mux_lib,
-                                openfpga_arch.circuit_lib, submodule_dir);
+  {
+    vtr::ScopedStartFinishTimer timer("Write SPICE netlists for multiplexers");
+    status =
+      print_spice_submodule_muxes(netlist_manager, module_manager, mux_lib,
+                                  openfpga_arch.circuit_lib, submodule_dir);
+  }
 
   /* Error out if fatal errors have been reported */
   if (CMD_EXEC_SUCCESS != status) {
@@ -82,8 +99,12 @@ int print_spice_submodule(NetlistManager& netlist_manager,
   }
 
   /* Look-Up Tables */
-  status = print_spice_submodule_luts(netlist_manager, module_manager,
-                                      openfpga_arch.circuit_lib, submodule_dir);
+  {
+    vtr::ScopedStartFinishTimer timer("Write SPICE netlists for LUTs");
+    status =
+      print_spice_submodule_luts(netlist_manager, module_manager,
+                                 openfpga_arch.circuit_lib, submodule_dir);
+  }
 
   /* Error out if fatal errors have been reported */
   if (CMD_EXEC_SUCCESS != status) {
@@ -91,9 +112,12 @@ int print_spice_submodule(NetlistManager& netlist_manager,
   }
 
   /* Memories */
-  status =
-    print_spice_submodule_memories(netlist_manager, module_manager, mux_lib,
-                                   openfpga_arch.circuit_lib, submodule_dir);
+  {
+    vtr::ScopedStartFinishTimer timer("Write SPICE netlists for memories");
+    status =
+      print_spice_submodule_memories(netlist_manager, module_manager, mux_lib,
+                                     openfpga_arch.circuit_lib, submodule_dir);
+  }
 
   /* Error out if fatal errors have been reported */
   if (CMD_EXEC_SUCCESS != status) {
@@ -138,8 +138,7 @@ void fpga_fabric_verilog(
 int fpga_verilog_full_testbench(
   const ModuleManager &module_manager,
   const BitstreamManager &bitstream_manager,
-  const FabricBitstream &fabric_bitstream,
-  const MemoryBankShiftRegisterBanks &blwl_sr_banks,
+  const FabricBitstreamProtocolView &fabric_bitstream_view,
   const AtomContext &atom_ctx, const PlacementContext &place_ctx,
   const PinConstraints &pin_constraints, const BusGroup &bus_group,
   const std::string &bitstream_file, const IoLocationMap &io_location_map,
@@ -167,8 +166,8 @@ int fpga_verilog_full_testbench(
     src_dir_path + netlist_name +
     std::string(AUTOCHECK_TOP_TESTBENCH_VERILOG_FILE_POSTFIX);
   print_verilog_full_testbench(
-    module_manager, bitstream_manager, fabric_bitstream, blwl_sr_banks,
-    circuit_lib, config_protocol, fabric_global_port_info, atom_ctx, place_ctx,
+    module_manager, bitstream_manager, fabric_bitstream_view, circuit_lib,
+    config_protocol, fabric_global_port_info, atom_ctx, place_ctx,
     pin_constraints, bus_group, bitstream_file, io_location_map,
     netlist_annotation, netlist_name, top_testbench_file_path,
     simulation_setting, options);
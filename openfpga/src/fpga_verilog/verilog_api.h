@@ -14,7 +14,7 @@
 #include "config_protocol.h"
 #include "decoder_library.h"
 #include "device_rr_gsb.h"
-#include "fabric_bitstream.h"
+#include "fabric_bitstream_protocol_view.h"
 #include "fabric_global_port_info.h"
 #include "fabric_verilog_options.h"
 #include "io_location_map.h"
@@ -47,8 +47,7 @@ void fpga_fabric_verilog(
 int fpga_verilog_full_testbench(
   const ModuleManager& module_manager,
   const BitstreamManager& bitstream_manager,
-  const FabricBitstream& fabric_bitstream,
-  const MemoryBankShiftRegisterBanks& blwl_sr_banks,
+  const FabricBitstreamProtocolView& fabric_bitstream_view,
   const AtomContext& atom_ctx, const PlacementContext& place_ctx,
   const PinConstraints& pin_constraints, const BusGroup& bus_group,
   const std::string& bitstream_file, const IoLocationMap& io_location_map,
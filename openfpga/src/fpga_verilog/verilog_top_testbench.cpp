@@ -980,7 +980,10 @@ static void print_verilog_top_testbench_ports(
 static size_t calculate_num_config_clock_cycles(
   const ConfigProtocol& config_protocol, const bool& fast_configuration,
   const bool& bit_value_to_skip, const BitstreamManager& bitstream_manager,
-  const FabricBitstream& fabric_bitstream) {
+  const FabricBitstreamProtocolView& fabric_bitstream_view) {
+  const FabricBitstream& fabric_bitstream =
+    fabric_bitstream_view.fabric_bitstream();
+
   /* Find the longest regional bitstream */
   size_t regional_bitstream_max_size =
     find_fabric_regional_bitstream_max_size(fabric_bitstream);
@@ -992,8 +995,7 @@ static size_t calculate_num_config_clock_cycles(
       /* TODO: Try to apply different length as the bitstream size for ccffs are
        * different driven by differnt clocks! Tried but no luck yet. */
       regional_bitstream_max_size =
-        config_protocol.num_prog_clocks() *
-        find_fabric_regional_bitstream_max_size(fabric_bitstream);
+        config_protocol.num_prog_clocks() * regional_bitstream_max_size;
     }
   }
 
@@ -1025,9 +1027,7 @@ static size_t calculate_num_config_clock_cycles(
 
         if (config_protocol.num_prog_clocks() > 1) {
           num_bits_to_skip =
-            config_protocol.num_prog_clocks() *
-            find_configuration_chain_fabric_bitstream_size_to_be_skipped(
-              fabric_bitstream, bitstream_manager, bit_value_to_skip);
+            config_protocol.num_prog_clocks() * num_bits_to_skip;
         }
 
         num_config_clock_cycles =
@@ -1046,13 +1046,12 @@ static size_t calculate_num_config_clock_cycles(
       if (BLWL_PROTOCOL_DECODER == config_protocol.bl_protocol_type()) {
         /* For fast configuration, we will skip all the zero data points */
         num_config_clock_cycles =
-          1 + build_memory_bank_fabric_bitstream_by_address(fabric_bitstream)
-                .size();
+          1 + fabric_bitstream_view.memory_bank_bitstream().size();
         if (true == fast_configuration) {
           size_t full_num_config_clock_cycles = num_config_clock_cycles;
           num_config_clock_cycles =
-            1 + find_memory_bank_fast_configuration_fabric_bitstream_size(
-                  fabric_bitstream, bit_value_to_skip);
+            1 + fabric_bitstream_view.memory_bank_fast_configuration_size(
+                  bit_value_to_skip);
           VTR_LOG(
             "Fast configuration reduces number of configuration clock cycles "
             "from %lu to %lu (compression_rate = %f%)\n",
@@ -1063,14 +1062,14 @@ static size_t calculate_num_config_clock_cycles(
         }
       } else if (BLWL_PROTOCOL_FLATTEN == config_protocol.bl_protocol_type()) {
         num_config_clock_cycles =
-          1 + build_memory_bank_flatten_fabric_bitstream(
-                fabric_bitstream, fast_configuration, bit_value_to_skip)
+          1 + fabric_bitstream_view
+                .memory_bank_flatten_bitstream(bit_value_to_skip)
                 .size();
       } else if (BLWL_PROTOCOL_SHIFT_REGISTER ==
                  config_protocol.bl_protocol_type()) {
         num_config_clock_cycles =
-          1 + build_memory_bank_flatten_fabric_bitstream(
-                fabric_bitstream, fast_configuration, bit_value_to_skip)
+          1 + fabric_bitstream_view
+                .memory_bank_flatten_bitstream(bit_value_to_skip)
                 .size();
       }
       break;
@@ -1078,13 +1077,12 @@ static size_t calculate_num_config_clock_cycles(
     case CONFIG_MEM_MEMORY_BANK: {
       /* For fast configuration, we will skip all the zero data points */
       num_config_clock_cycles =
-        1 +
-        build_memory_bank_fabric_bitstream_by_address(fabric_bitstream).size();
+        1 + fabric_bitstream_view.memory_bank_bitstream().size();
       if (true == fast_configuration) {
         size_t full_num_config_clock_cycles = num_config_clock_cycles;
         num_config_clock_cycles =
-          1 + find_memory_bank_fast_configuration_fabric_bitstream_size(
-                fabric_bitstream, bit_value_to_skip);
+          1 + fabric_bitstream_view.memory_bank_fast_configuration_size(
+                bit_value_to_skip);
         VTR_LOG(
           "Fast configuration reduces number of configuration clock cycles "
           "from %lu to %lu (compression_rate = %f%)\n",
@@ -1097,13 +1095,12 @@ static size_t calculate_num_config_clock_cycles(
     }
     case CONFIG_MEM_FRAME_BASED: {
       num_config_clock_cycles =
-        1 +
-        build_frame_based_fabric_bitstream_by_address(fabric_bitstream).size();
+        1 + fabric_bitstream_view.frame_based_bitstream().size();
       if (true == fast_configuration) {
         size_t full_num_config_clock_cycles = num_config_clock_cycles;
         num_config_clock_cycles =
-          1 + find_frame_based_fast_configuration_fabric_bitstream_size(
-                fabric_bitstream, bit_value_to_skip);
+          1 + fabric_bitstream_view.frame_based_fast_configuration_size(
+                bit_value_to_skip);
         VTR_LOG(
           "Fast configuration reduces number of configuration clock cycles "
           "from %lu to %lu (compression_rate = %f%)\n",
@@ -1409,9 +1406,8 @@ static void print_verilog_top_testbench_generic_stimulus(
 static int print_verilog_top_testbench_configuration_protocol_stimulus(
   std::fstream& fp, const ConfigProtocol& config_protocol,
   const SimulationSetting& sim_settings, const ModuleManager& module_manager,
-  const ModuleId& top_module, const bool& fast_configuration,
-  const bool& bit_value_to_skip, const FabricBitstream& fabric_bitstream,
-  const MemoryBankShiftRegisterBanks& blwl_sr_banks,
+  const ModuleId& top_module, const bool& bit_value_to_skip,
+  const FabricBitstreamProtocolView& fabric_bitstream_view,
   const float& prog_clock_period, const float& timescale) {
   /* Validate the file stream */
   valid_file_stream(fp);
@@ -1425,8 +1421,8 @@ static int print_verilog_top_testbench_configuration_protocol_stimulus(
     case CONFIG_MEM_QL_MEMORY_BANK:
       return print_verilog_top_testbench_configuration_protocol_ql_memory_bank_stimulus(
         fp, config_protocol, sim_settings, module_manager, top_module,
-        fast_configuration, bit_value_to_skip, fabric_bitstream, blwl_sr_banks,
-        prog_clock_period, timescale);
+        bit_value_to_skip, fabric_bitstream_view, prog_clock_period,
+        timescale);
       break;
     case CONFIG_MEM_MEMORY_BANK:
     case CONFIG_MEM_FRAME_BASED: {
@@ -1972,21 +1968,21 @@ static void print_verilog_full_testbench_memory_bank_bitstream(
   std::fstream& fp, const std::string& bitstream_file,
   const bool& fast_configuration, const bool& bit_value_to_skip,
   const ModuleManager& module_manager, const ModuleId& top_module,
-  const FabricBitstream& fabric_bitstream) {
+  const FabricBitstreamProtocolView& fabric_bitstream_view) {
   /* Validate the file stream */
   valid_file_stream(fp);
 
   /* Reorganize the fabric bitstream by the same address across regions */
-  MemoryBankFabricBitstream fabric_bits_by_addr =
-    build_memory_bank_fabric_bitstream_by_address(fabric_bitstream);
+  const MemoryBankFabricBitstream& fabric_bits_by_addr =
+    fabric_bitstream_view.memory_bank_bitstream();
 
   /* For fast configuration, identify the final bitstream size to be used */
   size_t num_bits_to_skip = 0;
   if (true == fast_configuration) {
     num_bits_to_skip =
       fabric_bits_by_addr.size() -
-      find_memory_bank_fast_configuration_fabric_bitstream_size(
-        fabric_bitstream, bit_value_to_skip);
+      fabric_bitstream_view.memory_bank_fast_configuration_size(
+        bit_value_to_skip);
   }
   VTR_ASSERT(num_bits_to_skip < fabric_bits_by_addr.size());
 
@@ -2133,21 +2129,21 @@ static void print_verilog_full_testbench_frame_decoder_bitstream(
   std::fstream& fp, const std::string& bitstream_file,
   const bool& fast_configuration, const bool& bit_value_to_skip,
   const ModuleManager& module_manager, const ModuleId& top_module,
-  const FabricBitstream& fabric_bitstream) {
+  const FabricBitstreamProtocolView& fabric_bitstream_view) {
   /* Validate the file stream */
   valid_file_stream(fp);
 
   /* Reorganize the fabric bitstream by the same address across regions */
-  FrameFabricBitstream fabric_bits_by_addr =
-    build_frame_based_fabric_bitstream_by_address(fabric_bitstream);
+  const FrameFabricBitstream& fabric_bits_by_addr =
+    fabric_bitstream_view.frame_based_bitstream();
 
   /* For fast configuration, identify the final bitstream size to be used */
   size_t num_bits_to_skip = 0;
   if (true == fast_configuration) {
     num_bits_to_skip =
       fabric_bits_by_addr.size() -
-      find_frame_based_fast_configuration_fabric_bitstream_size(
-        fabric_bitstream, bit_value_to_skip);
+      fabric_bitstream_view.frame_based_fast_configuration_size(
+        bit_value_to_skip);
   }
   VTR_ASSERT(num_bits_to_skip < fabric_bits_by_addr.size());
 
@@ -2279,8 +2275,10 @@ static void print_verilog_full_testbench_bitstream(
   const ConfigProtocol& config_protocol, const bool& fast_configuration,
   const bool& bit_value_to_skip, const ModuleManager& module_manager,
   const ModuleId& top_module, const BitstreamManager& bitstream_manager,
-  const FabricBitstream& fabric_bitstream,
-  const MemoryBankShiftRegisterBanks& blwl_sr_banks) {
+  const FabricBitstreamProtocolView& fabric_bitstream_view) {
+  const FabricBitstream& fabric_bitstream =
+    fabric_bitstream_view.fabric_bitstream();
+
   /* Branch on the type of configuration protocol */
   switch (config_protocol.type()) {
     case CONFIG_MEM_STANDALONE:
@@ -2297,18 +2295,17 @@ static void print_verilog_full_testbench_bitstream(
     case CONFIG_MEM_MEMORY_BANK:
       print_verilog_full_testbench_memory_bank_bitstream(
         fp, bitstream_file, fast_configuration, bit_value_to_skip,
-        module_manager, top_module, fabric_bitstream);
+        module_manager, top_module, fabric_bitstream_view);
       break;
     case CONFIG_MEM_QL_MEMORY_BANK:
       print_verilog_full_testbench_ql_memory_bank_bitstream(
         fp, bitstream_file, config_protocol, fast_configuration,
-        bit_value_to_skip, module_manager, top_module, fabric_bitstream,
-        blwl_sr_banks);
+        bit_value_to_skip, module_manager, top_module, fabric_bitstream_view);
       break;
     case CONFIG_MEM_FRAME_BASED:
       print_verilog_full_testbench_frame_decoder_bitstream(
         fp, bitstream_file, fast_configuration, bit_value_to_skip,
-        module_manager, top_module, fabric_bitstream);
+        module_manager, top_module, fabric_bitstream_view);
 
       break;
     default:
@@ -2429,8 +2426,7 @@ static void print_verilog_top_testbench_check(
 int print_verilog_full_testbench(
   const ModuleManager& module_manager,
   const BitstreamManager& bitstream_manager,
-  const FabricBitstream& fabric_bitstream,
-  const MemoryBankShiftRegisterBanks& blwl_sr_banks,
+  const FabricBitstreamProtocolView& fabric_bitstream_view,
   const CircuitLibrary& circuit_lib, const ConfigProtocol& config_protocol,
   const FabricGlobalPortInfo& global_ports, const AtomContext& atom_ctx,
   const PlacementContext& place_ctx, const PinConstraints& pin_constraints,
@@ -2440,6 +2436,8 @@ int print_verilog_full_testbench(
   const std::string& circuit_name, const std::string& verilog_fname,
   const SimulationSetting& simulation_parameters,
   const VerilogTestbenchOption& options) {
+  const FabricBitstream& fabric_bitstream =
+    fabric_bitstream_view.fabric_bitstream();
   bool fast_configuration = options.fast_configuration();
   bool explicit_port_mapping = options.explicit_port_mapping();
 
@@ -2512,7 +2510,7 @@ int print_verilog_full_testbench(
   /* Estimate the number of configuration clock cycles */
   size_t num_config_clock_cycles = calculate_num_config_clock_cycles(
     config_protocol, apply_fast_configuration, bit_value_to_skip,
-    bitstream_manager, fabric_bitstream);
+    bitstream_manager, fabric_bitstream_view);
 
   /* Generate stimuli for general control signals */
   print_verilog_top_testbench_generic_stimulus(
@@ -2523,8 +2521,8 @@ int print_verilog_full_testbench(
   int status = CMD_EXEC_SUCCESS;
   status = print_verilog_top_testbench_configuration_protocol_stimulus(
     fp, config_protocol, simulation_parameters, module_manager, top_module,
-    fast_configuration, bit_value_to_skip, fabric_bitstream, blwl_sr_banks,
-    prog_clock_period, VERILOG_SIM_TIMESCALE);
+    bit_value_to_skip, fabric_bitstream_view, prog_clock_period,
+    VERILOG_SIM_TIMESCALE);
 
   if (status == CMD_EXEC_FATAL_ERROR) {
     return status;
@@ -2586,7 +2584,7 @@ int print_verilog_full_testbench(
   print_verilog_full_testbench_bitstream(
     fp, bitstream_file, config_protocol, apply_fast_configuration,
     bit_value_to_skip, module_manager, top_module, bitstream_manager,
-    fabric_bitstream, blwl_sr_banks);
+    fabric_bitstream_view);
 
   /* Add signal initialization:
    * Bypass writing codes to files due to the autogenerated codes are very
@@ -11,10 +11,9 @@
 #include "bus_group.h"
 #include "circuit_library.h"
 #include "config_protocol.h"
-#include "fabric_bitstream.h"
+#include "fabric_bitstream_protocol_view.h"
 #include "fabric_global_port_info.h"
 #include "io_location_map.h"
-#include "memory_bank_shift_register_banks.h"
 #include "module_manager.h"
 #include "pin_constraints.h"
 #include "simulation_setting.h"
@@ -32,8 +31,7 @@ namespace openfpga {
 int print_verilog_full_testbench(
   const ModuleManager& module_manager,
   const BitstreamManager& bitstream_manager,
-  const FabricBitstream& fabric_bitstream,
-  const MemoryBankShiftRegisterBanks& blwl_sr_banks,
+  const FabricBitstreamProtocolView& fabric_bitstream_view,
   const CircuitLibrary& circuit_lib, const ConfigProtocol& config_protocol,
   const FabricGlobalPortInfo& global_ports, const AtomContext& atom_ctx,
   const PlacementContext& place_ctx, const PinConstraints& pin_constraints,
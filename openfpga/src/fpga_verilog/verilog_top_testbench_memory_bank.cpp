@@ -450,9 +450,8 @@ static int constrain_blwl_shift_register_clock_period_from_simulation_settings(
 int print_verilog_top_testbench_configuration_protocol_ql_memory_bank_stimulus(
   std::fstream& fp, const ConfigProtocol& config_protocol,
   const SimulationSetting& sim_settings, const ModuleManager& module_manager,
-  const ModuleId& top_module, const bool& fast_configuration,
-  const bool& bit_value_to_skip, const FabricBitstream& fabric_bitstream,
-  const MemoryBankShiftRegisterBanks& blwl_sr_banks,
+  const ModuleId& top_module, const bool& bit_value_to_skip,
+  const FabricBitstreamProtocolView& fabric_bitstream_view,
   const float& prog_clock_period, const float& timescale) {
   ModulePortId en_port_id = module_manager.find_module_port(
     top_module, std::string(DECODER_ENABLE_PORT_NAME));
@@ -485,9 +484,9 @@ int print_verilog_top_testbench_configuration_protocol_ql_memory_bank_stimulus(
   if ((CONFIG_MEM_QL_MEMORY_BANK == config_protocol.type()) &&
       (BLWL_PROTOCOL_SHIFT_REGISTER == config_protocol.bl_protocol_type()) &&
       (BLWL_PROTOCOL_SHIFT_REGISTER == config_protocol.wl_protocol_type())) {
-    MemoryBankShiftRegisterFabricBitstream fabric_bits_by_addr =
-      build_memory_bank_shift_register_fabric_bitstream(
-        fabric_bitstream, blwl_sr_banks, fast_configuration, bit_value_to_skip);
+    const MemoryBankShiftRegisterFabricBitstream& fabric_bits_by_addr =
+      fabric_bitstream_view.memory_bank_shift_register_bitstream(
+        bit_value_to_skip);
 
     /* Compute the auto-tuned clock period first, this is the lower bound of the
      * shift register clock periods:
@@ -558,16 +557,15 @@ int print_verilog_top_testbench_configuration_protocol_ql_memory_bank_stimulus(
  * BL/WLs */
 static void print_verilog_full_testbench_ql_memory_bank_flatten_bitstream(
   std::fstream& fp, const std::string& bitstream_file,
-  const bool& fast_configuration, const bool& bit_value_to_skip,
-  const ModuleManager& module_manager, const ModuleId& top_module,
-  const FabricBitstream& fabric_bitstream) {
+  const bool& bit_value_to_skip, const ModuleManager& module_manager,
+  const ModuleId& top_module,
+  const FabricBitstreamProtocolView& fabric_bitstream_view) {
   /* Validate the file stream */
   valid_file_stream(fp);
 
   /* Reorganize the fabric bitstream by the same address across regions */
-  MemoryBankFlattenFabricBitstream fabric_bits_by_addr =
-    build_memory_bank_flatten_fabric_bitstream(
-      fabric_bitstream, fast_configuration, bit_value_to_skip);
+  const MemoryBankFlattenFabricBitstream& fabric_bits_by_addr =
+    fabric_bitstream_view.memory_bank_flatten_bitstream(bit_value_to_skip);
 
   /* Feed address and data input pair one by one
    * Note: the first cycle is reserved for programming reset
@@ -708,17 +706,16 @@ static void print_verilog_full_testbench_ql_memory_bank_flatten_bitstream(
 static void
 print_verilog_full_testbench_ql_memory_bank_shift_register_bitstream(
   std::fstream& fp, const std::string& bitstream_file,
-  const bool& fast_configuration, const bool& bit_value_to_skip,
-  const ModuleManager& module_manager, const ModuleId& top_module,
-  const FabricBitstream& fabric_bitstream,
-  const MemoryBankShiftRegisterBanks& blwl_sr_banks) {
+  const bool& bit_value_to_skip, const ModuleManager& module_manager,
+  const ModuleId& top_module,
+  const FabricBitstreamProtocolView& fabric_bitstream_view) {
   /* Validate the file stream */
   valid_file_stream(fp);
 
   /* Reorganize the fabric bitstream by the same address across regions */
-  MemoryBankShiftRegisterFabricBitstream fabric_bits_by_addr =
-    build_memory_bank_shift_register_fabric_bitstream(
-      fabric_bitstream, blwl_sr_banks, fast_configuration, bit_value_to_skip);
+  const MemoryBankShiftRegisterFabricBitstream& fabric_bits_by_addr =
+    fabric_bitstream_view.memory_bank_shift_register_bitstream(
+      bit_value_to_skip);
 
   /* Feed address and data input pair one by one
    * Note: the first cycle is reserved for programming reset
@@ -1077,21 +1074,21 @@ static void print_verilog_full_testbench_ql_memory_bank_decoder_bitstream(
   std::fstream& fp, const std::string& bitstream_file,
   const bool& fast_configuration, const bool& bit_value_to_skip,
   const ModuleManager& module_manager, const ModuleId& top_module,
-  const FabricBitstream& fabric_bitstream) {
+  const FabricBitstreamProtocolView& fabric_bitstream_view) {
   /* Validate the file stream */
   valid_file_stream(fp);
 
   /* Reorganize the fabric bitstream by the same address across regions */
-  MemoryBankFabricBitstream fabric_bits_by_addr =
-    build_memory_bank_fabric_bitstream_by_address(fabric_bitstream);
+  const MemoryBankFabricBitstream& fabric_bits_by_addr =
+    fabric_bitstream_view.memory_bank_bitstream();
 
   /* For fast configuration, identify the final bitstream size to be used */
   size_t num_bits_to_skip = 0;
   if (true == fast_configuration) {
     num_bits_to_skip =
       fabric_bits_by_addr.size() -
-      find_memory_bank_fast_configuration_fabric_bitstream_size(
-        fabric_bitstream, bit_value_to_skip);
+      fabric_bitstream_view.memory_bank_fast_configuration_size(
+        bit_value_to_skip);
   }
   VTR_ASSERT(num_bits_to_skip < fabric_bits_by_addr.size());
 
@@ -1234,25 +1231,25 @@ void print_verilog_full_testbench_ql_memory_bank_bitstream(
   std::fstream& fp, const std::string& bitstream_file,
   const ConfigProtocol& config_protocol, const bool& fast_configuration,
   const bool& bit_value_to_skip, const ModuleManager& module_manager,
-  const ModuleId& top_module, const FabricBitstream& fabric_bitstream,
-  const MemoryBankShiftRegisterBanks& blwl_sr_banks) {
+  const ModuleId& top_module,
+  const FabricBitstreamProtocolView& fabric_bitstream_view) {
   if ((BLWL_PROTOCOL_DECODER == config_protocol.bl_protocol_type()) &&
       (BLWL_PROTOCOL_DECODER == config_protocol.wl_protocol_type())) {
     print_verilog_full_testbench_ql_memory_bank_decoder_bitstream(
       fp, bitstream_file, fast_configuration, bit_value_to_skip, module_manager,
-      top_module, fabric_bitstream);
+      top_module, fabric_bitstream_view);
   } else if ((BLWL_PROTOCOL_FLATTEN == config_protocol.bl_protocol_type()) &&
              (BLWL_PROTOCOL_FLATTEN == config_protocol.wl_protocol_type())) {
     print_verilog_full_testbench_ql_memory_bank_flatten_bitstream(
-      fp, bitstream_file, fast_configuration, bit_value_to_skip, module_manager,
-      top_module, fabric_bitstream);
+      fp, bitstream_file, bit_value_to_skip, module_manager, top_module,
+      fabric_bitstream_view);
   } else if ((BLWL_PROTOCOL_SHIFT_REGISTER ==
               config_protocol.bl_protocol_type()) &&
              (BLWL_PROTOCOL_SHIFT_REGISTER ==
               config_protocol.wl_protocol_type())) {
     print_verilog_full_testbench_ql_memory_bank_shift_register_bitstream(
-      fp, bitstream_file, fast_configuration, bit_value_to_skip, module_manager,
-      top_module, fabric_bitstream, blwl_sr_banks);
+      fp, bitstream_file, bit_value_to_skip, module_manager, top_module,
+      fabric_bitstream_view);
   }
 }
 
@@ -10,10 +10,9 @@
 #include "bitstream_manager.h"
 #include "circuit_library.h"
 #include "config_protocol.h"
-#include "fabric_bitstream.h"
+#include "fabric_bitstream_protocol_view.h"
 #include "fabric_global_port_info.h"
 #include "io_location_map.h"
-#include "memory_bank_shift_register_banks.h"
 #include "module_manager.h"
 #include "pin_constraints.h"
 #include "simulation_setting.h"
@@ -51,9 +50,8 @@ void print_verilog_top_testbench_global_shift_register_clock_ports_stimuli(
 int print_verilog_top_testbench_configuration_protocol_ql_memory_bank_stimulus(
   std::fstream& fp, const ConfigProtocol& config_protocol,
   const SimulationSetting& sim_settings, const ModuleManager& module_manager,
-  const ModuleId& top_module, const bool& fast_configuration,
-  const bool& bit_value_to_skip, const FabricBitstream& fabric_bitstream,
-  const MemoryBankShiftRegisterBanks& blwl_sr_banks,
+  const ModuleId& top_module, const bool& bit_value_to_skip,
+  const FabricBitstreamProtocolView& fabric_bitstream_view,
   const float& prog_clock_period, const float& timescale);
 
 /**
@@ -64,8 +62,8 @@ void print_verilog_full_testbench_ql_memory_bank_bitstream(
   std::fstream& fp, const std::string& bitstream_file,
   const ConfigProtocol& config_protocol, const bool& fast_configuration,
   const bool& bit_value_to_skip, const ModuleManager& module_manager,
-  const ModuleId& top_module, const FabricBitstream& fabric_bitstream,
-  const MemoryBankShiftRegisterBanks& blwl_sr_banks);
+  const ModuleId& top_module,
+  const FabricBitstreamProtocolView& fabric_bitstream_view);
 
 } /* end namespace openfpga */
 
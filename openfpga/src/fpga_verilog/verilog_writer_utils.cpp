@@ -2,8 +2,6 @@
  * Include functions for most frequently
  * used Verilog writers
  ***********************************************/
-#include <chrono>
-#include <ctime>
 #include <fstream>
 #include <iomanip>
 #include <string>
@@ -53,9 +51,7 @@ void print_verilog_file_header(std::fstream& fp, const std::string& usage,
   fp << "//\tOrganization: University of Utah" << std::endl;
 
   if (include_time_stamp) {
-    auto end = std::chrono::system_clock::now();
-    std::time_t end_time = std::chrono::system_clock::to_time_t(end);
-    fp << "//\tDate: " << std::ctime(&end_time);
+    fp << "//\tDate: " << get_current_time_stamp();
   }
 
   fp << "//-------------------------------------------" << std::endl;
@@ -2,6 +2,8 @@
  * This file includes functions that are used to redo packing for physical pbs
  ***************************************************************************************/
 
+#include <utility>
+
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
 #include "vtr_log.h"
@@ -976,7 +978,7 @@ static void repack_cluster(const AtomContext& atom_ctx,
   VTR_LOGV(verbose, "Saved results in physical pb\n");
 
   /* Add the pb to clustering context */
-  clustering_annotation.add_physical_pb(block_id, phy_pb);
+  clustering_annotation.add_physical_pb(block_id, std::move(phy_pb));
 
   VTR_LOG("Done\n");
 }
@@ -3,6 +3,9 @@
  * between tiles (programmable blocks)
  ***************************************************************************************/
 
+#include <map>
+#include <tuple>
+
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
 #include "vtr_log.h"
@@ -15,6 +18,7 @@
 
 /* Headers from vpr library */
 #include "build_tile_direct.h"
+#include "grid_type_lookup.h"
 #include "vpr_utils.h"
 
 /* begin namespace openfpga */
@@ -143,6 +147,36 @@ static std::vector<size_t> find_physical_tile_pin_id(
   return pin_ids;
 }
 
+/***************************************************************************************
+ * The pin ids of a port found in physical tiles, indexed by
+ * (physical tile, width offset, height offset, side)
+ ***************************************************************************************/
+typedef std::map<std::tuple<t_physical_tile_type_ptr, size_t, size_t, e_side>,
+                 std::vector<size_t>>
+  PhysicalTilePinCache;
+
+/***************************************************************************************
+ * Find the pin ids of a physical tile based on the given port, which is
+ * the same for all the grids of a direct connection. The pin ids are
+ * found only once for each tile type, offset and side, and then cached
+ ***************************************************************************************/
+static const std::vector<size_t>& find_cached_physical_tile_pin_id(
+  PhysicalTilePinCache& pin_cache, t_physical_tile_type_ptr physical_tile,
+  const size_t& pin_width_offset, const size_t& pin_height_offset,
+  const BasicPort& tile_port, const e_side& pin_side) {
+  auto cache_key = std::make_tuple(physical_tile, pin_width_offset,
+                                   pin_height_offset, pin_side);
+  auto result = pin_cache.find(cache_key);
+  if (result != pin_cache.end()) {
+    return result->second;
+  }
+  return pin_cache
+    .emplace(cache_key,
+             find_physical_tile_pin_id(physical_tile, pin_width_offset,
+                                       pin_height_offset, tile_port, pin_side))
+    .first->second;
+}
+
 /********************************************************************
  * Check if the grid coorindate given is in the device grid range
  *******************************************************************/
@@ -152,42 +186,20 @@ static bool is_grid_coordinate_exist_in_device(
           vtr::Point<size_t>(device_grid.width(), device_grid.height()));
 }
 
-/********************************************************************
- * Find the coordinate of a grid in a specific column
- * with a given type
- * This function will return the coordinate of the grid that satifies
- * the type requirement
- *******************************************************************/
-static vtr::Point<size_t> find_grid_coordinate_given_type(
-  const DeviceGrid& grids,
-  const std::vector<vtr::Point<size_t>>& candidate_coords,
-  const std::string& wanted_grid_type_name) {
-  for (vtr::Point<size_t> coord : candidate_coords) {
-    /* If the next column is not longer in device range, we can return */
-    if (false == is_grid_coordinate_exist_in_device(grids, coord)) {
-      continue;
-    }
-    if (wanted_grid_type_name ==
-        std::string(grids[coord.x()][coord.y()].type->name)) {
-      return coord;
-    }
-  }
-  /* Return an valid coordinate */
-  return vtr::Point<size_t>(grids.width(), grids.height());
-}
-
 /********************************************************************
  * Find the coordinate of the destination clb/heterogeneous block
  * considering intra column/row direct connections in core grids
  *******************************************************************/
 static vtr::Point<size_t> find_inter_direct_destination_coordinate(
-  const DeviceGrid& grids, const vtr::Point<size_t>& src_coord,
-  const std::string des_tile_type_name, const ArchDirect& arch_direct,
-  const ArchDirectId& arch_direct_id) {
+  const DeviceGrid& grids, const GridTypeLookup& grid_type_lookup,
+  const vtr::Point<size_t>& src_coord, const std::string des_tile_type_name,
+  const ArchDirect& arch_direct, const ArchDirectId& arch_direct_id) {
   vtr::Point<size_t> des_coord(grids.width(), grids.height());
 
   std::vector<size_t> first_search_space;
-  std::vector<size_t> second_search_space;
+  /* The second search space always covers the core grids, which is
+   * searched in the reverse order depending on the direction */
+  bool reverse_second_search_space = false;
 
   /* Cross column connection from Bottom to Top on Right
    * The next column may NOT have the grid type we want!
@@ -233,9 +245,6 @@ static vtr::Point<size_t> find_inter_direct_destination_coordinate(
      *  | Grid | 1
      *  +------+
      */
-    for (size_t iy = 1; iy < grids.height() - 1; ++iy) {
-      second_search_space.push_back(iy);
-    }
 
     /* For negative direction, our second search space will be in y-direction:
      *
@@ -249,9 +258,8 @@ static vtr::Point<size_t> find_inter_direct_destination_coordinate(
      *  | Grid | 1
      *  +------+
      */
-    if (POSITIVE_DIR == arch_direct.y_dir(arch_direct_id)) {
-      std::reverse(second_search_space.begin(), second_search_space.end());
-    }
+    reverse_second_search_space =
+      (POSITIVE_DIR == arch_direct.y_dir(arch_direct_id));
   }
 
   /* Cross row connection from Bottom to Top on Right
@@ -304,9 +312,6 @@ static vtr::Point<size_t> find_inter_direct_destination_coordinate(
      *  | Grid |<------| Grid |
      *  +------+       +------+
      */
-    for (size_t ix = 1; ix < grids.width() - 1; ++ix) {
-      second_search_space.push_back(ix);
-    }
 
     /* For negative direction,
      * our second search space will be in x-direction:
@@ -316,24 +321,23 @@ static vtr::Point<size_t> find_inter_direct_destination_coordinate(
      *  | Grid |------>| Grid |
      *  +------+       +------+
      */
-    if (POSITIVE_DIR == arch_direct.x_dir(arch_direct_id)) {
-      std::reverse(second_search_space.begin(), second_search_space.end());
-    }
+    reverse_second_search_space =
+      (POSITIVE_DIR == arch_direct.x_dir(arch_direct_id));
   }
 
   for (size_t ix : first_search_space) {
-    std::vector<vtr::Point<size_t>> next_col_row_coords;
-    for (size_t iy : second_search_space) {
-      if (INTER_COLUMN == arch_direct.type(arch_direct_id)) {
-        next_col_row_coords.push_back(vtr::Point<size_t>(ix, iy));
-      } else {
-        VTR_ASSERT(INTER_ROW == arch_direct.type(arch_direct_id));
-        /* For cross-row connection, our search space is flipped */
-        next_col_row_coords.push_back(vtr::Point<size_t>(iy, ix));
-      }
+    vtr::Point<size_t> des_coord_cand(grids.width(), grids.height());
+    if (INTER_COLUMN == arch_direct.type(arch_direct_id)) {
+      des_coord_cand = grid_type_lookup.find_coordinate_in_column(
+        des_tile_type_name, ix, 1, grids.height() - 1,
+        reverse_second_search_space);
+    } else {
+      VTR_ASSERT(INTER_ROW == arch_direct.type(arch_direct_id));
+      /* For cross-row connection, our search space is flipped */
+      des_coord_cand = grid_type_lookup.find_coordinate_in_row(
+        des_tile_type_name, ix, 1, grids.width() - 1,
+        reverse_second_search_space);
     }
-    vtr::Point<size_t> des_coord_cand = find_grid_coordinate_given_type(
-      grids, next_col_row_coords, des_tile_type_name);
     /* For a valid coordinate, we can return */
     if (true == is_grid_coordinate_exist_in_device(grids, des_coord_cand)) {
       return des_coord_cand;
@@ -382,8 +386,8 @@ static void report_direct_from_port_and_to_port_mismatch(
  ***************************************************************************************/
 static void build_inner_column_row_tile_direct(
   TileDirect& tile_direct, const t_direct_inf& vpr_direct,
-  const DeviceContext& device_ctx, const ArchDirectId& arch_direct_id,
-  const bool& verbose) {
+  const DeviceContext& device_ctx, const GridTypeLookup& grid_type_lookup,
+  const ArchDirectId& arch_direct_id, const bool& verbose) {
   /* Get the source tile and pin information */
   std::string from_tile_name =
     parse_direct_tile_name(std::string(vpr_direct.from_pin));
@@ -398,90 +402,83 @@ static void build_inner_column_row_tile_direct(
     parse_direct_port(std::string(vpr_direct.to_pin)));
   const BasicPort& to_tile_port = to_tile_port_parser.port();
 
-  /* Walk through the device fabric and find the grid that fit the source */
-  for (size_t x = 0; x < device_ctx.grid.width(); ++x) {
-    for (size_t y = 0; y < device_ctx.grid.height(); ++y) {
-      /* Bypass empty grid */
-      if (true == is_empty_type(device_ctx.grid[x][y].type)) {
+  PhysicalTilePinCache from_pin_cache;
+  PhysicalTilePinCache to_pin_cache;
+
+  /* Walk through the grids that fit the source */
+  for (const vtr::Point<size_t>& from_grid_coord :
+       grid_type_lookup.coordinates(from_tile_name)) {
+    const t_grid_tile& from_grid =
+      device_ctx.grid[from_grid_coord.x()][from_grid_coord.y()];
+
+    /* Search all the sides, the from pin may locate any side!
+     * Note: the vpr_direct.from_side is NUM_SIDES, which is unintialized
+     * This should be reported to VPR!!!
+     */
+    for (const e_side& from_side : {TOP, RIGHT, BOTTOM, LEFT}) {
+      /* Try to find the pin in this tile */
+      const std::vector<size_t>& from_pins = find_cached_physical_tile_pin_id(
+        from_pin_cache, from_grid.type, from_grid.width_offset,
+        from_grid.height_offset, from_tile_port, from_side);
+      /* If nothing found, we can continue */
+      if (0 == from_pins.size()) {
+        continue;
+      }
+
+      /* We should try to the sink grid for inner-column/row direct
+       * connections */
+      vtr::Point<size_t> to_grid_coord(
+        from_grid_coord.x() + vpr_direct.x_offset,
+        from_grid_coord.y() + vpr_direct.y_offset);
+      if (false ==
+          is_grid_coordinate_exist_in_device(device_ctx.grid, to_grid_coord)) {
         continue;
       }
+      const t_grid_tile& to_grid =
+        device_ctx.grid[to_grid_coord.x()][to_grid_coord.y()];
 
       /* Bypass the grid that does not fit the from_tile name */
-      if (from_tile_name != std::string(device_ctx.grid[x][y].type->name)) {
+      if (to_tile_name != std::string(to_grid.type->name)) {
         continue;
       }
 
-      /* Search all the sides, the from pin may locate any side!
-       * Note: the vpr_direct.from_side is NUM_SIDES, which is unintialized
+      /* Search all the sides, the to pin may locate any side!
+       * Note: the vpr_direct.to_side is NUM_SIDES, which is unintialized
        * This should be reported to VPR!!!
        */
-      for (const e_side& from_side : {TOP, RIGHT, BOTTOM, LEFT}) {
+      for (const e_side& to_side : {TOP, RIGHT, BOTTOM, LEFT}) {
         /* Try to find the pin in this tile */
-        std::vector<size_t> from_pins = find_physical_tile_pin_id(
-          device_ctx.grid[x][y].type, device_ctx.grid[x][y].width_offset,
-          device_ctx.grid[x][y].height_offset, from_tile_port, from_side);
+        const std::vector<size_t>& to_pins = find_cached_physical_tile_pin_id(
+          to_pin_cache, to_grid.type, to_grid.width_offset,
+          to_grid.height_offset, to_tile_port, to_side);
         /* If nothing found, we can continue */
-        if (0 == from_pins.size()) {
-          continue;
-        }
-
-        /* We should try to the sink grid for inner-column/row direct
-         * connections */
-        vtr::Point<size_t> from_grid_coord(x, y);
-        vtr::Point<size_t> to_grid_coord(x + vpr_direct.x_offset,
-                                         y + vpr_direct.y_offset);
-        if (false == is_grid_coordinate_exist_in_device(device_ctx.grid,
-                                                        to_grid_coord)) {
+        if (0 == to_pins.size()) {
           continue;
         }
 
-        /* Bypass the grid that does not fit the from_tile name */
-        if (to_tile_name !=
-            std::string(device_ctx.grid[to_grid_coord.x()][to_grid_coord.y()]
-                          .type->name)) {
-          continue;
+        /* If from port and to port do not match in sizes, error out */
+        if (from_pins.size() != to_pins.size()) {
+          report_direct_from_port_and_to_port_mismatch(
+            vpr_direct, from_tile_port, to_tile_port);
+          exit(1);
         }
 
-        /* Search all the sides, the to pin may locate any side!
-         * Note: the vpr_direct.to_side is NUM_SIDES, which is unintialized
-         * This should be reported to VPR!!!
-         */
-        for (const e_side& to_side : {TOP, RIGHT, BOTTOM, LEFT}) {
-          /* Try to find the pin in this tile */
-          std::vector<size_t> to_pins = find_physical_tile_pin_id(
-            device_ctx.grid[to_grid_coord.x()][to_grid_coord.y()].type,
-            device_ctx.grid[to_grid_coord.x()][to_grid_coord.y()].width_offset,
-            device_ctx.grid[to_grid_coord.x()][to_grid_coord.y()].height_offset,
-            to_tile_port, to_side);
-          /* If nothing found, we can continue */
-          if (0 == to_pins.size()) {
-            continue;
-          }
-
-          /* If from port and to port do not match in sizes, error out */
-          if (from_pins.size() != to_pins.size()) {
-            report_direct_from_port_and_to_port_mismatch(
-              vpr_direct, from_tile_port, to_tile_port);
-            exit(1);
-          }
-
-          /* Now add the tile direct */
-          for (size_t ipin = 0; ipin < from_pins.size(); ++ipin) {
-            VTR_LOGV(verbose,
-                     "Built a inner-column/row tile-to-tile direct from "
-                     "%s[%lu][%lu].%s[%lu] at side '%s' to "
-                     "%s[%lu][%lu].%s[%lu] at side '%s'\n",
-                     from_tile_name.c_str(), x, y,
-                     from_tile_port.get_name().c_str(), from_pins[ipin],
-                     SIDE_STRING[from_side], to_tile_name.c_str(),
-                     to_grid_coord.x(), to_grid_coord.y(),
-                     to_tile_port.get_name().c_str(), to_pins[ipin],
-                     SIDE_STRING[to_side]);
-            TileDirectId tile_direct_id = tile_direct.add_direct(
-              from_grid_coord, from_side, from_pins[ipin], to_grid_coord,
-              to_side, to_pins[ipin]);
-            tile_direct.set_arch_direct_id(tile_direct_id, arch_direct_id);
-          }
+        /* Now add the tile direct */
+        for (size_t ipin = 0; ipin < from_pins.size(); ++ipin) {
+          VTR_LOGV(verbose,
+                   "Built a inner-column/row tile-to-tile direct from "
+                   "%s[%lu][%lu].%s[%lu] at side '%s' to "
+                   "%s[%lu][%lu].%s[%lu] at side '%s'\n",
+                   from_tile_name.c_str(), from_grid_coord.x(),
+                   from_grid_coord.y(), from_tile_port.get_name().c_str(),
+                   from_pins[ipin], SIDE_STRING[from_side],
+                   to_tile_name.c_str(), to_grid_coord.x(), to_grid_coord.y(),
+                   to_tile_port.get_name().c_str(), to_pins[ipin],
+                   SIDE_STRING[to_side]);
+          TileDirectId tile_direct_id =
+            tile_direct.add_direct(from_grid_coord, from_side, from_pins[ipin],
+                                   to_grid_coord, to_side, to_pins[ipin]);
+          tile_direct.set_arch_direct_id(tile_direct_id, arch_direct_id);
         }
       }
     }
@@ -523,8 +520,9 @@ static void build_inner_column_row_tile_direct(
  *******************************************************************/
 static void build_inter_column_row_tile_direct(
   TileDirect& tile_direct, const t_direct_inf& vpr_direct,
-  const DeviceContext& device_ctx, const ArchDirect& arch_direct,
-  const ArchDirectId& arch_direct_id, const bool& verbose) {
+  const DeviceContext& device_ctx, const GridTypeLookup& grid_type_lookup,
+  const ArchDirect& arch_direct, const ArchDirectId& arch_direct_id,
+  const bool& verbose) {
   /* Get the source tile and pin information */
   std::string from_tile_name =
     parse_direct_tile_name(std::string(vpr_direct.from_pin));
@@ -545,6 +543,10 @@ static void build_inter_column_row_tile_direct(
       (INTER_ROW != arch_direct.type(arch_direct_id))) {
     return;
   }
+
+  PhysicalTilePinCache from_pin_cache;
+  PhysicalTilePinCache to_pin_cache;
+
   /* For cross-column connection, we will search the first valid grid in each
    * column from y = 1 to y = ny
    *
@@ -562,20 +564,13 @@ static void build_inter_column_row_tile_direct(
    */
   if (INTER_COLUMN == arch_direct.type(arch_direct_id)) {
     for (size_t ix = 1; ix < device_ctx.grid.width() - 1; ++ix) {
-      std::vector<vtr::Point<size_t>> next_col_src_grid_coords;
-      /* For negative y- direction, we should start from y = ny */
-      for (size_t iy = 1; iy < device_ctx.grid.height() - 1; ++iy) {
-        next_col_src_grid_coords.push_back(vtr::Point<size_t>(ix, iy));
-      }
-      /* For positive y- direction, we should start from y = 1 */
-      if (NEGATIVE_DIR == arch_direct.y_dir(arch_direct_id)) {
-        std::reverse(next_col_src_grid_coords.begin(),
-                     next_col_src_grid_coords.end());
-      }
-
-      /* Bypass the grid that does not fit the from_tile name */
-      vtr::Point<size_t> from_grid_coord = find_grid_coordinate_given_type(
-        device_ctx.grid, next_col_src_grid_coords, from_tile_name);
+      /* For negative y- direction, we should start from y = ny
+       * For positive y- direction, we should start from y = 1
+       */
+      vtr::Point<size_t> from_grid_coord =
+        grid_type_lookup.find_coordinate_in_column(
+          from_tile_name, ix, 1, device_ctx.grid.height() - 1,
+          NEGATIVE_DIR == arch_direct.y_dir(arch_direct_id));
       /* Skip if we do not have a valid coordinate for source CLB/heterogeneous
        * block */
       if (false == is_grid_coordinate_exist_in_device(device_ctx.grid,
@@ -589,7 +584,8 @@ static void build_inter_column_row_tile_direct(
        */
       for (const e_side& from_side : {TOP, RIGHT, BOTTOM, LEFT}) {
         /* Try to find the pin in this tile */
-        std::vector<size_t> from_pins = find_physical_tile_pin_id(
+        const std::vector<size_t>& from_pins = find_cached_physical_tile_pin_id(
+          from_pin_cache,
           device_ctx.grid[from_grid_coord.x()][from_grid_coord.y()].type,
           device_ctx.grid[from_grid_coord.x()][from_grid_coord.y()]
             .width_offset,
@@ -605,8 +601,8 @@ static void build_inter_column_row_tile_direct(
          * clb */
         vtr::Point<size_t> to_grid_coord =
           find_inter_direct_destination_coordinate(
-            device_ctx.grid, from_grid_coord, to_tile_name, arch_direct,
-            arch_direct_id);
+            device_ctx.grid, grid_type_lookup, from_grid_coord, to_tile_name,
+            arch_direct, arch_direct_id);
         /* If destination clb is valid, we should add something */
         if (false == is_grid_coordinate_exist_in_device(device_ctx.grid,
                                                         to_grid_coord)) {
@@ -619,7 +615,8 @@ static void build_inter_column_row_tile_direct(
          */
         for (const e_side& to_side : {TOP, RIGHT, BOTTOM, LEFT}) {
           /* Try to find the pin in this tile */
-          std::vector<size_t> to_pins = find_physical_tile_pin_id(
+          const std::vector<size_t>& to_pins = find_cached_physical_tile_pin_id(
+            to_pin_cache,
             device_ctx.grid[to_grid_coord.x()][to_grid_coord.y()].type,
             device_ctx.grid[to_grid_coord.x()][to_grid_coord.y()].width_offset,
             device_ctx.grid[to_grid_coord.x()][to_grid_coord.y()].height_offset,
@@ -672,19 +669,13 @@ static void build_inter_column_row_tile_direct(
    *
    */
   for (size_t iy = 1; iy < device_ctx.grid.height() - 1; ++iy) {
-    std::vector<vtr::Point<size_t>> next_col_src_grid_coords;
-    /* For negative x- direction, we should start from x = nx */
-    for (size_t ix = 1; ix < device_ctx.grid.width() - 1; ++ix) {
-      next_col_src_grid_coords.push_back(vtr::Point<size_t>(ix, iy));
-    }
-    /* For positive x- direction, we should start from x = 1 */
-    if (POSITIVE_DIR == arch_direct.x_dir(arch_direct_id)) {
-      std::reverse(next_col_src_grid_coords.begin(),
-                   next_col_src_grid_coords.end());
-    }
-
-    vtr::Point<size_t> from_grid_coord = find_grid_coordinate_given_type(
-      device_ctx.grid, next_col_src_grid_coords, from_tile_name);
+    /* For negative x- direction, we should start from x = nx
+     * For positive x- direction, we should start from x = 1
+     */
+    vtr::Point<size_t> from_grid_coord =
+      grid_type_lookup.find_coordinate_in_row(
+        from_tile_name, iy, 1, device_ctx.grid.width() - 1,
+        POSITIVE_DIR == arch_direct.x_dir(arch_direct_id));
     /* Skip if we do not have a valid coordinate for source CLB/heterogeneous
      * block */
     if (false ==
@@ -698,7 +689,8 @@ static void build_inter_column_row_tile_direct(
      */
     for (const e_side& from_side : {TOP, RIGHT, BOTTOM, LEFT}) {
       /* Try to find the pin in this tile */
-      std::vector<size_t> from_pins = find_physical_tile_pin_id(
+      const std::vector<size_t>& from_pins = find_cached_physical_tile_pin_id(
+        from_pin_cache,
         device_ctx.grid[from_grid_coord.x()][from_grid_coord.y()].type,
         device_ctx.grid[from_grid_coord.x()][from_grid_coord.y()].width_offset,
         device_ctx.grid[from_grid_coord.x()][from_grid_coord.y()].height_offset,
@@ -711,9 +703,9 @@ static void build_inter_column_row_tile_direct(
       /* For a valid coordinate, we can find the coordinate of the destination
        * clb */
       vtr::Point<size_t> to_grid_coord =
-        find_inter_direct_destination_coordinate(device_ctx.grid,
-                                                 from_grid_coord, to_tile_name,
-                                                 arch_direct, arch_direct_id);
+        find_inter_direct_destination_coordinate(
+          device_ctx.grid, grid_type_lookup, from_grid_coord, to_tile_name,
+          arch_direct, arch_direct_id);
       /* If destination clb is valid, we should add something */
       if (false ==
           is_grid_coordinate_exist_in_device(device_ctx.grid, to_grid_coord)) {
@@ -726,7 +718,8 @@ static void build_inter_column_row_tile_direct(
        */
       for (const e_side& to_side : {TOP, RIGHT, BOTTOM, LEFT}) {
         /* Try to find the pin in this tile */
-        std::vector<size_t> to_pins = find_physical_tile_pin_id(
+        const std::vector<size_t>& to_pins = find_cached_physical_tile_pin_id(
+          to_pin_cache,
           device_ctx.grid[to_grid_coord.x()][to_grid_coord.y()].type,
           device_ctx.grid[to_grid_coord.x()][to_grid_coord.y()].width_offset,
           device_ctx.grid[to_grid_coord.x()][to_grid_coord.y()].height_offset,
@@ -778,6 +771,9 @@ TileDirect build_device_tile_direct(const DeviceContext& device_ctx,
 
   TileDirect tile_direct;
 
+  /* Find the grids of each tile type without scanning the device grid */
+  GridTypeLookup grid_type_lookup(device_ctx.grid);
+
   /* Walk through each direct definition in the VPR arch */
   for (int idirect = 0; idirect < device_ctx.arch->num_directs; ++idirect) {
     ArchDirectId arch_direct_id =
@@ -790,13 +786,13 @@ TileDirect build_device_tile_direct(const DeviceContext& device_ctx,
       exit(1);
     }
     /* Build from original VPR arch definition */
-    build_inner_column_row_tile_direct(tile_direct,
-                                       device_ctx.arch->Directs[idirect],
-                                       device_ctx, arch_direct_id, verbose);
+    build_inner_column_row_tile_direct(
+      tile_direct, device_ctx.arch->Directs[idirect], device_ctx,
+      grid_type_lookup, arch_direct_id, verbose);
     /* Build from OpenFPGA arch definition */
     build_inter_column_row_tile_direct(
-      tile_direct, device_ctx.arch->Directs[idirect], device_ctx, arch_direct,
-      arch_direct_id, verbose);
+      tile_direct, device_ctx.arch->Directs[idirect], device_ctx,
+      grid_type_lookup, arch_direct, arch_direct_id, verbose);
   }
 
   VTR_LOG(
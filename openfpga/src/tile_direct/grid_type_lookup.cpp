@@ -0,0 +1,104 @@
+/******************************************************************************
+ * Memember functions for data structure GridTypeLookup
+ ******************************************************************************/
+#include "grid_type_lookup.h"
+
+#include <algorithm>
+
+/* Headers from vpr library */
+#include "vpr_utils.h"
+
+/* begin namespace openfpga */
+namespace openfpga {
+
+/**************************************************
+ * Find the first index in [index_begin, index_end) from a list of
+ * indices in an ascending order. Return the invalid index if not found
+ *************************************************/
+static size_t find_first_index_in_range(const std::vector<size_t>& indices,
+                                        const size_t& index_begin,
+                                        const size_t& index_end,
+                                        const bool& reverse,
+                                        const size_t& invalid_index) {
+  auto begin = std::lower_bound(indices.begin(), indices.end(), index_begin);
+  auto end = std::lower_bound(begin, indices.end(), index_end);
+  if (begin >= end) {
+    return invalid_index;
+  }
+  if (true == reverse) {
+    return *(end - 1);
+  }
+  return *begin;
+}
+
+/**************************************************
+ * Public Constructors
+ *************************************************/
+GridTypeLookup::GridTypeLookup(const DeviceGrid& grids) {
+  width_ = grids.width();
+  height_ = grids.height();
+
+  /* Visit x then y, so that all the lists are sorted */
+  for (size_t x = 0; x < width_; ++x) {
+    for (size_t y = 0; y < height_; ++y) {
+      if (true == is_empty_type(grids[x][y].type)) {
+        continue;
+      }
+      std::string type_name(grids[x][y].type->name);
+      type_coords_[type_name].push_back(vtr::Point<size_t>(x, y));
+
+      std::vector<std::vector<size_t>>& column_ys = type_column_ys_[type_name];
+      column_ys.resize(width_);
+      column_ys[x].push_back(y);
+
+      std::vector<std::vector<size_t>>& row_xs = type_row_xs_[type_name];
+      row_xs.resize(height_);
+      row_xs[y].push_back(x);
+    }
+  }
+}
+
+/**************************************************
+ * Public Accessors
+ *************************************************/
+const std::vector<vtr::Point<size_t>>& GridTypeLookup::coordinates(
+  const std::string& type_name) const {
+  static const std::vector<vtr::Point<size_t>> empty_coords;
+  auto result = type_coords_.find(type_name);
+  if (result == type_coords_.end()) {
+    return empty_coords;
+  }
+  return result->second;
+}
+
+vtr::Point<size_t> GridTypeLookup::find_coordinate_in_column(
+  const std::string& type_name, const size_t& x, const size_t& y_begin,
+  const size_t& y_end, const bool& reverse) const {
+  auto result = type_column_ys_.find(type_name);
+  if ((result == type_column_ys_.end()) || (x >= width_)) {
+    return vtr::Point<size_t>(width_, height_);
+  }
+  size_t y = find_first_index_in_range(result->second[x], y_begin, y_end,
+                                       reverse, height_);
+  if (height_ == y) {
+    return vtr::Point<size_t>(width_, height_);
+  }
+  return vtr::Point<size_t>(x, y);
+}
+
+vtr::Point<size_t> GridTypeLookup::find_coordinate_in_row(
+  const std::string& type_name, const size_t& y, const size_t& x_begin,
+  const size_t& x_end, const bool& reverse) const {
+  auto result = type_row_xs_.find(type_name);
+  if ((result == type_row_xs_.end()) || (y >= height_)) {
+    return vtr::Point<size_t>(width_, height_);
+  }
+  size_t x = find_first_index_in_range(result->second[y], x_begin, x_end,
+                                       reverse, width_);
+  if (width_ == x) {
+    return vtr::Point<size_t>(width_, height_);
+  }
+  return vtr::Point<size_t>(x, y);
+}
+
+} /* end namespace openfpga */
@@ -0,0 +1,75 @@
+#ifndef GRID_TYPE_LOOKUP_H
+#define GRID_TYPE_LOOKUP_H
+
+/********************************************************************
+ * Include header files required by the data structure definition
+ *******************************************************************/
+#include <map>
+#include <string>
+#include <vector>
+
+/* Headers from vtrutil library */
+#include "vtr_geometry.h"
+
+/* Headers from vpr library */
+#include "device_grid.h"
+
+/* Begin namespace openfpga */
+namespace openfpga {
+
+/********************************************************************
+ * GridTypeLookup is a fast look-up on the coordinates of each type of
+ * tile in a device grid, so that finding the tiles of a given type
+ * does not require scanning the full grid.
+ *
+ * For each type (indexed by name), the look-up stores
+ *  - all the coordinates, ordered by x and then by y
+ *  - the y of each column, in an ascending order
+ *  - the x of each row, in an ascending order
+ * Each location covered by a tile is stored, including those with
+ * non-zero width/height offsets. Empty grids are not stored.
+ *
+ * Note that the look-up is built for a fixed device grid, it should be
+ * rebuilt if the device grid changes.
+ *******************************************************************/
+class GridTypeLookup {
+ public: /* Constructors */
+  GridTypeLookup(const DeviceGrid& grids);
+
+ public: /* Public accessors */
+  /* Return all the coordinates of a tile type, ordered by x and then by y */
+  const std::vector<vtr::Point<size_t>>& coordinates(
+    const std::string& type_name) const;
+
+  /* Find the first coordinate of a tile type in column x, which is
+   * searched from y_begin to y_end - 1, or in the reverse order.
+   * Return an invalid coordinate (width, height) if not found */
+  vtr::Point<size_t> find_coordinate_in_column(const std::string& type_name,
+                                               const size_t& x,
+                                               const size_t& y_begin,
+                                               const size_t& y_end,
+                                               const bool& reverse) const;
+
+  /* Find the first coordinate of a tile type in row y, which is
+   * searched from x_begin to x_end - 1, or in the reverse order.
+   * Return an invalid coordinate (width, height) if not found */
+  vtr::Point<size_t> find_coordinate_in_row(const std::string& type_name,
+                                            const size_t& y,
+                                            const size_t& x_begin,
+                                            const size_t& x_end,
+                                            const bool& reverse) const;
+
+ private: /* Internal Data */
+  size_t width_;
+  size_t height_;
+
+  std::map<std::string, std::vector<vtr::Point<size_t>>> type_coords_;
+  /* [type_name][x] -> sorted y */
+  std::map<std::string, std::vector<std::vector<size_t>>> type_column_ys_;
+  /* [type_name][y] -> sorted x */
+  std::map<std::string, std::vector<std::vector<size_t>>> type_row_xs_;
+};
+
+} /* End namespace openfpga*/
+
+#endif
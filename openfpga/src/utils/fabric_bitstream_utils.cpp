@@ -191,9 +191,14 @@ FrameFabricBitstream build_frame_based_fabric_bitstream_by_address(
  *******************************************************************/
 size_t find_frame_based_fast_configuration_fabric_bitstream_size(
   const FabricBitstream& fabric_bitstream, const bool& bit_value_to_skip) {
-  FrameFabricBitstream fabric_bits_by_addr =
-    build_frame_based_fabric_bitstream_by_address(fabric_bitstream);
+  return find_frame_based_fast_configuration_fabric_bitstream_size(
+    build_frame_based_fabric_bitstream_by_address(fabric_bitstream),
+    bit_value_to_skip);
+}
 
+size_t find_frame_based_fast_configuration_fabric_bitstream_size(
+  const FrameFabricBitstream& fabric_bits_by_addr,
+  const bool& bit_value_to_skip) {
   size_t num_bits = 0;
 
   for (const auto& addr_din_pair : fabric_bits_by_addr) {
@@ -262,129 +267,137 @@ MemoryBankFabricBitstream build_memory_bank_fabric_bitstream_by_address(
 }
 
 MemoryBankFlattenFabricBitstream build_memory_bank_flatten_fabric_bitstream(
-  const FabricBitstream& fabric_bitstream, const bool& fast_configuration,
-  const bool& bit_value_to_skip, const char& dont_care_bit) {
-  /* If fast configuration is not enabled, we need all the wl address even some
-   * of them have all-dont-care-bits BLs */
-  if (!fast_configuration) {
-    vtr::vector<FabricBitRegionId, std::map<std::string, std::string>>
-      fabric_bits_per_region;
-    fabric_bits_per_region.resize(fabric_bitstream.num_regions());
-    for (const FabricBitRegionId& region : fabric_bitstream.regions()) {
-      for (const FabricBitId& bit_id : fabric_bitstream.region_bits(region)) {
-        /* Create string for BL address with complete don't care bits */
-        std::string bl_addr_str(fabric_bitstream.bit_bl_address(bit_id).size(),
-                                dont_care_bit);
-
-        /* Create string for WL address */
-        std::string wl_addr_str;
-        for (const char& addr_bit : fabric_bitstream.bit_wl_address(bit_id)) {
-          wl_addr_str.push_back(addr_bit);
-        }
-
-        /* Deposit the config bit */
-        fabric_bits_per_region[region][wl_addr_str] = bl_addr_str;
-      }
-    }
-  }
-
-  /* Build the bitstream by each region, here we use (WL, BL) pairs when storing
-   * bitstreams */
-  vtr::vector<FabricBitRegionId, std::map<std::string, std::string>>
+  const FabricBitstream& fabric_bitstream, const bool& bit_value_to_skip,
+  const char& dont_care_bit) {
+  /* Build the bitstream by each region in a single pass, here we use (WL, BL)
+   * pairs when storing bitstreams.
+   * Every WL address is kept, even if all the bits under it are to be skipped,
+   * i.e., its BLs are all-'0' bits */
+  vtr::vector<FabricBitRegionId, std::map<TernaryBitVector, TernaryBitVector>>
     fabric_bits_per_region;
   fabric_bits_per_region.resize(fabric_bitstream.num_regions());
   for (const FabricBitRegionId& region : fabric_bitstream.regions()) {
     for (const FabricBitId& bit_id : fabric_bitstream.region_bits(region)) {
-      /* Create string for BL address */
-      std::string bl_addr_str;
-      for (const char& addr_bit : fabric_bitstream.bit_bl_address(bit_id)) {
-        bl_addr_str.push_back(addr_bit);
-      }
+      /* Create vector for BL address */
+      TernaryBitVector bl_addr_vec(fabric_bitstream.bit_bl_address(bit_id));
 
       /* If this bit should be programmed to 0, convert the 1s in BL to 0s  */
       if (fabric_bitstream.bit_din(bit_id) == bit_value_to_skip) {
-        replace_str_bits(bl_addr_str, '1', '0');
+        bl_addr_vec.replace_bits('1', '0');
       }
 
-      /* Create string for WL address */
-      std::string wl_addr_str;
-      for (const char& addr_bit : fabric_bitstream.bit_wl_address(bit_id)) {
-        wl_addr_str.push_back(addr_bit);
-      }
+      /* Create vector for WL address */
+      TernaryBitVector wl_addr_vec(fabric_bitstream.bit_wl_address(bit_id));
 
       /* Place the config bit */
-      auto result = fabric_bits_per_region[region].find(wl_addr_str);
+      auto result = fabric_bits_per_region[region].find(wl_addr_vec);
       if (result == fabric_bits_per_region[region].end()) {
-        fabric_bits_per_region[region][wl_addr_str] = bl_addr_str;
+        fabric_bits_per_region[region].emplace(wl_addr_vec, bl_addr_vec);
       } else {
         VTR_ASSERT_SAFE(result != fabric_bits_per_region[region].end());
-        result->second = combine_two_1hot_str(result->second, bl_addr_str);
+        result->second.combine_1hot(bl_addr_vec);
       }
     }
   }
 
-  /* Find all the keys for the hash tables containing bitstream of each region
+  /* Index the (WL, BL) pairs of each region by their order in the hash tables
    */
-  vtr::vector<FabricBitRegionId, std::vector<std::string>>
-    fabric_bits_per_region_keys;
-  fabric_bits_per_region_keys.resize(fabric_bitstream.num_regions());
+  vtr::vector<FabricBitRegionId, std::vector<const TernaryBitVector*>>
+    wl_vectors_per_region;
+  vtr::vector<FabricBitRegionId, std::vector<const TernaryBitVector*>>
+    bl_vectors_per_region;
+  wl_vectors_per_region.resize(fabric_bitstream.num_regions());
+  bl_vectors_per_region.resize(fabric_bitstream.num_regions());
   for (const FabricBitRegionId& region : fabric_bitstream.regions()) {
     /* Pre-allocate memory, because the key size may be large */
-    fabric_bits_per_region_keys[region].reserve(
+    wl_vectors_per_region[region].reserve(
+      fabric_bits_per_region[region].size());
+    bl_vectors_per_region[region].reserve(
       fabric_bits_per_region[region].size());
     for (const auto& pair : fabric_bits_per_region[region]) {
-      fabric_bits_per_region_keys[region].push_back(pair.first);
+      wl_vectors_per_region[region].push_back(&pair.first);
+      bl_vectors_per_region[region].push_back(&pair.second);
     }
   }
 
   /* Find the maxium key size */
   size_t max_key_size = 0;
   for (const FabricBitRegionId& region : fabric_bitstream.regions()) {
-    max_key_size =
-      std::max(max_key_size, fabric_bits_per_region_keys[region].size());
+    max_key_size = std::max(max_key_size, wl_vectors_per_region[region].size());
   }
 
-  /* Find the BL/WL sizes per region; Pair convention is (BL, WL)
+  /* Create the all-'x' BL/WL vectors for the regions which run out of keys.
    * The address sizes are the same across any element,
    * just get it from the 1st element to save runtime
    */
-  vtr::vector<FabricBitRegionId, std::pair<size_t, size_t>>
-    max_blwl_sizes_per_region;
-  max_blwl_sizes_per_region.resize(fabric_bitstream.num_regions());
+  vtr::vector<FabricBitRegionId, TernaryBitVector> dont_care_bl_per_region;
+  vtr::vector<FabricBitRegionId, TernaryBitVector> dont_care_wl_per_region;
+  dont_care_bl_per_region.resize(fabric_bitstream.num_regions());
+  dont_care_wl_per_region.resize(fabric_bitstream.num_regions());
   for (const FabricBitRegionId& region : fabric_bitstream.regions()) {
-    max_blwl_sizes_per_region[region].first =
-      std::max(max_blwl_sizes_per_region[region].first,
-               fabric_bits_per_region[region].begin()->second.size());
-    max_blwl_sizes_per_region[region].second =
-      std::max(max_blwl_sizes_per_region[region].second,
-               fabric_bits_per_region[region].begin()->first.size());
+    dont_care_bl_per_region[region] = TernaryBitVector(
+      fabric_bits_per_region[region].begin()->second.size(), dont_care_bit);
+    dont_care_wl_per_region[region] = TernaryBitVector(
+      fabric_bits_per_region[region].begin()->first.size(), dont_care_bit);
+  }
+
+  /* Find the WL vector of a region in a word. If the key id is out of bound
+   * for the key list in this region, we use an all-'x' vector for both BL and
+   * WLs */
+  auto region_wl_vector = [&](const size_t& ikey,
+                              const FabricBitRegionId& region)
+    -> const TernaryBitVector* {
+    if (ikey < wl_vectors_per_region[region].size()) {
+      return wl_vectors_per_region[region][ikey];
+    }
+    return &dont_care_wl_per_region[region];
+  };
+  auto region_bl_vector = [&](const size_t& ikey,
+                              const FabricBitRegionId& region)
+    -> const TernaryBitVector* {
+    if (ikey < bl_vectors_per_region[region].size()) {
+      return bl_vectors_per_region[region][ikey];
+    }
+    return &dont_care_bl_per_region[region];
+  };
+
+  /* The words are downloaded in the order of their WL vectors, as they were
+   * sorted by a std::map. Sort the key ids rather than the vectors to avoid
+   * any copy */
+  std::vector<size_t> word_keys(max_key_size);
+  for (size_t ikey = 0; ikey < max_key_size; ikey++) {
+    word_keys[ikey] = ikey;
   }
+  std::sort(word_keys.begin(), word_keys.end(),
+            [&](const size_t& lhs, const size_t& rhs) {
+              for (const FabricBitRegionId& region :
+                   fabric_bitstream.regions()) {
+                const TernaryBitVector& lhs_wl = *region_wl_vector(lhs, region);
+                const TernaryBitVector& rhs_wl = *region_wl_vector(rhs, region);
+                if (lhs_wl < rhs_wl) {
+                  return true;
+                }
+                if (rhs_wl < lhs_wl) {
+                  return false;
+                }
+              }
+              return false;
+            });
 
   /* Combine the bitstream from different region into a unique one. Now we
    * follow the convention: use (WL, BL) pairs */
   MemoryBankFlattenFabricBitstream fabric_bits;
-  for (size_t ikey = 0; ikey < max_key_size; ikey++) {
+  fabric_bits.reserve(max_key_size);
+  std::vector<TernaryBitVector> cur_bl_vectors;
+  std::vector<TernaryBitVector> cur_wl_vectors;
+  for (const size_t& ikey : word_keys) {
     /* Prepare the final BL/WL vectors to be added to the bitstream database */
-    std::vector<std::string> cur_bl_vectors;
-    std::vector<std::string> cur_wl_vectors;
+    cur_bl_vectors.clear();
+    cur_wl_vectors.clear();
     for (const FabricBitRegionId& region : fabric_bitstream.regions()) {
-      /* If the key id is in bound for the key list in this region, find the BL
-       * and WL and add to the final bitstream database If the key id is out of
-       * bound for the key list in this region, we append an all-'x' string for
-       * both BL and WLs
-       */
-      if (ikey < fabric_bits_per_region_keys[region].size()) {
-        cur_wl_vectors.push_back(fabric_bits_per_region_keys[region][ikey]);
-        cur_bl_vectors.push_back(fabric_bits_per_region[region].at(
-          fabric_bits_per_region_keys[region][ikey]));
-      } else {
-        cur_wl_vectors.push_back(
-          std::string(max_blwl_sizes_per_region[region].second, dont_care_bit));
-        cur_bl_vectors.push_back(
-          std::string(max_blwl_sizes_per_region[region].first, dont_care_bit));
-      }
+      cur_wl_vectors.push_back(*region_wl_vector(ikey, region));
+      cur_bl_vectors.push_back(*region_bl_vector(ikey, region));
     }
-    /* Add the pair to std map */
     fabric_bits.add_blwl_vectors(cur_bl_vectors, cur_wl_vectors);
   }
 
@@ -416,8 +429,9 @@ MemoryBankFlattenFabricBitstream build_memory_bank_flatten_fabric_bitstream(
  *   vector N: 0xx
  *
  *******************************************************************/
-static std::vector<std::string> reshape_bitstream_vectors_to_first_element(
-  const std::vector<std::string>& bitstream_vectors,
+static std::vector<TernaryBitVector>
+reshape_bitstream_vectors_to_first_element(
+  const std::vector<TernaryBitVector>& bitstream_vectors,
   const char& default_bit_to_fill) {
   /* Find the max sizes of BL bits, this determines the size of shift register
    * chain */
@@ -425,124 +439,129 @@ static std::vector<std::string> reshape_bitstream_vectors_to_first_element(
   for (const auto& vec : bitstream_vectors) {
     max_vec_size = std::max(max_vec_size, vec.size());
   }
-  /* Reshape the BL vectors */
-  std::vector<std::string> reshaped_vectors(bitstream_vectors.size(),
-                                            std::string());
-  size_t col_cnt = 0;
-  for (const auto& vec : bitstream_vectors) {
-    reshaped_vectors[col_cnt] += vec;
-    reshaped_vectors[col_cnt] +=
-      std::string(max_vec_size - vec.size(), default_bit_to_fill);
-    col_cnt++;
-  }
 
-  /* Add the BL word to final bitstream */
-  std::vector<std::string> rotated_vectors;
-  for (size_t irow = 0; irow < max_vec_size; ++irow) {
-    std::string cur_vec;
-    for (size_t icol = 0; icol < reshaped_vectors.size(); ++icol) {
-      cur_vec.push_back(reshaped_vectors[icol][irow]);
+  /* Rotate the vectors, where the void in each vector is filled */
+  std::vector<TernaryBitVector> rotated_vectors(
+    max_vec_size,
+    TernaryBitVector(bitstream_vectors.size(), default_bit_to_fill));
+  for (size_t icol = 0; icol < bitstream_vectors.size(); ++icol) {
+    const TernaryBitVector& vec = bitstream_vectors[icol];
+    for (size_t irow = 0; irow < vec.size(); ++irow) {
+      rotated_vectors[irow].set_bit(icol, vec.bit(irow));
     }
-    rotated_vectors.push_back(cur_vec);
   }
 
   return rotated_vectors;
 }
 
-/** @brief Split each BL vector in a configuration region into multiple shift
- * register banks For example Original vector: 1xxx010xxx1 Resulting vector (2
- * register register banks): 1xxx0 10xxx1
+/** @brief Create the vectors of all the BL shift register banks, filled with
+ * don't care bits, in the order of configuration regions. The index of the
+ * first bank of each region in the vectors is also returned.
+ * These are the same for any word, and are built only once
  */
-static std::vector<std::string> redistribute_bl_vectors_to_shift_register_banks(
-  const std::vector<std::string> bl_vectors,
-  const MemoryBankShiftRegisterBanks& blwl_sr_banks,
-  const char& dont_care_bit) {
-  std::vector<std::string> multi_bank_bl_vec;
+static std::vector<TernaryBitVector>
+build_empty_bl_shift_register_bank_vectors(
+  const MemoryBankShiftRegisterBanks& blwl_sr_banks, const char& dont_care_bit,
+  vtr::vector<ConfigRegionId, size_t>& region_start_index) {
+  std::vector<TernaryBitVector> multi_bank_bl_vec;
 
-  /* Resize the vector by counting the dimension */
-  /* Compute the start index of each region */
-  vtr::vector<ConfigRegionId, size_t> region_start_index;
+  region_start_index.clear();
   region_start_index.resize(blwl_sr_banks.regions().size(), 0);
-  size_t total_num_banks = 0;
-  for (const auto& region : blwl_sr_banks.regions()) {
-    region_start_index[region] = total_num_banks;
-    total_num_banks += blwl_sr_banks.bl_banks(region).size();
-  }
-  multi_bank_bl_vec.resize(total_num_banks);
-
-  /* Resize each bank to be memory efficient */
-  size_t vec_start_index = 0;
   for (const auto& region : blwl_sr_banks.regions()) {
+    region_start_index[region] = multi_bank_bl_vec.size();
     for (const auto& bank : blwl_sr_banks.bl_banks(region)) {
-      size_t bank_size = blwl_sr_banks.bl_bank_size(region, bank);
-      multi_bank_bl_vec[vec_start_index].resize(bank_size, dont_care_bit);
-      vec_start_index++;
+      multi_bank_bl_vec.emplace_back(blwl_sr_banks.bl_bank_size(region, bank),
+                                     dont_care_bit);
     }
   }
 
-  for (const std::string& region_bl_vec : bl_vectors) {
+  return multi_bank_bl_vec;
+}
+
+/** @brief Split each BL vector in a configuration region into multiple shift
+ * register banks For example Original vector: 1xxx010xxx1 Resulting vector (2
+ * register register banks): 1xxx0 10xxx1
+ * Each bit is scattered to its bank and data pin using the look-up tables
+ * of the shift register banks
+ */
+static std::vector<TernaryBitVector>
+redistribute_bl_vectors_to_shift_register_banks(
+  const std::vector<TernaryBitVector>& bl_vectors,
+  const MemoryBankShiftRegisterBanks& blwl_sr_banks,
+  const vtr::vector<ConfigRegionId, size_t>& region_start_index,
+  const std::vector<TernaryBitVector>& empty_multi_bank_bl_vec) {
+  std::vector<TernaryBitVector> multi_bank_bl_vec = empty_multi_bank_bl_vec;
+
+  for (const TernaryBitVector& region_bl_vec : bl_vectors) {
     ConfigRegionId region = ConfigRegionId(&region_bl_vec - &bl_vectors[0]);
+    /* Find the shift register bank id and the offset in data lines */
+    const std::vector<FabricBitLineBankId>& bank_ids =
+      blwl_sr_banks.bl_shift_register_bank_ids(region);
+    const std::vector<size_t>& bank_pins =
+      blwl_sr_banks.bl_shift_register_bank_pins(region);
+    VTR_ASSERT(region_bl_vec.size() <= bank_ids.size());
     for (size_t ibit = 0; ibit < region_bl_vec.size(); ++ibit) {
-      /* Find the shift register bank id and the offset in data lines */
-      BasicPort bl_port(std::string(MEMORY_BL_PORT_NAME), ibit, ibit);
-      FabricBitLineBankId bank_id =
-        blwl_sr_banks.find_bl_shift_register_bank_id(region, bl_port);
-      BasicPort sr_port =
-        blwl_sr_banks.find_bl_shift_register_bank_data_port(region, bl_port);
-      VTR_ASSERT(1 == sr_port.get_width());
-
-      size_t vec_index = region_start_index[region] + size_t(bank_id);
-      multi_bank_bl_vec[vec_index][sr_port.get_lsb()] = region_bl_vec[ibit];
+      VTR_ASSERT(bank_ids[ibit]);
+      size_t vec_index = region_start_index[region] + size_t(bank_ids[ibit]);
+      multi_bank_bl_vec[vec_index].set_bit(bank_pins[ibit],
+                                           region_bl_vec.bit(ibit));
     }
   }
 
   return multi_bank_bl_vec;
 }
 
-/** @brief Split each WL vector in a configuration region into multiple shift
- * register banks For example Original vector: 1xxx010xxx1 Resulting vector (2
- * register register banks): 1xxx0 10xxx1
+/** @brief Create the vectors of all the WL shift register banks, filled with
+ * don't care bits, in the order of configuration regions. The index of the
+ * first bank of each region in the vectors is also returned.
+ * These are the same for any word, and are built only once
  */
-static std::vector<std::string> redistribute_wl_vectors_to_shift_register_banks(
-  const std::vector<std::string> wl_vectors,
-  const MemoryBankShiftRegisterBanks& blwl_sr_banks,
-  const char& dont_care_bit) {
-  std::vector<std::string> multi_bank_wl_vec;
+static std::vector<TernaryBitVector>
+build_empty_wl_shift_register_bank_vectors(
+  const MemoryBankShiftRegisterBanks& blwl_sr_banks, const char& dont_care_bit,
+  vtr::vector<ConfigRegionId, size_t>& region_start_index) {
+  std::vector<TernaryBitVector> multi_bank_wl_vec;
 
-  /* Resize the vector by counting the dimension */
-  /* Compute the start index of each region */
-  vtr::vector<ConfigRegionId, size_t> region_start_index;
+  region_start_index.clear();
   region_start_index.resize(blwl_sr_banks.regions().size(), 0);
-  size_t total_num_banks = 0;
-  for (const auto& region : blwl_sr_banks.regions()) {
-    region_start_index[region] = total_num_banks;
-    total_num_banks += blwl_sr_banks.wl_banks(region).size();
-  }
-  multi_bank_wl_vec.resize(total_num_banks);
-
-  /* Resize each bank to be memory efficient */
-  size_t vec_start_index = 0;
   for (const auto& region : blwl_sr_banks.regions()) {
+    region_start_index[region] = multi_bank_wl_vec.size();
     for (const auto& bank : blwl_sr_banks.wl_banks(region)) {
-      size_t bank_size = blwl_sr_banks.wl_bank_size(region, bank);
-      multi_bank_wl_vec[vec_start_index].resize(bank_size, dont_care_bit);
-      vec_start_index++;
+      multi_bank_wl_vec.emplace_back(blwl_sr_banks.wl_bank_size(region, bank),
+                                     dont_care_bit);
     }
   }
 
-  for (const std::string& region_wl_vec : wl_vectors) {
+  return multi_bank_wl_vec;
+}
+
+/** @brief Split each WL vector in a configuration region into multiple shift
+ * register banks For example Original vector: 1xxx010xxx1 Resulting vector (2
+ * register register banks): 1xxx0 10xxx1
+ * Each bit is scattered to its bank and data pin using the look-up tables
+ * of the shift register banks
+ */
+static std::vector<TernaryBitVector>
+redistribute_wl_vectors_to_shift_register_banks(
+  const std::vector<TernaryBitVector>& wl_vectors,
+  const MemoryBankShiftRegisterBanks& blwl_sr_banks,
+  const vtr::vector<ConfigRegionId, size_t>& region_start_index,
+  const std::vector<TernaryBitVector>& empty_multi_bank_wl_vec) {
+  std::vector<TernaryBitVector> multi_bank_wl_vec = empty_multi_bank_wl_vec;
+
+  for (const TernaryBitVector& region_wl_vec : wl_vectors) {
     ConfigRegionId region = ConfigRegionId(&region_wl_vec - &wl_vectors[0]);
+    /* Find the shift register bank id and the offset in data lines */
+    const std::vector<FabricWordLineBankId>& bank_ids =
+      blwl_sr_banks.wl_shift_register_bank_ids(region);
+    const std::vector<size_t>& bank_pins =
+      blwl_sr_banks.wl_shift_register_bank_pins(region);
+    VTR_ASSERT(region_wl_vec.size() <= bank_ids.size());
     for (size_t ibit = 0; ibit < region_wl_vec.size(); ++ibit) {
-      /* Find the shift register bank id and the offset in data lines */
-      BasicPort wl_port(std::string(MEMORY_WL_PORT_NAME), ibit, ibit);
-      FabricWordLineBankId bank_id =
-        blwl_sr_banks.find_wl_shift_register_bank_id(region, wl_port);
-      BasicPort sr_port =
-        blwl_sr_banks.find_wl_shift_register_bank_data_port(region, wl_port);
-      VTR_ASSERT(1 == sr_port.get_width());
-
-      size_t vec_index = region_start_index[region] + size_t(bank_id);
-      multi_bank_wl_vec[vec_index][sr_port.get_lsb()] = region_wl_vec[ibit];
+      VTR_ASSERT(bank_ids[ibit]);
+      size_t vec_index = region_start_index[region] + size_t(bank_ids[ibit]);
+      multi_bank_wl_vec[vec_index].set_bit(bank_pins[ibit],
+                                           region_wl_vec.bit(ibit));
     }
   }
 
@@ -553,28 +572,48 @@ MemoryBankShiftRegisterFabricBitstream
 build_memory_bank_shift_register_fabric_bitstream(
   const FabricBitstream& fabric_bitstream,
   const MemoryBankShiftRegisterBanks& blwl_sr_banks,
-  const bool& fast_configuration, const bool& bit_value_to_skip,
+  const bool& bit_value_to_skip, const char& dont_care_bit) {
+  return build_memory_bank_shift_register_fabric_bitstream(
+    build_memory_bank_flatten_fabric_bitstream(
+      fabric_bitstream, bit_value_to_skip, dont_care_bit),
+    blwl_sr_banks, dont_care_bit);
+}
+
+MemoryBankShiftRegisterFabricBitstream
+build_memory_bank_shift_register_fabric_bitstream(
+  const MemoryBankFlattenFabricBitstream& raw_fabric_bits,
+  const MemoryBankShiftRegisterBanks& blwl_sr_banks,
   const char& dont_care_bit) {
   vtr::ScopedStartFinishTimer timer(
     "Reshape fabric bitstream for memory bank using shift registers");
-  MemoryBankFlattenFabricBitstream raw_fabric_bits =
-    build_memory_bank_flatten_fabric_bitstream(
-      fabric_bitstream, fast_configuration, bit_value_to_skip, dont_care_bit);
   MemoryBankShiftRegisterFabricBitstream fabric_bits;
 
+  /* Layout of the shift register banks, which is the same for every word */
+  vtr::vector<ConfigRegionId, size_t> bl_region_start_index;
+  std::vector<TernaryBitVector> empty_multi_bank_bl_vec =
+    build_empty_bl_shift_register_bank_vectors(blwl_sr_banks, dont_care_bit,
+                                               bl_region_start_index);
+  vtr::vector<ConfigRegionId, size_t> wl_region_start_index;
+  std::vector<TernaryBitVector> empty_multi_bank_wl_vec =
+    build_empty_wl_shift_register_bank_vectors(blwl_sr_banks, dont_care_bit,
+                                               wl_region_start_index);
+
   /* Iterate over each word */
-  for (const auto& wl_vec : raw_fabric_bits.wl_vectors()) {
-    std::vector<std::string> bl_vec = raw_fabric_bits.bl_vector(wl_vec);
+  for (size_t iword = 0; iword < raw_fabric_bits.size(); ++iword) {
+    const std::vector<TernaryBitVector>& bl_vec =
+      raw_fabric_bits.bl_vector(iword);
+    const std::vector<TernaryBitVector>& wl_vec =
+      raw_fabric_bits.wl_vector(iword);
 
     MemoryBankShiftRegisterFabricBitstreamWordId word_id =
       fabric_bits.create_word();
 
     /* Redistribute the BL vector to multiple banks */
-    std::vector<std::string> multi_bank_bl_vec =
-      redistribute_bl_vectors_to_shift_register_banks(bl_vec, blwl_sr_banks,
-                                                      dont_care_bit);
+    std::vector<TernaryBitVector> multi_bank_bl_vec =
+      redistribute_bl_vectors_to_shift_register_banks(
+        bl_vec, blwl_sr_banks, bl_region_start_index, empty_multi_bank_bl_vec);
 
-    std::vector<std::string> reshaped_bl_vectors =
+    std::vector<TernaryBitVector> reshaped_bl_vectors =
       reshape_bitstream_vectors_to_first_element(multi_bank_bl_vec,
                                                  dont_care_bit);
     /* Reverse the vectors due to the shift register chain nature: first-in
@@ -586,11 +625,11 @@ build_memory_bank_shift_register_fabric_bitstream(
     }
 
     /* Redistribute the WL vector to multiple banks */
-    std::vector<std::string> multi_bank_wl_vec =
-      redistribute_wl_vectors_to_shift_register_banks(wl_vec, blwl_sr_banks,
-                                                      dont_care_bit);
+    std::vector<TernaryBitVector> multi_bank_wl_vec =
+      redistribute_wl_vectors_to_shift_register_banks(
+        wl_vec, blwl_sr_banks, wl_region_start_index, empty_multi_bank_wl_vec);
 
-    std::vector<std::string> reshaped_wl_vectors =
+    std::vector<TernaryBitVector> reshaped_wl_vectors =
       reshape_bitstream_vectors_to_first_element(multi_bank_wl_vec,
                                                  dont_care_bit);
     /* Reverse the vectors due to the shift register chain nature: first-in
@@ -622,9 +661,14 @@ build_memory_bank_shift_register_fabric_bitstream(
  *******************************************************************/
 size_t find_memory_bank_fast_configuration_fabric_bitstream_size(
   const FabricBitstream& fabric_bitstream, const bool& bit_value_to_skip) {
-  MemoryBankFabricBitstream fabric_bits_by_addr =
-    build_memory_bank_fabric_bitstream_by_address(fabric_bitstream);
+  return find_memory_bank_fast_configuration_fabric_bitstream_size(
+    build_memory_bank_fabric_bitstream_by_address(fabric_bitstream),
+    bit_value_to_skip);
+}
 
+size_t find_memory_bank_fast_configuration_fabric_bitstream_size(
+  const MemoryBankFabricBitstream& fabric_bits_by_addr,
+  const bool& bit_value_to_skip) {
   size_t num_bits = 0;
 
   for (const auto& addr_din_pair : fabric_bits_by_addr) {
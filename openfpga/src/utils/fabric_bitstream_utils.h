@@ -49,6 +49,10 @@ FrameFabricBitstream build_frame_based_fabric_bitstream_by_address(
 size_t find_frame_based_fast_configuration_fabric_bitstream_size(
   const FabricBitstream& fabric_bitstream, const bool& bit_value_to_skip);
 
+size_t find_frame_based_fast_configuration_fabric_bitstream_size(
+  const FrameFabricBitstream& fabric_bits_by_addr,
+  const bool& bit_value_to_skip);
+
 /********************************************************************
  * @ brief Reorganize the fabric bitstream for memory banks which use flatten BL
  *and WLs For each configuration region, we will merge BL address (which are
@@ -66,12 +70,16 @@ size_t find_frame_based_fast_configuration_fabric_bitstream_size(
  *   the bitstream will be merged as
  *   101_110 000_000
  *
+ * Every WL address is kept in the bitstream, even if all the bits under it
+ *are to be skipped. Therefore, the bitstream is the same with or without fast
+ *configuration.
+ *
  * @note the std::map may cause large memory footprint for large bitstream
  *databases!
  *******************************************************************/
 MemoryBankFlattenFabricBitstream build_memory_bank_flatten_fabric_bitstream(
-  const FabricBitstream& fabric_bitstream, const bool& fast_configuration,
-  const bool& bit_value_to_skip, const char& dont_care_bit = 'x');
+  const FabricBitstream& fabric_bitstream, const bool& bit_value_to_skip,
+  const char& dont_care_bit = 'x');
 
 /********************************************************************
  * @ brief Reorganize the fabric bitstream for memory banks which use shift
@@ -105,7 +113,14 @@ MemoryBankShiftRegisterFabricBitstream
 build_memory_bank_shift_register_fabric_bitstream(
   const FabricBitstream& fabric_bitstream,
   const MemoryBankShiftRegisterBanks& blwl_sr_banks,
-  const bool& fast_configuration, const bool& bit_value_to_skip,
+  const bool& bit_value_to_skip, const char& dont_care_bit = 'x');
+
+/* Reorganize a flatten fabric bitstream, which is built with the same
+ * don't care bit, for memory banks which use shift registers */
+MemoryBankShiftRegisterFabricBitstream
+build_memory_bank_shift_register_fabric_bitstream(
+  const MemoryBankFlattenFabricBitstream& raw_fabric_bits,
+  const MemoryBankShiftRegisterBanks& blwl_sr_banks,
   const char& dont_care_bit = 'x');
 
 /* Alias to a specific organization of bitstreams for memory bank configuration
@@ -118,6 +133,10 @@ MemoryBankFabricBitstream build_memory_bank_fabric_bitstream_by_address(
 size_t find_memory_bank_fast_configuration_fabric_bitstream_size(
   const FabricBitstream& fabric_bitstream, const bool& bit_value_to_skip);
 
+size_t find_memory_bank_fast_configuration_fabric_bitstream_size(
+  const MemoryBankFabricBitstream& fabric_bits_by_addr,
+  const bool& bit_value_to_skip);
+
 } /* end namespace openfpga */
 
 #endif
@@ -2,7 +2,9 @@
  * This file includes most utilized functions to manipulate LUTs,
  * especially their truth tables, in the OpenFPGA context
  *******************************************************************/
-#include <cmath>
+#include <algorithm>
+#include <cstdint>
+#include <utility>
 
 /* Headers from vtrutil library */
 #include "vtr_assert.h"
@@ -53,11 +55,13 @@ AtomNetlist::TruthTable lut_truth_table_adaption(
   const AtomNetlist::TruthTable& orig_tt,
   const std::vector<int>& rotated_pin_map) {
   AtomNetlist::TruthTable tt;
+  tt.reserve(orig_tt.size());
 
-  for (auto row : orig_tt) {
+  for (const std::vector<vtr::LogicValue>& row : orig_tt) {
     VTR_ASSERT(row.size() - 1 <= rotated_pin_map.size());
 
     std::vector<vtr::LogicValue> tt_line;
+    tt_line.reserve(rotated_pin_map.size() + 1);
     /* We do not care about the last digit, which is the output value */
     for (size_t i = 0; i < rotated_pin_map.size(); ++i) {
       if (-1 == rotated_pin_map[i]) {
@@ -71,7 +75,7 @@ AtomNetlist::TruthTable lut_truth_table_adaption(
 
     /* Do not miss the last digit in the final result */
     tt_line.push_back(row.back());
-    tt.push_back(tt_line);
+    tt.push_back(std::move(tt_line));
   }
 
   return tt;
@@ -205,7 +209,7 @@ AtomNetlist::TruthTable adapt_truth_table_for_frac_lut(
     }
     /* Modify bits starting from lut_frac_level */
     /* Decode the lut_output_mask to LUT input codes */
-    int temp = pow(2., num_mask_bits) - 1 - lut_output_mask;
+    int temp = (1 << num_mask_bits) - 1 - lut_output_mask;
     VTR_ASSERT(0 <= temp);
     std::vector<size_t> mask_bits_vec = itobin_vec(temp, num_mask_bits);
     /* Copy the bits to the truth table line */
@@ -263,96 +267,52 @@ bool lut_truth_table_use_on_set(const AtomNetlist::TruthTable& truth_table) {
   return on_set;
 }
 
+/* Number of LUT inputs which are decoded inside a 64-bit word of bitstream */
+constexpr size_t LUT_BITSTREAM_WORD_NUM_INPUTS = 6;
+constexpr size_t LUT_BITSTREAM_WORD_SIZE = 64;
+
+/* For the i-th input, the bits of a word whose SRAM address has a '1' on the
+ * i-th position */
+static const uint64_t LUT_BITSTREAM_WORD_INPUT_MASKS[] = {
+  0xAAAAAAAAAAAAAAAAULL, 0xCCCCCCCCCCCCCCCCULL, 0xF0F0F0F0F0F0F0F0ULL,
+  0xFF00FF00FF00FF00ULL, 0xFFFF0000FFFF0000ULL, 0xFFFFFFFF00000000ULL};
+
 /********************************************************************
- * Complete a line in truth table with a given lut size
- * Due to the size of truth table may be less than the lut size.
- * i.e. in LUT-6 architecture, there exists LUT1-6 in technology-mapped netlists
- * So, in truth table line, there may be 10- 1
- * In this case, we should complete it by --10- 1
+ * A line of truth table, i.e., a cube, encoded by two masks
+ *  - care_mask: bit i is '1' if the i-th input is not a don't care
+ *  - addr_mask: bit i is '1' if the i-th input is '0'
+ * The SRAM addresses covered by the cube are those satisfying
+ *   (addr & care_mask) == addr_mask
+ * Note that a truth table line may be shorter than the LUT size,
+ * i.e. in LUT-6 architecture, there exists LUT1-6 in technology-mapped
+ *netlists. The missing inputs are considered as don't cares.
  *******************************************************************/
-static std::vector<vtr::LogicValue> complete_truth_table_line(
-  const size_t& lut_size, const std::vector<vtr::LogicValue>& tt_line) {
-  std::vector<vtr::LogicValue> ret;
+struct LutTruthTableCube {
+  uint64_t care_mask;
+  uint64_t addr_mask;
+};
 
+static LutTruthTableCube build_lut_truth_table_cube(
+  const size_t& lut_size, const std::vector<vtr::LogicValue>& tt_line) {
   VTR_ASSERT(0 < tt_line.size());
 
-  /* Complete the truth table line*/
   size_t cover_len = tt_line.size() - 1;
   VTR_ASSERT(cover_len <= lut_size);
 
-  /* Copy the original truth table line */
-  ret = tt_line;
-  /* Kick out the last value for now as it is the output value */
-  ret.pop_back();
-
-  /* Add the number of '-' we should add in the back !!! */
-  for (size_t j = cover_len; j < lut_size; ++j) {
-    ret.push_back(vtr::LogicValue::DONT_CARE);
-  }
-
-  /* Copy the original truth table line */
-  ret.push_back(tt_line.back());
-
-  /* Check if the size of ret matches our expectation */
-  VTR_ASSERT(lut_size + 1 == ret.size());
-
-  return ret;
-}
-
-/********************************************************************
- * For each lut_bit_lines, we should recover the truth table,
- * and then set the sram bits to "1" if the truth table defines so.
- * Start_point: the position we start converting don't care sign '-'
- *              to explicit '0' or '1'
- *******************************************************************/
-static void rec_build_lut_bitstream_per_line(
-  std::vector<bool>& lut_bitstream, const size_t& lut_size,
-  const std::vector<vtr::LogicValue>& tt_line, const size_t& start_point) {
-  std::vector<vtr::LogicValue> temp_line = tt_line;
-
-  /* Check the length of sram bits and truth table line */
-  VTR_ASSERT(lut_size + 1 == tt_line.size()); /* lut_size + '1|0' */
-
-  /* End of truth_table_line should be "space" and "1" */
-  VTR_ASSERT((vtr::LogicValue::TRUE == tt_line.back()) ||
-             (vtr::LogicValue::FALSE == tt_line.back()));
-
-  /* Make sure before start point there is no '-' */
-  VTR_ASSERT(start_point < tt_line.size());
-  for (size_t i = 0; i < start_point; ++i) {
-    VTR_ASSERT(vtr::LogicValue::DONT_CARE != tt_line[i]);
-  }
-
-  /* Configure sram bits recursively */
-  for (size_t i = start_point; i < lut_size; ++i) {
-    if (vtr::LogicValue::DONT_CARE == tt_line[i]) {
-      /* if we find a dont_care, we don't do configure now but recursively*/
-      /* '0' branch */
-      temp_line[i] = vtr::LogicValue::FALSE;
-      rec_build_lut_bitstream_per_line(lut_bitstream, lut_size, temp_line,
-                                       start_point + 1);
-      /* '1' branch */
-      temp_line[i] = vtr::LogicValue::TRUE;
-      rec_build_lut_bitstream_per_line(lut_bitstream, lut_size, temp_line,
-                                       start_point + 1);
-      return;
-    }
-  }
-
-  /* TODO: Use MuxGraph to decode this!!! */
-  /* Decode bitstream only when there are only 0 or 1 in the truth table */
-  size_t sram_id = 0;
-  for (size_t i = 0; i < lut_size; ++i) {
-    /* Should be either '0' or '1' */
+  LutTruthTableCube cube = {0, 0};
+  for (size_t i = 0; i < cover_len; ++i) {
     switch (tt_line[i]) {
       case vtr::LogicValue::FALSE:
         /* We assume the 1-lut pass sram1 when input = 0 */
-        sram_id += (size_t)pow(2., (double)(i));
+        cube.care_mask |= uint64_t(1) << i;
+        cube.addr_mask |= uint64_t(1) << i;
         break;
       case vtr::LogicValue::TRUE:
         /* We assume the 1-lut pass sram0 when input = 1 */
+        cube.care_mask |= uint64_t(1) << i;
         break;
       case vtr::LogicValue::DONT_CARE:
+        break;
       default:
         VTR_LOGF_ERROR(__FILE__, __LINE__,
                        "Invalid truth_table bit '%s', should be [0|1|]!\n",
@@ -360,18 +320,63 @@ static void rec_build_lut_bitstream_per_line(
         exit(1);
     }
   }
-  /* Set the sram bit to '1'*/
-  VTR_ASSERT(sram_id < lut_bitstream.size());
-  if (vtr::LogicValue::TRUE == tt_line.back()) {
-    lut_bitstream[sram_id] = true; /* on set*/
-  } else if (vtr::LogicValue::FALSE == tt_line.back()) {
-    lut_bitstream[sram_id] = false; /* off set */
-  } else {
-    VTR_LOGF_ERROR(__FILE__, __LINE__,
-                   "Invalid truth_table_line ending '%s'!\n",
-                   vtr::LOGIC_VALUE_STRING[size_t(tt_line.back())]);
-    exit(1);
+
+  return cube;
+}
+
+/********************************************************************
+ * Set the sram bits covered by a truth table line to a given value.
+ * The LUT bitstream is stored in 64-bit words, where the first 6 inputs
+ * select a bit inside a word and the other inputs select the words.
+ * Don't cares are expanded by word-wide mask operations rather than
+ * visiting each combination
+ *******************************************************************/
+static void apply_lut_truth_table_cube(std::vector<uint64_t>& lut_words,
+                                       const size_t& lut_size,
+                                       const size_t& bitstream_size,
+                                       const LutTruthTableCube& cube,
+                                       const bool& bit_value) {
+  /* The largest SRAM address covered by the cube should be in range */
+  uint64_t lut_addr_range = (uint64_t(1) << lut_size) - 1;
+  VTR_ASSERT((cube.addr_mask | (~cube.care_mask & lut_addr_range)) <
+             bitstream_size);
+
+  /* Mask of the bits inside a word */
+  uint64_t word_mask = ~uint64_t(0);
+  if (lut_size < LUT_BITSTREAM_WORD_NUM_INPUTS) {
+    word_mask = (uint64_t(1) << (size_t(1) << lut_size)) - 1;
+  }
+  for (size_t i = 0; i < std::min(lut_size, LUT_BITSTREAM_WORD_NUM_INPUTS);
+       ++i) {
+    if (0 == ((cube.care_mask >> i) & 1)) {
+      continue;
+    }
+    if (1 == ((cube.addr_mask >> i) & 1)) {
+      word_mask &= LUT_BITSTREAM_WORD_INPUT_MASKS[i];
+    } else {
+      word_mask &= ~LUT_BITSTREAM_WORD_INPUT_MASKS[i];
+    }
+  }
+
+  /* Visit the words whose index matches the cube, by enumerating all the
+   * subsets of the don't care inputs which select words */
+  uint64_t word_addr = cube.addr_mask >> LUT_BITSTREAM_WORD_NUM_INPUTS;
+  uint64_t word_free = 0;
+  if (lut_size > LUT_BITSTREAM_WORD_NUM_INPUTS) {
+    word_free =
+      ~(cube.care_mask >> LUT_BITSTREAM_WORD_NUM_INPUTS) &
+      ((uint64_t(1) << (lut_size - LUT_BITSTREAM_WORD_NUM_INPUTS)) - 1);
   }
+  uint64_t subset = 0;
+  do {
+    uint64_t& word = lut_words[word_addr | subset];
+    if (true == bit_value) {
+      word |= word_mask;
+    } else {
+      word &= ~word_mask;
+    }
+    subset = (subset - word_free) & word_free;
+  } while (0 != subset);
 }
 
 /********************************************************************
@@ -386,7 +391,6 @@ static std::vector<bool> build_single_output_lut_bitstream(
   size_t lut_size = lut_mux_graph.num_memory_bits();
   size_t bitstream_size = lut_mux_graph.num_inputs();
   std::vector<bool> lut_bitstream(bitstream_size, false);
-  AtomNetlist::TruthTable completed_truth_table;
   bool on_set = false;
   bool off_set = false;
 
@@ -412,25 +416,42 @@ static std::vector<bool> build_single_output_lut_bitstream(
     off_set = !on_set;
   }
 
-  /* Read in truth table lines, decode one by one */
-  for (const std::vector<vtr::LogicValue>& tt_line : truth_table) {
-    /* Complete the truth table line by line*/
-    completed_truth_table.push_back(
-      complete_truth_table_line(lut_size, tt_line));
-  }
+  /* Initial all the bits in the bitstream
+   * By default, the lut_bitstream is initialize for on_set
+   * For off set, it should be flipped
+   */
+  std::vector<uint64_t> lut_words(
+    (bitstream_size + LUT_BITSTREAM_WORD_SIZE - 1) / LUT_BITSTREAM_WORD_SIZE,
+    true == off_set ? ~uint64_t(0) : uint64_t(0));
 
-  /* Initial all the bits in the bitstream */
-  if (true == off_set) {
-    /* By default, the lut_bitstream is initialize for on_set
-     * For off set, it should be flipped
-     */
-    lut_bitstream.clear();
-    lut_bitstream.resize(bitstream_size, true);
+  /* Read in truth table lines, decode one by one. Note that latter lines
+   * overwrite the bits set by former lines */
+  VTR_ASSERT(lut_size < LUT_BITSTREAM_WORD_SIZE);
+  for (const std::vector<vtr::LogicValue>& tt_line : truth_table) {
+    LutTruthTableCube cube = build_lut_truth_table_cube(lut_size, tt_line);
+    switch (tt_line.back()) {
+      case vtr::LogicValue::TRUE:
+        /* on set */
+        apply_lut_truth_table_cube(lut_words, lut_size, bitstream_size, cube,
+                                   true);
+        break;
+      case vtr::LogicValue::FALSE:
+        /* off set */
+        apply_lut_truth_table_cube(lut_words, lut_size, bitstream_size, cube,
+                                   false);
+        break;
+      default:
+        VTR_LOGF_ERROR(__FILE__, __LINE__,
+                       "Invalid truth_table_line ending '%s'!\n",
+                       vtr::LOGIC_VALUE_STRING[size_t(tt_line.back())]);
+        exit(1);
+    }
   }
 
-  for (const std::vector<vtr::LogicValue>& tt_line : completed_truth_table) {
-    /* Update the truth table, sram_bits */
-    rec_build_lut_bitstream_per_line(lut_bitstream, lut_size, tt_line, 0);
+  for (size_t ibit = 0; ibit < bitstream_size; ++ibit) {
+    lut_bitstream[ibit] = 1 == ((lut_words[ibit / LUT_BITSTREAM_WORD_SIZE] >>
+                                 (ibit % LUT_BITSTREAM_WORD_SIZE)) &
+                                1);
   }
 
   return lut_bitstream;
@@ -451,8 +472,8 @@ std::vector<bool> build_frac_lut_bitstream(
   std::vector<bool> lut_bitstream(lut_mux_graph.num_inputs(),
                                   default_sram_bit_value);
 
-  for (std::pair<const t_pb_graph_pin*, AtomNetlist::TruthTable> element :
-       truth_tables) {
+  for (const std::pair<const t_pb_graph_pin* const, AtomNetlist::TruthTable>&
+         element : truth_tables) {
     /* Find the corresponding circuit model output port and assoicated
      * lut_output_mask */
     CircuitPortId lut_model_output_port =
@@ -476,8 +497,7 @@ std::vector<bool> build_frac_lut_bitstream(
 
     /* Depending on the frac-level, we get the location(starting/end points) of
      * sram bits */
-    size_t length_of_temp_bitstream_to_copy =
-      (size_t)pow(2., (double)(lut_frac_level));
+    size_t length_of_temp_bitstream_to_copy = size_t(1) << lut_frac_level;
     size_t bitstream_offset =
       length_of_temp_bitstream_to_copy * lut_output_mask;
     /* Ensure the offset is in range */
@@ -77,6 +77,21 @@ size_t find_module_ql_memory_bank_num_blwls(
   const CircuitLibrary& circuit_lib, const CircuitModelId& sram_model,
   const e_config_protocol_type& sram_orgz_type,
   const e_circuit_model_port_type& circuit_port_type) {
+  /* Use the value stored by build_module_config_port_stats() when it is
+   * available */
+  if ((CIRCUIT_MODEL_PORT_BL == circuit_port_type) ||
+      (CIRCUIT_MODEL_PORT_WL == circuit_port_type)) {
+    size_t stored_num_blwls = module_manager.config_stat(
+      module_id,
+      CIRCUIT_MODEL_PORT_BL == circuit_port_type
+        ? ModuleManager::CONFIG_STAT_NUM_BLS
+        : ModuleManager::CONFIG_STAT_NUM_WLS,
+      module_config_port_stat_key(sram_model, sram_orgz_type));
+    if (size_t(-1) != stored_num_blwls) {
+      return stored_num_blwls;
+    }
+  }
+
   std::vector<std::string> config_port_names =
     generate_sram_port_names(circuit_lib, sram_model, sram_orgz_type);
   size_t num_blwls = 0; /* By default it has zero configuration bits*/
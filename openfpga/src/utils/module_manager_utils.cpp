@@ -4,6 +4,7 @@
  ******************************************************************************/
 
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <map>
 
@@ -15,6 +16,7 @@
 #include "build_decoder_modules.h"
 #include "circuit_library_utils.h"
 #include "decoder_library_utils.h"
+#include "memory_bank_utils.h"
 #include "memory_utils.h"
 #include "module_manager_utils.h"
 #include "openfpga_naming.h"
@@ -1957,13 +1959,33 @@ size_t find_module_num_shared_config_bits(const ModuleManager& module_manager,
   return num_shared_config_bits;
 }
 
+/********************************************************************
+ * The key of the configuration port statistics in the module manager,
+ * which depend on both the SRAM model and the configuration protocol
+ *******************************************************************/
+size_t module_config_port_stat_key(
+  const CircuitModelId& sram_model,
+  const e_config_protocol_type& sram_orgz_type) {
+  return size_t(sram_model) * NUM_CONFIG_PROTOCOL_TYPES +
+         size_t(sram_orgz_type);
+}
+
 /********************************************************************
  * Find the size of configuration ports for module
+ * Use the value stored by build_module_config_port_stats() when it is
+ * available
  *******************************************************************/
 size_t find_module_num_config_bits(
   const ModuleManager& module_manager, const ModuleId& module_id,
   const CircuitLibrary& circuit_lib, const CircuitModelId& sram_model,
   const e_config_protocol_type& sram_orgz_type) {
+  size_t stored_num_config_bits = module_manager.config_stat(
+    module_id, ModuleManager::CONFIG_STAT_CONFIG_PORT_WIDTH,
+    module_config_port_stat_key(sram_model, sram_orgz_type));
+  if (size_t(-1) != stored_num_config_bits) {
+    return stored_num_config_bits;
+  }
+
   std::vector<std::string> config_port_names =
     generate_sram_port_names(circuit_lib, sram_model, sram_orgz_type);
   size_t num_config_bits = 0; /* By default it has zero configuration bits*/
@@ -1988,6 +2010,39 @@ size_t find_module_num_config_bits(
   return num_config_bits;
 }
 
+/********************************************************************
+ * Store the size of configuration ports for all the modules, as well as
+ * the size of BL/WL ports under the QuickLogic memory bank protocol.
+ * The values are kept by the module manager until the ports of a module
+ * are changed, so that the builders of the top-level module and the
+ * bitstream generators do not search the ports again
+ *******************************************************************/
+void build_module_config_port_stats(
+  ModuleManager& module_manager, const CircuitLibrary& circuit_lib,
+  const CircuitModelId& sram_model,
+  const e_config_protocol_type& sram_orgz_type) {
+  size_t key = module_config_port_stat_key(sram_model, sram_orgz_type);
+  for (const ModuleId& module : module_manager.modules()) {
+    module_manager.set_config_stat(
+      module, ModuleManager::CONFIG_STAT_CONFIG_PORT_WIDTH, key,
+      find_module_num_config_bits(module_manager, module, circuit_lib,
+                                  sram_model, sram_orgz_type));
+    if (CONFIG_MEM_QL_MEMORY_BANK != sram_orgz_type) {
+      continue;
+    }
+    module_manager.set_config_stat(
+      module, ModuleManager::CONFIG_STAT_NUM_BLS, key,
+      find_module_ql_memory_bank_num_blwls(module_manager, module, circuit_lib,
+                                           sram_model, sram_orgz_type,
+                                           CIRCUIT_MODEL_PORT_BL));
+    module_manager.set_config_stat(
+      module, ModuleManager::CONFIG_STAT_NUM_WLS, key,
+      find_module_ql_memory_bank_num_blwls(module_manager, module, circuit_lib,
+                                           sram_model, sram_orgz_type,
+                                           CIRCUIT_MODEL_PORT_WL));
+  }
+}
+
 /********************************************************************
  * Add General purpose I/O ports to the module:
  * In this function, the following tasks are done:
@@ -2531,4 +2586,57 @@ void add_module_bus_nets(
  *
  *******************************************************************/
 
+/********************************************************************
+ * Estimate the runtime (in seconds) to store a given number of nets and
+ * net terminals in a module graph, which are skipped in lite mode.
+ * The runtime is sampled by building nets in a scratch module graph,
+ * including the look-up of nets which is done by most of the builders
+ *******************************************************************/
+float estimate_module_net_build_runtime(const size_t& num_nets,
+                                        const size_t& num_net_terminals) {
+  constexpr size_t num_sample_nets = 10000;
+
+  ModuleManager module_manager;
+  ModuleId parent_module = module_manager.add_module("parent");
+  ModuleId child_module = module_manager.add_module("child");
+  ModulePortId parent_port = module_manager.add_port(
+    parent_module, BasicPort("in", num_sample_nets),
+    ModuleManager::MODULE_INPUT_PORT);
+  ModulePortId child_port =
+    module_manager.add_port(child_module, BasicPort("in", num_sample_nets),
+                            ModuleManager::MODULE_INPUT_PORT);
+  module_manager.add_child_module(parent_module, child_module);
+
+  /* Sample the nets */
+  std::vector<ModuleNetId> nets;
+  nets.reserve(num_sample_nets);
+  std::chrono::steady_clock::time_point start =
+    std::chrono::steady_clock::now();
+  for (size_t ipin = 0; ipin < num_sample_nets; ++ipin) {
+    ModuleNetId net = module_manager.module_instance_port_net(
+      parent_module, parent_module, 0, parent_port, ipin);
+    if (ModuleNetId::INVALID() == net) {
+      net = module_manager.create_module_net(parent_module);
+      module_manager.set_net_name(parent_module, net, std::to_string(ipin));
+    }
+    nets.push_back(net);
+  }
+  std::chrono::duration<float> net_runtime =
+    std::chrono::steady_clock::now() - start;
+
+  /* Sample the net terminals: a source and a sink per net */
+  start = std::chrono::steady_clock::now();
+  for (size_t ipin = 0; ipin < num_sample_nets; ++ipin) {
+    module_manager.add_module_net_source(parent_module, nets[ipin],
+                                         parent_module, 0, parent_port, ipin);
+    module_manager.add_module_net_sink(parent_module, nets[ipin], child_module,
+                                       0, child_port, ipin);
+  }
+  std::chrono::duration<float> terminal_runtime =
+    std::chrono::steady_clock::now() - start;
+
+  return net_runtime.count() * num_nets / num_sample_nets +
+         terminal_runtime.count() * num_net_terminals / (2 * num_sample_nets);
+}
+
 } /* end namespace openfpga */
@@ -141,11 +141,20 @@ void add_pb_module_nets_memory_config_bus(
 size_t find_module_num_shared_config_bits(const ModuleManager& module_manager,
                                           const ModuleId& module_id);
 
+size_t module_config_port_stat_key(
+  const CircuitModelId& sram_model,
+  const e_config_protocol_type& sram_orgz_type);
+
 size_t find_module_num_config_bits(
   const ModuleManager& module_manager, const ModuleId& module_id,
   const CircuitLibrary& circuit_lib, const CircuitModelId& sram_model,
   const e_config_protocol_type& sram_orgz_type);
 
+void build_module_config_port_stats(
+  ModuleManager& module_manager, const CircuitLibrary& circuit_lib,
+  const CircuitModelId& sram_model,
+  const e_config_protocol_type& sram_orgz_type);
+
 void add_module_global_input_ports_from_child_modules(
   ModuleManager& module_manager, const ModuleId& module_id,
   const std::vector<std::string>& port_name_to_ignore =
@@ -183,6 +192,9 @@ void add_module_bus_nets(
   const ModulePortId& src_module_port_id, const ModuleId& des_module_id,
   const size_t& des_instance_id, const ModulePortId& des_module_port_id);
 
+float estimate_module_net_build_runtime(const size_t& num_nets,
+                                        const size_t& num_net_terminals);
+
 } /* end namespace openfpga */
 
 #endif
@@ -171,6 +171,21 @@ echo -e "Testing programmable clock architecture";
 run-task basic_tests/clock_network/homo_1clock_2layer $@
 run-task basic_tests/clock_network/homo_1clock_2layer_full_tb $@
 run-task basic_tests/clock_network/homo_2clock_2layer $@
+run-task basic_tests/clock_network/homo_2clock_2layer_disable_unused_spines $@
+# Unused spines only change the configuration of the clock network.
+# The fabric must be the same as the one of the run routing all the spines
+clkntwk_run_dir=${OPENFPGA_TASK_PATH}/basic_tests/clock_network/homo_2clock_2layer_disable_unused_spines/latest/k4_N4_tileable_Ntwk2clk2lvl_40nm/and2_latch
+for fabric_netlist in fpga_top.v lb routing sub_module; do
+  diff -r ${clkntwk_run_dir}/ALL_SPINES/SRC/${fabric_netlist} ${clkntwk_run_dir}/USED_SPINES/SRC/${fabric_netlist}
+done
+# The clock tree has 5 spines for each of the 2 clock pins. clk[1] has no net,
+# so all its spines are disabled, while clk[0] always needs the top-level spine
+grep "^Disabled 0 unused spines out of 10$" ${clkntwk_run_dir}/ALL_SPINES/openfpgashell.log
+num_disabled_spines=$(sed -n 's/^Disabled \([0-9]*\) unused spines out of 10$/\1/p' ${clkntwk_run_dir}/USED_SPINES/openfpgashell.log)
+if [ -z "${num_disabled_spines}" ] || [ ${num_disabled_spines} -lt 5 ] || [ ${num_disabled_spines} -gt 9 ]; then
+  echo -e "Unexpected number of disabled spines '${num_disabled_spines}' with --disable_unused_spines";
+  exit 1;
+fi
 
 echo -e "Testing configuration chain of a K4N4 FPGA using .blif generated by yosys+verific";
 run-task basic_tests/verific_test $@
@@ -223,8 +238,27 @@ run-task _task_copy $@
 
 echo -e "Testing output files without time stamp";
 run-task basic_tests/no_time_stamp/device_1x1 $@
+run-task basic_tests/no_time_stamp/device_1x1_parallel_const_commands $@
+# Outputs of concurrent commands must be the golden ones of device_1x1
+diff -r ${OPENFPGA_TASK_PATH}/basic_tests/no_time_stamp/device_1x1_parallel_const_commands/latest/k4_N4_tileable_40nm/and2/MIN_ROUTE_CHAN_WIDTH/outputs_no_time_stamp ${OPENFPGA_TASK_PATH}/basic_tests/no_time_stamp/device_1x1/golden_outputs_no_time_stamp
+run-task basic_tests/no_time_stamp/device_1x1_jobs $@
+# Outputs of multi-threaded commands must be the golden ones of device_1x1
+diff -r ${OPENFPGA_TASK_PATH}/basic_tests/no_time_stamp/device_1x1_jobs/latest/k4_N4_tileable_40nm/and2/MIN_ROUTE_CHAN_WIDTH/outputs_no_time_stamp ${OPENFPGA_TASK_PATH}/basic_tests/no_time_stamp/device_1x1/golden_outputs_no_time_stamp
+run-task basic_tests/no_time_stamp/analysis_sdc_compress_disable_timing $@
+# The uncompressed analysis SDC must be the golden one of device_1x1,
+# and the compressed one must disable the timing of the same resources
+analysis_sdc_run_dir=${OPENFPGA_TASK_PATH}/basic_tests/no_time_stamp/analysis_sdc_compress_disable_timing/latest/k4_N4_tileable_40nm/and2/MIN_ROUTE_CHAN_WIDTH
+diff ${analysis_sdc_run_dir}/SDC_analysis/and2_fpga_top_analysis.sdc ${OPENFPGA_TASK_PATH}/basic_tests/no_time_stamp/device_1x1/golden_outputs_no_time_stamp/and2_fpga_top_analysis.sdc
+python3 ${OPENFPGA_PATH}/openfpga_flow/scripts/check_sdc_disable_timing.py --check_sdc_file ${analysis_sdc_run_dir}/SDC_analysis_compressed/and2_fpga_top_analysis.sdc --reference_sdc_file ${analysis_sdc_run_dir}/SDC_analysis/and2_fpga_top_analysis.sdc
 run-task basic_tests/no_time_stamp/device_4x4 $@
 run-task basic_tests/no_time_stamp/no_cout_in_gsb $@
+run-task basic_tests/no_time_stamp/ql_memory_bank_flatten $@
+run-task basic_tests/no_time_stamp/ql_memory_bank_shift_register $@
+# The first run saves a fabric snapshot and the second run restores it.
+# Both runs must produce the golden netlists
+rm -rf ${OPENFPGA_PATH}/openfpga_flow/tasks/basic_tests/no_time_stamp/fabric_snapshot/fabric_cache
+run-task basic_tests/no_time_stamp/fabric_snapshot $@
+run-task basic_tests/no_time_stamp/fabric_snapshot $@
 # Run git-diff to ensure no changes on the golden netlists
 # Switch to root path in case users are running the tests in another location
 cd ${OPENFPGA_PATH}
@@ -238,6 +272,12 @@ else
   git diff -- ':openfpga_flow/tasks/basic_tests/no_time_stamp/*/golden_outputs_no_time_stamp/**';
   exit 1;
 fi
+# Outputs which are not committed have no golden to be compared with
+if [ -n "$(git ls-files --others --exclude-standard -- ':openfpga_flow/tasks/basic_tests/no_time_stamp/*/golden_outputs_no_time_stamp/**')" ]; then
+  echo -e "Detect outputs without golden netlists";
+  git ls-files --others --exclude-standard -- ':openfpga_flow/tasks/basic_tests/no_time_stamp/*/golden_outputs_no_time_stamp/**';
+  exit 1;
+fi
 cd -
 
 # Repgression test to test multi-user enviroment
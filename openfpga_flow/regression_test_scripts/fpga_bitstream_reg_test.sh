@@ -11,6 +11,7 @@ echo -e "FPGA-Bitstream regression tests";
 echo -e "Testing bitstream generation for an auto-sized device";
 run-task fpga_bitstream/generate_bitstream/configuration_chain/device_auto $@
 run-task fpga_bitstream/generate_bitstream/ql_memory_bank_shift_register/device_auto $@
+run-task fpga_bitstream/generate_bitstream/lite_fabric/device_auto $@
 
 echo -e "Testing bitstream generation for an 48x48 FPGA device";
 run-task fpga_bitstream/generate_bitstream/configuration_chain/device_48x48 $@
@@ -22,6 +23,28 @@ run-task fpga_bitstream/generate_bitstream/ql_memory_bank_shift_register/device_
 
 echo -e "Testing loading architecture bitstream from an external file";
 run-task fpga_bitstream/load_external_architecture_bitstream $@
+run-task fpga_bitstream/load_external_architecture_bitstream_stream_read $@
+run-task fpga_bitstream/load_external_architecture_bitstream_stream_read_gzip $@
+
+echo -e "Testing building bitstreams of multiple designs on the same fabric";
+run-task fpga_bitstream/build_bitstreams_batch $@
+# The bitstream of and2 must be the one built by the regular flow
+batch_run_dir=${OPENFPGA_TASK_PATH}/fpga_bitstream/build_bitstreams_batch/latest/k4_N4_tileable_40nm/and2/MIN_ROUTE_CHAN_WIDTH
+diff ${batch_run_dir}/fabric_bitstream.bit ${batch_run_dir}/batch/and2_fabric_bitstream.bit
+test -s ${batch_run_dir}/batch/or2_fabric_bitstream.bit
+# The client requests the same designs as the batch, with paths relative to the run directory of the server
+bitstream_server_socket=/tmp/openfpga_reg_test_bitstream_server.sock
+bitstream_server_vpr_options="--device 2x2 --route_chan_width 20 --clock_modeling ideal"
+${PYTHON_EXEC} ${OPENFPGA_PATH}/openfpga_flow/scripts/bitstream_server_client.py --socket ${bitstream_server_socket} \
+  --request "server_and2_fabric_bitstream.bit arch/k4_N4_tileable_40nm.xml benchmark/and2.blif ${bitstream_server_vpr_options}" \
+  --request "server_or2_fabric_bitstream.bit arch/k4_N4_tileable_40nm.xml benchmark/or2.blif ${bitstream_server_vpr_options}" \
+  --shutdown &
+bitstream_client_pid=$!
+run-task fpga_bitstream/start_bitstream_server $@
+wait ${bitstream_client_pid}
+server_run_dir=${OPENFPGA_TASK_PATH}/fpga_bitstream/start_bitstream_server/latest/k4_N4_tileable_40nm/and2/MIN_ROUTE_CHAN_WIDTH
+diff ${server_run_dir}/fabric_bitstream.bit ${server_run_dir}/server_and2_fabric_bitstream.bit
+diff ${batch_run_dir}/batch/or2_fabric_bitstream.bit ${server_run_dir}/server_or2_fabric_bitstream.bit
 
 echo -e "Testing repacker capability in identifying wire LUTs";
 run-task fpga_bitstream/repack_wire_lut $@
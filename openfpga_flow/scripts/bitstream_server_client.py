@@ -0,0 +1,106 @@
+#####################################################################
+# Python script to send jobs to a bitstream server, which is started by
+# the command start_bitstream_server of OpenFPGA shell
+# This script will
+#   - Wait until the server listens at the socket
+#   - Send the requests one by one, and wait for the reply of each job
+#   - Request the server to shut down if required
+# Each request is a line of '<bitstream_file> <vpr_options>', where the
+# file paths are resolved from the working directory of the server
+#####################################################################
+
+import socket
+import time
+import argparse
+import logging
+
+#####################################################################
+# Initialize logger
+#####################################################################
+logging.basicConfig(format="%(levelname)s: %(message)s", level=logging.DEBUG)
+
+#####################################################################
+# Parse the options
+# - [mandatory option] the file path to the socket of the server
+# - [optional] the requests to be sent
+# - [optional] shut down the server after all the requests
+#####################################################################
+parser = argparse.ArgumentParser(description="A client of the OpenFPGA bitstream server")
+parser.add_argument(
+    "--socket",
+    required=True,
+    help="Specify the file path of the Unix domain socket of the server",
+)
+parser.add_argument(
+    "--request",
+    action="append",
+    default=[],
+    help="Specify a request '<bitstream_file> <vpr_options>'. Can be used multiple times",
+)
+parser.add_argument(
+    "--shutdown",
+    action="store_true",
+    help="Request the server to shut down after all the requests",
+)
+parser.add_argument(
+    "--timeout",
+    type=int,
+    default=1200,
+    help="Specify the time in seconds to wait for the server to start",
+)
+args = parser.parse_args()
+
+
+#####################################################################
+# Connect to the server, retrying until the server is ready
+# A socket file left by a previous server refuses connections, which
+# is retried as well
+#####################################################################
+def connect_server(socket_path, timeout):
+    deadline = time.time() + timeout
+    while True:
+        client = socket.socket(socket.AF_UNIX, socket.SOCK_STREAM)
+        try:
+            client.connect(socket_path)
+            return client
+        except (FileNotFoundError, ConnectionRefusedError):
+            client.close()
+            if time.time() > deadline:
+                logging.error("No bitstream server is listening at " + socket_path)
+                exit(1)
+            time.sleep(1)
+
+
+#####################################################################
+# Send a request and return the reply, once the server closes the connection
+#####################################################################
+def send_request(request):
+    client = connect_server(args.socket, args.timeout)
+    client.sendall((request + "\n").encode())
+    reply = b""
+    while True:
+        data = client.recv(4096)
+        if not data:
+            break
+        reply += data
+    client.close()
+    return reply.decode().strip()
+
+
+num_failed_requests = 0
+for request in args.request:
+    logging.info("Request: " + request)
+    reply = send_request(request)
+    logging.info("Reply: " + reply)
+    if not reply.startswith("OK "):
+        num_failed_requests += 1
+
+if args.shutdown:
+    reply = send_request("shutdown")
+    logging.info("Reply: " + reply)
+    if reply != "OK shutdown":
+        num_failed_requests += 1
+
+logging.info("See " + str(num_failed_requests) + " failed requests")
+if 0 < num_failed_requests:
+    exit(1)
@@ -0,0 +1,129 @@
+#####################################################################
+# Python script to check if two SDC files disable the timing of
+# the same objects, e.g., the analysis SDC files written with and
+# without the option --compress_disable_timing
+# This script will
+#   - Expand each set_disable_timing command into single objects:
+#     collections {a b} are split, and ranged ports a[0:3] are split
+#     into a[0] a[1] a[2] a[3]
+#   - Check that each object of a file is covered by an object of the
+#     other file, where a '*' matches any name in one level of hierarchy
+#     and a trailing '/*' covers everything under the hierarchy
+#####################################################################
+
+from os.path import isfile
+import re
+import argparse
+import logging
+
+#####################################################################
+# Initialize logger
+#####################################################################
+logging.basicConfig(format="%(levelname)s: %(message)s", level=logging.DEBUG)
+
+#####################################################################
+# Parse the options
+# - [mandatory option] the file paths to the SDC files
+#####################################################################
+parser = argparse.ArgumentParser(
+    description="A checker for the set_disable_timing commands of two SDC files"
+)
+parser.add_argument(
+    "--check_sdc_file",
+    required=True,
+    help="Specify the to-be-checked SDC file, e.g., a compressed one",
+)
+parser.add_argument(
+    "--reference_sdc_file",
+    required=True,
+    help="Specify the reference SDC file",
+)
+args = parser.parse_args()
+
+#####################################################################
+# Check options:
+# - Input SDC files must be valid
+#   Otherwise, error out
+#####################################################################
+for sdc_file in [args.check_sdc_file, args.reference_sdc_file]:
+    if not isfile(sdc_file):
+        logging.error("Invalid SDC file: " + sdc_file + "\nFile does not exist!\n")
+        exit(1)
+
+
+#####################################################################
+# Expand the set_disable_timing commands of a SDC file into single objects
+#####################################################################
+def parse_disabled_objects(sdc_file_path):
+    disabled_objects = set()
+    with open(sdc_file_path, "r") as sdc_file:
+        for line in sdc_file:
+            tokens = line.split(None, 1)
+            if len(tokens) != 2 or tokens[0] != "set_disable_timing":
+                continue
+            for sdc_object in tokens[1].strip().strip("{}").split():
+                ranged_port = re.match(r"^(.*)\[(\d+):(\d+)\]$", sdc_object)
+                if ranged_port is None:
+                    disabled_objects.add(sdc_object)
+                    continue
+                for pin in range(int(ranged_port.group(2)), int(ranged_port.group(3)) + 1):
+                    disabled_objects.add(ranged_port.group(1) + "[" + str(pin) + "]")
+    return disabled_objects
+
+
+#####################################################################
+# Find the objects which are not covered by any object of the other file
+# A wildcard '*' matches any name in one level of hierarchy, while
+# a trailing '/*' disables everything under the hierarchy
+#####################################################################
+def find_uncovered_objects(objects_to_cover, covering_objects):
+    literal_objects = set()
+    wildcard_patterns = []
+    for covering_object in covering_objects:
+        if "*" not in covering_object:
+            literal_objects.add(covering_object)
+            continue
+        subtree = covering_object.endswith("/*")
+        if subtree:
+            covering_object = covering_object[:-1]
+        pattern = "[^/]*".join(map(re.escape, covering_object.split("*")))
+        if subtree:
+            pattern += ".*"
+        wildcard_patterns.append(re.compile("^" + pattern + "$"))
+
+    uncovered_objects = []
+    for sdc_object in sorted(objects_to_cover):
+        if sdc_object in literal_objects:
+            continue
+        if any(pattern.match(sdc_object) for pattern in wildcard_patterns):
+            continue
+        uncovered_objects.append(sdc_object)
+    return uncovered_objects
+
+
+check_objects = parse_disabled_objects(args.check_sdc_file)
+reference_objects = parse_disabled_objects(args.reference_sdc_file)
+logging.info(
+    "Found "
+    + str(len(check_objects))
+    + " disabled objects in "
+    + args.check_sdc_file
+    + " and "
+    + str(len(reference_objects))
+    + " in "
+    + args.reference_sdc_file
+)
+
+check_error_count = 0
+for sdc_object in find_uncovered_objects(reference_objects, check_objects):
+    logging.error("Timing of '" + sdc_object + "' is not disabled in " + args.check_sdc_file)
+    check_error_count += 1
+for sdc_object in find_uncovered_objects(check_objects, reference_objects):
+    logging.error(
+        "Timing of '" + sdc_object + "' is disabled but not in " + args.reference_sdc_file
+    )
+    check_error_count += 1
+
+logging.info("See " + str(check_error_count) + " mismatches")
+if 0 < check_error_count:
+    exit(1)
@@ -96,6 +96,17 @@ parser.add_argument(
     help="Sample openfpga shell script",
 )
 parser.add_argument("--openfpga_arch_file", type=str, help="Openfpga architecture file for shell")
+parser.add_argument(
+    "--parallel_const_commands",
+    action="store_true",
+    help="Execute consecutive const commands of openfpga shell concurrently",
+)
+parser.add_argument(
+    "--parallel_const_command_jobs",
+    type=int,
+    default=0,
+    help="Maximum number of const commands executed concurrently (0: all hardware threads)",
+)
 parser.add_argument(
     "--arch_variable_file", type=str, default=None, help="Openfpga architecture file for shell"
 )
@@ -892,6 +903,10 @@ def run_openfpga_shell():
     with open(args.top_module + "_run.openfpga", "w", encoding="utf-8") as archfile:
         archfile.write(tmpl.safe_substitute(path_variables))
     command = [cad_tools["openfpga_shell_path"], "-batch", "-f", args.top_module + "_run.openfpga"]
+    if args.parallel_const_commands:
+        command += ["--parallel_const_commands"]
+        if args.parallel_const_command_jobs:
+            command += ["--parallel_const_command_jobs", str(args.parallel_const_command_jobs)]
     run_command("OpenFPGA Shell Run", "openfpgashell.log", command)
     ExecTime["VPREnd"] = time.time()
     extract_vpr_stats("openfpgashell.log")
@@ -0,0 +1,370 @@
+//-------------------------------------------
+//	FPGA Synthesizable Verilog Netlist
+//	Description: Verilog modules for Unique Connection Blocks[1][1]
+//	Author: Xifan TANG
+//	Organization: University of Utah
+//-------------------------------------------
+//----- Time scale -----
+`timescale 1ns / 1ps
+
+//----- Default net type -----
+`default_nettype none
+
+// ----- Verilog module for cby_1__1_ -----
+module cby_1__1_(prog_clk,
+                 chany_bottom_in,
+                 chany_top_in,
+                 ccff_head,
+                 chany_bottom_out,
+                 chany_top_out,
+                 right_grid_left_width_0_height_0_subtile_0__pin_outpad_0_,
+                 right_grid_left_width_0_height_0_subtile_1__pin_outpad_0_,
+                 right_grid_left_width_0_height_0_subtile_2__pin_outpad_0_,
+                 right_grid_left_width_0_height_0_subtile_3__pin_outpad_0_,
+                 right_grid_left_width_0_height_0_subtile_4__pin_outpad_0_,
+                 right_grid_left_width_0_height_0_subtile_5__pin_outpad_0_,
+                 right_grid_left_width_0_height_0_subtile_6__pin_outpad_0_,
+                 right_grid_left_width_0_height_0_subtile_7__pin_outpad_0_,
+                 left_grid_right_width_0_height_0_subtile_0__pin_I_1_,
+                 left_grid_right_width_0_height_0_subtile_0__pin_I_5_,
+                 left_grid_right_width_0_height_0_subtile_0__pin_I_9_,
+                 ccff_tail);
+//----- GLOBAL PORTS -----
+input [0:0] prog_clk;
+//----- INPUT PORTS -----
+input [0:12] chany_bottom_in;
+//----- INPUT PORTS -----
+input [0:12] chany_top_in;
+//----- INPUT PORTS -----
+input [0:0] ccff_head;
+//----- OUTPUT PORTS -----
+output [0:12] chany_bottom_out;
+//----- OUTPUT PORTS -----
+output [0:12] chany_top_out;
+//----- OUTPUT PORTS -----
+output [0:0] right_grid_left_width_0_height_0_subtile_0__pin_outpad_0_;
+//----- OUTPUT PORTS -----
+output [0:0] right_grid_left_width_0_height_0_subtile_1__pin_outpad_0_;
+//----- OUTPUT PORTS -----
+output [0:0] right_grid_left_width_0_height_0_subtile_2__pin_outpad_0_;
+//----- OUTPUT PORTS -----
+output [0:0] right_grid_left_width_0_height_0_subtile_3__pin_outpad_0_;
+//----- OUTPUT PORTS -----
+output [0:0] right_grid_left_width_0_height_0_subtile_4__pin_outpad_0_;
+//----- OUTPUT PORTS -----
+output [0:0] right_grid_left_width_0_height_0_subtile_5__pin_outpad_0_;
+//----- OUTPUT PORTS -----
+output [0:0] right_grid_left_width_0_height_0_subtile_6__pin_outpad_0_;
+//----- OUTPUT PORTS -----
+output [0:0] right_grid_left_width_0_height_0_subtile_7__pin_outpad_0_;
+//----- OUTPUT PORTS -----
+output [0:0] left_grid_right_width_0_height_0_subtile_0__pin_I_1_;
+//----- OUTPUT PORTS -----
+output [0:0] left_grid_right_width_0_height_0_subtile_0__pin_I_5_;
+//----- OUTPUT PORTS -----
+output [0:0] left_grid_right_width_0_height_0_subtile_0__pin_I_9_;
+//----- OUTPUT PORTS -----
+output [0:0] ccff_tail;
+
+//----- BEGIN wire-connection ports -----
+//----- END wire-connection ports -----
+
+
+//----- BEGIN Registered ports -----
+//----- END Registered ports -----
+
+
+wire [0:2] mux_tree_tapbuf_size6_0_sram;
+wire [0:2] mux_tree_tapbuf_size6_0_sram_inv;
+wire [0:2] mux_tree_tapbuf_size6_10_sram;
+wire [0:2] mux_tree_tapbuf_size6_10_sram_inv;
+wire [0:2] mux_tree_tapbuf_size6_1_sram;
+wire [0:2] mux_tree_tapbuf_size6_1_sram_inv;
+wire [0:2] mux_tree_tapbuf_size6_2_sram;
+wire [0:2] mux_tree_tapbuf_size6_2_sram_inv;
+wire [0:2] mux_tree_tapbuf_size6_3_sram;
+wire [0:2] mux_tree_tapbuf_size6_3_sram_inv;
+wire [0:2] mux_tree_tapbuf_size6_4_sram;
+wire [0:2] mux_tree_tapbuf_size6_4_sram_inv;
+wire [0:2] mux_tree_tapbuf_size6_5_sram;
+wire [0:2] mux_tree_tapbuf_size6_5_sram_inv;
+wire [0:2] mux_tree_tapbuf_size6_6_sram;
+wire [0:2] mux_tree_tapbuf_size6_6_sram_inv;
+wire [0:2] mux_tree_tapbuf_size6_7_sram;
+wire [0:2] mux_tree_tapbuf_size6_7_sram_inv;
+wire [0:2] mux_tree_tapbuf_size6_8_sram;
+wire [0:2] mux_tree_tapbuf_size6_8_sram_inv;
+wire [0:2] mux_tree_tapbuf_size6_9_sram;
+wire [0:2] mux_tree_tapbuf_size6_9_sram_inv;
+wire [0:0] mux_tree_tapbuf_size6_mem_0_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size6_mem_1_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size6_mem_2_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size6_mem_3_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size6_mem_4_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size6_mem_5_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size6_mem_6_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size6_mem_7_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size6_mem_8_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size6_mem_9_ccff_tail;
+
+// ----- BEGIN Local short connections -----
+// ----- Local connection due to Wire 0 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_top_out[0] = chany_bottom_in[0];
+// ----- Local connection due to Wire 1 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_top_out[1] = chany_bottom_in[1];
+// ----- Local connection due to Wire 2 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_top_out[2] = chany_bottom_in[2];
+// ----- Local connection due to Wire 3 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_top_out[3] = chany_bottom_in[3];
+// ----- Local connection due to Wire 4 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_top_out[4] = chany_bottom_in[4];
+// ----- Local connection due to Wire 5 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_top_out[5] = chany_bottom_in[5];
+// ----- Local connection due to Wire 6 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_top_out[6] = chany_bottom_in[6];
+// ----- Local connection due to Wire 7 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_top_out[7] = chany_bottom_in[7];
+// ----- Local connection due to Wire 8 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_top_out[8] = chany_bottom_in[8];
+// ----- Local connection due to Wire 9 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_top_out[9] = chany_bottom_in[9];
+// ----- Local connection due to Wire 10 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_top_out[10] = chany_bottom_in[10];
+// ----- Local connection due to Wire 11 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_top_out[11] = chany_bottom_in[11];
+// ----- Local connection due to Wire 12 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_top_out[12] = chany_bottom_in[12];
+// ----- Local connection due to Wire 13 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_bottom_out[0] = chany_top_in[0];
+// ----- Local connection due to Wire 14 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_bottom_out[1] = chany_top_in[1];
+// ----- Local connection due to Wire 15 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_bottom_out[2] = chany_top_in[2];
+// ----- Local connection due to Wire 16 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_bottom_out[3] = chany_top_in[3];
+// ----- Local connection due to Wire 17 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_bottom_out[4] = chany_top_in[4];
+// ----- Local connection due to Wire 18 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_bottom_out[5] = chany_top_in[5];
+// ----- Local connection due to Wire 19 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_bottom_out[6] = chany_top_in[6];
+// ----- Local connection due to Wire 20 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_bottom_out[7] = chany_top_in[7];
+// ----- Local connection due to Wire 21 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_bottom_out[8] = chany_top_in[8];
+// ----- Local connection due to Wire 22 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_bottom_out[9] = chany_top_in[9];
+// ----- Local connection due to Wire 23 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_bottom_out[10] = chany_top_in[10];
+// ----- Local connection due to Wire 24 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_bottom_out[11] = chany_top_in[11];
+// ----- Local connection due to Wire 25 -----
+// ----- Net source id 0 -----
+// ----- Net sink id 0 -----
+	assign chany_bottom_out[12] = chany_top_in[12];
+// ----- END Local short connections -----
+// ----- BEGIN Local output short connections -----
+// ----- END Local output short connections -----
+
+	mux_tree_tapbuf_size6 mux_left_ipin_0 (
+		.in({chany_bottom_in[0], chany_top_in[0], chany_bottom_in[6], chany_top_in[6], chany_bottom_in[12], chany_top_in[12]}),
+		.sram(mux_tree_tapbuf_size6_0_sram[0:2]),
+		.sram_inv(mux_tree_tapbuf_size6_0_sram_inv[0:2]),
+		.out(right_grid_left_width_0_height_0_subtile_0__pin_outpad_0_));
+
+	mux_tree_tapbuf_size6 mux_left_ipin_1 (
+		.in({chany_bottom_in[0], chany_top_in[0], chany_bottom_in[1], chany_top_in[1], chany_bottom_in[7], chany_top_in[7]}),
+		.sram(mux_tree_tapbuf_size6_1_sram[0:2]),
+		.sram_inv(mux_tree_tapbuf_size6_1_sram_inv[0:2]),
+		.out(right_grid_left_width_0_height_0_subtile_1__pin_outpad_0_));
+
+	mux_tree_tapbuf_size6 mux_left_ipin_2 (
+		.in({chany_bottom_in[1], chany_top_in[1], chany_bottom_in[2], chany_top_in[2], chany_bottom_in[8], chany_top_in[8]}),
+		.sram(mux_tree_tapbuf_size6_2_sram[0:2]),
+		.sram_inv(mux_tree_tapbuf_size6_2_sram_inv[0:2]),
+		.out(right_grid_left_width_0_height_0_subtile_2__pin_outpad_0_));
+
+	mux_tree_tapbuf_size6 mux_left_ipin_3 (
+		.in({chany_bottom_in[2], chany_top_in[2], chany_bottom_in[3], chany_top_in[3], chany_bottom_in[9], chany_top_in[9]}),
+		.sram(mux_tree_tapbuf_size6_3_sram[0:2]),
+		.sram_inv(mux_tree_tapbuf_size6_3_sram_inv[0:2]),
+		.out(right_grid_left_width_0_height_0_subtile_3__pin_outpad_0_));
+
+	mux_tree_tapbuf_size6 mux_left_ipin_4 (
+		.in({chany_bottom_in[3], chany_top_in[3], chany_bottom_in[4], chany_top_in[4], chany_bottom_in[10], chany_top_in[10]}),
+		.sram(mux_tree_tapbuf_size6_4_sram[0:2]),
+		.sram_inv(mux_tree_tapbuf_size6_4_sram_inv[0:2]),
+		.out(right_grid_left_width_0_height_0_subtile_4__pin_outpad_0_));
+
+	mux_tree_tapbuf_size6 mux_left_ipin_5 (
+		.in({chany_bottom_in[4], chany_top_in[4], chany_bottom_in[5], chany_top_in[5], chany_bottom_in[11], chany_top_in[11]}),
+		.sram(mux_tree_tapbuf_size6_5_sram[0:2]),
+		.sram_inv(mux_tree_tapbuf_size6_5_sram_inv[0:2]),
+		.out(right_grid_left_width_0_height_0_subtile_5__pin_outpad_0_));
+
+	mux_tree_tapbuf_size6 mux_left_ipin_6 (
+		.in({chany_bottom_in[5], chany_top_in[5], chany_bottom_in[6], chany_top_in[6], chany_bottom_in[12], chany_top_in[12]}),
+		.sram(mux_tree_tapbuf_size6_6_sram[0:2]),
+		.sram_inv(mux_tree_tapbuf_size6_6_sram_inv[0:2]),
+		.out(right_grid_left_width_0_height_0_subtile_6__pin_outpad_0_));
+
+	mux_tree_tapbuf_size6 mux_left_ipin_7 (
+		.in({chany_bottom_in[0], chany_top_in[0], chany_bottom_in[6], chany_top_in[6], chany_bottom_in[7], chany_top_in[7]}),
+		.sram(mux_tree_tapbuf_size6_7_sram[0:2]),
+		.sram_inv(mux_tree_tapbuf_size6_7_sram_inv[0:2]),
+		.out(right_grid_left_width_0_height_0_subtile_7__pin_outpad_0_));
+
+	mux_tree_tapbuf_size6 mux_right_ipin_0 (
+		.in({chany_bottom_in[1], chany_top_in[1], chany_bottom_in[7], chany_top_in[7], chany_bottom_in[8], chany_top_in[8]}),
+		.sram(mux_tree_tapbuf_size6_8_sram[0:2]),
+		.sram_inv(mux_tree_tapbuf_size6_8_sram_inv[0:2]),
+		.out(left_grid_right_width_0_height_0_subtile_0__pin_I_1_));
+
+	mux_tree_tapbuf_size6 mux_right_ipin_1 (
+		.in({chany_bottom_in[2], chany_top_in[2], chany_bottom_in[8], chany_top_in[8], chany_bottom_in[9], chany_top_in[9]}),
+		.sram(mux_tree_tapbuf_size6_9_sram[0:2]),
+		.sram_inv(mux_tree_tapbuf_size6_9_sram_inv[0:2]),
+		.out(left_grid_right_width_0_height_0_subtile_0__pin_I_5_));
+
+	mux_tree_tapbuf_size6 mux_right_ipin_2 (
+		.in({chany_bottom_in[3], chany_top_in[3], chany_bottom_in[9], chany_top_in[9], chany_bottom_in[10], chany_top_in[10]}),
+		.sram(mux_tree_tapbuf_size6_10_sram[0:2]),
+		.sram_inv(mux_tree_tapbuf_size6_10_sram_inv[0:2]),
+		.out(left_grid_right_width_0_height_0_subtile_0__pin_I_9_));
+
+	mux_tree_tapbuf_size6_mem mem_left_ipin_0 (
+		.prog_clk(prog_clk),
+		.ccff_head(ccff_head),
+		.ccff_tail(mux_tree_tapbuf_size6_mem_0_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size6_0_sram[0:2]),
+		.mem_outb(mux_tree_tapbuf_size6_0_sram_inv[0:2]));
+
+	mux_tree_tapbuf_size6_mem mem_left_ipin_1 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size6_mem_0_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size6_mem_1_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size6_1_sram[0:2]),
+		.mem_outb(mux_tree_tapbuf_size6_1_sram_inv[0:2]));
+
+	mux_tree_tapbuf_size6_mem mem_left_ipin_2 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size6_mem_1_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size6_mem_2_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size6_2_sram[0:2]),
+		.mem_outb(mux_tree_tapbuf_size6_2_sram_inv[0:2]));
+
+	mux_tree_tapbuf_size6_mem mem_left_ipin_3 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size6_mem_2_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size6_mem_3_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size6_3_sram[0:2]),
+		.mem_outb(mux_tree_tapbuf_size6_3_sram_inv[0:2]));
+
+	mux_tree_tapbuf_size6_mem mem_left_ipin_4 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size6_mem_3_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size6_mem_4_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size6_4_sram[0:2]),
+		.mem_outb(mux_tree_tapbuf_size6_4_sram_inv[0:2]));
+
+	mux_tree_tapbuf_size6_mem mem_left_ipin_5 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size6_mem_4_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size6_mem_5_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size6_5_sram[0:2]),
+		.mem_outb(mux_tree_tapbuf_size6_5_sram_inv[0:2]));
+
+	mux_tree_tapbuf_size6_mem mem_left_ipin_6 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size6_mem_5_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size6_mem_6_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size6_6_sram[0:2]),
+		.mem_outb(mux_tree_tapbuf_size6_6_sram_inv[0:2]));
+
+	mux_tree_tapbuf_size6_mem mem_left_ipin_7 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size6_mem_6_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size6_mem_7_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size6_7_sram[0:2]),
+		.mem_outb(mux_tree_tapbuf_size6_7_sram_inv[0:2]));
+
+	mux_tree_tapbuf_size6_mem mem_right_ipin_0 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size6_mem_7_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size6_mem_8_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size6_8_sram[0:2]),
+		.mem_outb(mux_tree_tapbuf_size6_8_sram_inv[0:2]));
+
+	mux_tree_tapbuf_size6_mem mem_right_ipin_1 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size6_mem_8_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size6_mem_9_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size6_9_sram[0:2]),
+		.mem_outb(mux_tree_tapbuf_size6_9_sram_inv[0:2]));
+
+	mux_tree_tapbuf_size6_mem mem_right_ipin_2 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size6_mem_9_ccff_tail),
+		.ccff_tail(ccff_tail),
+		.mem_out(mux_tree_tapbuf_size6_10_sram[0:2]),
+		.mem_outb(mux_tree_tapbuf_size6_10_sram_inv[0:2]));
+
+endmodule
+// ----- END Verilog module for cby_1__1_ -----
+
+//----- Default net type -----
+`default_nettype none
+
+
+
+
@@ -0,0 +1,526 @@
+//-------------------------------------------
+//	FPGA Synthesizable Verilog Netlist
+//	Description: Verilog modules for Unique Switch Blocks[1][0]
+//	Author: Xifan TANG
+//	Organization: University of Utah
+//-------------------------------------------
+//----- Time scale -----
+`timescale 1ns / 1ps
+
+//----- Default net type -----
+`default_nettype none
+
+// ----- Verilog module for sb_1__0_ -----
+module sb_1__0_(prog_clk,
+                chany_top_in,
+                top_left_grid_right_width_0_height_0_subtile_0__pin_O_3_,
+                top_right_grid_left_width_0_height_0_subtile_0__pin_inpad_0_,
+                top_right_grid_left_width_0_height_0_subtile_1__pin_inpad_0_,
+                top_right_grid_left_width_0_height_0_subtile_2__pin_inpad_0_,
+                top_right_grid_left_width_0_height_0_subtile_3__pin_inpad_0_,
+                top_right_grid_left_width_0_height_0_subtile_4__pin_inpad_0_,
+                top_right_grid_left_width_0_height_0_subtile_5__pin_inpad_0_,
+                top_right_grid_left_width_0_height_0_subtile_6__pin_inpad_0_,
+                top_right_grid_left_width_0_height_0_subtile_7__pin_inpad_0_,
+                chanx_left_in,
+                left_top_grid_bottom_width_0_height_0_subtile_0__pin_O_0_,
+                left_bottom_grid_top_width_0_height_0_subtile_0__pin_inpad_0_,
+                left_bottom_grid_top_width_0_height_0_subtile_1__pin_inpad_0_,
+                left_bottom_grid_top_width_0_height_0_subtile_2__pin_inpad_0_,
+                left_bottom_grid_top_width_0_height_0_subtile_3__pin_inpad_0_,
+                left_bottom_grid_top_width_0_height_0_subtile_4__pin_inpad_0_,
+                left_bottom_grid_top_width_0_height_0_subtile_5__pin_inpad_0_,
+                left_bottom_grid_top_width_0_height_0_subtile_6__pin_inpad_0_,
+                left_bottom_grid_top_width_0_height_0_subtile_7__pin_inpad_0_,
+                ccff_head,
+                chany_top_out,
+                chanx_left_out,
+                ccff_tail);
+//----- GLOBAL PORTS -----
+input [0:0] prog_clk;
+//----- INPUT PORTS -----
+input [0:12] chany_top_in;
+//----- INPUT PORTS -----
+input [0:0] top_left_grid_right_width_0_height_0_subtile_0__pin_O_3_;
+//----- INPUT PORTS -----
+input [0:0] top_right_grid_left_width_0_height_0_subtile_0__pin_inpad_0_;
+//----- INPUT PORTS -----
+input [0:0] top_right_grid_left_width_0_height_0_subtile_1__pin_inpad_0_;
+//----- INPUT PORTS -----
+input [0:0] top_right_grid_left_width_0_height_0_subtile_2__pin_inpad_0_;
+//----- INPUT PORTS -----
+input [0:0] top_right_grid_left_width_0_height_0_subtile_3__pin_inpad_0_;
+//----- INPUT PORTS -----
+input [0:0] top_right_grid_left_width_0_height_0_subtile_4__pin_inpad_0_;
+//----- INPUT PORTS -----
+input [0:0] top_right_grid_left_width_0_height_0_subtile_5__pin_inpad_0_;
+//----- INPUT PORTS -----
+input [0:0] top_right_grid_left_width_0_height_0_subtile_6__pin_inpad_0_;
+//----- INPUT PORTS -----
+input [0:0] top_right_grid_left_width_0_height_0_subtile_7__pin_inpad_0_;
+//----- INPUT PORTS -----
+input [0:12] chanx_left_in;
+//----- INPUT PORTS -----
+input [0:0] left_top_grid_bottom_width_0_height_0_subtile_0__pin_O_0_;
+//----- INPUT PORTS -----
+input [0:0] left_bottom_grid_top_width_0_height_0_subtile_0__pin_inpad_0_;
+//----- INPUT PORTS -----
+input [0:0] left_bottom_grid_top_width_0_height_0_subtile_1__pin_inpad_0_;
+//----- INPUT PORTS -----
+input [0:0] left_bottom_grid_top_width_0_height_0_subtile_2__pin_inpad_0_;
+//----- INPUT PORTS -----
+input [0:0] left_bottom_grid_top_width_0_height_0_subtile_3__pin_inpad_0_;
+//----- INPUT PORTS -----
+input [0:0] left_bottom_grid_top_width_0_height_0_subtile_4__pin_inpad_0_;
+//----- INPUT PORTS -----
+input [0:0] left_bottom_grid_top_width_0_height_0_subtile_5__pin_inpad_0_;
+//----- INPUT PORTS -----
+input [0:0] left_bottom_grid_top_width_0_height_0_subtile_6__pin_inpad_0_;
+//----- INPUT PORTS -----
+input [0:0] left_bottom_grid_top_width_0_height_0_subtile_7__pin_inpad_0_;
+//----- INPUT PORTS -----
+input [0:0] ccff_head;
+//----- OUTPUT PORTS -----
+output [0:12] chany_top_out;
+//----- OUTPUT PORTS -----
+output [0:12] chanx_left_out;
+//----- OUTPUT PORTS -----
+output [0:0] ccff_tail;
+
+//----- BEGIN wire-connection ports -----
+//----- END wire-connection ports -----
+
+
+//----- BEGIN Registered ports -----
+//----- END Registered ports -----
+
+
+wire [0:1] mux_tree_tapbuf_size2_0_sram;
+wire [0:1] mux_tree_tapbuf_size2_0_sram_inv;
+wire [0:1] mux_tree_tapbuf_size2_1_sram;
+wire [0:1] mux_tree_tapbuf_size2_1_sram_inv;
+wire [0:1] mux_tree_tapbuf_size2_2_sram;
+wire [0:1] mux_tree_tapbuf_size2_2_sram_inv;
+wire [0:1] mux_tree_tapbuf_size2_3_sram;
+wire [0:1] mux_tree_tapbuf_size2_3_sram_inv;
+wire [0:1] mux_tree_tapbuf_size2_4_sram;
+wire [0:1] mux_tree_tapbuf_size2_4_sram_inv;
+wire [0:1] mux_tree_tapbuf_size2_5_sram;
+wire [0:1] mux_tree_tapbuf_size2_5_sram_inv;
+wire [0:1] mux_tree_tapbuf_size2_6_sram;
+wire [0:1] mux_tree_tapbuf_size2_6_sram_inv;
+wire [0:0] mux_tree_tapbuf_size2_mem_0_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size2_mem_1_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size2_mem_2_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size2_mem_3_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size2_mem_4_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size2_mem_5_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size2_mem_6_ccff_tail;
+wire [0:1] mux_tree_tapbuf_size3_0_sram;
+wire [0:1] mux_tree_tapbuf_size3_0_sram_inv;
+wire [0:1] mux_tree_tapbuf_size3_10_sram;
+wire [0:1] mux_tree_tapbuf_size3_10_sram_inv;
+wire [0:1] mux_tree_tapbuf_size3_11_sram;
+wire [0:1] mux_tree_tapbuf_size3_11_sram_inv;
+wire [0:1] mux_tree_tapbuf_size3_1_sram;
+wire [0:1] mux_tree_tapbuf_size3_1_sram_inv;
+wire [0:1] mux_tree_tapbuf_size3_2_sram;
+wire [0:1] mux_tree_tapbuf_size3_2_sram_inv;
+wire [0:1] mux_tree_tapbuf_size3_3_sram;
+wire [0:1] mux_tree_tapbuf_size3_3_sram_inv;
+wire [0:1] mux_tree_tapbuf_size3_4_sram;
+wire [0:1] mux_tree_tapbuf_size3_4_sram_inv;
+wire [0:1] mux_tree_tapbuf_size3_5_sram;
+wire [0:1] mux_tree_tapbuf_size3_5_sram_inv;
+wire [0:1] mux_tree_tapbuf_size3_6_sram;
+wire [0:1] mux_tree_tapbuf_size3_6_sram_inv;
+wire [0:1] mux_tree_tapbuf_size3_7_sram;
+wire [0:1] mux_tree_tapbuf_size3_7_sram_inv;
+wire [0:1] mux_tree_tapbuf_size3_8_sram;
+wire [0:1] mux_tree_tapbuf_size3_8_sram_inv;
+wire [0:1] mux_tree_tapbuf_size3_9_sram;
+wire [0:1] mux_tree_tapbuf_size3_9_sram_inv;
+wire [0:0] mux_tree_tapbuf_size3_mem_0_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size3_mem_10_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size3_mem_1_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size3_mem_2_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size3_mem_3_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size3_mem_4_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size3_mem_5_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size3_mem_6_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size3_mem_7_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size3_mem_8_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size3_mem_9_ccff_tail;
+wire [0:2] mux_tree_tapbuf_size4_0_sram;
+wire [0:2] mux_tree_tapbuf_size4_0_sram_inv;
+wire [0:2] mux_tree_tapbuf_size4_1_sram;
+wire [0:2] mux_tree_tapbuf_size4_1_sram_inv;
+wire [0:2] mux_tree_tapbuf_size4_2_sram;
+wire [0:2] mux_tree_tapbuf_size4_2_sram_inv;
+wire [0:2] mux_tree_tapbuf_size4_3_sram;
+wire [0:2] mux_tree_tapbuf_size4_3_sram_inv;
+wire [0:2] mux_tree_tapbuf_size4_4_sram;
+wire [0:2] mux_tree_tapbuf_size4_4_sram_inv;
+wire [0:2] mux_tree_tapbuf_size4_5_sram;
+wire [0:2] mux_tree_tapbuf_size4_5_sram_inv;
+wire [0:2] mux_tree_tapbuf_size4_6_sram;
+wire [0:2] mux_tree_tapbuf_size4_6_sram_inv;
+wire [0:0] mux_tree_tapbuf_size4_mem_0_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size4_mem_1_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size4_mem_2_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size4_mem_3_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size4_mem_4_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size4_mem_5_ccff_tail;
+wire [0:0] mux_tree_tapbuf_size4_mem_6_ccff_tail;
+
+// ----- BEGIN Local short connections -----
+// ----- END Local short connections -----
+// ----- BEGIN Local output short connections -----
+// ----- END Local output short connections -----
+
+	mux_tree_tapbuf_size4 mux_top_track_0 (
+		.in({top_left_grid_right_width_0_height_0_subtile_0__pin_O_3_, top_right_grid_left_width_0_height_0_subtile_0__pin_inpad_0_, top_right_grid_left_width_0_height_0_subtile_6__pin_inpad_0_, chanx_left_in[0]}),
+		.sram(mux_tree_tapbuf_size4_0_sram[0:2]),
+		.sram_inv(mux_tree_tapbuf_size4_0_sram_inv[0:2]),
+		.out(chany_top_out[0]));
+
+	mux_tree_tapbuf_size4 mux_top_track_2 (
+		.in({top_right_grid_left_width_0_height_0_subtile_0__pin_inpad_0_, top_right_grid_left_width_0_height_0_subtile_1__pin_inpad_0_, top_right_grid_left_width_0_height_0_subtile_7__pin_inpad_0_, chanx_left_in[12]}),
+		.sram(mux_tree_tapbuf_size4_1_sram[0:2]),
+		.sram_inv(mux_tree_tapbuf_size4_1_sram_inv[0:2]),
+		.out(chany_top_out[1]));
+
+	mux_tree_tapbuf_size4 mux_top_track_14 (
+		.in({top_right_grid_left_width_0_height_0_subtile_0__pin_inpad_0_, top_right_grid_left_width_0_height_0_subtile_6__pin_inpad_0_, top_right_grid_left_width_0_height_0_subtile_7__pin_inpad_0_, chanx_left_in[6]}),
+		.sram(mux_tree_tapbuf_size4_2_sram[0:2]),
+		.sram_inv(mux_tree_tapbuf_size4_2_sram_inv[0:2]),
+		.out(chany_top_out[7]));
+
+	mux_tree_tapbuf_size4 mux_left_track_1 (
+		.in({chany_top_in[0], left_top_grid_bottom_width_0_height_0_subtile_0__pin_O_0_, left_bottom_grid_top_width_0_height_0_subtile_0__pin_inpad_0_, left_bottom_grid_top_width_0_height_0_subtile_6__pin_inpad_0_}),
+		.sram(mux_tree_tapbuf_size4_3_sram[0:2]),
+		.sram_inv(mux_tree_tapbuf_size4_3_sram_inv[0:2]),
+		.out(chanx_left_out[0]));
+
+	mux_tree_tapbuf_size4 mux_left_track_3 (
+		.in({chany_top_in[12], left_bottom_grid_top_width_0_height_0_subtile_0__pin_inpad_0_, left_bottom_grid_top_width_0_height_0_subtile_1__pin_inpad_0_, left_bottom_grid_top_width_0_height_0_subtile_7__pin_inpad_0_}),
+		.sram(mux_tree_tapbuf_size4_4_sram[0:2]),
+		.sram_inv(mux_tree_tapbuf_size4_4_sram_inv[0:2]),
+		.out(chanx_left_out[1]));
+
+	mux_tree_tapbuf_size4 mux_left_track_13 (
+		.in({chany_top_in[7], left_top_grid_bottom_width_0_height_0_subtile_0__pin_O_0_, left_bottom_grid_top_width_0_height_0_subtile_5__pin_inpad_0_, left_bottom_grid_top_width_0_height_0_subtile_6__pin_inpad_0_}),
+		.sram(mux_tree_tapbuf_size4_5_sram[0:2]),
+		.sram_inv(mux_tree_tapbuf_size4_5_sram_inv[0:2]),
+		.out(chanx_left_out[6]));
+
+	mux_tree_tapbuf_size4 mux_left_track_15 (
+		.in({chany_top_in[6], left_bottom_grid_top_width_0_height_0_subtile_0__pin_inpad_0_, left_bottom_grid_top_width_0_height_0_subtile_6__pin_inpad_0_, left_bottom_grid_top_width_0_height_0_subtile_7__pin_inpad_0_}),
+		.sram(mux_tree_tapbuf_size4_6_sram[0:2]),
+		.sram_inv(mux_tree_tapbuf_size4_6_sram_inv[0:2]),
+		.out(chanx_left_out[7]));
+
+	mux_tree_tapbuf_size4_mem mem_top_track_0 (
+		.prog_clk(prog_clk),
+		.ccff_head(ccff_head),
+		.ccff_tail(mux_tree_tapbuf_size4_mem_0_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size4_0_sram[0:2]),
+		.mem_outb(mux_tree_tapbuf_size4_0_sram_inv[0:2]));
+
+	mux_tree_tapbuf_size4_mem mem_top_track_2 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size4_mem_0_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size4_mem_1_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size4_1_sram[0:2]),
+		.mem_outb(mux_tree_tapbuf_size4_1_sram_inv[0:2]));
+
+	mux_tree_tapbuf_size4_mem mem_top_track_14 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size3_mem_4_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size4_mem_2_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size4_2_sram[0:2]),
+		.mem_outb(mux_tree_tapbuf_size4_2_sram_inv[0:2]));
+
+	mux_tree_tapbuf_size4_mem mem_left_track_1 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size2_mem_3_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size4_mem_3_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size4_3_sram[0:2]),
+		.mem_outb(mux_tree_tapbuf_size4_3_sram_inv[0:2]));
+
+	mux_tree_tapbuf_size4_mem mem_left_track_3 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size4_mem_3_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size4_mem_4_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size4_4_sram[0:2]),
+		.mem_outb(mux_tree_tapbuf_size4_4_sram_inv[0:2]));
+
+	mux_tree_tapbuf_size4_mem mem_left_track_13 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size3_mem_9_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size4_mem_5_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size4_5_sram[0:2]),
+		.mem_outb(mux_tree_tapbuf_size4_5_sram_inv[0:2]));
+
+	mux_tree_tapbuf_size4_mem mem_left_track_15 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size4_mem_5_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size4_mem_6_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size4_6_sram[0:2]),
+		.mem_outb(mux_tree_tapbuf_size4_6_sram_inv[0:2]));
+
+	mux_tree_tapbuf_size3 mux_top_track_4 (
+		.in({top_right_grid_left_width_0_height_0_subtile_1__pin_inpad_0_, top_right_grid_left_width_0_height_0_subtile_2__pin_inpad_0_, chanx_left_in[11]}),
+		.sram(mux_tree_tapbuf_size3_0_sram[0:1]),
+		.sram_inv(mux_tree_tapbuf_size3_0_sram_inv[0:1]),
+		.out(chany_top_out[2]));
+
+	mux_tree_tapbuf_size3 mux_top_track_6 (
+		.in({top_right_grid_left_width_0_height_0_subtile_2__pin_inpad_0_, top_right_grid_left_width_0_height_0_subtile_3__pin_inpad_0_, chanx_left_in[10]}),
+		.sram(mux_tree_tapbuf_size3_1_sram[0:1]),
+		.sram_inv(mux_tree_tapbuf_size3_1_sram_inv[0:1]),
+		.out(chany_top_out[3]));
+
+	mux_tree_tapbuf_size3 mux_top_track_8 (
+		.in({top_right_grid_left_width_0_height_0_subtile_3__pin_inpad_0_, top_right_grid_left_width_0_height_0_subtile_4__pin_inpad_0_, chanx_left_in[9]}),
+		.sram(mux_tree_tapbuf_size3_2_sram[0:1]),
+		.sram_inv(mux_tree_tapbuf_size3_2_sram_inv[0:1]),
+		.out(chany_top_out[4]));
+
+	mux_tree_tapbuf_size3 mux_top_track_10 (
+		.in({top_right_grid_left_width_0_height_0_subtile_4__pin_inpad_0_, top_right_grid_left_width_0_height_0_subtile_5__pin_inpad_0_, chanx_left_in[8]}),
+		.sram(mux_tree_tapbuf_size3_3_sram[0:1]),
+		.sram_inv(mux_tree_tapbuf_size3_3_sram_inv[0:1]),
+		.out(chany_top_out[5]));
+
+	mux_tree_tapbuf_size3 mux_top_track_12 (
+		.in({top_right_grid_left_width_0_height_0_subtile_5__pin_inpad_0_, top_right_grid_left_width_0_height_0_subtile_6__pin_inpad_0_, chanx_left_in[7]}),
+		.sram(mux_tree_tapbuf_size3_4_sram[0:1]),
+		.sram_inv(mux_tree_tapbuf_size3_4_sram_inv[0:1]),
+		.out(chany_top_out[6]));
+
+	mux_tree_tapbuf_size3 mux_top_track_16 (
+		.in({top_right_grid_left_width_0_height_0_subtile_1__pin_inpad_0_, top_right_grid_left_width_0_height_0_subtile_7__pin_inpad_0_, chanx_left_in[5]}),
+		.sram(mux_tree_tapbuf_size3_5_sram[0:1]),
+		.sram_inv(mux_tree_tapbuf_size3_5_sram_inv[0:1]),
+		.out(chany_top_out[8]));
+
+	mux_tree_tapbuf_size3 mux_left_track_5 (
+		.in({chany_top_in[11], left_bottom_grid_top_width_0_height_0_subtile_1__pin_inpad_0_, left_bottom_grid_top_width_0_height_0_subtile_2__pin_inpad_0_}),
+		.sram(mux_tree_tapbuf_size3_6_sram[0:1]),
+		.sram_inv(mux_tree_tapbuf_size3_6_sram_inv[0:1]),
+		.out(chanx_left_out[2]));
+
+	mux_tree_tapbuf_size3 mux_left_track_7 (
+		.in({chany_top_in[10], left_bottom_grid_top_width_0_height_0_subtile_2__pin_inpad_0_, left_bottom_grid_top_width_0_height_0_subtile_3__pin_inpad_0_}),
+		.sram(mux_tree_tapbuf_size3_7_sram[0:1]),
+		.sram_inv(mux_tree_tapbuf_size3_7_sram_inv[0:1]),
+		.out(chanx_left_out[3]));
+
+	mux_tree_tapbuf_size3 mux_left_track_9 (
+		.in({chany_top_in[9], left_bottom_grid_top_width_0_height_0_subtile_3__pin_inpad_0_, left_bottom_grid_top_width_0_height_0_subtile_4__pin_inpad_0_}),
+		.sram(mux_tree_tapbuf_size3_8_sram[0:1]),
+		.sram_inv(mux_tree_tapbuf_size3_8_sram_inv[0:1]),
+		.out(chanx_left_out[4]));
+
+	mux_tree_tapbuf_size3 mux_left_track_11 (
+		.in({chany_top_in[8], left_bottom_grid_top_width_0_height_0_subtile_4__pin_inpad_0_, left_bottom_grid_top_width_0_height_0_subtile_5__pin_inpad_0_}),
+		.sram(mux_tree_tapbuf_size3_9_sram[0:1]),
+		.sram_inv(mux_tree_tapbuf_size3_9_sram_inv[0:1]),
+		.out(chanx_left_out[5]));
+
+	mux_tree_tapbuf_size3 mux_left_track_17 (
+		.in({chany_top_in[5], left_bottom_grid_top_width_0_height_0_subtile_1__pin_inpad_0_, left_bottom_grid_top_width_0_height_0_subtile_7__pin_inpad_0_}),
+		.sram(mux_tree_tapbuf_size3_10_sram[0:1]),
+		.sram_inv(mux_tree_tapbuf_size3_10_sram_inv[0:1]),
+		.out(chanx_left_out[8]));
+
+	mux_tree_tapbuf_size3 mux_left_track_25 (
+		.in({chany_top_in[1], left_top_grid_bottom_width_0_height_0_subtile_0__pin_O_0_, left_bottom_grid_top_width_0_height_0_subtile_5__pin_inpad_0_}),
+		.sram(mux_tree_tapbuf_size3_11_sram[0:1]),
+		.sram_inv(mux_tree_tapbuf_size3_11_sram_inv[0:1]),
+		.out(chanx_left_out[12]));
+
+	mux_tree_tapbuf_size3_mem mem_top_track_4 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size4_mem_1_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size3_mem_0_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size3_0_sram[0:1]),
+		.mem_outb(mux_tree_tapbuf_size3_0_sram_inv[0:1]));
+
+	mux_tree_tapbuf_size3_mem mem_top_track_6 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size3_mem_0_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size3_mem_1_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size3_1_sram[0:1]),
+		.mem_outb(mux_tree_tapbuf_size3_1_sram_inv[0:1]));
+
+	mux_tree_tapbuf_size3_mem mem_top_track_8 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size3_mem_1_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size3_mem_2_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size3_2_sram[0:1]),
+		.mem_outb(mux_tree_tapbuf_size3_2_sram_inv[0:1]));
+
+	mux_tree_tapbuf_size3_mem mem_top_track_10 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size3_mem_2_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size3_mem_3_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size3_3_sram[0:1]),
+		.mem_outb(mux_tree_tapbuf_size3_3_sram_inv[0:1]));
+
+	mux_tree_tapbuf_size3_mem mem_top_track_12 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size3_mem_3_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size3_mem_4_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size3_4_sram[0:1]),
+		.mem_outb(mux_tree_tapbuf_size3_4_sram_inv[0:1]));
+
+	mux_tree_tapbuf_size3_mem mem_top_track_16 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size4_mem_2_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size3_mem_5_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size3_5_sram[0:1]),
+		.mem_outb(mux_tree_tapbuf_size3_5_sram_inv[0:1]));
+
+	mux_tree_tapbuf_size3_mem mem_left_track_5 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size4_mem_4_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size3_mem_6_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size3_6_sram[0:1]),
+		.mem_outb(mux_tree_tapbuf_size3_6_sram_inv[0:1]));
+
+	mux_tree_tapbuf_size3_mem mem_left_track_7 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size3_mem_6_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size3_mem_7_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size3_7_sram[0:1]),
+		.mem_outb(mux_tree_tapbuf_size3_7_sram_inv[0:1]));
+
+	mux_tree_tapbuf_size3_mem mem_left_track_9 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size3_mem_7_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size3_mem_8_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size3_8_sram[0:1]),
+		.mem_outb(mux_tree_tapbuf_size3_8_sram_inv[0:1]));
+
+	mux_tree_tapbuf_size3_mem mem_left_track_11 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size3_mem_8_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size3_mem_9_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size3_9_sram[0:1]),
+		.mem_outb(mux_tree_tapbuf_size3_9_sram_inv[0:1]));
+
+	mux_tree_tapbuf_size3_mem mem_left_track_17 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size4_mem_6_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size3_mem_10_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size3_10_sram[0:1]),
+		.mem_outb(mux_tree_tapbuf_size3_10_sram_inv[0:1]));
+
+	mux_tree_tapbuf_size3_mem mem_left_track_25 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size2_mem_6_ccff_tail),
+		.ccff_tail(ccff_tail),
+		.mem_out(mux_tree_tapbuf_size3_11_sram[0:1]),
+		.mem_outb(mux_tree_tapbuf_size3_11_sram_inv[0:1]));
+
+	mux_tree_tapbuf_size2 mux_top_track_18 (
+		.in({top_right_grid_left_width_0_height_0_subtile_2__pin_inpad_0_, chanx_left_in[4]}),
+		.sram(mux_tree_tapbuf_size2_0_sram[0:1]),
+		.sram_inv(mux_tree_tapbuf_size2_0_sram_inv[0:1]),
+		.out(chany_top_out[9]));
+
+	mux_tree_tapbuf_size2 mux_top_track_20 (
+		.in({top_right_grid_left_width_0_height_0_subtile_3__pin_inpad_0_, chanx_left_in[3]}),
+		.sram(mux_tree_tapbuf_size2_1_sram[0:1]),
+		.sram_inv(mux_tree_tapbuf_size2_1_sram_inv[0:1]),
+		.out(chany_top_out[10]));
+
+	mux_tree_tapbuf_size2 mux_top_track_22 (
+		.in({top_right_grid_left_width_0_height_0_subtile_4__pin_inpad_0_, chanx_left_in[2]}),
+		.sram(mux_tree_tapbuf_size2_2_sram[0:1]),
+		.sram_inv(mux_tree_tapbuf_size2_2_sram_inv[0:1]),
+		.out(chany_top_out[11]));
+
+	mux_tree_tapbuf_size2 mux_top_track_24 (
+		.in({top_right_grid_left_width_0_height_0_subtile_5__pin_inpad_0_, chanx_left_in[1]}),
+		.sram(mux_tree_tapbuf_size2_3_sram[0:1]),
+		.sram_inv(mux_tree_tapbuf_size2_3_sram_inv[0:1]),
+		.out(chany_top_out[12]));
+
+	mux_tree_tapbuf_size2 mux_left_track_19 (
+		.in({chany_top_in[4], left_bottom_grid_top_width_0_height_0_subtile_2__pin_inpad_0_}),
+		.sram(mux_tree_tapbuf_size2_4_sram[0:1]),
+		.sram_inv(mux_tree_tapbuf_size2_4_sram_inv[0:1]),
+		.out(chanx_left_out[9]));
+
+	mux_tree_tapbuf_size2 mux_left_track_21 (
+		.in({chany_top_in[3], left_bottom_grid_top_width_0_height_0_subtile_3__pin_inpad_0_}),
+		.sram(mux_tree_tapbuf_size2_5_sram[0:1]),
+		.sram_inv(mux_tree_tapbuf_size2_5_sram_inv[0:1]),
+		.out(chanx_left_out[10]));
+
+	mux_tree_tapbuf_size2 mux_left_track_23 (
+		.in({chany_top_in[2], left_bottom_grid_top_width_0_height_0_subtile_4__pin_inpad_0_}),
+		.sram(mux_tree_tapbuf_size2_6_sram[0:1]),
+		.sram_inv(mux_tree_tapbuf_size2_6_sram_inv[0:1]),
+		.out(chanx_left_out[11]));
+
+	mux_tree_tapbuf_size2_mem mem_top_track_18 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size3_mem_5_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size2_mem_0_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size2_0_sram[0:1]),
+		.mem_outb(mux_tree_tapbuf_size2_0_sram_inv[0:1]));
+
+	mux_tree_tapbuf_size2_mem mem_top_track_20 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size2_mem_0_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size2_mem_1_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size2_1_sram[0:1]),
+		.mem_outb(mux_tree_tapbuf_size2_1_sram_inv[0:1]));
+
+	mux_tree_tapbuf_size2_mem mem_top_track_22 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size2_mem_1_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size2_mem_2_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size2_2_sram[0:1]),
+		.mem_outb(mux_tree_tapbuf_size2_2_sram_inv[0:1]));
+
+	mux_tree_tapbuf_size2_mem mem_top_track_24 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size2_mem_2_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size2_mem_3_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size2_3_sram[0:1]),
+		.mem_outb(mux_tree_tapbuf_size2_3_sram_inv[0:1]));
+
+	mux_tree_tapbuf_size2_mem mem_left_track_19 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size3_mem_10_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size2_mem_4_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size2_4_sram[0:1]),
+		.mem_outb(mux_tree_tapbuf_size2_4_sram_inv[0:1]));
+
+	mux_tree_tapbuf_size2_mem mem_left_track_21 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size2_mem_4_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size2_mem_5_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size2_5_sram[0:1]),
+		.mem_outb(mux_tree_tapbuf_size2_5_sram_inv[0:1]));
+
+	mux_tree_tapbuf_size2_mem mem_left_track_23 (
+		.prog_clk(prog_clk),
+		.ccff_head(mux_tree_tapbuf_size2_mem_5_ccff_tail),
+		.ccff_tail(mux_tree_tapbuf_size2_mem_6_ccff_tail),
+		.mem_out(mux_tree_tapbuf_size2_6_sram[0:1]),
+		.mem_outb(mux_tree_tapbuf_size2_6_sram_inv[0:1]));
+
+endmodule
+// ----- END Verilog module for sb_1__0_ -----
+
+//----- Default net type -----
+`default_nettype none
+
+
+